@@ -39,6 +39,14 @@ static constexpr int BUFFER_POOL_SIZE = 65536;                                //
 // static constexpr int BUFFER_POOL_SIZE = 262144;                                // size of buffer pool 1GB
 static constexpr int LOG_BUFFER_SIZE = (1024 * PAGE_SIZE);                    // size of a log buffer in byte
 static constexpr int BUCKET_SIZE = 50;                                        // size of extendible hash bucket
+static constexpr int SCAN_MORSEL_SIZE = 64;                                   // pages handed to a parallel scan worker at a time
+static constexpr int SCAN_MAX_WORKERS = 16;                                   // max number of workers of a parallel scan
+static constexpr int SCAN_PARALLEL_MIN_PAGES = 4 * SCAN_MORSEL_SIZE;          // tables with fewer pages are scanned serially
+static constexpr double IX_BULK_FILL_FACTOR = 0.9;                             // fill factor of B+ tree nodes built by bulk loading
+static constexpr size_t IX_SORT_BUFFER_SIZE = 64 * 1024 * 1024;              // memory used by the external sort of a bulk index build
+static constexpr size_t JOIN_BLOCK_SIZE = 4 * 1024 * 1024;                    // bytes of outer tuples buffered per block by the nested loop join
+static constexpr size_t HASH_JOIN_MEMORY_SIZE = 64 * 1024 * 1024;   // memory for the hash table of a hash join before it spills to disk
+static constexpr int HASH_JOIN_PARTITIONS = 32;                               // partitions a spilling hash join splits its inputs into
 
 using frame_id_t = int32_t;  // frame id type, 帧页ID, 页在BufferPool中的存储单元称为帧,一帧对应一页
 using page_id_t = int32_t;   // page id type , 页ID
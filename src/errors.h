@@ -132,6 +132,18 @@ class IndexExistsError : public RMDBError {
     }
 };
 
+class UniqueViolationError : public RMDBError {
+   public:
+    UniqueViolationError(const std::string &tab_name, const std::vector<std::string> &col_names) {
+        _msg += "Duplicate key in unique index: " + tab_name + ".(";
+        for(size_t i = 0; i < col_names.size(); ++i) {
+            if(i > 0) _msg += ", ";
+            _msg += col_names[i];
+        }
+        _msg += ")";
+    }
+};
+
 // QL errors
 class InvalidValueCountError : public RMDBError {
    public:
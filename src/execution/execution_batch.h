@@ -0,0 +1,74 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// 批量执行时一批记录的最大条数
+constexpr size_t BATCH_SIZE = 1024;
+
+/**
+ * 批量执行接口（AbstractExecutor::NextBatch）中算子之间传递的一批记录。
+ * 记录按行连续存放，每行长度为tuple_len；选择向量sel依次给出这一批中有效记录的行号，
+ * 过滤时只需要缩短选择向量，不需要移动记录
+ */
+class RecordBatch {
+   public:
+    using sel_t = uint16_t;
+    static_assert(BATCH_SIZE <= UINT16_MAX + 1, "selection vector index overflow");
+
+    // 清空这一批记录，之后的记录长度为tuple_len
+    void reset(size_t tuple_len) {
+        tuple_len_ = tuple_len;
+        num_rows_ = 0;
+        sel_.clear();
+        if (data_.size() < tuple_len * BATCH_SIZE) {
+            data_.resize(tuple_len * BATCH_SIZE);
+        }
+    }
+
+    size_t tuple_len() const { return tuple_len_; }
+
+    // 有效记录的条数
+    size_t size() const { return sel_.size(); }
+
+    bool empty() const { return sel_.empty(); }
+
+    // 还可以追加的行数
+    size_t room() const { return BATCH_SIZE - num_rows_; }
+
+    bool full() const { return num_rows_ == BATCH_SIZE; }
+
+    // 在末尾追加一行并选中，返回该行的起始地址，由调用者填写记录
+    char *append() {
+        sel_.push_back(num_rows_);
+        return data_.data() + tuple_len_ * num_rows_++;
+    }
+
+    // 第i条有效记录
+    char *get(size_t i) { return data_.data() + tuple_len_ * sel_[i]; }
+
+    const char *get(size_t i) const { return data_.data() + tuple_len_ * sel_[i]; }
+
+    std::vector<sel_t> &sel() { return sel_; }
+
+    const std::vector<sel_t> &sel() const { return sel_; }
+
+    // 第0行的起始地址，第i行位于 data() + i * tuple_len()
+    const char *data() const { return data_.data(); }
+
+   private:
+    size_t tuple_len_ = 0;
+    size_t num_rows_ = 0;       // data_中已经使用的行数，包括没有被选中的行
+    std::vector<char> data_;
+    std::vector<sel_t> sel_;
+};
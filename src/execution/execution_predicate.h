@@ -0,0 +1,174 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "common/common.h"
+#include "errors.h"
+#include "system/sm_meta.h"
+
+// 单个比较条件编译后的求值函数，lhs、rhs分别指向左右两侧的值，lhs_len、rhs_len为两侧的长度
+using PredFunc = bool (*)(const char *lhs, size_t lhs_len, const char *rhs, size_t rhs_len);
+
+template <CompOp op, typename L, typename R>
+inline bool apply_op(const L &lhs, const R &rhs) {
+    if constexpr (op == OP_EQ) {
+        return lhs == rhs;
+    } else if constexpr (op == OP_NE) {
+        return lhs != rhs;
+    } else if constexpr (op == OP_LT) {
+        return lhs < rhs;
+    } else if constexpr (op == OP_GT) {
+        return lhs > rhs;
+    } else if constexpr (op == OP_LE) {
+        return lhs <= rhs;
+    } else {
+        return lhs >= rhs;
+    }
+}
+
+// 数值列之间的比较，int与float比较时与AbstractExecutor::compare一样转换为float
+template <CompOp op, typename L, typename R>
+bool pred_num(const char *lhs, size_t, const char *rhs, size_t) {
+    L lhs_val;
+    R rhs_val;
+    memcpy(&lhs_val, lhs, sizeof(L));
+    memcpy(&rhs_val, rhs, sizeof(R));
+    return apply_op<op>(lhs_val, rhs_val);
+}
+
+// 比较两个定长字符串，较短的一侧视为在末尾补0，与init_raw的填充方式一致，长度不同的列之间比较时不会越界读取
+inline int compare_str(const char *lhs, size_t lhs_len, const char *rhs, size_t rhs_len) {
+    size_t len = std::min(lhs_len, rhs_len);
+    int res = memcmp(lhs, rhs, len);
+    if (res != 0 || lhs_len == rhs_len) {
+        return res;
+    }
+    // 较长一侧多出的部分全为0时两者相等，否则较长的一侧更大
+    const char *rest = lhs_len > rhs_len ? lhs + len : rhs + len;
+    size_t rest_len = std::max(lhs_len, rhs_len) - len;
+    for (size_t i = 0; i < rest_len; i++) {
+        if (rest[i] != 0) {
+            return lhs_len > rhs_len ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+template <CompOp op>
+bool pred_str(const char *lhs, size_t lhs_len, const char *rhs, size_t rhs_len) {
+    return apply_op<op>(compare_str(lhs, lhs_len, rhs, rhs_len), 0);
+}
+
+template <CompOp op>
+PredFunc get_pred_func(ColType lhs_type, ColType rhs_type) {
+    if (lhs_type == TYPE_INT && rhs_type == TYPE_INT) return pred_num<op, int, int>;
+    if (lhs_type == TYPE_INT && rhs_type == TYPE_FLOAT) return pred_num<op, int, float>;
+    if (lhs_type == TYPE_FLOAT && rhs_type == TYPE_INT) return pred_num<op, float, int>;
+    if (lhs_type == TYPE_FLOAT && rhs_type == TYPE_FLOAT) return pred_num<op, float, float>;
+    if (lhs_type == TYPE_STRING && rhs_type == TYPE_STRING) return pred_str<op>;
+    throw IncompatibleTypeError(coltype2str(lhs_type), coltype2str(rhs_type));
+}
+
+/**
+ * @description: 按比较运算符和左右两侧的类型选出特化的求值函数
+ * @return {PredFunc} 求值函数，逐条记录求值时不再需要按类型和运算符分支
+ * @param {ColType} lhs_type 左侧列的类型
+ * @param {ColType} rhs_type 右侧列或常量的类型
+ * @param {CompOp} op 比较运算符
+ */
+inline PredFunc get_pred_func(ColType lhs_type, ColType rhs_type, CompOp op) {
+    switch (op) {
+        case OP_EQ: return get_pred_func<OP_EQ>(lhs_type, rhs_type);
+        case OP_NE: return get_pred_func<OP_NE>(lhs_type, rhs_type);
+        case OP_LT: return get_pred_func<OP_LT>(lhs_type, rhs_type);
+        case OP_GT: return get_pred_func<OP_GT>(lhs_type, rhs_type);
+        case OP_LE: return get_pred_func<OP_LE>(lhs_type, rhs_type);
+        case OP_GE: return get_pred_func<OP_GE>(lhs_type, rhs_type);
+    }
+    throw InternalError("Unexpected comparison operator");
+}
+
+/**
+ * 编译后的WHERE条件。构造时把每个Condition解析成一条(左侧偏移, 右侧偏移或常量, 求值函数)指令，
+ * 对一条记录求值时只按顺序执行这些指令，不查找列、不构造Value，也不分配内存
+ */
+class CompiledPredicate {
+   public:
+    struct Step {
+        size_t lhs_offset;          // 左侧列在记录中的偏移
+        size_t len;                 // 左侧列的长度
+        size_t rhs_len;             // 右侧列或常量的长度
+        bool is_rhs_val;            // 右侧是否为常量
+        size_t rhs_offset;          // 右侧为列时在记录中的偏移
+        const char *rhs_val;        // 右侧为常量时指向常量的值
+        PredFunc func;
+    };
+
+    CompiledPredicate() = default;
+
+    CompiledPredicate(const std::vector<Condition> &conds, const std::vector<ColMeta> &cols) {
+        for (auto &cond : conds) {
+            auto &lhs_col = find_col(cols, cond.lhs_col);
+            Step step;
+            step.lhs_offset = lhs_col.offset;
+            step.len = lhs_col.len;
+            step.is_rhs_val = cond.is_rhs_val;
+            step.rhs_offset = 0;
+            step.rhs_val = nullptr;
+            ColType rhs_type;
+            if (cond.is_rhs_val) {
+                // 常量的raw由analyze按左侧列的长度生成，这里保留一份引用保证rhs_val一直有效
+                consts_.push_back(cond.rhs_val.raw);
+                step.rhs_val = cond.rhs_val.raw->data;
+                step.rhs_len = cond.rhs_val.raw->size;
+                rhs_type = cond.rhs_val.type;
+            } else {
+                auto &rhs_col = find_col(cols, cond.rhs_col);
+                step.rhs_offset = rhs_col.offset;
+                step.rhs_len = rhs_col.len;
+                rhs_type = rhs_col.type;
+            }
+            step.func = get_pred_func(lhs_col.type, rhs_type, cond.op);
+            steps_.push_back(step);
+        }
+    }
+
+    // 判断record是否满足所有条件
+    bool eval(const char *record) const {
+        for (auto &step : steps_) {
+            const char *rhs = step.is_rhs_val ? step.rhs_val : record + step.rhs_offset;
+            if (!step.func(record + step.lhs_offset, step.len, rhs, step.rhs_len)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool empty() const { return steps_.empty(); }
+
+   private:
+    static const ColMeta &find_col(const std::vector<ColMeta> &cols, const TabCol &target) {
+        for (auto &col : cols) {
+            if (col.tab_name == target.tab_name && col.name == target.col_name) {
+                return col;
+            }
+        }
+        throw ColumnNotFoundError(target.tab_name + '.' + target.col_name);
+    }
+
+    std::vector<Step> steps_;
+    std::vector<std::shared_ptr<RmRecord>> consts_;
+};
@@ -0,0 +1,221 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "execution_simd.h"
+
+#include <cstring>
+
+#include "execution_predicate.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define RMDB_SIMD_X86
+#include <immintrin.h>
+#endif
+
+bool simd_filter_supported(ColType col_type, size_t len, CompOp op, ColType val_type) {
+    if (col_type == TYPE_STRING || val_type == TYPE_STRING) {
+        return col_type == val_type && (op == OP_EQ || op == OP_NE);
+    }
+    return len == sizeof(int);
+}
+
+bool make_simd_filter(ColType col_type, size_t len, CompOp op, ColType val_type, const char *val,
+                      SimdFilter *filter) {
+    if (!simd_filter_supported(col_type, len, op, val_type)) {
+        return false;
+    }
+    filter->col_type = col_type;
+    filter->op = op;
+    filter->len = len;
+    filter->int_as_float = false;
+    filter->int_val = 0;
+    filter->float_val = 0;
+    filter->str_val = nullptr;
+    if (col_type == TYPE_STRING) {
+        filter->str_val = val;
+        return true;
+    }
+    if (col_type == TYPE_INT && val_type == TYPE_INT) {
+        memcpy(&filter->int_val, val, sizeof(int));
+    } else if (col_type == TYPE_INT) {
+        filter->int_as_float = true;
+        memcpy(&filter->float_val, val, sizeof(float));
+    } else if (val_type == TYPE_INT) {
+        // float列与int常量比较时常量转换为float
+        int int_val;
+        memcpy(&int_val, val, sizeof(int));
+        filter->float_val = int_val;
+    } else {
+        memcpy(&filter->float_val, val, sizeof(float));
+    }
+    return true;
+}
+
+namespace {
+
+template <CompOp op, typename T, typename V>
+size_t scalar_filter_num(const char *base, size_t stride, V val, int *sel, size_t n) {
+    size_t num_matched = 0;
+    for (size_t i = 0; i < n; i++) {
+        T col_val;
+        memcpy(&col_val, base + sel[i] * stride, sizeof(T));
+        if (apply_op<op>(col_val, val)) {
+            sel[num_matched++] = sel[i];
+        }
+    }
+    return num_matched;
+}
+
+template <typename T, typename V>
+size_t dispatch_scalar_filter(CompOp op, const char *base, size_t stride, V val, int *sel, size_t n) {
+    switch (op) {
+        case OP_EQ: return scalar_filter_num<OP_EQ, T>(base, stride, val, sel, n);
+        case OP_NE: return scalar_filter_num<OP_NE, T>(base, stride, val, sel, n);
+        case OP_LT: return scalar_filter_num<OP_LT, T>(base, stride, val, sel, n);
+        case OP_GT: return scalar_filter_num<OP_GT, T>(base, stride, val, sel, n);
+        case OP_LE: return scalar_filter_num<OP_LE, T>(base, stride, val, sel, n);
+        case OP_GE: return scalar_filter_num<OP_GE, T>(base, stride, val, sel, n);
+    }
+    return 0;
+}
+
+#ifdef RMDB_SIMD_X86
+
+// 把8个lane的比较结果按mask写回sel，lanes为这8个lane对应的下标
+inline size_t compact_sel(unsigned mask, const int *lanes, int *sel, size_t num_matched) {
+    while (mask != 0) {
+        sel[num_matched++] = lanes[__builtin_ctz(mask)];
+        mask &= mask - 1;
+    }
+    return num_matched;
+}
+
+__attribute__((target("avx2"))) inline unsigned cmp_mask_i32(CompOp op, __m256i vals, __m256i target) {
+    __m256i cmp;
+    bool negate = false;
+    switch (op) {
+        case OP_EQ: cmp = _mm256_cmpeq_epi32(vals, target); break;
+        case OP_NE: cmp = _mm256_cmpeq_epi32(vals, target); negate = true; break;
+        case OP_GT: cmp = _mm256_cmpgt_epi32(vals, target); break;
+        case OP_LE: cmp = _mm256_cmpgt_epi32(vals, target); negate = true; break;
+        case OP_LT: cmp = _mm256_cmpgt_epi32(target, vals); break;
+        default: cmp = _mm256_cmpgt_epi32(target, vals); negate = true; break;  // OP_GE
+    }
+    unsigned mask = _mm256_movemask_ps(_mm256_castsi256_ps(cmp));
+    return negate ? mask ^ 0xFF : mask;
+}
+
+// 与C++中float的比较运算一致：有NaN时只有!=成立
+__attribute__((target("avx2"))) inline unsigned cmp_mask_f32(CompOp op, __m256 vals, __m256 target) {
+    switch (op) {
+        case OP_EQ: return _mm256_movemask_ps(_mm256_cmp_ps(vals, target, _CMP_EQ_OQ));
+        case OP_NE: return _mm256_movemask_ps(_mm256_cmp_ps(vals, target, _CMP_NEQ_UQ));
+        case OP_LT: return _mm256_movemask_ps(_mm256_cmp_ps(vals, target, _CMP_LT_OQ));
+        case OP_GT: return _mm256_movemask_ps(_mm256_cmp_ps(vals, target, _CMP_GT_OQ));
+        case OP_LE: return _mm256_movemask_ps(_mm256_cmp_ps(vals, target, _CMP_LE_OQ));
+        default: return _mm256_movemask_ps(_mm256_cmp_ps(vals, target, _CMP_GE_OQ));
+    }
+}
+
+// int/float列：每次用gather取出8个候选值，比较后按掩码压缩sel，剩下不足8个的候选值逐个比较
+__attribute__((target("avx2"))) size_t avx2_filter_num(const SimdFilter &filter, const char *base, size_t stride,
+                                                       int *sel, size_t n) {
+    const __m256i vstride = _mm256_set1_epi32(static_cast<int>(stride));
+    const __m256i int_target = _mm256_set1_epi32(filter.int_val);
+    const __m256 float_target = _mm256_set1_ps(filter.float_val);
+    alignas(32) int lanes[8];
+    size_t num_matched = 0;
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(sel + i));
+        _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), idx);
+        __m256i vals = _mm256_i32gather_epi32(reinterpret_cast<const int *>(base), _mm256_mullo_epi32(idx, vstride), 1);
+        unsigned mask;
+        if (filter.col_type == TYPE_INT && !filter.int_as_float) {
+            mask = cmp_mask_i32(filter.op, vals, int_target);
+        } else if (filter.int_as_float) {
+            mask = cmp_mask_f32(filter.op, _mm256_cvtepi32_ps(vals), float_target);
+        } else {
+            mask = cmp_mask_f32(filter.op, _mm256_castsi256_ps(vals), float_target);
+        }
+        num_matched = compact_sel(mask, lanes, sel, num_matched);
+    }
+    // 剩余的候选值先移到已匹配部分之后，再用逐个比较的实现过滤
+    size_t rest = n - i;
+    memmove(sel + num_matched, sel + i, rest * sizeof(int));
+    return num_matched + scalar_filter(filter, base, stride, sel + num_matched, rest);
+}
+
+// 定长字符串：每32字节用一条向量比较，不足32字节的部分用memcmp
+__attribute__((target("avx2"))) size_t avx2_filter_str(const SimdFilter &filter, const char *base, size_t stride,
+                                                       int *sel, size_t n) {
+    size_t len = filter.len;
+    size_t num_matched = 0;
+    for (size_t i = 0; i < n; i++) {
+        const char *val = base + sel[i] * stride;
+        bool equal = true;
+        size_t k = 0;
+        for (; k + 32 <= len && equal; k += 32) {
+            __m256i lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(val + k));
+            __m256i rhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(filter.str_val + k));
+            equal = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs))) == 0xFFFFFFFFu;
+        }
+        if (equal && k < len) {
+            equal = memcmp(val + k, filter.str_val + k, len - k) == 0;
+        }
+        if (equal == (filter.op == OP_EQ)) {
+            sel[num_matched++] = sel[i];
+        }
+    }
+    return num_matched;
+}
+
+#endif
+
+}  // namespace
+
+size_t scalar_filter(const SimdFilter &filter, const char *base, size_t stride, int *sel, size_t n) {
+    if (filter.col_type == TYPE_STRING) {
+        size_t num_matched = 0;
+        for (size_t i = 0; i < n; i++) {
+            bool equal = memcmp(base + sel[i] * stride, filter.str_val, filter.len) == 0;
+            if (equal == (filter.op == OP_EQ)) {
+                sel[num_matched++] = sel[i];
+            }
+        }
+        return num_matched;
+    }
+    if (filter.col_type == TYPE_INT && !filter.int_as_float) {
+        return dispatch_scalar_filter<int>(filter.op, base, stride, filter.int_val, sel, n);
+    }
+    if (filter.int_as_float) {
+        return dispatch_scalar_filter<int>(filter.op, base, stride, filter.float_val, sel, n);
+    }
+    return dispatch_scalar_filter<float>(filter.op, base, stride, filter.float_val, sel, n);
+}
+
+bool cpu_supports_avx2() {
+#ifdef RMDB_SIMD_X86
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+size_t simd_filter(const SimdFilter &filter, const char *base, size_t stride, int *sel, size_t n) {
+#ifdef RMDB_SIMD_X86
+    if (cpu_supports_avx2()) {
+        return filter.col_type == TYPE_STRING ? avx2_filter_str(filter, base, stride, sel, n)
+                                              : avx2_filter_num(filter, base, stride, sel, n);
+    }
+#endif
+    return scalar_filter(filter, base, stride, sel, n);
+}
@@ -0,0 +1,65 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "common/common.h"
+
+/**
+ * 批量过滤内核：把“列 op 常量”形式的比较一次作用在一组等间隔存放的列值上。
+ * 第i个候选值位于 base + sel[i] * stride，过滤后sel中只保留满足条件的下标，顺序不变。
+ * 支持int/float的六种比较运算符，以及定长字符串的等值、不等比较；
+ * CPU支持AVX2时使用向量化实现，否则使用逐个比较的实现，两者结果完全相同
+ */
+struct SimdFilter {
+    ColType col_type;       // 列的类型
+    CompOp op;
+    size_t len;             // 列的长度
+    bool int_as_float;      // int列与float常量比较，列值先转换为float，与AbstractExecutor::compare一致
+    int int_val;            // col_type为TYPE_INT且int_as_float为false时的常量
+    float float_val;        // 与float比较时的常量
+    const char *str_val;    // col_type为TYPE_STRING时的常量，长度为len，由调用者保证有效
+};
+
+// “列 op 常量”能否用过滤内核求值：int/float之间的比较，以及同长度字符串的OP_EQ和OP_NE
+bool simd_filter_supported(ColType col_type, size_t len, CompOp op, ColType val_type);
+
+/**
+ * @description: 为“列 op 常量”构造过滤内核的参数
+ * @return {bool} 该比较能否用过滤内核求值，同simd_filter_supported
+ * @param {ColType} col_type 列的类型
+ * @param {size_t} len 列的长度
+ * @param {CompOp} op 比较运算符，列在左侧
+ * @param {ColType} val_type 常量的类型
+ * @param {char*} val 常量的值，字符串常量的长度与列相同
+ * @param {SimdFilter*} filter 构造出的参数
+ */
+bool make_simd_filter(ColType col_type, size_t len, CompOp op, ColType val_type, const char *val,
+                      SimdFilter *filter);
+
+/**
+ * @description: 用过滤内核过滤sel中的下标，根据CPU是否支持AVX2选择实现
+ * @return {size_t} 过滤后sel中剩下的下标个数
+ * @param {SimdFilter&} filter make_simd_filter构造的参数
+ * @param {char*} base 下标为0的值的地址
+ * @param {size_t} stride 相邻两个值之间的距离，sel中的下标乘以stride不能超过INT32_MAX
+ * @param {int*} sel 候选值的下标，过滤结果原地写回
+ * @param {size_t} n 候选值的个数
+ */
+size_t simd_filter(const SimdFilter &filter, const char *base, size_t stride, int *sel, size_t n);
+
+// 逐个比较的实现，CPU不支持AVX2时使用
+size_t scalar_filter(const SimdFilter &filter, const char *base, size_t stride, int *sel, size_t n);
+
+// 当前CPU是否支持AVX2，只检测一次
+bool cpu_supports_avx2();
@@ -21,28 +21,40 @@ class SortExecutor : public AbstractExecutor {
     ColMeta cols_;                              // 框架中只支持一个键排序，需要自行修改数据结构支持多个键排序
     size_t tuple_num;
     bool is_desc_;
-    std::vector<size_t> used_tuple;
-    std::unique_ptr<RmRecord> current_tuple;
+    std::vector<std::unique_ptr<RmRecord>> tuples_;  // 子算子的全部记录，beginTuple时读取并排序
 
    public:
     SortExecutor(std::unique_ptr<AbstractExecutor> prev, TabCol sel_cols, bool is_desc) {
         prev_ = std::move(prev);
-        cols_ = prev_->get_col_offset(sel_cols);
+        cols_ = *get_col(prev_->cols(), sel_cols);
         is_desc_ = is_desc;
         tuple_num = 0;
-        used_tuple.clear();
     }
 
-    void beginTuple() override { 
-        
-    }
+    size_t tupleLen() const override { return prev_->tupleLen(); }
+
+    const std::vector<ColMeta> &cols() const override { return prev_->cols(); }
 
-    void nextTuple() override {
-        
+    void beginTuple() override {
+        tuples_.clear();
+        for (prev_->beginTuple(); !prev_->is_end(); prev_->nextTuple()) {
+            tuples_.push_back(prev_->Next());
+        }
+        std::stable_sort(tuples_.begin(), tuples_.end(),
+                         [&](const std::unique_ptr<RmRecord> &a, const std::unique_ptr<RmRecord> &b) {
+                             int cmp = compare(a->data + cols_.offset, b->data + cols_.offset, cols_.type, cols_.type,
+                                               cols_.len);
+                             return is_desc_ ? cmp > 0 : cmp < 0;
+                         });
+        tuple_num = 0;
     }
 
+    void nextTuple() override { tuple_num++; }
+
+    bool is_end() const override { return tuple_num >= tuples_.size(); }
+
     std::unique_ptr<RmRecord> Next() override {
-        return nullptr;
+        return std::make_unique<RmRecord>(*tuples_[tuple_num]);
     }
 
     Rid &rid() override { return _abstract_rid; }
@@ -0,0 +1,94 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "execution_spill.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+SpillFile::SpillFile(DiskManager *disk_manager, std::string path, size_t tuple_len)
+    : disk_manager_(disk_manager), path_(std::move(path)), tuple_len_(tuple_len) {
+    if (disk_manager_->is_file(path_)) {
+        disk_manager_->destroy_file(path_);
+    }
+    disk_manager_->create_file(path_);
+    fd_ = disk_manager_->open_file(path_);
+    page_.resize(PAGE_SIZE);
+}
+
+SpillFile::~SpillFile() {
+    disk_manager_->close_file(fd_);
+    disk_manager_->destroy_file(path_);
+}
+
+/**
+ * @description: 在文件末尾追加一条记录，只能在rewind()之前调用
+ */
+void SpillFile::append(const char *tuple) {
+    assert(writing_);
+    write_bytes(tuple, tuple_len_);
+    num_tuples_++;
+}
+
+/**
+ * @description: 结束写入，写出最后一个页面，之后从第一条记录开始读出
+ */
+void SpillFile::rewind() {
+    if (writing_ && page_pos_ > 0) {
+        disk_manager_->write_page(fd_, page_no_, page_.data(), PAGE_SIZE);
+    }
+    writing_ = false;
+    num_read_ = 0;
+    page_no_ = 0;
+    page_pos_ = PAGE_SIZE;  // 读第一条记录时再读入第0个页面
+}
+
+/**
+ * @description: 读出下一条记录
+ * @return {bool} 所有记录都已经读出时返回false
+ */
+bool SpillFile::read(char *tuple) {
+    assert(!writing_);
+    if (num_read_ == num_tuples_) {
+        return false;
+    }
+    read_bytes(tuple, tuple_len_);
+    num_read_++;
+    return true;
+}
+
+void SpillFile::write_bytes(const char *data, size_t len) {
+    while (len > 0) {
+        size_t cnt = std::min(len, PAGE_SIZE - page_pos_);
+        memcpy(page_.data() + page_pos_, data, cnt);
+        page_pos_ += cnt;
+        data += cnt;
+        len -= cnt;
+        if (page_pos_ == PAGE_SIZE) {
+            disk_manager_->write_page(fd_, page_no_++, page_.data(), PAGE_SIZE);
+            page_pos_ = 0;
+        }
+    }
+}
+
+void SpillFile::read_bytes(char *data, size_t len) {
+    while (len > 0) {
+        if (page_pos_ == PAGE_SIZE) {
+            disk_manager_->read_page(fd_, page_no_++, page_.data(), PAGE_SIZE);
+            page_pos_ = 0;
+        }
+        size_t cnt = std::min(len, PAGE_SIZE - page_pos_);
+        memcpy(data, page_.data() + page_pos_, cnt);
+        page_pos_ += cnt;
+        data += cnt;
+        len -= cnt;
+    }
+}
@@ -0,0 +1,55 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "storage/disk_manager.h"
+
+/**
+ * 算子溢出到磁盘的临时文件，保存定长的记录。
+ * 记录先按顺序追加写入，写完后调用rewind()从头顺序读出，记录可以跨越页面。
+ * 页面通过DiskManager读写，文件在析构时删除
+ */
+class SpillFile {
+    DiskManager *disk_manager_;
+    std::string path_;
+    int fd_;
+    size_t tuple_len_;
+    size_t num_tuples_ = 0;     // 文件中的记录条数
+    size_t num_read_ = 0;       // 已经读出的记录条数
+    std::vector<char> page_;    // 当前正在写入或读出的页面
+    size_t page_pos_ = 0;       // 下一个字节在page_中的位置
+    page_id_t page_no_ = 0;     // page_对应的页号
+    bool writing_ = true;
+
+   public:
+    SpillFile(DiskManager *disk_manager, std::string path, size_t tuple_len);
+
+    ~SpillFile();
+
+    void append(const char *tuple);
+
+    void rewind();
+
+    bool read(char *tuple);
+
+    size_t size() const { return num_tuples_; }
+
+    // 文件中记录的总字节数
+    size_t bytes() const { return num_tuples_ * tuple_len_; }
+
+   private:
+    void write_bytes(const char *data, size_t len);
+
+    void read_bytes(char *data, size_t len);
+};
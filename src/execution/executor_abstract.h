@@ -10,7 +10,9 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include "execution_batch.h"
 #include "execution_defs.h"
+#include "execution_predicate.h"
 #include "common/common.h"
 #include "index/ix.h"
 #include "system/sm.h"
@@ -45,6 +47,22 @@ class AbstractExecutor {
 
     virtual std::unique_ptr<RmRecord> Next() = 0;
 
+    /**
+     * @description: 批量接口，beginTuple()之后反复调用，每次取出最多BATCH_SIZE条记录
+     * 默认实现用逐条接口适配，没有实现批量接口的算子也可以作为批量算子的儿子节点
+     * @return {bool} 取出了记录时返回true，batch不为空；没有剩余的记录时返回false
+     * @param {RecordBatch*} batch 输出的一批记录
+     */
+    virtual bool NextBatch(RecordBatch *batch) {
+        size_t len = tupleLen();
+        batch->reset(len);
+        for (; !batch->full() && !is_end(); nextTuple()) {
+            auto rec = Next();
+            memcpy(batch->append(), rec->data, len);
+        }
+        return !batch->empty();
+    }
+
     virtual ColMeta get_col_offset(const TabCol &target) { return ColMeta();};
 
     std::vector<ColMeta>::const_iterator get_col(const std::vector<ColMeta> &rec_cols, const TabCol &target) {
@@ -153,62 +171,119 @@ class AbstractExecutor {
             break;
         }
     }
-    /*判断满不满足单个表的where条件*/
-    bool do_pridict(const std::unique_ptr<RmRecord> &record, std::vector<Condition> conds_,
-                    std::vector<ColMeta> cols)
-    {
-        if (conds_.size() == 0)
-        {
-            return true;
+
+};
+
+/**
+ * 连接算子的公共部分：左儿子节点、拼接后的记录的字段和一条外表记录的连接结果。
+ * 子类在advance()中产生连接结果并用append_joined()写入joined_rows_，逐条接口和批量接口都从joined_rows_中输出
+ */
+class JoinExecutor : public AbstractExecutor {
+   protected:
+    std::unique_ptr<AbstractExecutor> left_;    // 左儿子节点（外表）
+    size_t len_;                                // join后获得的每条记录的长度
+    std::vector<ColMeta> cols_;                 // join后获得的记录的字段，右表的字段在左表的字段之后
+    std::vector<Condition> fed_conds_;          // join条件
+
+    // 外表的一条记录（或一个块）的连接结果，输出完之后再调用advance()
+    std::vector<char> joined_rows_;
+    size_t num_joined_ = 0;
+    size_t position = 0;
+
+    // 继续连接直到joined_rows_中有新的结果或者输入读完，调用前num_joined_和position已经清零
+    virtual void advance() = 0;
+
+    void init_join(std::unique_ptr<AbstractExecutor> left, std::vector<ColMeta> right_cols, size_t right_len,
+                   std::vector<Condition> conds) {
+        left_ = std::move(left);
+        len_ = left_->tupleLen() + right_len;
+        cols_ = left_->cols();
+        for (auto &col : right_cols) {
+            col.offset += left_->tupleLen();
         }
-        char *record_data = record->data;
-        ColType right_type;
-        ColType left_type;
-        for (auto cond : conds_)
-        {
-            auto clo_meta = get_col(cols, cond.lhs_col);
+        cols_.insert(cols_.end(), right_cols.begin(), right_cols.end());
+        fed_conds_ = std::move(conds);
+    }
 
-            char *left_data = (record_data + clo_meta->offset);
-            left_type = clo_meta->type;
+    // 丢弃已经输出的连接结果，产生下一批结果
+    void refill() {
+        num_joined_ = 0;
+        position = 0;
+        advance();
+    }
 
-            char *right_data;
-            if (cond.is_rhs_val)
-            {
-                right_data = cond.rhs_val.raw->data;
-                right_type = cond.rhs_val.type;
-            }
-            else
-            {
-                auto right_colMeta = get_col(cols, cond.rhs_col);
-                right_data = (record_data + right_colMeta->offset);
-                right_type = right_colMeta->type;
-            }
-            int result = compare(left_data, right_data, left_type, right_type, clo_meta->len);
-            switch (cond.op)
-            {
-            case CompOp::OP_EQ:
-                result = (result == 0);
-                break;
-            case CompOp::OP_GE:
-                result = (result >= 0);
-                break;
-            case CompOp::OP_GT:
-                result = (result > 0);
-                break;
-            case CompOp::OP_LE:
-                result = (result <= 0);
-                break;
-            case CompOp::OP_LT:
-                result = (result < 0);
-                break;
-            case CompOp::OP_NE:
-                result = (result != 0);
-                break;
-            }
-            if (result == 0)
-                return false;
+    // 拼接左表记录和右表记录，满足pred时作为一条连接结果
+    void append_joined(const char *left_row, const char *right_row, size_t right_len, const CompiledPredicate &pred) {
+        size_t left_len = len_ - right_len;
+        joined_rows_.resize((num_joined_ + 1) * len_);
+        char *record = joined_rows_.data() + num_joined_ * len_;
+        memcpy(record, left_row, left_len);
+        memcpy(record + left_len, right_row, right_len);
+        if (pred.eval(record)) {
+            num_joined_++;
+        }
+    }
+
+    /**
+     * @description: 判断条件是否比较左表的一列和右表的一列，并且两列的长度相同
+     * @return {bool} 是时返回true，left_col和right_col为两列的元数据，right_col的offset为在右表记录中的偏移
+     * @param {Condition} &cond 一个join条件
+     * @param {ColMeta} *left_col 左表的列
+     * @param {ColMeta} *right_col 右表的列
+     * @param {bool} *lhs_left 条件的左侧是否为左表的列
+     */
+    bool split_join_cond(const Condition &cond, ColMeta *left_col, ColMeta *right_col, bool *lhs_left) {
+        if (cond.is_rhs_val) {
+            return false;
         }
+        int left_len = left_->tupleLen();
+        auto lhs_col = get_col(cols_, cond.lhs_col);
+        auto rhs_col = get_col(cols_, cond.rhs_col);
+        *lhs_left = lhs_col->offset < left_len;
+        if (*lhs_left == (rhs_col->offset < left_len) || lhs_col->len != rhs_col->len) {
+            return false;
+        }
+        *left_col = *lhs_left ? *lhs_col : *rhs_col;
+        *right_col = *lhs_left ? *rhs_col : *lhs_col;
+        right_col->offset -= left_len;
         return true;
     }
 
-};
\ No newline at end of file
+    // 左表的一列与右表中类型和长度都相同的一列的等值条件，可以作为hash join、merge join和index join的key
+    bool split_equi_cond(const Condition &cond, ColMeta *left_col, ColMeta *right_col) {
+        bool lhs_left;
+        return cond.op == OP_EQ && split_join_cond(cond, left_col, right_col, &lhs_left) &&
+               left_col->type == right_col->type;
+    }
+
+   public:
+    void nextTuple() override {
+        position++;
+        if (position == num_joined_) {
+            refill();
+        }
+    }
+
+    std::unique_ptr<RmRecord> Next() override {
+        return std::make_unique<RmRecord>(len_, joined_rows_.data() + position * len_);
+    }
+
+    bool NextBatch(RecordBatch *batch) override {
+        batch->reset(len_);
+        while (position < num_joined_ && !batch->full()) {
+            memcpy(batch->append(), joined_rows_.data() + position * len_, len_);
+            if (++position == num_joined_) {
+                refill();
+            }
+        }
+        return !batch->empty();
+    }
+
+    Rid &rid() override { return _abstract_rid; }
+
+    bool is_end() const override { return position == num_joined_; }
+
+    size_t tupleLen() const override { return len_; }
+
+    const std::vector<ColMeta> &cols() const override { return cols_; }
+};
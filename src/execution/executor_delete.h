@@ -40,11 +40,22 @@ class DeleteExecutor : public AbstractExecutor {
     */
 
     std::unique_ptr<RmRecord> Next() override {
-        // 这里先只删除记录
+        // 持有表的写latch期间索引不会被建立、重建或删除，构造执行器之后索引可能已经发生了变化
+        std::shared_lock tab_latch{sm_manager_->get_table_latch(tab_name_)};
+        tab_.indexes = sm_manager_->db_.get_table(tab_name_).indexes;
+        Transaction *txn = context_ == nullptr ? nullptr : context_->txn_;
         for (auto rid : rids_) {
+            // 先删除索引中的key，删除之后就读不到原记录了
+            if (!tab_.indexes.empty()) {
+                auto rec = fh_->get_record(rid, context_);
+                for (auto &index : tab_.indexes) {
+                    std::vector<char> key(index.col_tot_len);
+                    index.get_key(rec->data, key.data());
+                    sm_manager_->delete_index_entry(tab_name_, index, key.data(), rid, txn);
+                }
+            }
             fh_->delete_record(rid, context_);
         }
-        /* 这里还需要删除对应的索引文件,后面需要添加 */
         return nullptr;
     }
 
@@ -0,0 +1,389 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "execution_defs.h"
+#include "execution_manager.h"
+#include "execution_spill.h"
+#include "executor_abstract.h"
+#include "index/ix.h"
+#include "system/sm.h"
+
+/**
+ * 等值连接的hash join：用右表（内表）的全部记录建立开放寻址的哈希表，再逐条读取左表（外表）的记录探测哈希表。
+ * 同一个key的记录按插入顺序排在探测序列上，因此输出顺序与NestedLoopJoinExecutor相同。
+ * 左右两侧类型和长度都相同的等值条件组成哈希表的key，其余条件在拼接后的记录上判断。
+ * 哈希表超过内存预算时按哈希值的高位把两侧输入分成HASH_JOIN_PARTITIONS个分区（hybrid hash join）：
+ * 尽量多的分区留在内存中直接探测，其余分区的记录写入临时文件，左表读完后再逐个分区连接。
+ * 一个分区仍然放不下时用哈希值的下一段高位继续划分，溢出的分区的输出顺序与NestedLoopJoinExecutor不同
+ */
+class HashJoinExecutor : public JoinExecutor {
+   private:
+    std::unique_ptr<AbstractExecutor> right_;   // 右儿子节点，建立哈希表；左儿子节点探测哈希表
+
+    // key中的一列，left_offset和right_offset分别是该列在左表记录和右表记录中的偏移
+    struct KeyCol {
+        size_t left_offset;
+        size_t right_offset;
+        size_t len;
+        ColType type;
+    };
+    std::vector<KeyCol> key_cols_;
+    CompiledPredicate residual_pred_;           // 不属于key的join条件
+
+    // 哈希表的槽，row为右表记录在build_rows_中的行号，EMPTY_ROW表示空槽；hash保存哈希值的低32位，用于快速排除
+    struct Slot {
+        uint32_t hash;
+        uint32_t row;
+    };
+    static constexpr uint32_t EMPTY_ROW = UINT32_MAX;
+    std::vector<Slot> slots_;                   // 线性探测，大小为2的幂
+    std::vector<char> build_rows_;              // 留在内存中的右表记录，按行连续存放
+    size_t num_build_;
+
+    // 溢出到磁盘的一个分区，level为划分这个分区所用的层数
+    struct Partition {
+        std::unique_ptr<SpillFile> build;
+        std::unique_ptr<SpillFile> probe;
+        int level;
+    };
+    static constexpr int MAX_SPILL_LEVEL = 5;   // 超过这个层数的分区不再划分，整个分区装入内存
+    DiskManager *disk_manager_;
+    size_t mem_limit_;                          // 哈希表的内存预算
+    std::string file_prefix_;                   // 临时文件名的前缀
+    size_t num_files_;
+    int level_;                                 // 当前哈希表的层数
+    bool partitioned_;                          // 当前哈希表是否已经超过预算而划分了分区
+    std::vector<bool> spilled_;                 // 每个分区是否已经写入临时文件
+    std::vector<size_t> part_rows_;             // 每个分区留在内存中的记录条数
+    std::vector<std::unique_ptr<SpillFile>> build_files_;
+    std::vector<std::unique_ptr<SpillFile>> probe_files_;
+    std::vector<Partition> pending_;            // 等待连接的分区
+    std::unique_ptr<SpillFile> probe_source_;   // 正在探测的分区的左表记录，为空时从left_读取
+    std::vector<char> probe_row_;
+
+    RecordBatch left_batch_;                    // 左表当前的一批记录
+    size_t left_pos_;                           // left_batch_中下一条要探测的记录
+    bool left_done_;
+
+    // 左右两侧类型和长度相同的等值条件作为key，其余条件留给residual_pred_
+    void init_key_cols() {
+        std::vector<Condition> residual;
+        for (auto &cond : fed_conds_) {
+            ColMeta left_col, right_col;
+            if (!split_equi_cond(cond, &left_col, &right_col)) {
+                residual.push_back(cond);
+                continue;
+            }
+            key_cols_.push_back({(size_t)left_col.offset, (size_t)right_col.offset, (size_t)left_col.len,
+                                 left_col.type});
+        }
+        if (key_cols_.empty()) {
+            throw InternalError("Hash join requires an equi-join condition");
+        }
+        residual_pred_ = CompiledPredicate(residual, cols_);
+    }
+
+    static uint64_t mix(uint64_t h) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    // 计算记录中key的哈希值，left表示record来自左表还是右表。float的+0.0和-0.0相等，因此按相同的值计算
+    uint64_t hash_key(const char *record, bool left) const {
+        uint64_t h = 0;
+        for (auto &col : key_cols_) {
+            const char *data = record + (left ? col.left_offset : col.right_offset);
+            if (col.type == TYPE_FLOAT) {
+                float val;
+                memcpy(&val, data, sizeof(float));
+                uint32_t bits = 0;
+                if (val != 0) {
+                    memcpy(&bits, &val, sizeof(float));
+                }
+                h = mix(h ^ bits);
+                continue;
+            }
+            size_t i = 0;
+            for (; i + 8 <= col.len; i += 8) {
+                uint64_t word;
+                memcpy(&word, data + i, 8);
+                h = mix(h ^ word);
+            }
+            uint64_t tail = 0;
+            memcpy(&tail, data + i, col.len - i);
+            h = mix(h ^ tail ^ (col.len << 56));
+        }
+        return h;
+    }
+
+    // 左表记录与右表记录的key是否相等，float按值比较
+    bool key_equal(const char *left_row, const char *right_row) const {
+        for (auto &col : key_cols_) {
+            const char *lhs = left_row + col.left_offset, *rhs = right_row + col.right_offset;
+            if (col.type == TYPE_FLOAT) {
+                float lhs_val, rhs_val;
+                memcpy(&lhs_val, lhs, sizeof(float));
+                memcpy(&rhs_val, rhs, sizeof(float));
+                if (lhs_val != rhs_val) return false;
+            } else if (memcmp(lhs, rhs, col.len) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 第level层用哈希值的第(64 - 5 * (level + 1))位开始的5位划分分区，哈希表本身只用低位
+    int partition_of(uint64_t h) const {
+        return (h >> (64 - 5 * (level_ + 1))) & (HASH_JOIN_PARTITIONS - 1);
+    }
+
+    std::unique_ptr<SpillFile> new_spill_file(size_t tuple_len) {
+        return std::make_unique<SpillFile>(disk_manager_, file_prefix_ + "." + std::to_string(num_files_++),
+                                           tuple_len);
+    }
+
+    // 哈希表在内存中的大小，包括装载因子为0.5时的槽
+    bool over_budget() const {
+        return num_build_ * (right_->tupleLen() + 2 * sizeof(Slot)) > mem_limit_;
+    }
+
+    void begin_build(int level) {
+        build_rows_.clear();
+        num_build_ = 0;
+        level_ = level;
+        partitioned_ = false;
+        spilled_.assign(HASH_JOIN_PARTITIONS, false);
+        build_files_.clear();
+        build_files_.resize(HASH_JOIN_PARTITIONS);
+        probe_files_.clear();
+        probe_files_.resize(HASH_JOIN_PARTITIONS);
+    }
+
+    // 把分区part在内存中的记录全部写入临时文件，之后这个分区的记录都直接写入文件
+    void spill_partition(int part) {
+        size_t right_len = right_->tupleLen();
+        spilled_[part] = true;
+        build_files_[part] = new_spill_file(right_len);
+        size_t kept = 0;
+        for (size_t row = 0; row < num_build_; row++) {
+            char *src = build_rows_.data() + row * right_len;
+            if (partition_of(hash_key(src, false)) == part) {
+                build_files_[part]->append(src);
+                continue;
+            }
+            if (kept != row) {
+                memmove(build_rows_.data() + kept * right_len, src, right_len);
+            }
+            kept++;
+        }
+        num_build_ = kept;
+        build_rows_.resize(kept * right_len);
+        part_rows_[part] = 0;
+    }
+
+    // 超过预算后划分分区，从内存中记录最多的分区开始写入临时文件，直到回到预算之内
+    void spill() {
+        size_t right_len = right_->tupleLen();
+        if (!partitioned_) {
+            partitioned_ = true;
+            part_rows_.assign(HASH_JOIN_PARTITIONS, 0);
+            for (size_t row = 0; row < num_build_; row++) {
+                part_rows_[partition_of(hash_key(build_rows_.data() + row * right_len, false))]++;
+            }
+        }
+        while (over_budget()) {
+            int victim = 0;
+            for (int part = 1; part < HASH_JOIN_PARTITIONS; part++) {
+                if (part_rows_[part] > part_rows_[victim]) {
+                    victim = part;
+                }
+            }
+            spill_partition(victim);
+        }
+    }
+
+    void add_build_row(const char *row) {
+        size_t right_len = right_->tupleLen();
+        if (partitioned_) {
+            int part = partition_of(hash_key(row, false));
+            if (spilled_[part]) {
+                build_files_[part]->append(row);
+                return;
+            }
+            part_rows_[part]++;
+        }
+        build_rows_.insert(build_rows_.end(), row, row + right_len);
+        num_build_++;
+        if (level_ < MAX_SPILL_LEVEL && over_budget()) {
+            spill();
+        }
+    }
+
+    // 用留在内存中的记录建立哈希表，并为溢出的分区准备存放左表记录的临时文件
+    void finish_build() {
+        size_t right_len = right_->tupleLen();
+        if (num_build_ >= EMPTY_ROW) {
+            throw InternalError("Too many rows on the build side of hash join");
+        }
+        // 装载因子不超过0.5
+        size_t capacity = 16;
+        while (capacity < 2 * num_build_) {
+            capacity <<= 1;
+        }
+        slots_.assign(capacity, {0, EMPTY_ROW});
+        size_t mask = capacity - 1;
+        for (size_t row = 0; row < num_build_; row++) {
+            uint64_t h = hash_key(build_rows_.data() + row * right_len, false);
+            size_t pos = h & mask;
+            while (slots_[pos].row != EMPTY_ROW) {
+                pos = (pos + 1) & mask;
+            }
+            slots_[pos] = {(uint32_t)h, (uint32_t)row};
+        }
+        for (int part = 0; part < HASH_JOIN_PARTITIONS; part++) {
+            if (spilled_[part]) {
+                probe_files_[part] = new_spill_file(left_->tupleLen());
+            }
+        }
+    }
+
+    // 读取右表的全部记录并建立哈希表
+    void build() {
+        begin_build(0);
+        RecordBatch batch;
+        for (right_->beginTuple(); right_->NextBatch(&batch);) {
+            for (size_t i = 0; i < batch.size(); i++) {
+                add_build_row(batch.get(i));
+            }
+        }
+        finish_build();
+    }
+
+    // 用左表的一条记录探测哈希表，连接结果写入joined_rows_，h为这条记录的key的哈希值
+    void probe(const char *left_row, uint64_t h) {
+        size_t right_len = right_->tupleLen();
+        size_t mask = slots_.size() - 1;
+        for (size_t pos = h & mask; slots_[pos].row != EMPTY_ROW; pos = (pos + 1) & mask) {
+            const char *right_row = build_rows_.data() + slots_[pos].row * right_len;
+            if (slots_[pos].hash != (uint32_t)h || !key_equal(left_row, right_row)) {
+                continue;
+            }
+            append_joined(left_row, right_row, right_len, residual_pred_);
+        }
+    }
+
+    // 下一条要探测的左表记录：正在连接溢出的分区时从分区的临时文件读取，否则从left_读取
+    const char *next_probe_row() {
+        if (probe_source_ != nullptr) {
+            return probe_source_->read(probe_row_.data()) ? probe_row_.data() : nullptr;
+        }
+        if (left_pos_ == left_batch_.size()) {
+            if (left_done_ || !left_->NextBatch(&left_batch_)) {
+                left_done_ = true;
+                left_pos_ = left_batch_.size();
+                return nullptr;
+            }
+            left_pos_ = 0;
+        }
+        return left_batch_.get(left_pos_++);
+    }
+
+    // 当前的左表记录探测完之后，把这一层溢出的分区加入pending_，再取出一个分区建立哈希表
+    bool next_partition() {
+        for (int part = 0; part < HASH_JOIN_PARTITIONS; part++) {
+            if (spilled_[part] && probe_files_[part]->size() > 0) {
+                pending_.push_back({std::move(build_files_[part]), std::move(probe_files_[part]), level_ + 1});
+            }
+        }
+        std::vector<char> row(right_->tupleLen());
+        while (!pending_.empty()) {
+            Partition part = std::move(pending_.back());
+            pending_.pop_back();
+            begin_build(part.level);
+            part.build->rewind();
+            while (part.build->read(row.data())) {
+                add_build_row(row.data());
+            }
+            finish_build();
+            if (num_build_ == 0 && !partitioned_) {
+                continue;
+            }
+            probe_source_ = std::move(part.probe);
+            probe_source_->rewind();
+            return true;
+        }
+        begin_build(0);
+        probe_source_.reset();
+        return false;
+    }
+
+    // 上一条左表记录的连接结果输出完毕后，继续探测直到产生新的结果或者所有分区都连接完
+    void advance() override {
+        while (num_joined_ == 0) {
+            const char *left_row = next_probe_row();
+            if (left_row == nullptr) {
+                if (!next_partition()) {
+                    return;
+                }
+                continue;
+            }
+            uint64_t h = hash_key(left_row, true);
+            if (partitioned_) {
+                int part = partition_of(h);
+                if (spilled_[part]) {
+                    probe_files_[part]->append(left_row);
+                    continue;
+                }
+            }
+            probe(left_row, h);
+        }
+    }
+
+   public:
+    HashJoinExecutor(std::unique_ptr<AbstractExecutor> left, std::unique_ptr<AbstractExecutor> right,
+                     std::vector<Condition> conds, DiskManager *disk_manager,
+                     size_t mem_limit = HASH_JOIN_MEMORY_SIZE) {
+        right_ = std::move(right);
+        init_join(std::move(left), right_->cols(), right_->tupleLen(), std::move(conds));
+        init_key_cols();
+
+        disk_manager_ = disk_manager;
+        mem_limit_ = mem_limit;
+        static std::atomic<uint64_t> next_id{0};
+        file_prefix_ = "hashjoin" + std::to_string(next_id++);
+        num_files_ = 0;
+        probe_row_.resize(left_->tupleLen());
+        begin_build(0);
+
+        left_pos_ = 0;
+        left_done_ = true;
+    }
+
+    void beginTuple() override {
+        pending_.clear();
+        probe_source_.reset();
+        build();
+        left_->beginTuple();
+        left_batch_.reset(left_->tupleLen());
+        left_pos_ = 0;
+        // 右表为空时不需要读取左表
+        left_done_ = num_build_ == 0 && !partitioned_;
+        refill();
+    }
+
+    std::string getType() override { return "HashJoin"; }
+};
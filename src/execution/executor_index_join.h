@@ -0,0 +1,161 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include "execution_defs.h"
+#include "execution_manager.h"
+#include "executor_abstract.h"
+#include "executor_index_scan.h"
+#include "index/ix.h"
+#include "system/sm.h"
+
+/**
+ * index nested loop join：右侧（内表）是一张带B+树索引的表，不扫描内表，
+ * 而是对左表（外表）的每一条记录用它的连接列构造key，在内表的索引上用lower_bound/upper_bound定位后读取匹配的记录。
+ * 索引前缀上的每个字段需要有与外表的列类型和长度都相同的等值连接条件，或者内表上与常量的等值条件，
+ * 其余连接条件在拼接后的记录上判断，内表上的其余条件在内表的记录上判断
+ */
+class IndexJoinExecutor : public JoinExecutor {
+   private:
+    std::string tab_name_;                      // 内表名称
+    TabMeta tab_;                               // 内表的元数据
+    RmFileHandle *fh_;                          // 内表的数据文件句柄
+    IndexMeta index_meta_;                      // 查找所用的B+树索引
+    std::vector<std::string> index_col_names_;
+    size_t inner_len_;                          // 内表记录的长度
+    SmManager *sm_manager_;
+
+    // key中的一个字段：来自外表记录中偏移为left_offset的列，或者是常量value
+    struct KeyPart {
+        bool is_const;
+        size_t left_offset;
+        std::vector<char> value;
+    };
+    std::vector<KeyPart> key_parts_;            // 索引的前缀字段，其余字段查找时填充最小值和最大值
+    std::vector<char> lower_key_;
+    std::vector<char> upper_key_;
+    CompiledPredicate inner_pred_;              // 内表上的条件
+    CompiledPredicate residual_pred_;           // 不属于key的join条件
+
+    RecordBatch left_batch_;                    // 外表当前的一批记录
+    size_t left_pos_;                           // left_batch_中下一条要查找的记录
+
+    // 依次为索引的每个字段寻找连接条件或常量等值条件，遇到没有条件的字段为止
+    void init_key_parts(const std::vector<Condition> &inner_conds) {
+        std::vector<bool> used(fed_conds_.size(), false);
+        for (auto &col : index_meta_.cols) {
+            bool found = false;
+            for (size_t i = 0; i < fed_conds_.size() && !found; i++) {
+                ColMeta outer_col, inner_col;
+                if (used[i] || !split_equi_cond(fed_conds_[i], &outer_col, &inner_col) || inner_col.name != col.name) {
+                    continue;
+                }
+                key_parts_.push_back({false, (size_t)outer_col.offset, {}});
+                used[i] = found = true;
+            }
+            for (auto &cond : inner_conds) {
+                if (found) break;
+                if (!cond.is_rhs_val || cond.op != OP_EQ || cond.lhs_col.col_name != col.name ||
+                    cond.rhs_val.type != col.type) {
+                    continue;
+                }
+                auto data = cond.rhs_val.raw->data;
+                key_parts_.push_back({true, 0, std::vector<char>(data, data + col.len)});
+                found = true;
+            }
+            if (!found) break;
+        }
+        if (key_parts_.empty()) {
+            throw InternalError("Index join requires an equi-join condition on the index");
+        }
+        std::vector<Condition> residual;
+        for (size_t i = 0; i < fed_conds_.size(); i++) {
+            if (!used[i]) {
+                residual.push_back(fed_conds_[i]);
+            }
+        }
+        residual_pred_ = CompiledPredicate(residual, cols_);
+    }
+
+    // 用外表的一条记录在内表的索引上查找，连接结果写入joined_rows_
+    void probe(const char *left_row) {
+        size_t offset = 0;
+        for (size_t i = 0; i < index_meta_.cols.size(); i++) {
+            auto &col = index_meta_.cols[i];
+            if (i < key_parts_.size()) {
+                const char *val = key_parts_[i].is_const ? key_parts_[i].value.data()
+                                                         : left_row + key_parts_[i].left_offset;
+                memcpy(lower_key_.data() + offset, val, col.len);
+                memcpy(upper_key_.data() + offset, val, col.len);
+            } else {
+                IndexScanExecutor::fill_bound(lower_key_.data() + offset, col, false);
+                IndexScanExecutor::fill_bound(upper_key_.data() + offset, col, true);
+            }
+            offset += col.len;
+        }
+        auto ih = sm_manager_->get_index_handle(tab_name_, index_col_names_);
+        IxScan scan(ih, ih->lower_bound(lower_key_.data()), ih->upper_bound(upper_key_.data()),
+                    sm_manager_->get_bpm());
+        for (; !scan.is_end(); scan.next()) {
+            auto rec = fh_->get_record(scan.rid(), context_);
+            if (inner_pred_.eval(rec->data)) {
+                append_joined(left_row, rec->data, inner_len_, residual_pred_);
+            }
+        }
+    }
+
+    // 上一条外表记录的连接结果输出完毕后，继续查找直到产生新的结果或者外表读完
+    void advance() override {
+        while (num_joined_ == 0) {
+            if (left_pos_ == left_batch_.size()) {
+                if (!left_->NextBatch(&left_batch_)) {
+                    left_pos_ = left_batch_.size();
+                    return;
+                }
+                left_pos_ = 0;
+            }
+            probe(left_batch_.get(left_pos_++));
+        }
+    }
+
+   public:
+    IndexJoinExecutor(SmManager *sm_manager, std::unique_ptr<AbstractExecutor> left, std::string tab_name,
+                      std::vector<Condition> inner_conds, std::vector<std::string> index_col_names,
+                      std::vector<Condition> conds, Context *context) {
+        sm_manager_ = sm_manager;
+        context_ = context;
+        tab_name_ = std::move(tab_name);
+        tab_ = sm_manager_->db_.get_table(tab_name_);
+        fh_ = sm_manager_->fhs_.at(tab_name_).get();
+        index_col_names_ = std::move(index_col_names);
+        index_meta_ = *tab_.get_index_meta(index_col_names_);
+        if (index_meta_.type != INDEX_BTREE) {
+            throw InternalError("Index join requires a B+ tree index");
+        }
+        inner_len_ = tab_.cols.back().offset + tab_.cols.back().len;
+        init_join(std::move(left), tab_.cols, inner_len_, std::move(conds));
+        inner_pred_ = CompiledPredicate(inner_conds, tab_.cols);
+        init_key_parts(inner_conds);
+        lower_key_.resize(index_meta_.col_tot_len);
+        upper_key_.resize(index_meta_.col_tot_len);
+
+        left_pos_ = 0;
+    }
+
+    void beginTuple() override {
+        left_->beginTuple();
+        left_batch_.reset(left_->tupleLen());
+        left_pos_ = 0;
+        refill();
+    }
+
+    std::string getType() override { return "IndexJoin"; }
+};
@@ -10,6 +10,10 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
 #include "execution_defs.h"
 #include "execution_manager.h"
 #include "executor_abstract.h"
@@ -25,18 +29,35 @@ class IndexScanExecutor : public AbstractExecutor {
     std::vector<ColMeta> cols_;                 // 需要读取的字段
     size_t len_;                                // 选取出来的一条记录的长度
     std::vector<Condition> fed_conds_;          // 扫描条件，和conds_字段相同
+    CompiledPredicate pred_;                    // 编译后的fed_conds_
 
     std::vector<std::string> index_col_names_;  // index scan涉及到的索引包含的字段
     IndexMeta index_meta_;                      // index scan涉及到的索引元数据
 
+    // 只扫描索引（index-only scan）：需要读取的字段都包含在索引中时，直接用索引中的key构造记录，不读取表的数据文件
+    bool index_only_;
+    std::vector<char> key_;                     // index-only scan时当前索引槽中的key
+
     Rid rid_;
+    std::unique_ptr<RmRecord> rec_;             // 当前满足条件的记录
     std::unique_ptr<RecScan> scan_;
+    IxScan *ix_scan_ = nullptr;                 // scan_为B+树索引上的扫描时指向scan_
+
+    bool reverse_;                              // 按索引逆序扫描，用于ORDER BY ... DESC
+
+    // bitmap heap scan：先收集索引范围内所有的Rid，按页面排序后逐页读取记录，每个页面只fetch一次
+    bool bitmap_;
+    std::vector<Rid> rids_;                     // 按(page_no, slot_no)排好序的Rid
+    size_t rid_pos_ = 0;                        // 下一个要读取的页面在rids_中的起始位置
+    std::vector<Rid> page_rids_;                // 当前页面上满足条件的记录的Rid
+    std::vector<std::unique_ptr<RmRecord>> page_recs_;  // 当前页面上满足条件的记录
+    size_t page_pos_ = 0;                       // 当前记录在page_recs_中的位置
 
     SmManager *sm_manager_;
 
    public:
     IndexScanExecutor(SmManager *sm_manager, std::string tab_name, std::vector<Condition> conds, std::vector<std::string> index_col_names,
-                    Context *context) {
+                    Context *context, bool index_only = false, bool bitmap = false, bool reverse = false) {
         sm_manager_ = sm_manager;
         context_ = context;
         tab_name_ = std::move(tab_name);
@@ -48,6 +69,14 @@ class IndexScanExecutor : public AbstractExecutor {
         fh_ = sm_manager_->fhs_.at(tab_name_).get();
         cols_ = tab_.cols;
         len_ = cols_.back().offset + cols_.back().len;
+        index_only_ = index_only && index_meta_.type == INDEX_BTREE;
+        bitmap_ = bitmap && !index_only_ && index_meta_.type == INDEX_BTREE;
+        reverse_ = reverse;
+        if (index_only_) {
+            key_.resize(index_meta_.col_tot_len);
+            rec_ = std::make_unique<RmRecord>(len_);
+            memset(rec_->data, 0, len_);
+        }
         std::map<CompOp, CompOp> swap_op = {
             {OP_EQ, OP_EQ}, {OP_NE, OP_NE}, {OP_LT, OP_GT}, {OP_GT, OP_LT}, {OP_LE, OP_GE}, {OP_GE, OP_LE},
         };
@@ -62,19 +91,210 @@ class IndexScanExecutor : public AbstractExecutor {
             }
         }
         fed_conds_ = conds_;
+        pred_ = CompiledPredicate(fed_conds_, cols_);
+    }
+
+    size_t tupleLen() const override { return len_; };
+
+    std::string get_tableName() override { return tab_name_; }
+
+    // 在key中填充字段类型的最小值或最大值
+    static void fill_bound(char *key, const ColMeta &col, bool upper) {
+        if (col.type == TYPE_INT) {
+            int val = upper ? INT_MAX : INT_MIN;
+            memcpy(key, &val, sizeof(int));
+        } else if (col.type == TYPE_FLOAT) {
+            float val = upper ? INFINITY : -INFINITY;
+            memcpy(key, &val, sizeof(float));
+        } else {
+            memset(key, upper ? 0xff : 0, col.len);
+        }
+    }
+
+    /**
+     * 根据索引字段上的条件构造查找范围：最长的等值条件前缀，加上紧随其后一个字段上的范围条件
+     * 条件中的常量与字段类型不同时视为没有条件，其余条件在find_next_match中作为过滤条件检查
+     * @param lower_open 下界是否为开区间（>），此时之后的字段填充最大值，用upper_bound定位
+     * @param upper_open 上界是否为开区间（<），此时之后的字段填充最小值，用lower_bound定位
+     * @return 前缀中有等值条件的字段数量，下一个字段上有范围条件时再加一
+     */
+    int build_key(char *lower, char *upper, bool &lower_open, bool &upper_open) {
+        int offset = 0, num_matched = 0;
+        lower_open = upper_open = false;
+        bool prefix = true;
+        for (auto &col : index_meta_.cols) {
+            if (!prefix) {
+                fill_bound(lower + offset, col, lower_open);
+                fill_bound(upper + offset, col, !upper_open);
+                offset += col.len;
+                continue;
+            }
+            auto cond = std::find_if(fed_conds_.begin(), fed_conds_.end(), [&](const Condition &cond) {
+                return cond.is_rhs_val && cond.op == OP_EQ && cond.lhs_col.col_name == col.name &&
+                       cond.rhs_val.type == col.type;
+            });
+            if (cond != fed_conds_.end()) {
+                memcpy(lower + offset, cond->rhs_val.raw->data, col.len);
+                memcpy(upper + offset, cond->rhs_val.raw->data, col.len);
+                num_matched++;
+                offset += col.len;
+                continue;
+            }
+            prefix = false;
+            // 等值前缀之后的第一个字段：取最紧的下界和上界
+            const Condition *lo = nullptr, *hi = nullptr;
+            for (auto &cond : fed_conds_) {
+                if (!cond.is_rhs_val || cond.lhs_col.col_name != col.name || cond.rhs_val.type != col.type) continue;
+                bool is_lower = cond.op == OP_GT || cond.op == OP_GE;
+                bool is_upper = cond.op == OP_LT || cond.op == OP_LE;
+                if (!is_lower && !is_upper) continue;
+                const Condition *&bound = is_lower ? lo : hi;
+                int cmp = bound == nullptr ? 0 : ix_compare(cond.rhs_val.raw->data, bound->rhs_val.raw->data, col.type, col.len);
+                bool strict = cond.op == OP_GT || cond.op == OP_LT;
+                if (bound == nullptr || (is_lower ? cmp > 0 : cmp < 0) || (cmp == 0 && strict)) {
+                    bound = &cond;
+                }
+            }
+            if (lo != nullptr) {
+                memcpy(lower + offset, lo->rhs_val.raw->data, col.len);
+                lower_open = lo->op == OP_GT;
+            } else {
+                fill_bound(lower + offset, col, false);
+            }
+            if (hi != nullptr) {
+                memcpy(upper + offset, hi->rhs_val.raw->data, col.len);
+                upper_open = hi->op == OP_LT;
+            } else {
+                fill_bound(upper + offset, col, true);
+            }
+            if (lo != nullptr || hi != nullptr) {
+                num_matched++;
+            }
+            offset += col.len;
+        }
+        return num_matched;
+    }
+
+    // 从scan_当前的位置开始，找到第一条满足所有条件的记录
+    void find_next_match() {
+        for (; !scan_->is_end(); scan_->next()) {
+            rid_ = scan_->rid();
+            if (index_only_) {
+                // 只填充记录中索引包含的字段，上层算子只会用到这些字段
+                ix_scan_->key(key_.data());
+                int offset = 0;
+                for (auto &col : index_meta_.cols) {
+                    memcpy(rec_->data + col.offset, key_.data() + offset, col.len);
+                    offset += col.len;
+                }
+            } else {
+                rec_ = fh_->get_record(rid_, context_);
+            }
+            if (pred_.eval(rec_->data)) {
+                return;
+            }
+        }
+    }
+
+    // bitmap heap scan：逐页读取rids_中的记录，直到当前页面上有满足条件的记录或者读完所有页面
+    void fetch_next_page() {
+        while (page_pos_ == page_recs_.size() && rid_pos_ < rids_.size()) {
+            size_t end = rid_pos_;
+            while (end < rids_.size() && rids_[end].page_no == rids_[rid_pos_].page_no) {
+                end++;
+            }
+            auto records = fh_->get_records(rids_.data() + rid_pos_, end - rid_pos_, context_);
+            page_rids_.clear();
+            page_recs_.clear();
+            page_pos_ = 0;
+            for (size_t i = 0; i < records.size(); i++) {
+                if (pred_.eval(records[i]->data)) {
+                    page_rids_.push_back(rids_[rid_pos_ + i]);
+                    page_recs_.push_back(std::move(records[i]));
+                }
+            }
+            rid_pos_ = end;
+        }
+        if (page_pos_ < page_recs_.size()) {
+            rid_ = page_rids_[page_pos_];
+        }
     }
 
     void beginTuple() override {
-        
+        std::vector<char> lower_key(index_meta_.col_tot_len), upper_key(index_meta_.col_tot_len);
+        bool lower_open, upper_open;
+        int num_matched = build_key(lower_key.data(), upper_key.data(), lower_open, upper_open);
+        if (index_meta_.type == INDEX_HASH) {
+            // 哈希索引只能查找完整的key，无法构造key时退化为顺序扫描
+            if (num_matched == index_meta_.col_num && !lower_open && !upper_open &&
+                lower_key == upper_key) {
+                scan_ = std::make_unique<IxHashScan>(sm_manager_->get_hash_handle(tab_name_, index_meta_.cols),
+                                                     lower_key.data());
+            } else {
+                scan_ = std::make_unique<RmScan>(fh_);
+            }
+            find_next_match();
+            return;
+        }
+        auto ih = sm_manager_->get_index_handle(tab_name_, index_col_names_);
+        Iid lower = ih->leaf_begin();
+        Iid upper = ih->leaf_end();
+        if (num_matched > 0) {
+            lower = lower_open ? ih->upper_bound(lower_key.data()) : ih->lower_bound(lower_key.data());
+            upper = upper_open ? ih->lower_bound(upper_key.data()) : ih->upper_bound(upper_key.data());
+            // 下界大于上界时范围为空，不能让扫描从lower一直走到叶子链表的末尾
+            int cmp = 0, offset = 0;
+            for (auto &col : index_meta_.cols) {
+                cmp = ix_compare(lower_key.data() + offset, upper_key.data() + offset, col.type, col.len);
+                if (cmp != 0) break;
+                offset += col.len;
+            }
+            if (cmp > 0 || (cmp == 0 && (lower_open || upper_open))) {
+                upper = lower;
+            }
+        }
+        auto scan = std::make_unique<IxScan>(ih, lower, upper, sm_manager_->get_bpm(), reverse_);
+        ix_scan_ = scan.get();
+        if (bitmap_) {
+            rids_.clear();
+            for (; !scan->is_end(); scan->next()) {
+                rids_.push_back(scan->rid());
+            }
+            std::sort(rids_.begin(), rids_.end(), [](const Rid &a, const Rid &b) {
+                return a.page_no != b.page_no ? a.page_no < b.page_no : a.slot_no < b.slot_no;
+            });
+            rid_pos_ = 0;
+            page_rids_.clear();
+            page_recs_.clear();
+            page_pos_ = 0;
+            scan_ = std::move(scan);
+            fetch_next_page();
+            return;
+        }
+        scan_ = std::move(scan);
+        find_next_match();
     }
 
     void nextTuple() override {
-        
+        if (bitmap_) {
+            page_pos_++;
+            fetch_next_page();
+            return;
+        }
+        scan_->next();
+        find_next_match();
     }
 
+    bool is_end() const override { return bitmap_ ? page_pos_ == page_recs_.size() : scan_->is_end(); }
+
     std::unique_ptr<RmRecord> Next() override {
-        return nullptr;
+        if (bitmap_) {
+            return std::make_unique<RmRecord>(*page_recs_[page_pos_]);
+        }
+        return std::make_unique<RmRecord>(*rec_);
     }
 
     Rid &rid() override { return rid_; }
+
+    const std::vector<ColMeta> &cols() const override { return cols_; }
 };
\ No newline at end of file
@@ -52,19 +52,27 @@ class InsertExecutor : public AbstractExecutor {
             val.init_raw(col.len);
             memcpy(rec.data + col.offset, val.raw->data, col.len);
         }
+        // 持有表的写latch期间索引不会被建立、重建或删除，构造执行器之后索引可能已经发生了变化
+        std::shared_lock tab_latch{sm_manager_->get_table_latch(tab_name_)};
+        tab_.indexes = sm_manager_->db_.get_table(tab_name_).indexes;
         // Insert into record file
         rid_ = fh_->insert_record(rec.data, context_);      // 主干,用来插入一条新的记录
         // Insert into index
         for(size_t i = 0; i < tab_.indexes.size(); ++i) {
             auto& index = tab_.indexes[i];
-            auto ih = sm_manager_->ihs_.at(sm_manager_->get_ix_manager()->get_index_name(tab_name_, index.cols)).get();
-            char* key = new char[index.col_tot_len];
-            int offset = 0;
-            for(size_t i = 0; i < (size_t)index.col_num; ++i) {
-                memcpy(key + offset, rec.data + index.cols[i].offset, index.cols[i].len);
-                offset += index.cols[i].len;
+            std::vector<char> key(index.col_tot_len);
+            index.get_key(rec.data, key.data());
+            if (!sm_manager_->insert_index_entry(tab_name_, index, key.data(), rid_, context_->txn_)) {
+                // 唯一索引中已经有相同的key，撤销已经插入的索引项和记录
+                for (size_t j = 0; j < i; ++j) {
+                    std::vector<char> inserted_key(tab_.indexes[j].col_tot_len);
+                    tab_.indexes[j].get_key(rec.data, inserted_key.data());
+                    sm_manager_->delete_index_entry(tab_name_, tab_.indexes[j], inserted_key.data(), rid_,
+                                                    context_->txn_);
+                }
+                fh_->delete_record(rid_, context_);
+                throw UniqueViolationError(tab_name_, index.get_col_names());
             }
-            ih->insert_entry(key, rid_, context_->txn_);
         }
         return nullptr;
         // return std::make_unique<RmRecord>(rec);
@@ -0,0 +1,164 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include "execution_defs.h"
+#include "execution_manager.h"
+#include "executor_abstract.h"
+#include "index/ix.h"
+#include "system/sm.h"
+
+/**
+ * 等值连接的sort merge join：左右两个子节点的输出都按key升序排列（由planner保证，必要时在子节点上加排序），
+ * 同时顺序读取两侧，把右表中key相同的一段连续记录缓存下来，与左表中key相同的每一条记录连接。
+ * 第一个左右两侧类型和长度都相同的等值条件作为key，其余条件在拼接后的记录上判断。
+ * 输出按key升序排列，key相同时按左表的顺序
+ */
+class MergeJoinExecutor : public JoinExecutor {
+   private:
+    std::unique_ptr<AbstractExecutor> right_;   // 右儿子节点
+
+    ColMeta left_key_;                          // key在左表记录中的字段
+    ColMeta right_key_;                         // key在右表记录中的字段，offset为在右表记录中的偏移
+    CompiledPredicate residual_pred_;           // key以外的join条件
+
+    RecordBatch left_batch_;                    // 左表当前的一批记录
+    size_t left_pos_;                           // left_batch_中当前的左表记录
+    bool left_done_;
+    RecordBatch right_batch_;                   // 右表当前的一批记录
+    size_t right_pos_;                          // right_batch_中下一条还没有读入run_rows_的记录
+    bool right_done_;
+
+    // 右表中key相同的一段连续记录
+    std::vector<char> run_rows_;
+    size_t num_run_;
+
+    void init_key() {
+        std::vector<Condition> residual;
+        bool found = false;
+        for (auto &cond : fed_conds_) {
+            if (found || !split_equi_cond(cond, &left_key_, &right_key_)) {
+                residual.push_back(cond);
+                continue;
+            }
+            found = true;
+        }
+        if (!found) {
+            throw InternalError("Merge join requires an equi-join condition");
+        }
+        residual_pred_ = CompiledPredicate(residual, cols_);
+    }
+
+    int compare_key(const char *left_row, const char *right_row) {
+        return compare(const_cast<char *>(left_row) + left_key_.offset,
+                       const_cast<char *>(right_row) + right_key_.offset, left_key_.type, right_key_.type,
+                       left_key_.len);
+    }
+
+    // 当前的左表记录，左表读完时返回nullptr
+    const char *left_row() {
+        if (left_pos_ == left_batch_.size()) {
+            if (left_done_ || !left_->NextBatch(&left_batch_)) {
+                left_done_ = true;
+                left_pos_ = left_batch_.size();
+                return nullptr;
+            }
+            left_pos_ = 0;
+        }
+        return left_batch_.get(left_pos_);
+    }
+
+    // 下一条还没有读入run_rows_的右表记录，右表读完时返回nullptr
+    const char *right_row() {
+        if (right_pos_ == right_batch_.size()) {
+            if (right_done_ || !right_->NextBatch(&right_batch_)) {
+                right_done_ = true;
+                right_pos_ = right_batch_.size();
+                return nullptr;
+            }
+            right_pos_ = 0;
+        }
+        return right_batch_.get(right_pos_);
+    }
+
+    // 跳过右表中key小于左表记录的记录，再把key等于左表记录的一段记录读入run_rows_
+    void load_run(const char *left) {
+        size_t right_len = right_->tupleLen();
+        run_rows_.clear();
+        num_run_ = 0;
+        const char *right;
+        while ((right = right_row()) != nullptr && compare_key(left, right) > 0) {
+            right_pos_++;
+        }
+        while ((right = right_row()) != nullptr && compare_key(left, right) == 0) {
+            run_rows_.insert(run_rows_.end(), right, right + right_len);
+            num_run_++;
+            right_pos_++;
+        }
+    }
+
+    // 左表的一条记录与run_rows_中的记录连接，结果写入joined_rows_
+    void join_row(const char *left) {
+        size_t right_len = right_->tupleLen();
+        for (size_t i = 0; i < num_run_; i++) {
+            append_joined(left, run_rows_.data() + i * right_len, right_len, residual_pred_);
+        }
+    }
+
+    // 上一条左表记录的连接结果输出完毕后，继续合并直到产生新的结果或者有一侧读完
+    void advance() override {
+        while (num_joined_ == 0) {
+            const char *left = left_row();
+            if (left == nullptr) {
+                return;
+            }
+            // key与上一条左表记录相同时继续使用run_rows_
+            if (num_run_ == 0 || compare_key(left, run_rows_.data()) != 0) {
+                load_run(left);
+                if (num_run_ == 0 && right_done_) {
+                    return;
+                }
+            }
+            if (num_run_ > 0) {
+                join_row(left);
+            }
+            left_pos_++;
+        }
+    }
+
+   public:
+    MergeJoinExecutor(std::unique_ptr<AbstractExecutor> left, std::unique_ptr<AbstractExecutor> right,
+                      std::vector<Condition> conds) {
+        right_ = std::move(right);
+        init_join(std::move(left), right_->cols(), right_->tupleLen(), std::move(conds));
+        init_key();
+
+        left_pos_ = 0;
+        left_done_ = true;
+        right_pos_ = 0;
+        right_done_ = true;
+        num_run_ = 0;
+    }
+
+    void beginTuple() override {
+        left_->beginTuple();
+        right_->beginTuple();
+        left_batch_.reset(left_->tupleLen());
+        right_batch_.reset(right_->tupleLen());
+        left_pos_ = right_pos_ = 0;
+        left_done_ = right_done_ = false;
+        run_rows_.clear();
+        num_run_ = 0;
+        refill();
+    }
+
+    std::string getType() override { return "MergeJoin"; }
+};
@@ -11,95 +11,165 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 #include "execution_defs.h"
 #include "execution_manager.h"
+#include "execution_simd.h"
 #include "executor_abstract.h"
 #include "index/ix.h"
 #include "system/sm.h"
 
-class NestedLoopJoinExecutor : public AbstractExecutor
+class NestedLoopJoinExecutor : public JoinExecutor
 {
 private:
-    std::unique_ptr<AbstractExecutor> left_;  // 左儿子节点（需要join的表）
     std::unique_ptr<AbstractExecutor> right_; // 右儿子节点（需要join的表）
-    size_t len_;                              // join后获得的每条记录的长度
-    std::vector<ColMeta> cols_;               // join后获得的记录的字段
 
-    std::vector<Condition> fed_conds_; // join条件
-    bool isend;
+    // 左表的列与右表的列之间的比较，对左表的每条记录，左侧的值是常量，可以用过滤内核一次过滤右表的一批记录
+    struct JoinFilter
+    {
+        size_t left_offset;  // 左表的列在左表记录中的偏移
+        ColType left_type;
+        size_t right_offset; // 右表的列在右表记录中的偏移
+        ColType right_type;
+        size_t len;          // 右表的列的长度
+        CompOp op;           // 右表的列 op 左表的列
+    };
+    std::vector<JoinFilter> join_filters_;
+    CompiledPredicate residual_pred_;  // 不能用过滤内核求值的join条件
 
-    std::vector<std::unique_ptr<RmRecord>> left_record;
-    std::vector<std::unique_ptr<RmRecord>> right_record;
-    std::vector<std::unique_ptr<RmRecord>> all_record; // 存储所有的拼接好的record
-    int position;
+    // block nested loop join：每次把左表（外表）大约block_size_字节的记录读入block_，
+    // 然后重新扫描右表（内表），右表的每一批记录与block_中的每条记录连接，连接结果立即输出
+    size_t block_size_;                // 外表每个块的字节数，读入一批记录后超过时结束这个块
+    std::vector<char> block_;          // 外表当前块的记录，按行连续存放
+    size_t block_rows_;                // block_中的记录条数
+    size_t block_pos_;                 // block_中下一条要与right_batch_连接的记录
+    bool left_end_;                    // 外表已经读完
+    RecordBatch left_batch_;
+    RecordBatch right_batch_;          // 内表当前的一批记录
+    std::vector<int> sel_;             // right_batch_中满足join_filters_的行号
 
-public:
-    NestedLoopJoinExecutor(std::unique_ptr<AbstractExecutor> left, std::unique_ptr<AbstractExecutor> right,
-                           std::vector<Condition> conds)
+    // 把左右两侧分别在左表和右表上的条件转换为JoinFilter，其余条件留给residual_pred_
+    void init_join_filters()
     {
-        left_ = std::move(left);
-        right_ = std::move(right);
-        len_ = left_->tupleLen() + right_->tupleLen();
-        cols_ = left_->cols();
-        auto right_cols = right_->cols();
-        for (auto &col : right_cols)
+        static const std::map<CompOp, CompOp> swap_op = {
+            {OP_EQ, OP_EQ}, {OP_NE, OP_NE}, {OP_LT, OP_GT}, {OP_GT, OP_LT}, {OP_LE, OP_GE}, {OP_GE, OP_LE},
+        };
+        std::vector<Condition> residual;
+        for (auto &cond : fed_conds_)
         {
-            col.offset += left_->tupleLen();
+            ColMeta left_col, right_col;
+            bool lhs_left;
+            if (!split_join_cond(cond, &left_col, &right_col, &lhs_left))
+            {
+                residual.push_back(cond);
+                continue;
+            }
+            CompOp op = lhs_left ? swap_op.at(cond.op) : cond.op;
+            if (!simd_filter_supported(right_col.type, right_col.len, op, left_col.type))
+            {
+                residual.push_back(cond);
+                continue;
+            }
+            join_filters_.push_back({(size_t)left_col.offset, left_col.type, (size_t)right_col.offset,
+                                     right_col.type, (size_t)right_col.len, op});
         }
+        residual_pred_ = CompiledPredicate(residual, cols_);
+    }
 
-        cols_.insert(cols_.end(), right_cols.begin(), right_cols.end());
-        isend = false;
-        fed_conds_ = std::move(conds);
-
-        position = 0;
+    // 读入外表的下一个块，外表已经读完时返回false
+    bool load_block()
+    {
+        size_t left_len = left_->tupleLen();
+        block_.clear();
+        block_rows_ = 0;
+        block_pos_ = 0;
+        while (!left_end_ && block_.size() < block_size_)
+        {
+            if (!left_->NextBatch(&left_batch_))
+            {
+                left_end_ = true;
+                break;
+            }
+            for (size_t i = 0; i < left_batch_.size(); i++)
+            {
+                block_.insert(block_.end(), left_batch_.get(i), left_batch_.get(i) + left_len);
+            }
+            block_rows_ += left_batch_.size();
+        }
+        return block_rows_ > 0;
     }
 
-    void beginTuple() override
+    // 把block_中第i条记录与right_batch_连接，结果写入joined_rows_
+    void join_row(size_t i)
     {
-        // 1.填充 left_record 和 right_record
-        for (left_->beginTuple(); !left_->is_end(); left_->nextTuple())
+        size_t left_len = left_->tupleLen(), right_len = right_->tupleLen();
+        const char *left_row = block_.data() + i * left_len;
+        const auto &batch_sel = right_batch_.sel();
+        sel_.assign(batch_sel.begin(), batch_sel.end());
+        size_t num_sel = sel_.size();
+        for (size_t k = 0; k < join_filters_.size() && num_sel > 0; ++k)
         {
-            left_record.push_back(std::move(left_->Next()));
+            auto &jf = join_filters_[k];
+            SimdFilter filter;
+            make_simd_filter(jf.right_type, jf.len, jf.op, jf.left_type, left_row + jf.left_offset, &filter);
+            num_sel = simd_filter(filter, right_batch_.data() + jf.right_offset, right_len, sel_.data(), num_sel);
         }
-        for (right_->beginTuple(); !right_->is_end(); right_->nextTuple())
+        for (size_t j = 0; j < num_sel; ++j)
         {
-            right_record.push_back(std::move(right_->Next()));
+            append_joined(left_row, right_batch_.data() + sel_[j] * right_len, right_len, residual_pred_);
         }
+    }
 
-        // 2.填充all_record
-        for (auto i = 0; i < left_record.size(); ++i)
+    // 上一次的连接结果输出完毕后，继续连接直到产生新的结果或者外表和内表都已经处理完
+    void advance() override
+    {
+        while (num_joined_ == 0)
         {
-            for (auto j = 0; j < right_record.size(); ++j)
+            if (block_pos_ == block_rows_)
             {
-                auto left_Tuple = left_record[i].get();
-                auto right_Tuple = right_record[j].get();
-                auto record = std::make_unique<RmRecord>(len_);
-                memcpy(record->data, left_Tuple->data, left_Tuple->size);
-                memcpy(record->data + left_Tuple->size, right_Tuple->data, right_Tuple->size);
-
-                if (do_pridict(record, fed_conds_, cols_))
+                // right_batch_已经与整个块连接完毕，取内表的下一批记录
+                if (!right_->NextBatch(&right_batch_))
                 {
-                    all_record.push_back(std::move(record));
+                    // 内表扫描完毕，读入外表的下一个块并重新扫描内表
+                    if (!load_block())
+                    {
+                        return;
+                    }
+                    right_->beginTuple();
+                    block_pos_ = block_rows_;
+                    continue;
                 }
+                block_pos_ = 0;
             }
+            join_row(block_pos_++);
         }
-        // 时间复杂度 o(m+n+mn) 看起来还不错
-        // 空间复杂度也是这么多
     }
 
-    void nextTuple() override
+public:
+    NestedLoopJoinExecutor(std::unique_ptr<AbstractExecutor> left, std::unique_ptr<AbstractExecutor> right,
+                           std::vector<Condition> conds, size_t block_size = JOIN_BLOCK_SIZE)
     {
-        position++;
+        block_size_ = block_size;
+        right_ = std::move(right);
+        init_join(std::move(left), right_->cols(), right_->tupleLen(), std::move(conds));
+        init_join_filters();
+
+        block_rows_ = 0;
+        block_pos_ = 0;
+        left_end_ = false;
     }
 
-    std::unique_ptr<RmRecord> Next() override
+    void beginTuple() override
     {
-        return std::move(all_record[position]);
+        left_->beginTuple();
+        left_end_ = false;
+        num_joined_ = 0;
+        position = 0;
+        if (!load_block())
+        {
+            return;
+        }
+        right_->beginTuple();
+        block_pos_ = block_rows_;
+        refill();
     }
 
-    Rid &rid() override { return _abstract_rid; }
     std::string getType() override { return "Nestedloop_Scan"; }
-    bool is_end() const override { return (position == all_record.size()); }
-    size_t tupleLen() const override { return len_; }
-    const std::vector<ColMeta> &cols() const override{
-        return cols_;
-    }
 };
\ No newline at end of file
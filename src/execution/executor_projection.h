@@ -21,6 +21,7 @@ class ProjectionExecutor : public AbstractExecutor {
     std::vector<ColMeta> cols_;                     // 需要投影的字段
     size_t len_;                                    // 字段总长度
     std::vector<size_t> sel_idxs_;                  // 字段位于记录数组中的下标（注意是下标）
+    RecordBatch prev_batch_;                        // 批量执行时儿子节点输出的一批记录
 
    public:
     ProjectionExecutor(std::unique_ptr<AbstractExecutor> prev, const std::vector<TabCol> &sel_cols) {
@@ -67,6 +68,23 @@ class ProjectionExecutor : public AbstractExecutor {
         return rec;
     }
 
+    // 对儿子节点的一批记录逐条投影，只处理选择向量中的记录
+    bool NextBatch(RecordBatch *batch) override {
+        batch->reset(len_);
+        if (!prev_->NextBatch(&prev_batch_)) {
+            return false;
+        }
+        auto &prev_cols = prev_->cols();
+        for (size_t i = 0; i < prev_batch_.size(); i++) {
+            const char *prev_rec = prev_batch_.get(i);
+            char *rec = batch->append();
+            for (size_t j = 0; j < sel_idxs_.size(); j++) {
+                memcpy(rec + cols_[j].offset, prev_rec + prev_cols[sel_idxs_[j]].offset, cols_[j].len);
+            }
+        }
+        return true;
+    }
+
     Rid &rid() override { return _abstract_rid; }
 
     size_t tupleLen() const override { return len_; };
@@ -10,8 +10,14 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 #include "execution_defs.h"
 #include "execution_manager.h"
+#include "execution_simd.h"
 #include "executor_abstract.h"
 #include "index/ix.h"
 #include "system/sm.h"
@@ -26,15 +32,70 @@ class SeqScanExecutor : public AbstractExecutor {
     std::vector<ColMeta> cols_;         // scan后生成的记录的字段
     size_t len_;                        // scan后生成的每条记录的长度
     std::vector<Condition> fed_conds_;  // 同conds_，两个字段相同
+    std::vector<RmField> proj_fields_;  // 上层算子需要的列，为空表示需要整条记录
+
+    // 编译后的条件，与fed_conds_一一对应。类型相关的部分在构造时确定，页面上的存放方式在beginTuple时确定
+    struct CondField {
+        PredFunc func;                              // 按左右两侧类型和运算符特化的求值函数
+        size_t len;                                 // 左侧列的长度
+        size_t rhs_len;                             // 右侧列或常量的长度
+        const char *rhs_val = nullptr;              // 右侧常量的值，右侧为列时为nullptr
+        bool code_eq = false;                       // 字典编码的列与常量做等值或不等比较时直接比较编码
+        bool negate = false;                        // code_eq时为OP_NE
+        RmField lhs;                                // 左侧列在slot中的位置
+        RmField rhs;                                // 右侧列在slot中的位置，右侧为常量时无效
+        const RmDictionary *lhs_dict = nullptr;     // 左侧列的字典，没有使用字典编码时为nullptr
+        const RmDictionary *rhs_dict = nullptr;     // 右侧列的字典
+        int rhs_code = -1;                          // 右侧常量在左侧列字典中的编码，不在字典中时为-1
+        bool use_simd = false;                      // 批量扫描时用过滤内核求值，要求右侧为常量且左侧列没有字典编码
+        SimdFilter simd;
+    };
+    std::vector<CondField> cond_fields_;
+
+    // 并行扫描时一个morsel的扫描结果
+    struct MorselResult {
+        bool done = false;                                  // worker是否已经扫描完该morsel
+        int scanned = 0;                                    // 扫描过的记录个数
+        std::vector<Rid> rids;                              // 满足条件的记录号
+        std::vector<std::unique_ptr<RmRecord>> records;     // 满足条件的记录，与rids一一对应
+    };
+
+    // 并行扫描：表中的页面划分为morsel交给多个worker，worker各自过滤自己的页面，
+    // 结果按morsel的顺序输出，因此输出顺序与串行扫描相同。只有足够大的表才并行扫描，
+    // worker在第一次并行扫描时创建，重新beginTuple时继续使用，直到算子析构
+    bool allow_parallel_ = true;            // 作为连接的内侧反复扫描时不并行
+    size_t max_workers_ = std::min<size_t>(std::thread::hardware_concurrency(), SCAN_MAX_WORKERS);
+    bool parallel_ = false;
+    std::vector<RmMorsel> morsels_;
+    std::vector<RmZonePred> zone_preds_;    // 本次扫描中用于跳过页面的谓词
+    std::vector<MorselResult> results_;     // results_[i]为morsels_[i]的扫描结果
+    size_t next_morsel_ = 0;                // 下一个交给worker的morsel
+    size_t curr_morsel_ = 0;                // 当前正在输出的morsel
+    size_t curr_pos_ = 0;                   // 当前输出的记录在results_[curr_morsel_]中的下标
+    size_t max_pending_ = 0;                // 已经交给worker但还没有输出完的morsel个数上限，限制缓存的结果大小
+    size_t num_active_ = 0;                 // 正在扫描morsel的worker个数
+    bool stop_ = false;                     // 通知worker退出，只在析构时设置
+    std::exception_ptr error_;              // worker扫描时抛出的异常，由输出结果的线程重新抛出
+    std::mutex latch_;                      // 保护以上并行扫描的状态
+    std::condition_variable producer_cv_;   // 等待可以领取新的morsel
+    std::condition_variable consumer_cv_;   // 等待curr_morsel_扫描完毕，或者等待所有worker空闲
+    std::vector<std::thread> workers_;
 
     Rid rid_;
-    std::unique_ptr<RecScan> scan_;     // table_iterator
+    std::unique_ptr<RmScan> scan_;      // table_iterator
+
+    // 批量扫描的状态
+    bool at_match_ = false;             // scan_是否停在find_next_match找到的记录上，这条记录已经判断过条件
+    bool table_locked_ = false;         // 批量扫描直接从页面上读取记录，在表上加共享锁
+    std::vector<int> slots_;            // 当前页面上的候选slot，逐个条件过滤后只剩下满足所有条件的slot
 
     SmManager *sm_manager_;
 
    public:
-    SeqScanExecutor(SmManager *sm_manager, std::string tab_name, std::vector<Condition> conds, Context *context) {
+    SeqScanExecutor(SmManager *sm_manager, std::string tab_name, std::vector<Condition> conds, Context *context,
+                    const std::vector<TabCol> &proj_cols = {}, bool allow_parallel = true) {
         sm_manager_ = sm_manager;
+        allow_parallel_ = allow_parallel;
         tab_name_ = std::move(tab_name);
         conds_ = std::move(conds);
         TabMeta &tab = sm_manager_->db_.get_table(tab_name_);
@@ -45,8 +106,19 @@ class SeqScanExecutor : public AbstractExecutor {
         context_ = context;
 
         fed_conds_ = conds_;
+        compile_conds();
+
+        // 只有PAX布局才需要按列读取，行式布局下直接拷贝整条记录的代价更低
+        if (fh_->get_file_hdr().layout == RM_LAYOUT_PAX && proj_cols.size() < cols_.size()) {
+            for (auto &proj_col : proj_cols) {
+                auto col = get_col(cols_, proj_col);
+                proj_fields_.push_back({col->offset, col->len});
+            }
+        }
     }
 
+    ~SeqScanExecutor() { stop_workers(); }
+
     /*
         这里的beginTuple和nextTuple都是用来遍历所有的记录的,核心思想是找到满足条件的rid,并记录在数组中
     */
@@ -55,77 +127,325 @@ class SeqScanExecutor : public AbstractExecutor {
 
     std::string get_tableName() override{ return tab_name_ ;}
     
-    /* 这个函数的功能还没有太完善 */
-    // 比较当前条件是否满足
-    bool isTupleMatched(std::unique_ptr<RmRecord> &record, const Condition &cond) {
-        TabCol lhsCol = cond.lhs_col;
-        ColMeta lhsColMeta = *get_col(cols_, lhsCol);
-
-        Value lhsVal = fetchColumnValue(record, lhsColMeta);    // 获取左列上的值
-
-        if (cond.is_rhs_val) {
-            Value rhsVal = cond.rhs_val;
-            
-            return cmpVal(lhsVal, rhsVal, cond.op);
-        } else {
-            TabCol rhsCol = cond.rhs_col;
-            ColMeta rhsColMeta = *get_col(cols_, rhsCol);
-
-            /* 右边可能是一个值列表,但是这里先不用管 */
-            Value rhsVal = fetchColumnValue(record, rhsColMeta);
-            return cmpVal(lhsVal, rhsVal, cond.op);
+    // 直接在页面上判断slot_no处的记录是否满足条件，只读取条件中涉及的列
+    bool isTupleMatched(const RmPageHandle &page_handle, int slot_no, const CondField &field) {
+        const char *lhs_data = page_handle.get_field(slot_no, field.lhs);
+        if (field.code_eq) {
+            // 字典编码的列与常量的等值比较直接比较编码，常量不在字典中时不会有记录与之相等
+            return (RmDictionary::get_code(lhs_data) == field.rhs_code) != field.negate;
+        }
+        if (field.lhs_dict != nullptr) {
+            lhs_data = field.lhs_dict->decode(RmDictionary::get_code(lhs_data));
         }
-        return false;
+        const char *rhs_data = field.rhs_val;
+        if (rhs_data == nullptr) {
+            rhs_data = page_handle.get_field(slot_no, field.rhs);
+            if (field.rhs_dict != nullptr) {
+                rhs_data = field.rhs_dict->decode(RmDictionary::get_code(rhs_data));
+            }
+        }
+        return field.func(lhs_data, field.len, rhs_data, field.rhs_len);
     }
 
-    void beginTuple() override {
-        for (scan_ = std::make_unique<RmScan>(fh_); !scan_->is_end(); scan_->next()) {
-            // 检查当前记录是否满足条件 1.条件为空 2.满足fed_中的条件
-            rid_ = scan_->rid();
-            scan_record_cnt++;
-            auto record = fh_->get_record(rid_, context_);
-            if (fed_conds_.empty()) {
-                return ;
+    // 构造时编译条件：查找条件中的列，按类型和运算符选出求值函数，之后逐条记录判断时不再查找列
+    void compile_conds() {
+        cond_fields_.clear();
+        for (auto &cond : fed_conds_) {
+            CondField field;
+            auto lhs_col = get_col(cols_, cond.lhs_col);
+            ColType rhs_type = cond.is_rhs_val ? cond.rhs_val.type : get_col(cols_, cond.rhs_col)->type;
+            field.func = get_pred_func(lhs_col->type, rhs_type, cond.op);
+            field.len = lhs_col->len;
+            if (cond.is_rhs_val) {
+                field.rhs_val = cond.rhs_val.raw->data;
+                field.rhs_len = cond.rhs_val.raw->size;
+            } else {
+                field.rhs_len = get_col(cols_, cond.rhs_col)->len;
             }
-            bool flag = true;
-            for (auto& cond : fed_conds_) {
-                // 对比当前记录和所有的条件
-                if (!isTupleMatched(record, cond)) {
-                    flag = false;
-                    break ;
-                } 
+            cond_fields_.push_back(field);
+        }
+    }
+
+    // 计算每个条件中的列在页面上的位置，字典编码的列与常量比较时预先查出常量的编码
+    void init_cond_fields() {
+        for (size_t i = 0; i < fed_conds_.size(); i++) {
+            auto &cond = fed_conds_[i];
+            auto &field = cond_fields_[i];
+            auto lhs_col = get_col(cols_, cond.lhs_col);
+            field.lhs = fh_->get_slot_field({lhs_col->offset, lhs_col->len});
+            field.lhs_dict = fh_->get_dictionary({lhs_col->offset, lhs_col->len});
+            field.code_eq = false;
+            if (cond.is_rhs_val) {
+                if (field.lhs_dict != nullptr && cond.rhs_val.type == TYPE_STRING) {
+                    field.rhs_code = field.lhs_dict->find(cond.rhs_val.raw->data);
+                    field.code_eq = cond.op == OP_EQ || cond.op == OP_NE;
+                    field.negate = cond.op == OP_NE;
+                }
+            } else {
+                auto rhs_col = get_col(cols_, cond.rhs_col);
+                field.rhs = fh_->get_slot_field({rhs_col->offset, rhs_col->len});
+                field.rhs_dict = fh_->get_dictionary({rhs_col->offset, rhs_col->len});
             }
-            if (flag) break;
+            field.use_simd = cond.is_rhs_val && field.lhs_dict == nullptr &&
+                             make_simd_filter(lhs_col->type, lhs_col->len, cond.op, cond.rhs_val.type,
+                                              field.rhs_val, &field.simd);
         }
-        return ;
     }
 
-    void nextTuple() override {
-        for (scan_->next(); !scan_->is_end(); scan_->next()) {
+    // 从scan_当前的位置开始，找到第一条满足所有条件的记录
+    void find_next_match() {
+        for (; !scan_->is_end(); scan_->next()) {
             rid_ = scan_->rid();
             scan_record_cnt++;
-            auto record = fh_->get_record(rid_, context_);
-            if (fed_conds_.empty()) break;
+            RmPageHandle page_handle = scan_->page_handle();
             bool flag = true;
-            for (auto& cond : fed_conds_) {
+            for (size_t i = 0; i < fed_conds_.size(); i++) {
                 // 对比当前记录和所有的条件
-                if (!isTupleMatched(record, cond)) {
+                if (!isTupleMatched(page_handle, rid_.slot_no, cond_fields_[i])) {
                     flag = false;
                     break ;
                 } 
             }
             if (flag) break;
         }
-        return ;
+        at_match_ = !scan_->is_end();
     }
-    bool is_end() const override { return scan_->is_end(); };
+
+    // 从页面上读取slot_no处的记录，只需要部分列时只读取这些列
+    void read_slot(const RmPageHandle &page_handle, int slot_no, char *buf) {
+        if (!proj_fields_.empty()) {
+            fh_->read_fields(page_handle, slot_no, proj_fields_, buf);
+        } else {
+            fh_->read_record(page_handle, slot_no, buf);
+        }
+    }
+
+    // 从条件中提取可以用zone map判断的谓词，只考虑数值列与同类型常量的比较
+    std::vector<RmZonePred> get_zone_preds() {
+        std::vector<RmZonePred> zone_preds;
+        const RmZoneMap *zone_map = nullptr;
+        for (auto &cond : fed_conds_) {
+            if (!cond.is_rhs_val) continue;
+            auto col = get_col(cols_, cond.lhs_col);
+            if (col->type == TYPE_STRING || cond.rhs_val.type != col->type) continue;
+            // 只有存在可用的谓词时才建立zone map
+            if (zone_map == nullptr && (zone_map = fh_->get_zone_map()) == nullptr) break;
+            int col_idx = zone_map->get_col_idx(col->offset);
+            if (col_idx < 0) continue;
+            double val = col->type == TYPE_INT ? cond.rhs_val.int_val : cond.rhs_val.float_val;
+            zone_preds.push_back({col_idx, cond.op, val});
+        }
+        return zone_preds;
+    }
+
+    // worker的执行函数：不断领取当前扫描的morsel，过滤其中的记录并把结果交给输出结果的线程，直到算子析构
+    void scan_morsels() {
+        std::unique_lock<std::mutex> lock(latch_);
+        while (true) {
+            producer_cv_.wait(lock, [&] {
+                return stop_ || (next_morsel_ < morsels_.size() && next_morsel_ < curr_morsel_ + max_pending_);
+            });
+            if (stop_) return;
+            size_t morsel_idx = next_morsel_++;
+            RmMorsel morsel = morsels_[morsel_idx];
+            num_active_++;
+            lock.unlock();
+
+            // 有worker在扫描时beginTuple不会修改zone_preds_和results_
+            MorselResult result;
+            std::exception_ptr error;
+            try {
+                for (RmScan scan(fh_, morsel, zone_preds_); !scan.is_end(); scan.next()) {
+                    result.scanned++;
+                    RmPageHandle page_handle = scan.page_handle();
+                    int slot_no = scan.rid().slot_no;
+                    bool flag = true;
+                    for (size_t i = 0; i < fed_conds_.size() && flag; i++) {
+                        flag = isTupleMatched(page_handle, slot_no, cond_fields_[i]);
+                    }
+                    if (!flag) continue;
+                    auto record = std::make_unique<RmRecord>(len_);
+                    read_slot(page_handle, slot_no, record->data);
+                    result.rids.push_back(scan.rid());
+                    result.records.push_back(std::move(record));
+                }
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+            num_active_--;
+            if (error != nullptr) {
+                // 不再领取本次扫描剩余的morsel，由输出结果的线程重新抛出异常
+                error_ = error;
+                next_morsel_ = morsels_.size();
+            } else {
+                result.done = true;
+                results_[morsel_idx] = std::move(result);
+            }
+            consumer_cv_.notify_one();
+        }
+    }
+
+    // 并行扫描时从curr_morsel_的curr_pos_开始，找到下一条满足条件的记录，必要时等待worker扫描完毕
+    void wait_parallel_match() {
+        std::unique_lock<std::mutex> lock(latch_);
+        while (curr_morsel_ < morsels_.size()) {
+            consumer_cv_.wait(lock, [&] { return error_ != nullptr || results_[curr_morsel_].done; });
+            if (error_ != nullptr) {
+                std::rethrow_exception(error_);
+            }
+            auto &result = results_[curr_morsel_];
+            if (curr_pos_ < result.rids.size()) {
+                rid_ = result.rids[curr_pos_];
+                return;
+            }
+            // 当前morsel已经输出完毕，释放其结果，worker可以继续领取新的morsel
+            scan_record_cnt += result.scanned;
+            result = MorselResult();
+            curr_morsel_++;
+            curr_pos_ = 0;
+            producer_cv_.notify_all();
+        }
+    }
+
+    // 结束上一次并行扫描：不再分配新的morsel，等待正在扫描的worker完成
+    void finish_parallel_scan() {
+        std::unique_lock<std::mutex> lock(latch_);
+        next_morsel_ = morsels_.size();
+        consumer_cv_.wait(lock, [&] { return num_active_ == 0; });
+    }
+
+    void stop_workers() {
+        {
+            std::lock_guard<std::mutex> lock(latch_);
+            stop_ = true;
+        }
+        producer_cv_.notify_all();
+        for (auto &worker : workers_) {
+            worker.join();
+        }
+        workers_.clear();
+    }
+
+    void beginTuple() override {
+        finish_parallel_scan();
+        init_cond_fields();
+        auto zone_preds = get_zone_preds();
+        // 表中的页面太少时并行的收益不足以抵消线程同步的开销
+        parallel_ = allow_parallel_ && max_workers_ > 1 && fh_->get_file_hdr().num_pages >= SCAN_PARALLEL_MIN_PAGES;
+        if (!parallel_) {
+            scan_ = std::make_unique<RmScan>(fh_, zone_preds);
+            find_next_match();
+            return;
+        }
+        // worker直接从页面上读取记录，因此在表上加共享锁，而不是逐条记录加锁
+        if (context_ != nullptr) {
+            context_->lock_mgr_->lock_shared_on_table(context_->txn_, fh_->GetFd());
+        }
+        size_t num_workers = max_workers_;
+        {
+            std::lock_guard<std::mutex> lock(latch_);
+            zone_preds_ = std::move(zone_preds);
+            morsels_ = fh_->get_morsels(SCAN_MORSEL_SIZE);
+            num_workers = std::min(num_workers, morsels_.size());
+            results_ = std::vector<MorselResult>(morsels_.size());
+            next_morsel_ = curr_morsel_ = curr_pos_ = 0;
+            max_pending_ = 2 * num_workers;
+            error_ = nullptr;
+        }
+        while (workers_.size() < num_workers) {
+            workers_.emplace_back([this] { scan_morsels(); });
+        }
+        producer_cv_.notify_all();
+        wait_parallel_match();
+    }
+
+    void nextTuple() override {
+        if (parallel_) {
+            curr_pos_++;
+            wait_parallel_match();
+            return;
+        }
+        scan_->next();
+        find_next_match();
+    }
+
+    bool is_end() const override { return parallel_ ? curr_morsel_ == morsels_.size() : scan_->is_end(); };
 
     std::unique_ptr<RmRecord> Next() override {
-        
-        return fh_->get_record(rid_, context_);;
+        if (parallel_) {
+            // 复制结果，重复调用Next()时仍然返回当前记录
+            return std::make_unique<RmRecord>(*results_[curr_morsel_].records[curr_pos_]);
+        }
+        if (!proj_fields_.empty()) {
+            return fh_->get_record(rid_, proj_fields_, context_);
+        }
+        return fh_->get_record(rid_, context_);
+    }
+
+    /**
+     * @description: 批量扫描，串行扫描时每次取出当前页面上的一组候选slot，按条件依次过滤选择向量，
+     * 列与常量的数值比较和字符串等值比较使用过滤内核，最后只读取满足所有条件的记录；并行扫描时直接复制worker的结果。beginTuple之后不能再与逐条接口混用
+     */
+    bool NextBatch(RecordBatch *batch) override {
+        batch->reset(len_);
+        if (parallel_) {
+            while (!batch->full() && curr_morsel_ < morsels_.size()) {
+                auto &records = results_[curr_morsel_].records;
+                for (; curr_pos_ < records.size() && !batch->full(); curr_pos_++) {
+                    memcpy(batch->append(), records[curr_pos_]->data, len_);
+                }
+                wait_parallel_match();
+            }
+            return !batch->empty();
+        }
+
+        if (context_ != nullptr && !table_locked_) {
+            context_->lock_mgr_->lock_shared_on_table(context_->txn_, fh_->GetFd());
+            table_locked_ = true;
+        }
+        if (at_match_) {
+            read_slot(scan_->page_handle(), scan_->rid().slot_no, batch->append());
+            at_match_ = false;
+            scan_->next();
+        }
+        int num_slots = fh_->get_file_hdr().num_records_per_page;
+        while (!batch->full() && !scan_->is_end()) {
+            RmPageHandle page_handle = scan_->page_handle();
+            slots_.clear();
+            size_t room = batch->room();
+            for (int slot_no = scan_->rid().slot_no; slot_no < num_slots && slots_.size() < room;
+                 slot_no = Bitmap::next_bit(true, page_handle.bitmap, num_slots, slot_no)) {
+                slots_.push_back(slot_no);
+            }
+            scan_record_cnt += slots_.size();
+            int last_slot = slots_.back();
+            for (size_t i = 0; i < fed_conds_.size() && !slots_.empty(); i++) {
+                auto &field = cond_fields_[i];
+                if (field.use_simd) {
+                    const char *base = page_handle.get_field(0, field.lhs);
+                    size_t stride = page_handle.field_stride(field.lhs);
+                    slots_.resize(simd_filter(field.simd, base, stride, slots_.data(), slots_.size()));
+                    continue;
+                }
+                size_t num_matched = 0;
+                for (int slot_no : slots_) {
+                    if (isTupleMatched(page_handle, slot_no, field)) {
+                        slots_[num_matched++] = slot_no;
+                    }
+                }
+                slots_.resize(num_matched);
+            }
+            for (int slot_no : slots_) {
+                read_slot(page_handle, slot_no, batch->append());
+            }
+            scan_->skip(last_slot);
+        }
+        return !batch->empty();
     }
 
     Rid &rid() override { return rid_; }
 
     const std::vector<ColMeta> &cols() const override { return cols_; }
-};
\ No newline at end of file
+};
@@ -24,6 +24,52 @@ class UpdateExecutor : public AbstractExecutor {
     std::string tab_name_;
     std::vector<SetClause> set_clauses_;
     SmManager *sm_manager_;
+    std::vector<RmField> set_fields_;   // set子句修改的字段
+    std::unique_ptr<RmRecord> set_buf_; // 按记录格式存放的set子句的新值，只有set_fields_对应的部分有效
+
+    // 旧记录按set子句修改之后的新记录
+    std::unique_ptr<RmRecord> make_new_record(const RmRecord &old_rec) {
+        auto new_rec = std::make_unique<RmRecord>(old_rec);
+        for (auto &field : set_fields_) {
+            memcpy(new_rec->data + field.offset, set_buf_->data + field.offset, field.len);
+        }
+        return new_rec;
+    }
+
+    /**
+     * @description: 为一条记录实际发生的修改写update日志，并用日志的LSN标记记录所在的页面
+     */
+    void log_update(const Rid &rid, const RmRecordDelta &delta) {
+        if (delta.empty() || context_ == nullptr || context_->log_mgr_ == nullptr || context_->txn_ == nullptr) {
+            return;
+        }
+        UpdateLogRecord log_record(context_->txn_->get_transaction_id(), delta, rid, tab_name_);
+        log_record.prev_lsn_ = context_->txn_->get_prev_lsn();
+        lsn_t lsn = context_->log_mgr_->add_log_to_buffer(&log_record);
+        context_->txn_->set_prev_lsn(lsn);
+        fh_->set_page_lsn(rid.page_no, lsn);
+    }
+
+    /**
+     * @description: 撤销一条记录的修改：前num_indexes个索引中删除新key、插回旧key，再把记录中的字段恢复为旧值，
+     * 恢复旧值同样写update日志
+     */
+    void undo_update(const std::vector<IndexMeta *> &indexes, size_t num_indexes, const Rid &rid,
+                     const RmRecord *old_rec) {
+        Transaction *txn = context_ == nullptr ? nullptr : context_->txn_;
+        auto new_rec = make_new_record(*old_rec);
+        for (size_t j = 0; j < num_indexes; j++) {
+            auto index = indexes[j];
+            std::vector<char> old_key(index->col_tot_len), new_key(index->col_tot_len);
+            index->get_key(old_rec->data, old_key.data());
+            index->get_key(new_rec->data, new_key.data());
+            if (old_key != new_key) {
+                sm_manager_->delete_index_entry(tab_name_, *index, new_key.data(), rid, txn);
+                sm_manager_->insert_index_entry(tab_name_, *index, old_key.data(), rid, txn);
+            }
+        }
+        log_update(rid, fh_->update_fields(rid, set_fields_, old_rec->data, context_));
+    }
 
    public:
     UpdateExecutor(SmManager *sm_manager, const std::string &tab_name, std::vector<SetClause> set_clauses,
@@ -36,6 +82,25 @@ class UpdateExecutor : public AbstractExecutor {
         conds_ = conds;
         rids_ = rids;
         context_ = context;
+
+        // set子句的值对所有记录都相同，只需要计算一次
+        set_buf_ = std::make_unique<RmRecord>(fh_->get_file_hdr().record_size);
+        for (auto &clause : set_clauses_) {
+            auto rhs_val = clause.rhs;
+            auto lhs_col = tab_.get_col(clause.lhs.col_name);
+
+            // 考虑 int <=> float相互转换
+            if (rhs_val.type != lhs_col->type) {
+                if (rhs_val.type == TYPE_INT) {
+                    rhs_val.set_float((float)rhs_val.int_val);
+                } else if (rhs_val.type == TYPE_FLOAT) {
+                    rhs_val.set_int((int)rhs_val.float_val);
+                }
+            }
+            rhs_val.init_raw(lhs_col->len);
+            memcpy(set_buf_->data + lhs_col->offset, rhs_val.raw->data, lhs_col->len);
+            set_fields_.push_back({lhs_col->offset, lhs_col->len});
+        }
     }
     /**
      *  rids_已经是根据where条件筛选后的记录元数据
@@ -43,32 +108,56 @@ class UpdateExecutor : public AbstractExecutor {
     std::unique_ptr<RmRecord> Next() override {
         /** update操作的逻辑
          *  首先rids_是已经根据where条件筛选出来的记录元数据,我们的目的是将筛选出来的每个记录中对应列的数据修改为set的新值
+         *  只在页面上原地修改set子句涉及的字段，每修改一条记录就根据实际发生变化的字段写update日志
          */
+        // 持有表的写latch期间索引不会被建立、重建或删除，构造执行器之后索引可能已经发生了变化
+        std::shared_lock tab_latch{sm_manager_->get_table_latch(tab_name_)};
+        tab_.indexes = sm_manager_->db_.get_table(tab_name_).indexes;
+        // 只有包含被修改字段的索引需要维护
+        std::vector<IndexMeta *> indexes;
+        for (auto &index : tab_.indexes) {
+            for (auto &col : index.cols) {
+                if (std::any_of(set_fields_.begin(), set_fields_.end(),
+                                [&](const RmField &field) { return field.offset == col.offset; })) {
+                    indexes.push_back(&index);
+                    break;
+                }
+            }
+        }
+        Transaction *txn = context_ == nullptr ? nullptr : context_->txn_;
+        // 已经修改的记录，唯一索引冲突时用旧记录撤销；每条记录修改之后立即写日志
+        std::vector<std::unique_ptr<RmRecord>> old_recs(rids_.size());
+        std::vector<RmRecordDelta> deltas(rids_.size());
         for (size_t i = 0; i < rids_.size(); i++) {
-            std::unique_ptr<RmRecord> record = fh_->get_record(rids_[i], context_);
-
-            for (auto clause : set_clauses_) {
-                auto rhs_val = clause.rhs;
-                auto lhs_col = tab_.get_col(clause.lhs.col_name);
-                
-                // 考虑 int <=> float相互转换
-                if (rhs_val.type != lhs_col->type) {
-                    if (rhs_val.type == TYPE_INT) {
-                        rhs_val.float_val = rhs_val.int_val;
-                    } else if (rhs_val.type == TYPE_FLOAT) {
-                        rhs_val.int_val = rhs_val.float_val;
-                    }
+            if (!indexes.empty()) {
+                old_recs[i] = fh_->get_record(rids_[i], context_);
+            }
+            deltas[i] = fh_->update_fields(rids_[i], set_fields_, set_buf_->data, context_);
+            log_update(rids_[i], deltas[i]);
+            if (indexes.empty() || deltas[i].empty()) {
+                continue;
+            }
+            auto new_rec = make_new_record(*old_recs[i]);
+            for (size_t j = 0; j < indexes.size(); j++) {
+                auto index = indexes[j];
+                std::vector<char> old_key(index->col_tot_len), new_key(index->col_tot_len);
+                index->get_key(old_recs[i]->data, old_key.data());
+                index->get_key(new_rec->data, new_key.data());
+                if (old_key == new_key) {
+                    continue;
                 }
-                // 这里默认lhs_col->type 和 rhs_val.type 相同
-                if (lhs_col->type == TYPE_STRING) {
-                    memcpy(record->data + lhs_col->offset, rhs_val.str_val.c_str(), lhs_col->len);
-                } else if (lhs_col->type == TYPE_INT) {
-                    memcpy(record->data + lhs_col->offset, &rhs_val.int_val, lhs_col->len);
-                } else {
-                    memcpy(record->data + lhs_col->offset, &rhs_val.float_val, lhs_col->len);
+                sm_manager_->delete_index_entry(tab_name_, *index, old_key.data(), rids_[i], txn);
+                if (!sm_manager_->insert_index_entry(tab_name_, *index, new_key.data(), rids_[i], txn)) {
+                    sm_manager_->insert_index_entry(tab_name_, *index, old_key.data(), rids_[i], txn);
+                    undo_update(indexes, j, rids_[i], old_recs[i].get());
+                    for (size_t k = i; k-- > 0;) {
+                        if (!deltas[k].empty()) {
+                            undo_update(indexes, indexes.size(), rids_[k], old_recs[k].get());
+                        }
+                    }
+                    throw UniqueViolationError(tab_name_, index->get_col_names());
                 }
             }
-            fh_->update_record(rids_[i], record->data, context_);
         }
         return nullptr;
     }
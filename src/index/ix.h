@@ -10,5 +10,8 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include "ix_hash_index.h"
 #include "ix_scan.h"
 #include "ix_manager.h"
+#include "ix_search.h"
+#include "ix_sorter.h"
@@ -22,6 +22,18 @@ constexpr int IX_INIT_ROOT_PAGE = 2;
 constexpr int IX_INIT_NUM_PAGES = 3;
 constexpr int IX_MAX_COL_LEN = 512;
 
+// 索引文件格式的版本，记录在IxFileHdr的最后；没有版本号的旧文件视为IX_FORMAT_RAW
+constexpr int IX_FORMAT_RAW = 0;            // key按照记录中的原始格式存放，用ix_compare逐个字段比较
+constexpr int IX_FORMAT_NORMALIZED = 1;     // key编码为可以直接用memcmp比较的格式（见ix_encode_key）
+constexpr int IX_FORMAT_COMPRESSED = 2;     // 在NORMALIZED的基础上压缩结点中的key（见IxKeyFmt），内部结点的key为截断后的分隔key
+// 非唯一索引在文件头的版本号中记录这一位，旧文件没有这一位，都是唯一索引
+constexpr int IX_NONUNIQUE_FLAG = 1 << 16;
+
+class IxFileHdr;
+
+// 结点内的查找函数，返回keys[lo, hi)中第一个>=target（lower_bound）或>target（upper_bound）的下标，不存在时返回hi
+using IxSearchFunc = int (*)(const char *keys, int lo, int hi, const char *target, const IxFileHdr *file_hdr);
+
 class IxFileHdr {
 public: 
     page_id_t first_free_page_no_;      // 文件中第一个空闲的磁盘页面的页面号
@@ -31,12 +43,17 @@ public:
     std::vector<ColType> col_types_;    // 字段的类型
     std::vector<int> col_lens_;         // 字段的长度
     int col_tot_len_;                   // 索引包含的字段的总长度
-    int btree_order_;                   // # children per page 每个结点最多可插入的键值对数量
+    int btree_order_;                   // # children per page 每个结点最多可插入的键值对数量（压缩格式见IxNodeHandle::get_max_size）
     int keys_size_;                     // keys_size = (btree_order + 1) * col_tot_len
     // first_leaf初始化之后没有进行修改，只不过是在测试文件中遍历叶子结点的时候用了
     page_id_t first_leaf_;              // 首叶节点对应的页号，在上层IxManager的open函数进行初始化，初始化为root page_no
     page_id_t last_leaf_;               // 尾叶节点对应的页号
     int tot_len_;                       // 记录结构体的整体长度
+    int version_ = IX_FORMAT_NORMALIZED;  // 索引文件格式的版本
+    bool unique_ = true;                // 唯一索引中重复的key只保留第一个；非唯一索引中重复key的rid存放在posting list中
+    // 以下两个查找函数不写入磁盘，打开索引时根据col_types_选择一次（见ix_search.h）
+    IxSearchFunc lower_bound_ = nullptr;
+    IxSearchFunc upper_bound_ = nullptr;
 
     IxFileHdr() {
         tot_len_ = col_num_ = 0;
@@ -53,6 +70,7 @@ public:
         tot_len_ = 0;
         tot_len_ += sizeof(page_id_t) * 4 + sizeof(int) * 6;
         tot_len_ += sizeof(ColType) * col_num_ + sizeof(int) * col_num_;
+        tot_len_ += sizeof(int);
     }
 
     void serialize(char* dest) {
@@ -85,6 +103,9 @@ public:
         offset += sizeof(page_id_t);
         memcpy(dest + offset, &last_leaf_, sizeof(page_id_t));
         offset += sizeof(page_id_t);
+        int version = version_ | (unique_ ? 0 : IX_NONUNIQUE_FLAG);
+        memcpy(dest + offset, &version, sizeof(int));
+        offset += sizeof(int);
         assert(offset == tot_len_);
     }
 
@@ -100,7 +121,6 @@ public:
         offset += sizeof(page_id_t);
         col_num_ = *reinterpret_cast<const int*>(src + offset);
         offset += sizeof(int);
-        std::cout << col_num_ << "\n";
         for(int i = 0; i < col_num_; ++i) {
             // col_types_[i] = *reinterpret_cast<const ColType*>(src + offset);
             ColType type = *reinterpret_cast<const ColType*>(src + offset);
@@ -123,6 +143,15 @@ public:
         offset += sizeof(page_id_t);
         last_leaf_ = *reinterpret_cast<const page_id_t*>(src + offset);
         offset += sizeof(page_id_t);
+        // 旧的索引文件中没有版本号
+        version_ = IX_FORMAT_RAW;
+        unique_ = true;
+        if (offset < tot_len_) {
+            version_ = *reinterpret_cast<const int*>(src + offset);
+            offset += sizeof(int);
+            unique_ = !(version_ & IX_NONUNIQUE_FLAG);
+            version_ &= ~IX_NONUNIQUE_FLAG;
+        }
         assert(offset == tot_len_);
     }
 };
@@ -137,6 +166,16 @@ public:
     page_id_t next_leaf;            // next leaf node's page_no, effective only when is_leaf is true
 };
 
+/**
+ * IX_FORMAT_COMPRESSED格式的结点在IxPageHdr之后依次存放：IxKeyFmt、公共前缀、num_key个定长的key、num_key个rid
+ * 结点中所有key的前prefix_len个字节相同，只存放一次；每个key只存放[prefix_len, prefix_len + key_len)的字节，
+ * 之后的字节都是0（字符串末尾填充的0，或者截断后的分隔key）
+ */
+struct IxKeyFmt {
+    uint16_t prefix_len;
+    uint16_t key_len;
+};
+
 class Iid {
 public:
     int page_no;
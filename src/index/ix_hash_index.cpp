@@ -0,0 +1,250 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "ix_hash_index.h"
+
+#include <mutex>
+
+IxHashIndexHandle::IxHashIndexHandle(DiskManager *disk_manager, BufferPoolManager *buffer_pool_manager, int fd)
+    : disk_manager_(disk_manager), buffer_pool_manager_(buffer_pool_manager), fd_(fd) {
+    Page *hdr_page = fetch_bucket(IX_FILE_HDR_PAGE);
+    memcpy(&file_hdr_, hdr_page->get_data(), sizeof(IxHashFileHdr));
+    auto dir_page_nos = reinterpret_cast<const page_id_t *>(hdr_page->get_data() + sizeof(IxHashFileHdr));
+    dir_pages_.assign(dir_page_nos, dir_page_nos + file_hdr_.num_dir_pages);
+    buffer_pool_manager_->unpin_page(hdr_page->get_page_id(), false);
+    // 文件中的页面都已经分配给桶或者目录，新的页面分配在文件末尾
+    disk_manager_->set_fd2pageno(fd, file_hdr_.num_pages);
+
+    dir_.resize(1ULL << file_hdr_.global_depth);
+    for (size_t i = 0; i < dir_.size(); i += IX_HASH_DIR_ENTRIES_PER_PAGE) {
+        Page *page = fetch_bucket(dir_pages_[i / IX_HASH_DIR_ENTRIES_PER_PAGE]);
+        size_t n = std::min(dir_.size() - i, (size_t)IX_HASH_DIR_ENTRIES_PER_PAGE);
+        memcpy(dir_.data() + i, page->get_data(), n * sizeof(page_id_t));
+        buffer_pool_manager_->unpin_page(page->get_page_id(), false);
+    }
+}
+
+/**
+ * @description: 查找key对应的rid
+ * @return {bool} key是否存在
+ * @param {char*} key 要查找的key
+ * @param {vector<Rid>*} result 存在时将rid加入result
+ * @param {Transaction*} transaction 事务指针
+ */
+bool IxHashIndexHandle::get_value(const char *key, std::vector<Rid> *result, Transaction *transaction) {
+    uint64_t hash = ix_hash_key(key, file_hdr_.col_tot_len);
+    std::shared_lock lock(dir_latch_);
+    Page *page = fetch_bucket(bucket_page_no(hash));
+    page->rlatch();
+    int pos = find_in_bucket(page, key);
+    if (pos >= 0) {
+        result->push_back(*get_bucket_rid(page, pos));
+    }
+    page->runlatch();
+    buffer_pool_manager_->unpin_page(page->get_page_id(), false);
+    return pos >= 0;
+}
+
+/**
+ * @description: 插入键值对，key已经存在时不插入
+ * @return {page_id_t} 插入的桶所在的页面号，key已经存在时返回IX_NO_PAGE
+ * @param {char*} key 要插入的key
+ * @param {Rid&} value 要插入的rid
+ * @param {Transaction*} transaction 事务指针
+ */
+page_id_t IxHashIndexHandle::insert_entry(const char *key, const Rid &value, Transaction *transaction) {
+    uint64_t hash = ix_hash_key(key, file_hdr_.col_tot_len);
+    // 先只对目录加读锁，桶未满时直接插入
+    {
+        std::shared_lock lock(dir_latch_);
+        page_id_t page_no = bucket_page_no(hash);
+        Page *page = fetch_bucket(page_no);
+        page->wlatch();
+        int pos = find_in_bucket(page, key);
+        bool full = get_bucket_hdr(page)->num_entries == file_hdr_.bucket_capacity;
+        if (pos < 0 && !full) {
+            append_to_bucket(page, key, value);
+        }
+        page->wunlatch();
+        buffer_pool_manager_->unpin_page(page->get_page_id(), pos < 0 && !full);
+        if (pos >= 0) return IX_NO_PAGE;
+        if (!full) return page_no;
+    }
+
+    // 桶已满，对目录加写锁后分裂，此时没有其他线程访问任何桶；释放读锁期间其他线程可能已经分裂了这个桶
+    std::unique_lock lock(dir_latch_);
+    while (true) {
+        Page *page = fetch_bucket(bucket_page_no(hash));
+        page_id_t page_no = page->get_page_id().page_no;
+        if (find_in_bucket(page, key) >= 0) {
+            buffer_pool_manager_->unpin_page(page->get_page_id(), false);
+            return IX_NO_PAGE;
+        }
+        if (get_bucket_hdr(page)->num_entries < file_hdr_.bucket_capacity) {
+            append_to_bucket(page, key, value);
+            buffer_pool_manager_->unpin_page(page->get_page_id(), true);
+            return page_no;
+        }
+        // 分裂后桶中的key可能仍然全部在同一侧，需要继续分裂
+        split_bucket(page);
+        buffer_pool_manager_->unpin_page(page->get_page_id(), true);
+    }
+}
+
+/**
+ * @description: 删除key对应的键值对
+ * @return {bool} key是否存在
+ * @param {char*} key 要删除的key
+ * @param {Transaction*} transaction 事务指针
+ */
+bool IxHashIndexHandle::delete_entry(const char *key, Transaction *transaction) {
+    uint64_t hash = ix_hash_key(key, file_hdr_.col_tot_len);
+    std::shared_lock lock(dir_latch_);
+    Page *page = fetch_bucket(bucket_page_no(hash));
+    page->wlatch();
+    int pos = find_in_bucket(page, key);
+    if (pos >= 0) {
+        // 桶中的键值对无序，用最后一个键值对填补删除的位置
+        auto hdr = get_bucket_hdr(page);
+        int last = --hdr->num_entries;
+        memcpy(get_bucket_key(page, pos), get_bucket_key(page, last), file_hdr_.col_tot_len);
+        *get_bucket_rid(page, pos) = *get_bucket_rid(page, last);
+    }
+    page->wunlatch();
+    buffer_pool_manager_->unpin_page(page->get_page_id(), pos >= 0);
+    return pos >= 0;
+}
+
+Page *IxHashIndexHandle::fetch_bucket(page_id_t page_no) const {
+    Page *page = buffer_pool_manager_->fetch_page(PageId{fd_, page_no});
+    if (page == nullptr) {
+        throw InternalError("IxHashIndexHandle::fetch_bucket: buffer pool is full");
+    }
+    return page;
+}
+
+/* 返回key在桶中的下标，不存在时返回-1 */
+int IxHashIndexHandle::find_in_bucket(Page *page, const char *key) const {
+    int n = get_bucket_hdr(page)->num_entries;
+    for (int i = 0; i < n; i++) {
+        if (memcmp(get_bucket_key(page, i), key, file_hdr_.col_tot_len) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void IxHashIndexHandle::append_to_bucket(Page *page, const char *key, const Rid &value) const {
+    auto hdr = get_bucket_hdr(page);
+    memcpy(get_bucket_key(page, hdr->num_entries), key, file_hdr_.col_tot_len);
+    *get_bucket_rid(page, hdr->num_entries) = value;
+    hdr->num_entries++;
+}
+
+/* 在文件末尾分配一个新的页面，返回的页面已经pin住，调用者需要持有目录的写锁 */
+Page *IxHashIndexHandle::new_page() {
+    PageId page_id = {.fd = fd_, .page_no = INVALID_PAGE_ID};
+    Page *page = buffer_pool_manager_->new_page(&page_id);
+    if (page == nullptr) {
+        throw InternalError("IxHashIndexHandle::new_page: buffer pool is full");
+    }
+    file_hdr_.num_pages = std::max(file_hdr_.num_pages, page_id.page_no + 1);
+    return page;
+}
+
+/**
+ * @description: 将桶分裂为两个，哈希值第local_depth位为1的键值对移动到新的桶中，调用者需要持有目录的写锁
+ * 修改过的目录页面和文件头通过缓冲池写出
+ * @param {Page*} page 要分裂的桶页面
+ */
+void IxHashIndexHandle::split_bucket(Page *page) {
+    auto hdr = get_bucket_hdr(page);
+    int depth = hdr->local_depth;
+    if (depth == file_hdr_.global_depth) {
+        if (depth == IX_HASH_MAX_DEPTH) {
+            throw InternalError("IxHashIndexHandle::split_bucket: directory is too large");
+        }
+        // 目录扩大一倍，新的一半与原来的一半指向相同的桶，放不下时分配新的目录页面
+        size_t n = dir_.size();
+        dir_.resize(n * 2);
+        std::copy(dir_.begin(), dir_.begin() + n, dir_.begin() + n);
+        file_hdr_.global_depth++;
+        while ((size_t)dir_pages_.size() * IX_HASH_DIR_ENTRIES_PER_PAGE < dir_.size()) {
+            Page *dir_page = new_page();
+            dir_pages_.push_back(dir_page->get_page_id().page_no);
+            buffer_pool_manager_->unpin_page(dir_page->get_page_id(), true);
+        }
+        file_hdr_.num_dir_pages = dir_pages_.size();
+        write_dir(n, n * 2);
+    }
+
+    Page *bucket = new_page();
+    page_id_t new_page_no = bucket->get_page_id().page_no;
+    file_hdr_.num_buckets++;
+    auto new_hdr = get_bucket_hdr(bucket);
+    new_hdr->local_depth = hdr->local_depth = depth + 1;
+    new_hdr->num_entries = 0;
+
+    int n = hdr->num_entries, kept = 0;
+    for (int i = 0; i < n; i++) {
+        const char *key = get_bucket_key(page, i);
+        Rid rid = *get_bucket_rid(page, i);
+        if (ix_hash_key(key, file_hdr_.col_tot_len) >> depth & 1) {
+            append_to_bucket(bucket, key, rid);
+        } else {
+            // 留在原桶中的键值对依次前移
+            if (kept != i) {
+                memcpy(get_bucket_key(page, kept), key, file_hdr_.col_tot_len);
+                *get_bucket_rid(page, kept) = rid;
+            }
+            kept++;
+        }
+    }
+    hdr->num_entries = kept;
+    buffer_pool_manager_->unpin_page(bucket->get_page_id(), true);
+
+    // 指向原桶且第depth位为1的目录项改为指向新的桶，只写出包含这些目录项的目录页面
+    page_id_t page_no = page->get_page_id().page_no;
+    for (size_t begin = 0; begin < dir_.size(); begin += IX_HASH_DIR_ENTRIES_PER_PAGE) {
+        size_t end = std::min(dir_.size(), begin + IX_HASH_DIR_ENTRIES_PER_PAGE);
+        bool changed = false;
+        for (size_t i = begin; i < end; i++) {
+            if (dir_[i] == page_no && (i >> depth & 1)) {
+                dir_[i] = new_page_no;
+                changed = true;
+            }
+        }
+        if (changed) {
+            write_dir(begin, end);
+        }
+    }
+    write_file_hdr();
+}
+
+/* 通过缓冲池将目录项[begin, end)写入对应的目录页面 */
+void IxHashIndexHandle::write_dir(size_t begin, size_t end) {
+    while (begin < end) {
+        size_t page_idx = begin / IX_HASH_DIR_ENTRIES_PER_PAGE;
+        size_t page_end = std::min(end, (page_idx + 1) * IX_HASH_DIR_ENTRIES_PER_PAGE);
+        Page *page = fetch_bucket(dir_pages_[page_idx]);
+        memcpy(page->get_data() + (begin % IX_HASH_DIR_ENTRIES_PER_PAGE) * sizeof(page_id_t), dir_.data() + begin,
+               (page_end - begin) * sizeof(page_id_t));
+        buffer_pool_manager_->unpin_page(page->get_page_id(), true);
+        begin = page_end;
+    }
+}
+
+/* 通过缓冲池将文件头和目录页面的页面号写入第0页 */
+void IxHashIndexHandle::write_file_hdr() {
+    Page *page = fetch_bucket(IX_FILE_HDR_PAGE);
+    memcpy(page->get_data(), &file_hdr_, sizeof(IxHashFileHdr));
+    memcpy(page->get_data() + sizeof(IxHashFileHdr), dir_pages_.data(), dir_pages_.size() * sizeof(page_id_t));
+    buffer_pool_manager_->unpin_page(page->get_page_id(), true);
+}
@@ -0,0 +1,139 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <shared_mutex>
+#include <vector>
+
+#include "ix_defs.h"
+#include "transaction/transaction.h"
+
+constexpr int IX_HASH_INIT_BUCKET_PAGE = 1;
+constexpr int IX_HASH_INIT_DIR_PAGE = 2;
+constexpr int IX_HASH_INIT_NUM_PAGES = 3;
+constexpr int IX_HASH_DIR_ENTRIES_PER_PAGE = PAGE_SIZE / sizeof(page_id_t);  // 每个目录页面存放的目录项个数
+constexpr int IX_HASH_MAX_DEPTH = 19;       // 目录最多有2^19项，需要512个目录页面
+
+/* 计算key的哈希值，结果写入磁盘上的目录，不能依赖std::hash的实现 */
+inline uint64_t ix_hash_key(const char *key, int len) {
+    uint64_t h = 0x9e3779b97f4a7c15ULL ^ (uint64_t)len;
+    for (int i = 0; i < len; i += 8) {
+        uint64_t w = 0;
+        memcpy(&w, key + i, std::min(8, len - i));
+        h = (h ^ w) * 0xff51afd7ed558ccdULL;
+        h ^= h >> 32;
+    }
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+/* 哈希索引文件的第0页，之后紧接着存放num_dir_pages个目录页面的页面号 */
+struct IxHashFileHdr {
+    int num_pages;          // 文件中已经分配的页面数量（包括第0页、桶页面和目录页面）
+    int num_buckets;        // 桶的数量
+    int global_depth;       // 目录的全局深度，目录共有2^global_depth项
+    int num_dir_pages;      // 目录页面的数量，第i个目录页面存放第i * IX_HASH_DIR_ENTRIES_PER_PAGE项开始的目录项
+    int bucket_capacity;    // 每个桶最多存放的键值对数量
+    int col_num;            // 索引包含的字段数量
+    int col_tot_len;        // 索引包含的字段的总长度
+};
+
+constexpr int IX_HASH_MAX_DIR_PAGES = (PAGE_SIZE - sizeof(IxHashFileHdr)) / sizeof(page_id_t);
+static_assert((1 << IX_HASH_MAX_DEPTH) / IX_HASH_DIR_ENTRIES_PER_PAGE <= IX_HASH_MAX_DIR_PAGES,
+              "directory page numbers do not fit in the file header page");
+
+/* 桶页面的页头，之后依次存放bucket_capacity个key和bucket_capacity个rid */
+struct IxHashBucketHdr {
+    int local_depth;        // 桶中所有key的哈希值的低local_depth位相同
+    int num_entries;        // 桶中的键值对数量
+};
+
+/**
+ * 可扩展哈希索引，只支持完整key的等值查找，key唯一
+ * 目录常驻内存，打开索引时从文件中读入；桶和目录都存放在通过缓冲池分配的页面中，
+ * 目录页面分配之后不会被其他页面复用，分裂桶时通过缓冲池写出修改过的目录页面和文件头
+ * 查找、插入、删除时对目录加读锁、对桶页面加读写锁，不同桶上的操作可以并发执行；
+ * 桶满时释放锁，对目录加写锁后分裂桶，必要时将目录扩大一倍。桶变空后不合并
+ */
+class IxHashIndexHandle {
+    friend class IxManager;
+
+   private:
+    DiskManager *disk_manager_;
+    BufferPoolManager *buffer_pool_manager_;
+    int fd_;
+    IxHashFileHdr file_hdr_;
+    std::vector<page_id_t> dir_;        // 目录，下标为哈希值的低global_depth位
+    std::vector<page_id_t> dir_pages_;  // 存放目录的页面
+    std::shared_mutex dir_latch_;       // 保护目录和file_hdr_，分裂桶时加写锁
+
+   public:
+    IxHashIndexHandle(DiskManager *disk_manager, BufferPoolManager *buffer_pool_manager, int fd);
+
+    bool get_value(const char *key, std::vector<Rid> *result, Transaction *transaction);
+
+    page_id_t insert_entry(const char *key, const Rid &value, Transaction *transaction);
+
+    bool delete_entry(const char *key, Transaction *transaction);
+
+    int get_global_depth() const { return file_hdr_.global_depth; }
+
+    int get_num_buckets() const { return file_hdr_.num_buckets; }
+
+    int get_fd() const { return fd_; }
+
+   private:
+    page_id_t bucket_page_no(uint64_t hash) const { return dir_[hash & ((1ULL << file_hdr_.global_depth) - 1)]; }
+
+    Page *fetch_bucket(page_id_t page_no) const;
+
+    IxHashBucketHdr *get_bucket_hdr(Page *page) const { return reinterpret_cast<IxHashBucketHdr *>(page->get_data()); }
+
+    char *get_bucket_key(Page *page, int i) const {
+        return page->get_data() + sizeof(IxHashBucketHdr) + i * file_hdr_.col_tot_len;
+    }
+
+    Rid *get_bucket_rid(Page *page, int i) const {
+        return reinterpret_cast<Rid *>(page->get_data() + sizeof(IxHashBucketHdr) +
+                                       file_hdr_.bucket_capacity * file_hdr_.col_tot_len) + i;
+    }
+
+    int find_in_bucket(Page *page, const char *key) const;
+
+    void append_to_bucket(Page *page, const char *key, const Rid &value) const;
+
+    Page *new_page();
+
+    void split_bucket(Page *page);
+
+    void write_dir(size_t begin, size_t end);
+
+    void write_file_hdr();
+};
+
+/* 哈希索引上的等值查找，key唯一，结果最多包含一条记录 */
+class IxHashScan : public RecScan {
+    std::vector<Rid> rids_;
+    size_t pos_ = 0;
+
+   public:
+    IxHashScan(IxHashIndexHandle *ih, const char *key) { ih->get_value(key, &rids_, nullptr); }
+
+    void next() override { pos_++; }
+
+    bool is_end() const override { return pos_ >= rids_.size(); }
+
+    Rid rid() const override { return rids_[pos_]; }
+};
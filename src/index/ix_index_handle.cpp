@@ -10,7 +10,11 @@ See the Mulan PSL v2 for more details. */
 
 #include "ix_index_handle.h"
 
+#include <algorithm>
+
 #include "ix_scan.h"
+#include "ix_search.h"
+#include "ix_sorter.h"
 
 /**
  * @brief 在当前node中查找第一个>=target的key_idx
@@ -22,8 +26,8 @@ int IxNodeHandle::lower_bound(const char *target) const {
     // Todo:
     // 查找当前节点中第一个大于等于target的key，并返回key的位置给上层
     // 提示: 可以采用多种查找方式，如顺序遍历、二分查找等；使用ix_compare()函数进行比较
-
-    return -1;
+    // 查找函数在打开索引时根据字段类型选择（见ix_search.h），避免每次比较都按类型分派
+    return file_hdr->lower_bound_(keys, 0, page_hdr->num_key, target, file_hdr);
 }
 
 /**
@@ -36,8 +40,7 @@ int IxNodeHandle::upper_bound(const char *target) const {
     // Todo:
     // 查找当前节点中第一个大于target的key，并返回key的位置给上层
     // 提示: 可以采用多种查找方式：顺序遍历、二分查找等；使用ix_compare()函数进行比较
-
-    return -1;
+    return file_hdr->upper_bound_(keys, 1, page_hdr->num_key, target, file_hdr);
 }
 
 /**
@@ -54,8 +57,13 @@ bool IxNodeHandle::leaf_lookup(const char *key, Rid **value) {
     // 2. 判断目标key是否存在
     // 3. 如果存在，获取key对应的Rid，并赋值给传出参数value
     // 提示：可以调用lower_bound()和get_rid()函数。
-
-    return false;
+    char buf[IX_MAX_COL_LEN];
+    int pos = lower_bound(key);
+    if (pos == get_size() || ix_compare(get_key(pos, buf), key, file_hdr) != 0) {
+        return false;
+    }
+    *value = get_rid(pos);
+    return true;
 }
 
 /**
@@ -68,8 +76,7 @@ page_id_t IxNodeHandle::internal_lookup(const char *key) {
     // 1. 查找当前非叶子节点中目标key所在孩子节点（子树）的位置
     // 2. 获取该孩子节点（子树）所在页面的编号
     // 3. 返回页面编号
-
-    return -1;
+    return value_at(upper_bound(key) - 1);
 }
 
 /**
@@ -92,7 +99,160 @@ void IxNodeHandle::insert_pairs(int pos, const char *key, const Rid *rid, int n)
     // 2. 通过key获取n个连续键值对的key值，并把n个key值插入到pos位置
     // 3. 通过rid获取n个连续键值对的rid值，并把n个rid值插入到pos位置
     // 4. 更新当前节点的键数量
+    int size = get_size();
+    assert(pos >= 0 && pos <= size && n >= 0);
+    int key_len = file_hdr->col_tot_len_;
+    if (!is_compressed()) {
+        memmove(keys + (pos + n) * key_len, keys + pos * key_len, (size - pos) * key_len);
+        memcpy(keys + pos * key_len, key, n * key_len);
+        memmove(get_rid(pos + n), get_rid(pos), (size - pos) * sizeof(Rid));
+        memcpy(get_rid(pos), rid, n * sizeof(Rid));
+        set_size(size + n);
+        return;
+    }
+
+    bool in_place = ix_node_bytes(key_fmt()->prefix_len, key_fmt()->key_len, size + n) <= PAGE_SIZE;
+    for (int i = 0; i < n && in_place; i++) {
+        in_place = conforms(key + i * key_len);
+    }
+    if (!in_place) {
+        // 新的key不能按当前的格式存放，还原所有的key之后重新确定公共前缀和key的长度
+        std::vector<char> all_keys((size_t)(size + n) * key_len);
+        std::vector<Rid> all_rids(size + n);
+        get_keys(0, pos, all_keys.data());
+        memcpy(all_keys.data() + (size_t)pos * key_len, key, (size_t)n * key_len);
+        get_keys(pos, size - pos, all_keys.data() + (size_t)(pos + n) * key_len);
+        memcpy(all_rids.data(), get_rid(0), pos * sizeof(Rid));
+        memcpy(all_rids.data() + pos, rid, n * sizeof(Rid));
+        memcpy(all_rids.data() + pos + n, get_rid(pos), (size - pos) * sizeof(Rid));
+        rebuild(all_keys.data(), all_rids.data(), size + n);
+        return;
+    }
+
+    // rid数组整体后移n个key的长度，[pos, size)的rid再后移n个位置；先移动后面的部分，避免覆盖
+    int prefix_len = key_fmt()->prefix_len, suffix_len = key_fmt()->key_len;
+    char *old_rids = key_suffix(size);
+    char *new_rids = old_rids + n * suffix_len;
+    memmove(new_rids + (pos + n) * sizeof(Rid), old_rids + pos * sizeof(Rid), (size - pos) * sizeof(Rid));
+    memmove(new_rids, old_rids, pos * sizeof(Rid));
+    memcpy(new_rids + pos * sizeof(Rid), rid, n * sizeof(Rid));
+    memmove(key_suffix(pos + n), key_suffix(pos), (size - pos) * suffix_len);
+    for (int i = 0; i < n; i++) {
+        memcpy(key_suffix(pos + i), key + i * key_len + prefix_len, suffix_len);
+    }
+    set_size(size + n);
+}
+
+/**
+ * @brief 压缩格式中key是否可以按照结点当前的公共前缀和key的长度存放
+ */
+bool IxNodeHandle::conforms(const char *key) const {
+    const IxKeyFmt *fmt = key_fmt();
+    return memcmp(key, key_prefix(), fmt->prefix_len) == 0 &&
+           ix_key_siglen(key, file_hdr->col_tot_len_) <= fmt->prefix_len + fmt->key_len;
+}
+
+/**
+ * @brief 压缩格式中，结点存放现有的key和新的key，共n个键值对时最多占用的字节数
+ * 重新确定格式时公共前缀只会更长、key的长度只会更短，所以按照当前格式与key的公共前缀估计的结果不会偏小
+ */
+int IxNodeHandle::bytes_with(const char *key, int n) const {
+    int key_len = file_hdr->col_tot_len_;
+    int siglen = ix_key_siglen(key, key_len);
+    if (get_size() == 0) {
+        return ix_node_bytes(siglen, 0, n);
+    }
+    const IxKeyFmt *fmt = key_fmt();
+    int prefix_len = ix_common_prefix(key, key_prefix(), fmt->prefix_len);
+    int max_len = std::max<int>(fmt->prefix_len + fmt->key_len, siglen);
+    return ix_node_bytes(prefix_len, max_len - prefix_len, n);
+}
+
+/**
+ * @brief 压缩格式中，用n个完整的键值对重写整个结点，公共前缀取所有key的公共前缀，key的长度取去掉末尾的0之后最长的key
+ * @note keys_src和rids_src不能指向本结点的页面
+ */
+void IxNodeHandle::rebuild(const char *keys_src, const Rid *rids_src, int n) {
+    int key_len = file_hdr->col_tot_len_;
+    int prefix_len = n > 0 ? key_len : 0;
+    int max_len = 0;
+    for (int i = 0; i < n; i++) {
+        const char *key = keys_src + (size_t)i * key_len;
+        max_len = std::max(max_len, ix_key_siglen(key, key_len));
+        prefix_len = ix_common_prefix(keys_src, key, prefix_len);
+    }
+    prefix_len = std::min(prefix_len, max_len);
+    assert(ix_node_bytes(prefix_len, max_len - prefix_len, n) <= PAGE_SIZE);
+
+    key_fmt()->prefix_len = prefix_len;
+    key_fmt()->key_len = max_len - prefix_len;
+    memcpy(key_prefix(), keys_src, prefix_len);
+    for (int i = 0; i < n; i++) {
+        memcpy(key_suffix(i), keys_src + (size_t)i * key_len + prefix_len, max_len - prefix_len);
+    }
+    set_size(n);
+    memcpy(get_rid(0), rids_src, n * sizeof(Rid));
+}
+
+/**
+ * @brief 将第key_idx个key修改为key
+ * @note 压缩格式中调用前需要用can_set_key()检查结点能否放下
+ */
+void IxNodeHandle::set_key(int key_idx, const char *key) {
+    int key_len = file_hdr->col_tot_len_;
+    if (!is_compressed()) {
+        memcpy(keys + key_idx * key_len, key, key_len);
+        return;
+    }
+    if (conforms(key)) {
+        memcpy(key_suffix(key_idx), key + key_fmt()->prefix_len, key_fmt()->key_len);
+        return;
+    }
+    int size = get_size();
+    std::vector<char> all_keys((size_t)size * key_len);
+    std::vector<Rid> all_rids(get_rid(0), get_rid(0) + size);
+    get_keys(0, size, all_keys.data());
+    memcpy(all_keys.data() + (size_t)key_idx * key_len, key, key_len);
+    rebuild(all_keys.data(), all_rids.data(), size);
+}
 
+/**
+ * @brief 插入key之后结点是否仍然放得下；非压缩格式的结点达到max_size之后才分裂，总能放下
+ */
+bool IxNodeHandle::can_insert(const char *key) const {
+    if (!is_compressed()) return true;
+    return bytes_with(key, page_hdr->num_key + 1) <= PAGE_SIZE;
+}
+
+/**
+ * @brief 插入任意一个key之后结点是否一定放得下，用于还不知道要插入的分隔key的内部结点
+ */
+bool IxNodeHandle::can_insert_any() const {
+    if (!is_compressed()) return true;
+    return ix_node_bytes(0, file_hdr->col_tot_len_, page_hdr->num_key + 1) <= PAGE_SIZE;
+}
+
+/**
+ * @brief 把结点中的某个key修改为key之后结点是否仍然放得下
+ */
+bool IxNodeHandle::can_set_key(const char *key) const {
+    if (!is_compressed()) return true;
+    return bytes_with(key, page_hdr->num_key) <= PAGE_SIZE;
+}
+
+/**
+ * @brief other的所有键值对追加到本结点之后是否放得下，用于合并结点
+ */
+bool IxNodeHandle::can_append(const IxNodeHandle *other) const {
+    int size = page_hdr->num_key, other_size = other->page_hdr->num_key;
+    if (!is_compressed() || size == 0 || other_size == 0) {
+        return size + other_size < get_max_size();
+    }
+    const IxKeyFmt *fmt = key_fmt(), *other_fmt = other->key_fmt();
+    int prefix_len = ix_common_prefix(key_prefix(), other->key_prefix(), std::min(fmt->prefix_len, other_fmt->prefix_len));
+    int max_len = std::max(fmt->prefix_len + fmt->key_len, other_fmt->prefix_len + other_fmt->key_len);
+    return size + other_size < get_max_size() &&
+           ix_node_bytes(prefix_len, max_len - prefix_len, size + other_size) <= PAGE_SIZE;
 }
 
 /**
@@ -108,21 +268,43 @@ int IxNodeHandle::insert(const char *key, const Rid &value) {
     // 2. 如果key重复则不插入
     // 3. 如果key不重复则插入键值对
     // 4. 返回完成插入操作之后的键值对数量
-
-    return -1;
+    char buf[IX_MAX_COL_LEN];
+    int pos = lower_bound(key);
+    if (pos < get_size() && ix_compare(get_key(pos, buf), key, file_hdr) == 0) {
+        return get_size();
+    }
+    insert_pair(pos, key, value);
+    return get_size();
 }
 
 /**
- * @brief 用于在结点中的指定位置删除单个键值对
+ * @brief 用于在结点中的指定位置删除n个连续的键值对
  *
  * @param pos 要删除键值对的位置
+ * @param n 键值对数量
  */
-void IxNodeHandle::erase_pair(int pos) {
+void IxNodeHandle::erase_pairs(int pos, int n) {
     // Todo:
     // 1. 删除该位置的key
     // 2. 删除该位置的rid
     // 3. 更新结点的键值对数量
-
+    int size = get_size();
+    assert(pos >= 0 && n >= 0 && pos + n <= size);
+    if (!is_compressed()) {
+        int key_len = file_hdr->col_tot_len_;
+        memmove(keys + pos * key_len, keys + (pos + n) * key_len, (size - pos - n) * key_len);
+        memmove(get_rid(pos), get_rid(pos + n), (size - pos - n) * sizeof(Rid));
+        set_size(size - n);
+        return;
+    }
+    // 删除key不会使结点放不下，保持当前的格式；rid数组整体前移n个key的长度，[pos + n, size)的rid再前移n个位置
+    int suffix_len = key_fmt()->key_len;
+    char *old_rids = key_suffix(size);
+    char *new_rids = old_rids - n * suffix_len;
+    memmove(key_suffix(pos), key_suffix(pos + n), (size - pos - n) * suffix_len);
+    memmove(new_rids, old_rids, pos * sizeof(Rid));
+    memmove(new_rids + pos * sizeof(Rid), old_rids + (pos + n) * sizeof(Rid), (size - pos - n) * sizeof(Rid));
+    set_size(size - n);
 }
 
 /**
@@ -136,23 +318,29 @@ int IxNodeHandle::remove(const char *key) {
     // 1. 查找要删除键值对的位置
     // 2. 如果要删除的键值对存在，删除键值对
     // 3. 返回完成删除操作后的键值对数量
-
-    return -1;
+    char buf[IX_MAX_COL_LEN];
+    int pos = lower_bound(key);
+    if (pos < get_size() && ix_compare(get_key(pos, buf), key, file_hdr) == 0) {
+        erase_pair(pos);
+    }
+    return get_size();
 }
 
 IxIndexHandle::IxIndexHandle(DiskManager *disk_manager, BufferPoolManager *buffer_pool_manager, int fd)
     : disk_manager_(disk_manager), buffer_pool_manager_(buffer_pool_manager), fd_(fd) {
     // init file_hdr_
-    disk_manager_->read_page(fd, IX_FILE_HDR_PAGE, (char *)&file_hdr_, sizeof(file_hdr_));
     char* buf = new char[PAGE_SIZE];
     memset(buf, 0, PAGE_SIZE);
     disk_manager_->read_page(fd, IX_FILE_HDR_PAGE, buf, PAGE_SIZE);
     file_hdr_ = new IxFileHdr();
     file_hdr_->deserialize(buf);
-    
+    delete[] buf;
+    ix_init_search(file_hdr_);
+
     // disk_manager管理的fd对应的文件中，设置从file_hdr_->num_pages开始分配page_no
-    int now_page_no = disk_manager_->get_fd2pageno(fd);
-    disk_manager_->set_fd2pageno(fd, now_page_no + 1);
+    // 删除结点时num_pages会减小，但被删除的页面号不会被重新分配，所以还要保证不小于文件中已有的页面数量
+    int file_pages = disk_manager_->get_file_size(disk_manager_->get_file_name(fd)) / PAGE_SIZE;
+    disk_manager_->set_fd2pageno(fd, std::max(file_hdr_->num_pages_, file_pages));
 }
 
 /**
@@ -170,8 +358,136 @@ std::pair<IxNodeHandle *, bool> IxIndexHandle::find_leaf_page(const char *key, O
     // 1. 获取根节点
     // 2. 从根节点开始不断向下查找目标key
     // 3. 找到包含该key值的叶子结点停止查找，并返回叶子节点
+    // 乐观下降：内部结点只加读锁，锁住孩子结点之后立即释放父结点；
+    // 查找时叶子结点加读锁，插入和删除时叶子结点加写锁，调用者需要检查叶子结点是否安全，不安全时再悲观地重新下降。
+    // 结点是否为叶子结点在创建之后不会改变，因此可以在加锁之前判断
+    bool leaf_write = operation != Operation::FIND;
+    root_latch_.lock_shared();
+    IxNodeHandle *node = fetch_node(file_hdr_->root_page_);
+    if (node->is_leaf_page() && leaf_write) {
+        node->page->wlatch();
+    } else {
+        node->page->rlatch();
+    }
+    root_latch_.unlock_shared();
 
-    return std::make_pair(nullptr, false);
+    while (!node->is_leaf_page()) {
+        page_id_t child_page_no = find_first ? node->value_at(0) : node->internal_lookup(key);
+        IxNodeHandle *child = fetch_node(child_page_no);
+        if (child->is_leaf_page() && leaf_write) {
+            child->page->wlatch();
+        } else {
+            child->page->rlatch();
+        }
+        node->page->runlatch();
+        buffer_pool_manager_->unpin_page(node->get_page_id(), false);
+        delete node;
+        node = child;
+    }
+    return std::make_pair(node, false);
+}
+
+/**
+ * @brief 悲观地查找指定键所在的叶子结点，从根结点开始对沿途结点加写锁（latch crabbing）
+ * 当某个结点在本次操作后不会分裂/合并，且其第一个key不会改变时，称该结点是安全的，此时释放其所有祖先结点的锁
+ *
+ * @param key 要查找的目标key值
+ * @param operation 插入或删除
+ * @param transaction 事务指针，持有写锁的页面记录在transaction的index_latch_page_set中
+ * @return [leaf node] and [root_is_latched] 返回目标叶子结点以及root_latch_是否仍被持有
+ * @note 叶子结点和仍被锁住的祖先结点都在index_latch_page_set中，需要调用release_latches()统一解锁和unpin
+ */
+std::pair<IxNodeHandle *, bool> IxIndexHandle::find_leaf_page_pessimistic(const char *key, Operation operation,
+                                                                        Transaction *transaction) {
+    auto latch_set = transaction->get_index_latch_page_set();
+    root_latch_.lock();
+    bool root_is_latched = true;
+    IxNodeHandle *node = fetch_node(file_hdr_->root_page_);
+    node->page->wlatch();
+    latch_set->push_back(node->page);
+    bool is_root = true;
+    while (true) {
+        if (is_safe(node, key, operation, is_root)) {
+            // 释放node之上的所有祖先结点
+            latch_set->pop_back();
+            release_latches(transaction, &root_is_latched, false);
+            latch_set->push_back(node->page);
+        }
+        if (node->is_leaf_page()) {
+            break;
+        }
+        IxNodeHandle *child = fetch_node(node->internal_lookup(key));
+        child->page->wlatch();
+        latch_set->push_back(child->page);
+        delete node;
+        node = child;
+        is_root = false;
+    }
+    return std::make_pair(node, root_is_latched);
+}
+
+/**
+ * @brief 判断结点在本次插入/删除之后是否安全，即不会分裂/合并，并且不会修改父结点中指向它的key
+ *
+ * @param node 已经加写锁的结点
+ * @param key 要插入/删除的key
+ * @param operation 插入或删除
+ * @param is_root node是否为根结点
+ * @note 内部结点的第一个key等于其子树中最小的key，只有key小于（插入）或等于（删除）第一个key时才会改变它；
+ * 压缩格式中父结点的key只是子树中key的下界，不需要随第一个key更新
+ */
+bool IxIndexHandle::is_safe(IxNodeHandle *node, const char *key, Operation operation, bool is_root) {
+    int size = node->get_size();
+    bool exact = file_hdr_->version_ < IX_FORMAT_COMPRESSED;
+    char buf[IX_MAX_COL_LEN];
+    if (operation == Operation::INSERT) {
+        if (size + 1 >= node->get_max_size()) return false;
+        // 叶子结点插入的就是key；内部结点插入的分隔key还不知道，按照最坏的情况判断
+        if (!(node->is_leaf_page() ? node->can_insert(key) : node->can_insert_any())) return false;
+        return !exact || is_root || size == 0 ||
+               ix_compare(key, node->get_key(0, buf), file_hdr_) > 0;
+    }
+    if (operation == Operation::DELETE) {
+        if (is_root) {
+            // 根结点为叶子结点时允许为空，为内部结点时只剩一个孩子就需要调整根结点
+            return node->is_leaf_page() || size > 2;
+        }
+        if (size - 1 < node->get_min_size()) return false;
+        return !exact || ix_compare(key, node->get_key(0, buf), file_hdr_) != 0;
+    }
+    return true;
+}
+
+/**
+ * @brief 释放transaction在本索引上持有的所有页面写锁，并unpin这些页面；如果仍持有root_latch_，也一并释放
+ *
+ * @param transaction 事务指针
+ * @param root_is_latched 传入传出参数：root_latch_是否被持有
+ * @param is_dirty 这些页面是否被修改过
+ */
+void IxIndexHandle::release_latches(Transaction *transaction, bool *root_is_latched, bool is_dirty) {
+    if (*root_is_latched) {
+        root_latch_.unlock();
+        *root_is_latched = false;
+    }
+    auto latch_set = transaction->get_index_latch_page_set();
+    for (Page *page : *latch_set) {
+        page->wunlatch();
+        buffer_pool_manager_->unpin_page(page->get_page_id(), is_dirty);
+    }
+    latch_set->clear();
+}
+
+/**
+ * @brief 释放所有锁之后，从缓冲池中删除合并时被删除的结点
+ * @note 此时已经没有结点指向这些页面；若页面仍被其他线程pin住则保留在缓冲池中，被删除的页面号不会被重新分配
+ */
+void IxIndexHandle::delete_pages(Transaction *transaction) {
+    auto deleted_set = transaction->get_index_deleted_page_set();
+    for (Page *page : *deleted_set) {
+        buffer_pool_manager_->delete_page(page->get_page_id());
+    }
+    deleted_set->clear();
 }
 
 /**
@@ -188,8 +504,19 @@ bool IxIndexHandle::get_value(const char *key, std::vector<Rid> *result, Transac
     // 2. 在叶子节点中查找目标key值的位置，并读取key对应的rid
     // 3. 把rid存入result参数中
     // 提示：使用完buffer_pool提供的page之后，记得unpin page；记得处理并发的上锁
-
-    return false;
+    // 索引中存放的是编码后的key
+    char key_buf[IX_MAX_COL_LEN];
+    key = encode_key(key, key_buf);
+    auto [leaf, root_is_latched] = find_leaf_page(key, Operation::FIND, transaction);
+    Rid *rid;
+    bool found = leaf->leaf_lookup(key, &rid);
+    if (found) {
+        posting_read(*rid, result);
+    }
+    leaf->page->runlatch();
+    buffer_pool_manager_->unpin_page(leaf->get_page_id(), false);
+    delete leaf;
+    return found;
 }
 
 /**
@@ -206,8 +533,100 @@ IxNodeHandle *IxIndexHandle::split(IxNodeHandle *node) {
     // 2. 如果新的右兄弟结点是叶子结点，更新新旧节点的prev_leaf和next_leaf指针
     //    为新节点分配键值对，更新旧节点的键值对数记录
     // 3. 如果新的右兄弟结点不是叶子结点，更新该结点的所有孩子结点的父节点信息(使用IxIndexHandle::maintain_child())
+    IxNodeHandle *new_node = create_node();
+    *new_node->page_hdr = {
+        .next_free_page_no = IX_NO_PAGE,
+        .parent = node->get_parent_page_no(),
+        .num_key = 0,
+        .is_leaf = node->is_leaf_page(),
+        .prev_leaf = IX_NO_PAGE,
+        .next_leaf = IX_NO_PAGE,
+    };
+    int size = node->get_size();
+    int mid = size / 2;
+    int key_len = file_hdr_->col_tot_len_;
+    std::vector<char> split_keys((size_t)size * key_len);
+    std::vector<Rid> split_rids(node->get_rid(0), node->get_rid(0) + size);
+    node->get_keys(0, size, split_keys.data());
+    new_node->insert_pairs(0, split_keys.data() + (size_t)mid * key_len, split_rids.data() + mid, size - mid);
+    node->erase_pairs(mid, size - mid);
+    if (node->is_compressed()) {
+        // 左半部分的key的公共前缀可能变长，重新压缩
+        node->rebuild(split_keys.data(), split_rids.data(), mid);
+    }
 
-    return nullptr;
+    if (new_node->is_leaf_page()) {
+        // 右侧的叶子结点（可能是leaf header）不在本线程持有的锁之中，按从左到右的顺序对其加锁
+        IxNodeHandle *next = fetch_node(node->get_next_leaf());
+        next->page->wlatch();
+        new_node->set_prev_leaf(node->get_page_no());
+        new_node->set_next_leaf(node->get_next_leaf());
+        next->set_prev_leaf(new_node->get_page_no());
+        node->set_next_leaf(new_node->get_page_no());
+        if (next->get_page_no() == IX_LEAF_HEADER_PAGE) {
+            // last_leaf_由leaf header页面的锁保护
+            file_hdr_->last_leaf_ = new_node->get_page_no();
+        }
+        next->page->wunlatch();
+        buffer_pool_manager_->unpin_page(next->get_page_id(), true);
+        delete next;
+    } else {
+        for (int i = 0; i < new_node->get_size(); i++) {
+            maintain_child(new_node, i);
+        }
+    }
+    return new_node;
+}
+
+/**
+ * @brief 在node的pos位置插入键值对；压缩格式的结点放不下时先分裂再插入，插入后达到max_size时分裂
+ * @return 分裂得到的右兄弟结点，没有分裂时返回nullptr
+ * @note 结点最多有max_size - 1个键值对，先分裂时两半都不超过btree_order - 1个，
+ * 即使完全不能压缩也能放下btree_order个键值对，所以一次插入最多分裂一次
+ */
+IxNodeHandle *IxIndexHandle::insert_or_split(IxNodeHandle *node, int pos, const char *key, const Rid &rid) {
+    IxNodeHandle *new_node = nullptr;
+    IxNodeHandle *target = node;
+    if (!node->can_insert(key)) {
+        new_node = split(node);
+        if (pos > node->get_size()) {
+            pos -= node->get_size();
+            target = new_node;
+        }
+    }
+    target->insert_pair(pos, key, rid);
+    maintain_child(target, pos);
+    if (new_node == nullptr && node->get_size() == node->get_max_size()) {
+        new_node = split(node);
+    }
+    return new_node;
+}
+
+/**
+ * @brief 计算相邻的两个叶子结点之间的分隔key，满足left_last < sep <= right_first
+ * 压缩格式中取right_first中能与left_last区分开的最短前缀，之后的字节填0（suffix truncation），使内部结点中的key更短
+ */
+void IxIndexHandle::make_separator(const char *left_last, const char *right_first, char *sep) const {
+    int key_len = file_hdr_->col_tot_len_;
+    memcpy(sep, right_first, key_len);
+    if (file_hdr_->version_ >= IX_FORMAT_COMPRESSED) {
+        int len = std::min(key_len, ix_common_prefix(left_last, right_first, key_len) + 1);
+        memset(sep + len, 0, key_len - len);
+    }
+}
+
+/**
+ * @brief 计算right分裂出来之后，父结点中指向right的key
+ * 叶子结点为两个结点之间的分隔key；内部结点的第一个key就是父结点中指向它的key
+ */
+void IxIndexHandle::get_separator(IxNodeHandle *left, IxNodeHandle *right, char *sep) const {
+    char first_buf[IX_MAX_COL_LEN], last_buf[IX_MAX_COL_LEN];
+    const char *first = right->get_key(0, first_buf);
+    if (right->is_leaf_page()) {
+        make_separator(left->get_key(left->get_size() - 1, last_buf), first, sep);
+    } else {
+        memcpy(sep, first, file_hdr_->col_tot_len_);
+    }
 }
 
 /**
@@ -231,6 +650,40 @@ void IxIndexHandle::insert_into_parent(IxNodeHandle *old_node, const char *key,
     // 3. 获取key对应的rid，并将(key, rid)插入到父亲结点
     // 4. 如果父亲结点仍需要继续分裂，则进行递归插入
     // 提示：记得unpin page
+    // 原结点不安全，所以其父结点（或者root_latch_）一定仍被本线程持有
+    if (old_node->is_root_page()) {
+        IxNodeHandle *root = create_node();
+        *root->page_hdr = {
+            .next_free_page_no = IX_NO_PAGE,
+            .parent = IX_NO_PAGE,
+            .num_key = 0,
+            .is_leaf = false,
+            .prev_leaf = IX_NO_PAGE,
+            .next_leaf = IX_NO_PAGE,
+        };
+        char buf[IX_MAX_COL_LEN];
+        root->insert_pair(0, old_node->get_key(0, buf), Rid{old_node->get_page_no(), -1});
+        root->insert_pair(1, key, Rid{new_node->get_page_no(), -1});
+        old_node->set_parent_page_no(root->get_page_no());
+        new_node->set_parent_page_no(root->get_page_no());
+        update_root_page_no(root->get_page_no());
+        buffer_pool_manager_->unpin_page(root->get_page_id(), true);
+        delete root;
+        return;
+    }
+
+    IxNodeHandle *parent = fetch_node(old_node->get_parent_page_no());
+    int rank = parent->find_child(old_node);
+    IxNodeHandle *new_parent = insert_or_split(parent, rank + 1, key, Rid{new_node->get_page_no(), -1});
+    if (new_parent != nullptr) {
+        char sep[IX_MAX_COL_LEN];
+        get_separator(parent, new_parent, sep);
+        insert_into_parent(parent, sep, new_parent, transaction);
+        buffer_pool_manager_->unpin_page(new_parent->get_page_id(), true);
+        delete new_parent;
+    }
+    buffer_pool_manager_->unpin_page(parent->get_page_id(), true);
+    delete parent;
 }
 
 /**
@@ -246,7 +699,63 @@ page_id_t IxIndexHandle::insert_entry(const char *key, const Rid &value, Transac
     // 3. 如果结点已满，分裂结点，并把新结点的相关信息插入父节点
     // 提示：记得unpin page；若当前叶子节点是最右叶子节点，则需要更新file_hdr_.last_leaf；记得处理并发的上锁
 
-    return -1;
+    char key_buf[IX_MAX_COL_LEN], buf[IX_MAX_COL_LEN];
+    key = encode_key(key, key_buf);
+    // 先乐观地只对叶子结点加写锁，叶子结点插入后不会分裂、第一个key也不变时直接插入
+    auto [leaf, root_is_latched] = find_leaf_page(key, Operation::INSERT, transaction);
+    int pos = leaf->lower_bound(key);
+    bool exists = pos < leaf->get_size() &&
+                  ix_compare(leaf->get_key(pos, buf), key, file_hdr_) == 0;
+    if (exists || is_safe(leaf, key, Operation::INSERT, leaf->is_root_page())) {
+        // 唯一索引中已经存在的key不再插入；非唯一索引中将rid加入key的posting list，叶子结点的结构不变
+        bool inserted = !exists || (!file_hdr_->unique_ && posting_insert(leaf->get_rid(pos), value));
+        if (!exists) {
+            leaf->insert_pair(pos, key, value);
+        }
+        page_id_t page_no = inserted ? leaf->get_page_no() : IX_NO_PAGE;
+        leaf->page->wunlatch();
+        buffer_pool_manager_->unpin_page(leaf->get_page_id(), inserted);
+        delete leaf;
+        return page_no;
+    }
+    leaf->page->wunlatch();
+    buffer_pool_manager_->unpin_page(leaf->get_page_id(), false);
+    delete leaf;
+
+    // 叶子结点可能分裂，重新悲观地下降
+    std::unique_ptr<Transaction> local_txn;
+    if (transaction == nullptr) {
+        local_txn = std::make_unique<Transaction>(INVALID_TXN_ID);
+        transaction = local_txn.get();
+    }
+    std::tie(leaf, root_is_latched) = find_leaf_page_pessimistic(key, Operation::INSERT, transaction);
+    page_id_t page_no = IX_NO_PAGE;
+    pos = leaf->lower_bound(key);
+    exists = pos < leaf->get_size() &&
+             ix_compare(leaf->get_key(pos, buf), key, file_hdr_) == 0;
+    if (exists && !file_hdr_->unique_ && posting_insert(leaf->get_rid(pos), value)) {
+        page_no = leaf->get_page_no();
+    }
+    if (!exists) {
+        page_no = leaf->get_page_no();
+        IxNodeHandle *new_leaf = insert_or_split(leaf, pos, key, value);
+        if (pos == 0) {
+            maintain_parent(leaf);
+        }
+        if (new_leaf != nullptr) {
+            if (ix_compare(key, new_leaf->get_key(0, buf), file_hdr_) >= 0) {
+                page_no = new_leaf->get_page_no();
+            }
+            char sep[IX_MAX_COL_LEN];
+            get_separator(leaf, new_leaf, sep);
+            insert_into_parent(leaf, sep, new_leaf, transaction);
+            buffer_pool_manager_->unpin_page(new_leaf->get_page_id(), true);
+            delete new_leaf;
+        }
+    }
+    delete leaf;
+    release_latches(transaction, &root_is_latched, page_no != IX_NO_PAGE);
+    return page_no;
 }
 
 /**
@@ -255,13 +764,87 @@ page_id_t IxIndexHandle::insert_entry(const char *key, const Rid &value, Transac
  * @param transaction 事务指针
  */
 bool IxIndexHandle::delete_entry(const char *key, Transaction *transaction) {
+    return delete_entry(key, nullptr, transaction);
+}
+
+/**
+ * @brief 删除key对应的rid：唯一索引中rid与key对应的rid相同时才删除key；
+ * 非唯一索引中从key的posting list中删除rid，只剩下这一个rid时删除key
+ *
+ * @return 是否删除成功
+ */
+bool IxIndexHandle::delete_entry(const char *key, const Rid &rid, Transaction *transaction) {
+    return delete_entry(key, &rid, transaction);
+}
+
+bool IxIndexHandle::delete_entry(const char *key, const Rid *rid, Transaction *transaction) {
     // Todo:
     // 1. 获取该键值对所在的叶子结点
     // 2. 在该叶子结点中删除键值对
     // 3. 如果删除成功需要调用CoalesceOrRedistribute来进行合并或重分配操作，并根据函数返回结果判断是否有结点需要删除
     // 4. 如果需要并发，并且需要删除叶子结点，则需要在事务的delete_page_set中添加删除结点的对应页面；记得处理并发的上锁
 
-    return false;
+    char key_buf[IX_MAX_COL_LEN], buf[IX_MAX_COL_LEN];
+    key = encode_key(key, key_buf);
+    // 先乐观地只对叶子结点加写锁，叶子结点删除后不会合并、第一个key也不变时直接删除
+    auto [leaf, root_is_latched] = find_leaf_page(key, Operation::DELETE, transaction);
+    int pos = leaf->lower_bound(key);
+    bool exists = pos < leaf->get_size() &&
+                  ix_compare(leaf->get_key(pos, buf), key, file_hdr_) == 0;
+    // rid在posting list中时只修改posting list；rid与key对应的rid不同时不删除
+    bool in_posting = exists && rid != nullptr && ix_is_posting(*leaf->get_rid(pos));
+    if (exists && rid != nullptr && !in_posting && *leaf->get_rid(pos) != *rid) {
+        exists = false;
+    }
+    if (!exists || in_posting || is_safe(leaf, key, Operation::DELETE, leaf->is_root_page())) {
+        bool erased = exists;
+        if (in_posting) {
+            erased = posting_erase(leaf->get_rid(pos), *rid);
+        } else if (exists) {
+            posting_free(*leaf->get_rid(pos));
+            leaf->erase_pair(pos);
+        }
+        leaf->page->wunlatch();
+        buffer_pool_manager_->unpin_page(leaf->get_page_id(), erased);
+        delete leaf;
+        return erased;
+    }
+    leaf->page->wunlatch();
+    buffer_pool_manager_->unpin_page(leaf->get_page_id(), false);
+    delete leaf;
+
+    // 叶子结点可能合并或重分配，重新悲观地下降
+    std::unique_ptr<Transaction> local_txn;
+    if (transaction == nullptr) {
+        local_txn = std::make_unique<Transaction>(INVALID_TXN_ID);
+        transaction = local_txn.get();
+    }
+    std::tie(leaf, root_is_latched) = find_leaf_page_pessimistic(key, Operation::DELETE, transaction);
+    pos = leaf->lower_bound(key);
+    exists = pos < leaf->get_size() &&
+             ix_compare(leaf->get_key(pos, buf), key, file_hdr_) == 0;
+    if (exists && rid != nullptr && ix_is_posting(*leaf->get_rid(pos))) {
+        // 重新下降之前其他线程向key中插入了rid
+        bool erased = posting_erase(leaf->get_rid(pos), *rid);
+        delete leaf;
+        release_latches(transaction, &root_is_latched, erased);
+        return erased;
+    }
+    if (exists && rid != nullptr && *leaf->get_rid(pos) != *rid) {
+        exists = false;
+    }
+    if (exists) {
+        posting_free(*leaf->get_rid(pos));
+        leaf->erase_pair(pos);
+        if (pos == 0 && leaf->get_size() > 0) {
+            maintain_parent(leaf);
+        }
+        coalesce_or_redistribute(leaf, transaction, &root_is_latched);
+    }
+    delete leaf;
+    release_latches(transaction, &root_is_latched, exists);
+    delete_pages(transaction);
+    return exists;
 }
 
 /**
@@ -285,8 +868,40 @@ bool IxIndexHandle::coalesce_or_redistribute(IxNodeHandle *node, Transaction *tr
     // 4. 如果node结点和兄弟结点的键值对数量之和，能够支撑两个B+树结点（即node.size+neighbor.size >=
     // NodeMinSize*2)，则只需要重新分配键值对（调用Redistribute函数）
     // 5. 如果不满足上述条件，则需要合并两个结点，将右边的结点合并到左边的结点（调用Coalesce函数）
+    // node不安全，所以其父结点（根结点时为root_latch_）一定仍被本线程持有
+    if (node->is_root_page()) {
+        if (adjust_root(node)) {
+            transaction->append_index_deleted_page(node->page);
+            return true;
+        }
+        return false;
+    }
+    if (node->get_size() >= node->get_min_size()) {
+        return false;
+    }
 
-    return false;
+    IxNodeHandle *parent = fetch_node(node->get_parent_page_no());
+    int index = parent->find_child(node);
+    // 兄弟结点不在下降的路径上，需要单独加锁；父结点被本线程锁住，其他线程无法再到达兄弟结点
+    IxNodeHandle *neighbor = fetch_node(parent->value_at(index == 0 ? 1 : index - 1));
+    neighbor->page->wlatch();
+
+    // 压缩格式中父结点可能放不下新的分隔key、两个结点合并后也可能放不下，此时node暂时少于min_size个键值对
+    bool node_deleted = false;
+    bool redistributed = node->get_size() + neighbor->get_size() >= node->get_min_size() * 2 &&
+                         redistribute(neighbor, node, parent, index);
+    if (!redistributed && (index == 0 ? node->can_append(neighbor) : neighbor->can_append(node))) {
+        IxNodeHandle *left = neighbor, *right = node, *parent_node = parent;
+        coalesce(&left, &right, &parent_node, index, transaction, root_is_latched);
+        node_deleted = index > 0;
+    }
+
+    neighbor->page->wunlatch();
+    buffer_pool_manager_->unpin_page(neighbor->get_page_id(), true);
+    delete neighbor;
+    buffer_pool_manager_->unpin_page(parent->get_page_id(), true);
+    delete parent;
+    return node_deleted;
 }
 
 /**
@@ -300,7 +915,16 @@ bool IxIndexHandle::adjust_root(IxNodeHandle *old_root_node) {
     // 1. 如果old_root_node是内部结点，并且大小为1，则直接把它的孩子更新成新的根结点
     // 2. 如果old_root_node是叶结点，且大小为0，则直接更新root page
     // 3. 除了上述两种情况，不需要进行操作
-
+    // 叶子结点作为根结点时允许为空，保留该结点作为空树的根，这样first_leaf_也不会改变
+    if (!old_root_node->is_leaf_page() && old_root_node->get_size() == 1) {
+        IxNodeHandle *child = fetch_node(old_root_node->remove_and_return_only_child());
+        child->set_parent_page_no(IX_NO_PAGE);
+        update_root_page_no(child->get_page_no());
+        buffer_pool_manager_->unpin_page(child->get_page_id(), true);
+        delete child;
+        release_node_handle(*old_root_node);
+        return true;
+    }
     return false;
 }
 
@@ -317,13 +941,47 @@ bool IxIndexHandle::adjust_root(IxNodeHandle *old_root_node) {
  * index=0，则neighbor是node后继结点，表示：node(left)      neighbor(right)
  * index>0，则neighbor是node前驱结点，表示：neighbor(left)  node(right)
  * 注意更新parent结点的相关kv对
+ * @return 是否进行了重新分配；压缩格式中parent放不下新的分隔key时不进行重新分配，返回false
  */
-void IxIndexHandle::redistribute(IxNodeHandle *neighbor_node, IxNodeHandle *node, IxNodeHandle *parent, int index) {
+bool IxIndexHandle::redistribute(IxNodeHandle *neighbor_node, IxNodeHandle *node, IxNodeHandle *parent, int index) {
     // Todo:
     // 1. 通过index判断neighbor_node是否为node的前驱结点
     // 2. 从neighbor_node中移动一个键值对到node结点中
     // 3. 更新父节点中的相关信息，并且修改移动键值对对应孩字结点的父结点信息（maintain_child函数）
     // 注意：neighbor_node的位置不同，需要移动的键值对不同，需要分类讨论
+    // 先算出移动之后父结点中的分隔key：叶子结点为移动的key与其相邻key之间的分隔key，内部结点为移动之后右侧结点的第一个key
+    char sep[IX_MAX_COL_LEN], buf[IX_MAX_COL_LEN], moved_buf[IX_MAX_COL_LEN];
+    bool is_leaf = node->is_leaf_page();
+    if (index == 0) {
+        // node(left) neighbor(right)：把neighbor的第一个键值对移动到node的末尾
+        const char *moved = neighbor_node->get_key(0, moved_buf);
+        const char *next = neighbor_node->get_key(1, buf);
+        if (is_leaf) {
+            make_separator(moved, next, sep);
+        } else {
+            memcpy(sep, next, file_hdr_->col_tot_len_);
+        }
+        if (!parent->can_set_key(sep)) return false;
+        node->insert_pair(node->get_size(), moved, *neighbor_node->get_rid(0));
+        neighbor_node->erase_pair(0);
+        maintain_child(node, node->get_size() - 1);
+        parent->set_key(1, sep);
+    } else {
+        // neighbor(left) node(right)：把neighbor的最后一个键值对移动到node的开头
+        int last = neighbor_node->get_size() - 1;
+        const char *moved = neighbor_node->get_key(last, moved_buf);
+        if (is_leaf) {
+            make_separator(neighbor_node->get_key(last - 1, buf), moved, sep);
+        } else {
+            memcpy(sep, moved, file_hdr_->col_tot_len_);
+        }
+        if (!parent->can_set_key(sep)) return false;
+        node->insert_pair(0, moved, *neighbor_node->get_rid(last));
+        neighbor_node->erase_pair(last);
+        maintain_child(node, 0);
+        parent->set_key(index, sep);
+    }
+    return true;
 }
 
 /**
@@ -347,8 +1005,220 @@ bool IxIndexHandle::coalesce(IxNodeHandle **neighbor_node, IxNodeHandle **node,
     // 2. 把node结点的键值对移动到neighbor_node中，并更新node结点孩子结点的父节点信息（调用maintain_child函数）
     // 3. 释放和删除node结点，并删除parent中node结点的信息，返回parent是否需要被删除
     // 提示：如果是叶子结点且为最右叶子结点，需要更新file_hdr_.last_leaf
+    if (index == 0) {
+        std::swap(*neighbor_node, *node);
+        index = 1;
+    }
+    IxNodeHandle *left = *neighbor_node, *right = *node;
+    int left_size = left->get_size();
+    std::vector<char> right_keys((size_t)right->get_size() * file_hdr_->col_tot_len_);
+    right->get_keys(0, right->get_size(), right_keys.data());
+    left->insert_pairs(left_size, right_keys.data(), right->get_rid(0), right->get_size());
+    if (left->is_leaf_page()) {
+        erase_leaf(right);
+    } else {
+        for (int i = left_size; i < left->get_size(); i++) {
+            maintain_child(left, i);
+        }
+    }
+    release_node_handle(*right);
+    transaction->append_index_deleted_page(right->page);
 
-    return false;
+    (*parent)->erase_pair(index);
+    return coalesce_or_redistribute(*parent, transaction, root_is_latched);
+}
+
+/**
+ * @brief 分配一个posting list页面
+ */
+Page *IxIndexHandle::create_posting_page() {
+    {
+        std::scoped_lock lock{file_hdr_latch_};
+        file_hdr_->num_pages_++;
+    }
+    PageId new_page_id = {.fd = fd_, .page_no = INVALID_PAGE_ID};
+    return buffer_pool_manager_->new_page(&new_page_id);
+}
+
+// 释放不再使用的posting list页面，调用前需要unpin
+void IxIndexHandle::delete_posting_page(const PageId &page_id) {
+    {
+        std::scoped_lock lock{file_hdr_latch_};
+        file_hdr_->num_pages_--;
+    }
+    buffer_pool_manager_->delete_page(page_id);
+}
+
+// 将有序的rids编码后写入page
+void IxIndexHandle::posting_write(Page *page, const Rid *rids, int n, page_id_t next_page) {
+    IxPostingHdr *hdr = posting_hdr(page);
+    hdr->next_page = next_page;
+    hdr->num_rids = n;
+    hdr->num_bytes = ix_posting_encode(rids, n, page->get_data() + sizeof(IxPostingHdr));
+    hdr->last = rids[n - 1];
+    assert(hdr->num_bytes <= IX_POSTING_CAPACITY);
+}
+
+/**
+ * @brief 用有序的rids（至少两个）建立posting list，每个页面尽量放满
+ *
+ * @return 叶子结点中指向posting list的rid
+ */
+Rid IxIndexHandle::posting_build(const Rid *rids, int n) {
+    assert(n > 1);
+    page_id_t first = IX_NO_PAGE;
+    Page *prev = nullptr;
+    for (int i = 0; i < n;) {
+        int j = i, bytes = 0;
+        uint64_t last = 0;
+        while (j < n) {
+            int len = ix_varint_len(ix_rid_ord(rids[j]) - last);
+            if (bytes + len > IX_POSTING_CAPACITY) break;
+            bytes += len;
+            last = ix_rid_ord(rids[j]);
+            j++;
+        }
+        Page *page = create_posting_page();
+        posting_write(page, rids + i, j - i, IX_NO_PAGE);
+        if (prev != nullptr) {
+            posting_hdr(prev)->next_page = page->get_page_id().page_no;
+            buffer_pool_manager_->unpin_page(prev->get_page_id(), true);
+        } else {
+            first = page->get_page_id().page_no;
+        }
+        prev = page;
+        i = j;
+    }
+    buffer_pool_manager_->unpin_page(prev->get_page_id(), true);
+    return Rid{.page_no = first, .slot_no = IX_POSTING_SLOT};
+}
+
+/**
+ * @brief 将rid加入叶子结点中ref对应的posting list，ref是直接存放的rid时转换为posting list
+ *
+ * @param ref 叶子结点中key对应的rid，调用者持有叶子结点的写锁
+ * @return rid已经存在时返回false
+ */
+bool IxIndexHandle::posting_insert(Rid *ref, const Rid &rid) {
+    if (!ix_is_posting(*ref)) {
+        if (*ref == rid) return false;
+        Rid pair[2] = {*ref, rid};
+        if (ix_rid_less(rid, *ref)) std::swap(pair[0], pair[1]);
+        *ref = posting_build(pair, 2);
+        return true;
+    }
+    // rid放入第一个最大rid不小于它的页面，比所有rid都大时放入最后一个页面
+    Page *page = buffer_pool_manager_->fetch_page(PageId{fd_, ref->page_no});
+    while (posting_hdr(page)->next_page != IX_NO_PAGE && ix_rid_less(posting_hdr(page)->last, rid)) {
+        page_id_t next = posting_hdr(page)->next_page;
+        buffer_pool_manager_->unpin_page(page->get_page_id(), false);
+        page = buffer_pool_manager_->fetch_page(PageId{fd_, next});
+    }
+    IxPostingHdr *hdr = posting_hdr(page);
+    std::vector<Rid> rids;
+    rids.reserve(hdr->num_rids + 1);
+    ix_posting_decode(page->get_data() + sizeof(IxPostingHdr), hdr->num_rids, &rids);
+    auto pos = std::lower_bound(rids.begin(), rids.end(), rid, ix_rid_less);
+    if (pos != rids.end() && *pos == rid) {
+        buffer_pool_manager_->unpin_page(page->get_page_id(), false);
+        return false;
+    }
+    rids.insert(pos, rid);
+    if (ix_posting_encode(rids.data(), rids.size(), nullptr) <= IX_POSTING_CAPACITY) {
+        posting_write(page, rids.data(), rids.size(), hdr->next_page);
+    } else {
+        // 页面放不下时分裂，后一半放入新页面，链接在当前页面之后
+        int half = rids.size() / 2;
+        Page *new_page = create_posting_page();
+        posting_write(new_page, rids.data() + half, rids.size() - half, hdr->next_page);
+        posting_write(page, rids.data(), half, new_page->get_page_id().page_no);
+        buffer_pool_manager_->unpin_page(new_page->get_page_id(), true);
+    }
+    buffer_pool_manager_->unpin_page(page->get_page_id(), true);
+    return true;
+}
+
+/**
+ * @brief 从ref对应的posting list中删除rid，删空的页面从链表中摘除，只剩一个rid时改为直接存放在叶子结点中
+ *
+ * @param ref 叶子结点中key对应的rid，指向posting list，调用者持有叶子结点的写锁
+ * @return rid是否存在
+ */
+bool IxIndexHandle::posting_erase(Rid *ref, const Rid &rid) {
+    Page *prev = nullptr;
+    Page *page = buffer_pool_manager_->fetch_page(PageId{fd_, ref->page_no});
+    while (posting_hdr(page)->next_page != IX_NO_PAGE && ix_rid_less(posting_hdr(page)->last, rid)) {
+        page_id_t next = posting_hdr(page)->next_page;
+        if (prev != nullptr) buffer_pool_manager_->unpin_page(prev->get_page_id(), false);
+        prev = page;
+        page = buffer_pool_manager_->fetch_page(PageId{fd_, next});
+    }
+    IxPostingHdr *hdr = posting_hdr(page);
+    std::vector<Rid> rids;
+    ix_posting_decode(page->get_data() + sizeof(IxPostingHdr), hdr->num_rids, &rids);
+    auto pos = std::lower_bound(rids.begin(), rids.end(), rid, ix_rid_less);
+    bool found = pos != rids.end() && *pos == rid;
+    bool prev_dirty = false;
+    if (found) {
+        rids.erase(pos);
+    }
+    if (found && rids.empty()) {
+        if (prev != nullptr) {
+            posting_hdr(prev)->next_page = hdr->next_page;
+            prev_dirty = true;
+        } else {
+            ref->page_no = hdr->next_page;
+        }
+        buffer_pool_manager_->unpin_page(page->get_page_id(), false);
+        delete_posting_page(page->get_page_id());
+    } else {
+        if (found) {
+            posting_write(page, rids.data(), rids.size(), hdr->next_page);
+        }
+        buffer_pool_manager_->unpin_page(page->get_page_id(), found);
+    }
+    if (prev != nullptr) {
+        buffer_pool_manager_->unpin_page(prev->get_page_id(), prev_dirty);
+    }
+    if (!found) return false;
+
+    Page *first = buffer_pool_manager_->fetch_page(PageId{fd_, ref->page_no});
+    hdr = posting_hdr(first);
+    bool single = hdr->next_page == IX_NO_PAGE && hdr->num_rids == 1;
+    if (single) {
+        *ref = hdr->last;
+    }
+    buffer_pool_manager_->unpin_page(first->get_page_id(), false);
+    if (single) {
+        delete_posting_page(first->get_page_id());
+    }
+    return true;
+}
+
+// 将ref对应的所有rid依次加入rids，ref不是posting list时就是唯一的rid
+void IxIndexHandle::posting_read(const Rid &ref, std::vector<Rid> *rids) const {
+    if (!ix_is_posting(ref)) {
+        rids->push_back(ref);
+        return;
+    }
+    for (page_id_t page_no = ref.page_no; page_no != IX_NO_PAGE;) {
+        Page *page = buffer_pool_manager_->fetch_page(PageId{fd_, page_no});
+        IxPostingHdr *hdr = posting_hdr(page);
+        ix_posting_decode(page->get_data() + sizeof(IxPostingHdr), hdr->num_rids, rids);
+        page_no = hdr->next_page;
+        buffer_pool_manager_->unpin_page(page->get_page_id(), false);
+    }
+}
+
+// 释放ref对应的posting list的所有页面
+void IxIndexHandle::posting_free(const Rid &ref) {
+    if (!ix_is_posting(ref)) return;
+    for (page_id_t page_no = ref.page_no; page_no != IX_NO_PAGE;) {
+        Page *page = buffer_pool_manager_->fetch_page(PageId{fd_, page_no});
+        page_no = posting_hdr(page)->next_page;
+        buffer_pool_manager_->unpin_page(page->get_page_id(), false);
+        delete_posting_page(page->get_page_id());
+    }
 }
 
 /**
@@ -362,11 +1232,18 @@ bool IxIndexHandle::coalesce(IxNodeHandle **neighbor_node, IxNodeHandle **node,
  */
 Rid IxIndexHandle::get_rid(const Iid &iid) const {
     IxNodeHandle *node = fetch_node(iid.page_no);
+    node->page->rlatch();
     if (iid.slot_no >= node->get_size()) {
+        node->page->runlatch();
+        buffer_pool_manager_->unpin_page(node->get_page_id(), false);
+        delete node;
         throw IndexEntryNotFoundError();
     }
+    Rid rid = *node->get_rid(iid.slot_no);
+    node->page->runlatch();
     buffer_pool_manager_->unpin_page(node->get_page_id(), false);  // unpin it!
-    return *node->get_rid(iid.slot_no);
+    delete node;
+    return rid;
 }
 
 /**
@@ -378,8 +1255,18 @@ Rid IxIndexHandle::get_rid(const Iid &iid) const {
  * 可用*(int *)key转换回去
  */
 Iid IxIndexHandle::lower_bound(const char *key) {
-
-    return Iid{-1, -1};
+    char key_buf[IX_MAX_COL_LEN];
+    key = encode_key(key, key_buf);
+    auto [leaf, root_is_latched] = find_leaf_page(key, Operation::FIND, nullptr);
+    Iid iid = {.page_no = leaf->get_page_no(), .slot_no = leaf->lower_bound(key)};
+    if (iid.slot_no == leaf->get_size() && leaf->get_next_leaf() != IX_LEAF_HEADER_PAGE) {
+        // 目标位置在下一个叶子结点的开头
+        iid = {.page_no = leaf->get_next_leaf(), .slot_no = 0};
+    }
+    leaf->page->runlatch();
+    buffer_pool_manager_->unpin_page(leaf->get_page_id(), false);
+    delete leaf;
+    return iid;
 }
 
 /**
@@ -389,8 +1276,24 @@ Iid IxIndexHandle::lower_bound(const char *key) {
  * @return Iid
  */
 Iid IxIndexHandle::upper_bound(const char *key) {
-    
-    return Iid{-1, -1};
+    char key_buf[IX_MAX_COL_LEN];
+    key = encode_key(key, key_buf);
+    auto [leaf, root_is_latched] = find_leaf_page(key, Operation::FIND, nullptr);
+    // 结点的upper_bound从1开始查找，只适用于内部结点，叶子结点中用lower_bound再跳过相等的key
+    char buf[IX_MAX_COL_LEN];
+    int pos = leaf->lower_bound(key);
+    if (pos < leaf->get_size() &&
+        ix_compare(leaf->get_key(pos, buf), key, file_hdr_) == 0) {
+        pos++;
+    }
+    Iid iid = {.page_no = leaf->get_page_no(), .slot_no = pos};
+    if (iid.slot_no == leaf->get_size() && leaf->get_next_leaf() != IX_LEAF_HEADER_PAGE) {
+        iid = {.page_no = leaf->get_next_leaf(), .slot_no = 0};
+    }
+    leaf->page->runlatch();
+    buffer_pool_manager_->unpin_page(leaf->get_page_id(), false);
+    delete leaf;
+    return iid;
 }
 
 /**
@@ -400,10 +1303,26 @@ Iid IxIndexHandle::upper_bound(const char *key) {
  * @return Iid
  */
 Iid IxIndexHandle::leaf_end() const {
-    IxNodeHandle *node = fetch_node(file_hdr_->last_leaf_);
-    Iid iid = {.page_no = file_hdr_->last_leaf_, .slot_no = node->get_size()};
-    buffer_pool_manager_->unpin_page(node->get_page_id(), false);  // unpin it!
-    return iid;
+    while (true) {
+        // last_leaf_由leaf header页面的锁保护；读到之后最后一个叶子结点可能已经分裂，需要重新检查
+        IxNodeHandle *header = fetch_node(IX_LEAF_HEADER_PAGE);
+        header->page->rlatch();
+        page_id_t last_leaf = file_hdr_->last_leaf_;
+        header->page->runlatch();
+        buffer_pool_manager_->unpin_page(header->get_page_id(), false);
+        delete header;
+
+        IxNodeHandle *node = fetch_node(last_leaf);
+        node->page->rlatch();
+        bool is_last = node->get_next_leaf() == IX_LEAF_HEADER_PAGE;
+        Iid iid = {.page_no = last_leaf, .slot_no = node->get_size()};
+        node->page->runlatch();
+        buffer_pool_manager_->unpin_page(node->get_page_id(), false);  // unpin it!
+        delete node;
+        if (is_last) {
+            return iid;
+        }
+    }
 }
 
 /**
@@ -417,6 +1336,190 @@ Iid IxIndexHandle::leaf_begin() const {
     return iid;
 }
 
+/**
+ * @brief 用有序的键值对自底向上建立B+树，用于在已有数据的表上创建索引
+ * 先按顺序填满叶子结点，再用每个结点的第一个key逐层建立内部结点，直到只剩下一个根结点
+ *
+ * @param sorter 已经调用过sort()的外部排序器，按照(key, rid)从小到大输出原始格式的键值对
+ * @param fill_factor 每个结点填入的键值对数量占btree_order的比例，留出的空间供之后的插入使用
+ * @return 唯一索引中出现重复的key时停止建立并返回false，此时的索引文件不完整，由调用者删除
+ * @note 只能在刚刚创建的空索引上调用，此时索引还不会被其他线程访问，不需要加锁
+ */
+bool IxIndexHandle::bulk_load(IxSorter *sorter, double fill_factor) {
+    assert(file_hdr_->root_page_ == IX_INIT_ROOT_PAGE && file_hdr_->num_pages_ == IX_INIT_NUM_PAGES);
+    int key_len = file_hdr_->col_tot_len_;
+    bool compressed = file_hdr_->version_ >= IX_FORMAT_COMPRESSED;
+    IxNodeHandle *leaf = fetch_node(IX_INIT_ROOT_PAGE);
+    // 结点中的键值对达到max_size时才分裂，所以最多填入max_size - 1个；内部结点至少需要两个孩子才能减少层数
+    int capacity = leaf->get_max_size() - 1;
+    int fill = std::max(2, std::min(capacity, (int)(capacity * fill_factor)));
+    // 压缩格式中每个key占用的空间不同，还要按照字节数限制填充的比例
+    int fill_bytes = sizeof(IxPageHdr) + (int)((PAGE_SIZE - sizeof(IxPageHdr)) * fill_factor);
+
+    std::vector<char> level_keys;           // 当前层每个结点的第一个key
+    std::vector<page_id_t> level_pages;     // 当前层每个结点的页面号
+
+    // 1. 依次填满叶子结点，第一个叶子结点复用初始的根结点
+    std::vector<char> key(key_len);
+    std::vector<char> last_key(key_len);
+    char key_buf[IX_MAX_COL_LEN];
+    bool has_last = false;
+    Rid rid;
+    IxNodeHandle *prev = nullptr;
+    // 每个结点在父结点中的key：叶子结点为与左侧叶子结点之间的分隔key，内部结点为第一个key
+    auto add_to_level = [&](IxNodeHandle *node, IxNodeHandle *left) {
+        char first_buf[IX_MAX_COL_LEN], last_buf[IX_MAX_COL_LEN], sep[IX_MAX_COL_LEN];
+        const char *first = node->get_key(0, first_buf);
+        if (left != nullptr) {
+            make_separator(left->get_key(left->get_size() - 1, last_buf), first, sep);
+            first = sep;
+        }
+        level_keys.insert(level_keys.end(), first, first + key_len);
+        level_pages.push_back(node->get_page_no());
+    };
+    // 非唯一索引中当前key的所有rid，key改变时写成posting list，放入最后一个键值对
+    std::vector<Rid> dup_rids;
+    auto flush_dups = [&]() {
+        if (dup_rids.size() > 1) {
+            *leaf->get_rid(leaf->get_size() - 1) = posting_build(dup_rids.data(), dup_rids.size());
+        }
+        dup_rids.clear();
+    };
+    while (sorter->next(key.data(), &rid)) {
+        // 非唯一索引中sorter按(key, rid)排序，rid依次加入posting list；唯一索引中不能有重复的key
+        if (has_last && ix_compare(key.data(), last_key.data(), file_hdr_->col_types_, file_hdr_->col_lens_) == 0) {
+            if (file_hdr_->unique_) {
+                if (prev != nullptr) {
+                    buffer_pool_manager_->unpin_page(prev->get_page_id(), true);
+                    delete prev;
+                }
+                buffer_pool_manager_->unpin_page(leaf->get_page_id(), true);
+                delete leaf;
+                return false;
+            }
+            dup_rids.push_back(rid);
+            continue;
+        }
+        flush_dups();
+        dup_rids.push_back(rid);
+        memcpy(last_key.data(), key.data(), key_len);
+        has_last = true;
+
+        const char *encoded = encode_key(key.data(), key_buf);
+        if (leaf->get_size() == fill || (compressed && leaf->bytes_with(encoded, leaf->get_size() + 1) > fill_bytes)) {
+            IxNodeHandle *new_leaf = create_node();
+            *new_leaf->page_hdr = {
+                .next_free_page_no = IX_NO_PAGE,
+                .parent = IX_NO_PAGE,
+                .num_key = 0,
+                .is_leaf = true,
+                .prev_leaf = leaf->get_page_no(),
+                .next_leaf = IX_LEAF_HEADER_PAGE,
+            };
+            leaf->set_next_leaf(new_leaf->get_page_no());
+            add_to_level(leaf, prev);
+            if (prev != nullptr) {
+                buffer_pool_manager_->unpin_page(prev->get_page_id(), true);
+                delete prev;
+            }
+            prev = leaf;
+            leaf = new_leaf;
+        }
+        leaf->insert_pair(leaf->get_size(), encoded, rid);
+    }
+    if (leaf->get_size() > 0) {
+        flush_dups();
+    }
+    // 最后一个叶子结点过少时，从前一个叶子结点移过来一部分键值对
+    if (prev != nullptr && leaf->get_size() < leaf->get_min_size()) {
+        int total = prev->get_size() + leaf->get_size();
+        while (leaf->get_size() < total / 2) {
+            int last = prev->get_size() - 1;
+            const char *moved = prev->get_key(last, key_buf);
+            if (!leaf->can_insert(moved)) break;
+            leaf->insert_pair(0, moved, *prev->get_rid(last));
+            prev->erase_pair(last);
+        }
+    }
+    page_id_t last_leaf = leaf->get_page_no();
+    if (leaf->get_size() > 0) {
+        add_to_level(leaf, prev);
+    }
+    if (prev != nullptr) {
+        buffer_pool_manager_->unpin_page(prev->get_page_id(), true);
+        delete prev;
+    }
+    buffer_pool_manager_->unpin_page(leaf->get_page_id(), true);
+    delete leaf;
+
+    IxNodeHandle *leaf_header = fetch_node(IX_LEAF_HEADER_PAGE);
+    leaf_header->set_prev_leaf(last_leaf);
+    buffer_pool_manager_->unpin_page(leaf_header->get_page_id(), true);
+    delete leaf_header;
+    file_hdr_->last_leaf_ = last_leaf;
+
+    // 2. 逐层建立内部结点，每层的结点数量确定后平均分配孩子，避免最后一个结点过少
+    while (level_pages.size() > 1) {
+        int num_children = level_pages.size();
+        int num_nodes = (num_children + fill - 1) / fill;
+        // 压缩格式中还要保证每个结点都不超过fill_bytes，有序的key的公共前缀就是第一个和最后一个key的公共前缀
+        auto chunk_fits = [&](int start, int cnt) {
+            const char *first = level_keys.data() + (size_t)start * key_len;
+            const char *last = first + (size_t)(cnt - 1) * key_len;
+            int max_len = 0;
+            for (int j = 0; j < cnt; j++) {
+                max_len = std::max(max_len, ix_key_siglen(first + (size_t)j * key_len, key_len));
+            }
+            int prefix_len = std::min(max_len, ix_common_prefix(first, last, key_len));
+            return ix_node_bytes(prefix_len, max_len - prefix_len, cnt) <= fill_bytes;
+        };
+        while (compressed && num_nodes < num_children) {
+            bool fits = true;
+            for (int i = 0, start = 0; i < num_nodes && fits; i++) {
+                int cnt = num_children / num_nodes + (i < num_children % num_nodes ? 1 : 0);
+                fits = chunk_fits(start, cnt);
+                start += cnt;
+            }
+            if (fits) break;
+            num_nodes++;
+        }
+        std::vector<Rid> children(num_children);
+        for (int i = 0; i < num_children; i++) {
+            children[i] = Rid{level_pages[i], -1};
+        }
+        std::vector<char> child_keys;
+        child_keys.swap(level_keys);
+        level_pages.clear();
+
+        for (int i = 0, start = 0; i < num_nodes; i++) {
+            int cnt = num_children / num_nodes + (i < num_children % num_nodes ? 1 : 0);
+            IxNodeHandle *node = create_node();
+            *node->page_hdr = {
+                .next_free_page_no = IX_NO_PAGE,
+                .parent = IX_NO_PAGE,
+                .num_key = 0,
+                .is_leaf = false,
+                .prev_leaf = IX_NO_PAGE,
+                .next_leaf = IX_NO_PAGE,
+            };
+            node->insert_pairs(0, child_keys.data() + (size_t)start * key_len, children.data() + start, cnt);
+            for (int j = 0; j < cnt; j++) {
+                maintain_child(node, j);
+            }
+            add_to_level(node, nullptr);
+            buffer_pool_manager_->unpin_page(node->get_page_id(), true);
+            delete node;
+            start += cnt;
+        }
+    }
+
+    // 3. 最后剩下的结点就是根结点
+    if (!level_pages.empty()) {
+        update_root_page_no(level_pages[0]);
+    }
+    return true;
+}
+
 /**
  * @brief 获取一个指定结点
  *
@@ -443,7 +1546,10 @@ IxNodeHandle *IxIndexHandle::fetch_node(int page_no) const {
  */
 IxNodeHandle *IxIndexHandle::create_node() {
     IxNodeHandle *node;
-    file_hdr_->num_pages_++;
+    {
+        std::scoped_lock lock{file_hdr_latch_};
+        file_hdr_->num_pages_++;
+    }
 
     PageId new_page_id = {.fd = fd_, .page_no = INVALID_PAGE_ID};
     // 从3开始分配page_no，第一次分配之后，new_page_id.page_no=3，file_hdr_.num_pages=4
@@ -458,21 +1564,34 @@ IxNodeHandle *IxIndexHandle::create_node() {
  * @param node
  */
 void IxIndexHandle::maintain_parent(IxNodeHandle *node) {
+    // 压缩格式中父结点的key只是子树中key的下界，第一个key变化时不需要更新
+    if (file_hdr_->version_ >= IX_FORMAT_COMPRESSED) return;
+    // 只有第一个key发生变化的结点才会修改父结点，这样的结点都不安全，其父结点一定被本线程锁住
     IxNodeHandle *curr = node;
     while (curr->get_parent_page_no() != IX_NO_PAGE) {
         // Load its parent
         IxNodeHandle *parent = fetch_node(curr->get_parent_page_no());
         int rank = parent->find_child(curr);
-        char *parent_key = parent->get_key(rank);
-        char *child_first_key = curr->get_key(0);
-        if (memcmp(parent_key, child_first_key, file_hdr_->col_tot_len_) == 0) {
-            assert(buffer_pool_manager_->unpin_page(parent->get_page_id(), true));
-            break;
+        char parent_buf[IX_MAX_COL_LEN], child_buf[IX_MAX_COL_LEN];
+        const char *parent_key = parent->get_key(rank, parent_buf);
+        const char *child_first_key = curr->get_key(0, child_buf);
+        bool changed = memcmp(parent_key, child_first_key, file_hdr_->col_tot_len_) != 0;
+        if (changed) {
+            parent->set_key(rank, child_first_key);  // 修改了parent node
+        }
+        if (curr != node) {
+            buffer_pool_manager_->unpin_page(curr->get_page_id(), true);
+            delete curr;
         }
-        memcpy(parent_key, child_first_key, file_hdr_->col_tot_len_);  // 修改了parent node
         curr = parent;
-
-        assert(buffer_pool_manager_->unpin_page(parent->get_page_id(), true));
+        if (!changed || rank != 0) {
+            // 父结点的第一个key没有改变，不需要继续向上更新
+            break;
+        }
+    }
+    if (curr != node) {
+        buffer_pool_manager_->unpin_page(curr->get_page_id(), true);
+        delete curr;
     }
 }
 
@@ -484,13 +1603,22 @@ void IxIndexHandle::maintain_parent(IxNodeHandle *node) {
 void IxIndexHandle::erase_leaf(IxNodeHandle *leaf) {
     assert(leaf->is_leaf_page());
 
+    // 合并时总是删除右侧结点，其前驱就是已经被本线程锁住的左侧兄弟结点
     IxNodeHandle *prev = fetch_node(leaf->get_prev_leaf());
     prev->set_next_leaf(leaf->get_next_leaf());
     buffer_pool_manager_->unpin_page(prev->get_page_id(), true);
+    delete prev;
 
+    // 后继结点（可能是leaf header）需要单独加锁
     IxNodeHandle *next = fetch_node(leaf->get_next_leaf());
+    next->page->wlatch();
     next->set_prev_leaf(leaf->get_prev_leaf());  // 注意此处是SetPrevLeaf()
+    if (next->get_page_no() == IX_LEAF_HEADER_PAGE) {
+        file_hdr_->last_leaf_ = leaf->get_prev_leaf();
+    }
+    next->page->wunlatch();
     buffer_pool_manager_->unpin_page(next->get_page_id(), true);
+    delete next;
 }
 
 /**
@@ -499,6 +1627,7 @@ void IxIndexHandle::erase_leaf(IxNodeHandle *leaf) {
  * @param node
  */
 void IxIndexHandle::release_node_handle(IxNodeHandle &node) {
+    std::scoped_lock lock{file_hdr_latch_};
     file_hdr_->num_pages_--;
 }
 
@@ -512,5 +1641,6 @@ void IxIndexHandle::maintain_child(IxNodeHandle *node, int child_idx) {
         IxNodeHandle *child = fetch_node(child_page_no);
         child->set_parent_page_no(node->get_page_no());
         buffer_pool_manager_->unpin_page(child->get_page_id(), true);
+        delete child;
     }
 }
\ No newline at end of file
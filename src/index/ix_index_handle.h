@@ -10,9 +10,14 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <shared_mutex>
+
 #include "ix_defs.h"
+#include "ix_posting.h"
 #include "transaction/transaction.h"
 
+class IxSorter;
+
 enum class Operation { FIND = 0, INSERT, DELETE };  // 三种操作：查找、插入、删除
 
 static const bool binary_search = false;
@@ -46,6 +51,117 @@ inline int ix_compare(const char* a, const char* b, const std::vector<ColType>&
     return 0;
 }
 
+/* 比较索引中存放的两个key，IX_FORMAT_NORMALIZED格式的key直接用memcmp比较 */
+inline int ix_compare(const char *a, const char *b, const IxFileHdr *file_hdr) {
+    if (file_hdr->version_ >= IX_FORMAT_NORMALIZED) {
+        return memcmp(a, b, file_hdr->col_tot_len_);
+    }
+    return ix_compare(a, b, file_hdr->col_types_, file_hdr->col_lens_);
+}
+
+/**
+ * @description: 将一个字段编码为可以用memcmp比较的格式，编码后的长度不变
+ * int翻转符号位后按大端序存放；float的正数翻转符号位、负数翻转所有位后按大端序存放；字符串已经用0填充到定长，原样存放
+ */
+inline void ix_encode_col(const char *src, char *dst, ColType type, int col_len) {
+    uint32_t bits;
+    switch (type) {
+        case TYPE_INT:
+            memcpy(&bits, src, sizeof(uint32_t));
+            bits = __builtin_bswap32(bits ^ 0x80000000u);
+            memcpy(dst, &bits, sizeof(uint32_t));
+            break;
+        case TYPE_FLOAT: {
+            float val;
+            memcpy(&val, src, sizeof(float));
+            if (val == 0) val = 0;  // -0.0和0.0相等，统一编码为0.0
+            memcpy(&bits, &val, sizeof(uint32_t));
+            bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+            bits = __builtin_bswap32(bits);
+            memcpy(dst, &bits, sizeof(uint32_t));
+            break;
+        }
+        case TYPE_STRING:
+            memcpy(dst, src, col_len);
+            break;
+        default:
+            throw InternalError("Unexpected data type");
+    }
+}
+
+/* ix_encode_col的逆过程 */
+inline void ix_decode_col(const char *src, char *dst, ColType type, int col_len) {
+    uint32_t bits;
+    switch (type) {
+        case TYPE_INT:
+            memcpy(&bits, src, sizeof(uint32_t));
+            bits = __builtin_bswap32(bits) ^ 0x80000000u;
+            memcpy(dst, &bits, sizeof(uint32_t));
+            break;
+        case TYPE_FLOAT:
+            memcpy(&bits, src, sizeof(uint32_t));
+            bits = __builtin_bswap32(bits);
+            bits = (bits & 0x80000000u) ? (bits & 0x7fffffffu) : ~bits;
+            memcpy(dst, &bits, sizeof(uint32_t));
+            break;
+        case TYPE_STRING:
+            memcpy(dst, src, col_len);
+            break;
+        default:
+            throw InternalError("Unexpected data type");
+    }
+}
+
+/* 将上层传入的原始格式的key编码为索引中存放的格式，IX_FORMAT_RAW格式的索引不需要编码 */
+inline void ix_encode_key(const char *src, char *dst, const IxFileHdr *file_hdr) {
+    if (file_hdr->version_ < IX_FORMAT_NORMALIZED) {
+        memcpy(dst, src, file_hdr->col_tot_len_);
+        return;
+    }
+    int offset = 0;
+    for (int i = 0; i < file_hdr->col_num_; i++) {
+        ix_encode_col(src + offset, dst + offset, file_hdr->col_types_[i], file_hdr->col_lens_[i]);
+        offset += file_hdr->col_lens_[i];
+    }
+}
+
+/* 将索引中存放的key还原为原始格式 */
+inline void ix_decode_key(const char *src, char *dst, const IxFileHdr *file_hdr) {
+    if (file_hdr->version_ < IX_FORMAT_NORMALIZED) {
+        memcpy(dst, src, file_hdr->col_tot_len_);
+        return;
+    }
+    int offset = 0;
+    for (int i = 0; i < file_hdr->col_num_; i++) {
+        ix_decode_col(src + offset, dst + offset, file_hdr->col_types_[i], file_hdr->col_lens_[i]);
+        offset += file_hdr->col_lens_[i];
+    }
+}
+
+/* 返回a和b从第一个字节开始的公共前缀长度，不超过len */
+inline int ix_common_prefix(const char *a, const char *b, int len) {
+    int i = 0;
+    for (; i + 8 <= len; i += 8) {
+        uint64_t x, y;
+        memcpy(&x, a + i, 8);
+        memcpy(&y, b + i, 8);
+        if (x != y) break;
+    }
+    while (i < len && a[i] == b[i]) i++;
+    return i;
+}
+
+/* 返回key去掉末尾的0之后的长度 */
+inline int ix_key_siglen(const char *key, int len) {
+    while (len > 0 && key[len - 1] == 0) len--;
+    return len;
+}
+
+/* IX_FORMAT_COMPRESSED格式的结点存放n个键值对占用的字节数，包括页面头 */
+inline int ix_node_bytes(int prefix_len, int key_len, int n) {
+    return sizeof(IxPageHdr) + sizeof(IxKeyFmt) + prefix_len + n * (key_len + (int)sizeof(Rid));
+}
+
 /* 管理B+树中的每个节点 */
 class IxNodeHandle {
     friend class IxIndexHandle;
@@ -57,6 +173,22 @@ class IxNodeHandle {
     IxPageHdr *page_hdr;            // page->data的第一部分，指针指向首地址，长度为sizeof(IxPageHdr)
     char *keys;                     // page->data的第二部分，指针指向首地址，长度为file_hdr->keys_size，每个key的长度为file_hdr->col_len
     Rid *rids;                      // page->data的第三部分，指针指向首地址
+    // IX_FORMAT_COMPRESSED格式的结点中keys指向IxKeyFmt，rids紧跟在num_key个key之后，位置随num_key变化，不使用rids
+
+    bool is_compressed() const { return file_hdr->version_ >= IX_FORMAT_COMPRESSED; }
+
+    IxKeyFmt *key_fmt() const { return reinterpret_cast<IxKeyFmt *>(keys); }
+
+    char *key_prefix() const { return keys + sizeof(IxKeyFmt); }
+
+    // 压缩格式中第i个key去掉公共前缀后存放的位置，i=num_key时为rid数组的起始位置
+    char *key_suffix(int i) const { return key_prefix() + key_fmt()->prefix_len + i * key_fmt()->key_len; }
+
+    bool conforms(const char *key) const;
+
+    int bytes_with(const char *key, int n) const;
+
+    void rebuild(const char *keys_src, const Rid *rids_src, int n);
 
    public:
     IxNodeHandle() = default;
@@ -67,15 +199,24 @@ class IxNodeHandle {
         rids = reinterpret_cast<Rid *>(keys + file_hdr->keys_size_);
     }
 
-    int get_size() { return page_hdr->num_key; }
+    int get_size() const { return page_hdr->num_key; }
 
     void set_size(int size) { page_hdr->num_key = size; }
 
-    int get_max_size() { return file_hdr->btree_order_ + 1; }
+    // 压缩格式的结点中每个key占用的空间不固定，最多存放btree_order的两倍左右的键值对，
+    // 这样结点放不下时先分裂，分裂后的一半即使不能压缩也一定放得下（见IxIndexHandle::insert_or_split）
+    int get_max_size() const { return is_compressed() ? file_hdr->btree_order_ * 2 - 1 : file_hdr->btree_order_ + 1; }
 
-    int get_min_size() { return get_max_size() / 2; }
+    int get_min_size() const { return get_max_size() / 2; }
 
-    int key_at(int i) { return *(int *)get_key(i); }
+    // 第i个key的第一个字段，只用于第一个字段为int的索引
+    int key_at(int i) {
+        char buf[IX_MAX_COL_LEN];
+        const char *key = get_key(i, buf);
+        int val;
+        ix_decode_col(key, (char *)&val, TYPE_INT, sizeof(int));
+        return file_hdr->version_ >= IX_FORMAT_NORMALIZED ? val : *(int *)key;
+    }
 
     /* 得到第i个孩子结点的page_no */
     page_id_t value_at(int i) { return get_rid(i)->page_no; }
@@ -100,11 +241,31 @@ class IxNodeHandle {
 
     void set_parent_page_no(page_id_t parent) { page_hdr->parent = parent; }
 
-    char *get_key(int key_idx) const { return keys + key_idx * file_hdr->col_tot_len_; }
+    // 返回第key_idx个完整的key，压缩格式的结点中key需要还原到buf中，buf的长度至少为col_tot_len
+    const char *get_key(int key_idx, char *buf) const {
+        if (!is_compressed()) return keys + key_idx * file_hdr->col_tot_len_;
+        const IxKeyFmt *fmt = key_fmt();
+        memcpy(buf, key_prefix(), fmt->prefix_len);
+        memcpy(buf + fmt->prefix_len, key_suffix(key_idx), fmt->key_len);
+        memset(buf + fmt->prefix_len + fmt->key_len, 0, file_hdr->col_tot_len_ - fmt->prefix_len - fmt->key_len);
+        return buf;
+    }
+
+    // 将[pos, pos + n)的完整key依次存入dst
+    void get_keys(int pos, int n, char *dst) const {
+        int key_len = file_hdr->col_tot_len_;
+        for (int i = 0; i < n; i++) {
+            const char *key = get_key(pos + i, dst + i * key_len);
+            if (key != dst + i * key_len) memcpy(dst + i * key_len, key, key_len);
+        }
+    }
 
-    Rid *get_rid(int rid_idx) const { return &rids[rid_idx]; }
+    Rid *get_rid(int rid_idx) const {
+        if (is_compressed()) return reinterpret_cast<Rid *>(key_suffix(page_hdr->num_key)) + rid_idx;
+        return &rids[rid_idx];
+    }
 
-    void set_key(int key_idx, const char *key) { memcpy(keys + key_idx * file_hdr->col_tot_len_, key, file_hdr->col_tot_len_); }
+    void set_key(int key_idx, const char *key);
 
     void set_rid(int rid_idx, const Rid &rid) { rids[rid_idx] = rid; }
 
@@ -123,7 +284,17 @@ class IxNodeHandle {
     // 用于在结点中的指定位置插入单个键值对
     void insert_pair(int pos, const char *key, const Rid &rid) { insert_pairs(pos, key, &rid, 1); }
 
-    void erase_pair(int pos);
+    void erase_pairs(int pos, int n);
+
+    void erase_pair(int pos) { erase_pairs(pos, 1); }
+
+    bool can_insert(const char *key) const;
+
+    bool can_insert_any() const;
+
+    bool can_set_key(const char *key) const;
+
+    bool can_append(const IxNodeHandle *other) const;
 
     int remove(const char *key);
 
@@ -167,11 +338,14 @@ class IxIndexHandle {
     BufferPoolManager *buffer_pool_manager_;
     int fd_;                                    // 存储B+树的文件
     IxFileHdr* file_hdr_;                       // 存了root_page，但其初始化为2（第0页存FILE_HDR_PAGE，第1页存LEAF_HEADER_PAGE）
-    std::mutex root_latch_;
+    std::shared_mutex root_latch_;              // 保护file_hdr_->root_page_，修改根结点时需要持有写锁
+    std::mutex file_hdr_latch_;                 // 保护file_hdr_中的页面计数
 
    public:
     IxIndexHandle(DiskManager *disk_manager, BufferPoolManager *buffer_pool_manager, int fd);
 
+    ~IxIndexHandle() { delete file_hdr_; }
+
     // for search
     bool get_value(const char *key, std::vector<Rid> *result, Transaction *transaction);
 
@@ -183,16 +357,24 @@ class IxIndexHandle {
 
     IxNodeHandle *split(IxNodeHandle *node);
 
+    IxNodeHandle *insert_or_split(IxNodeHandle *node, int pos, const char *key, const Rid &rid);
+
+    void make_separator(const char *left_last, const char *right_first, char *sep) const;
+
+    void get_separator(IxNodeHandle *left, IxNodeHandle *right, char *sep) const;
+
     void insert_into_parent(IxNodeHandle *old_node, const char *key, IxNodeHandle *new_node, Transaction *transaction);
 
     // for delete
     bool delete_entry(const char *key, Transaction *transaction);
 
+    bool delete_entry(const char *key, const Rid &rid, Transaction *transaction);
+
     bool coalesce_or_redistribute(IxNodeHandle *node, Transaction *transaction = nullptr,
                                 bool *root_is_latched = nullptr);
     bool adjust_root(IxNodeHandle *old_root_node);
 
-    void redistribute(IxNodeHandle *neighbor_node, IxNodeHandle *node, IxNodeHandle *parent, int index);
+    bool redistribute(IxNodeHandle *neighbor_node, IxNodeHandle *node, IxNodeHandle *parent, int index);
 
     bool coalesce(IxNodeHandle **neighbor_node, IxNodeHandle **node, IxNodeHandle **parent, int index,
                   Transaction *transaction, bool *root_is_latched);
@@ -205,12 +387,32 @@ class IxIndexHandle {
 
     Iid leaf_begin() const;
 
+    // for bulk loading
+    bool bulk_load(IxSorter *sorter, double fill_factor = IX_BULK_FILL_FACTOR);
+
    private:
     // 辅助函数
     void update_root_page_no(page_id_t root) { file_hdr_->root_page_ = root; }
 
+    // 将上层传入的key编码后存入buf，返回编码后的key
+    const char *encode_key(const char *key, char *buf) const {
+        if (file_hdr_->version_ < IX_FORMAT_NORMALIZED) return key;
+        ix_encode_key(key, buf, file_hdr_);
+        return buf;
+    }
+
     bool is_empty() const { return file_hdr_->root_page_ == IX_NO_PAGE; }
 
+    // for concurrency control
+    std::pair<IxNodeHandle *, bool> find_leaf_page_pessimistic(const char *key, Operation operation,
+                                                               Transaction *transaction);
+
+    bool is_safe(IxNodeHandle *node, const char *key, Operation operation, bool is_root);
+
+    void release_latches(Transaction *transaction, bool *root_is_latched, bool is_dirty);
+
+    void delete_pages(Transaction *transaction);
+
     // for get/create node
     IxNodeHandle *fetch_node(int page_no) const;
 
@@ -225,6 +427,28 @@ class IxIndexHandle {
 
     void maintain_child(IxNodeHandle *node, int child_idx);
 
+    // 删除key，rid不为空时只删除key对应的这一个rid
+    bool delete_entry(const char *key, const Rid *rid, Transaction *transaction);
+
+    // for posting list，见ix_posting.h
+    Page *create_posting_page();
+
+    void delete_posting_page(const PageId &page_id);
+
+    IxPostingHdr *posting_hdr(Page *page) const { return reinterpret_cast<IxPostingHdr *>(page->get_data()); }
+
+    void posting_write(Page *page, const Rid *rids, int n, page_id_t next_page);
+
+    Rid posting_build(const Rid *rids, int n);
+
+    bool posting_insert(Rid *ref, const Rid &rid);
+
+    bool posting_erase(Rid *ref, const Rid &rid);
+
+    void posting_read(const Rid &ref, std::vector<Rid> *rids) const;
+
+    void posting_free(const Rid &ref);
+
     // for index test
     Rid get_rid(const Iid &iid) const;
 };
\ No newline at end of file
@@ -10,11 +10,13 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
 #include "system/sm_meta.h"
 #include "ix_defs.h"
+#include "ix_hash_index.h"
 #include "ix_index_handle.h"
 
 class IxManager {
@@ -54,7 +56,7 @@ class IxManager {
         return disk_manager_->is_file(ix_name);
     }
 
-    void create_index(const std::string &filename, const std::vector<ColMeta>& index_cols) {
+    void create_index(const std::string &filename, const std::vector<ColMeta>& index_cols, bool unique = true) {
         std::string ix_name = get_index_name(filename, index_cols);
         // Create index file
         disk_manager_->create_file(ix_name);
@@ -86,12 +88,19 @@ class IxManager {
             fhdr->col_types_.push_back(index_cols[i].type);
             fhdr->col_lens_.push_back(index_cols[i].len);
         }
+        // 组合索引和字符串索引的key较长，相邻的key往往有较长的公共前缀，结点中的key压缩存放
+        bool has_string = std::any_of(index_cols.begin(), index_cols.end(),
+                                      [](const ColMeta &col) { return col.type == TYPE_STRING; });
+        fhdr->version_ = col_num > 1 || has_string ? IX_FORMAT_COMPRESSED : IX_FORMAT_NORMALIZED;
+        fhdr->unique_ = unique;
         fhdr->update_tot_len();
         
         char* data = new char[fhdr->tot_len_];
         fhdr->serialize(data);
 
         disk_manager_->write_page(fd, IX_FILE_HDR_PAGE, data, fhdr->tot_len_);
+        delete[] data;
+        delete fhdr;
 
         char page_buf[PAGE_SIZE];  // 在内存中初始化page_buf中的内容，然后将其写入磁盘
         memset(page_buf, 0, PAGE_SIZE);
@@ -133,6 +142,50 @@ class IxManager {
         disk_manager_->close_file(fd);
     }
 
+    /**
+     * 创建哈希索引文件：第0页为IxHashFileHdr，第1页为初始的桶，第2页为存放全局深度为0的目录的目录页面
+     * 哈希索引文件与B+树索引文件的文件名相同，同一组字段上只能建立一种索引
+     */
+    void create_hash_index(const std::string &filename, const std::vector<ColMeta>& index_cols) {
+        std::string ix_name = get_index_name(filename, index_cols);
+        disk_manager_->create_file(ix_name);
+        int fd = disk_manager_->open_file(ix_name);
+
+        int col_tot_len = 0;
+        for(auto& col: index_cols) {
+            col_tot_len += col.len;
+        }
+        if (col_tot_len > IX_MAX_COL_LEN) {
+            throw InvalidColLengthError(col_tot_len);
+        }
+        IxHashFileHdr fhdr;
+        fhdr.num_pages = IX_HASH_INIT_NUM_PAGES;
+        fhdr.num_buckets = 1;
+        fhdr.global_depth = 0;
+        fhdr.num_dir_pages = 1;
+        // 每个桶最多存放BUCKET_SIZE个键值对，key较长时以一个页面能放下的数量为准
+        fhdr.bucket_capacity = std::min(BUCKET_SIZE, static_cast<int>((PAGE_SIZE - sizeof(IxHashBucketHdr)) /
+                                                                      (col_tot_len + sizeof(Rid))));
+        fhdr.col_num = index_cols.size();
+        fhdr.col_tot_len = col_tot_len;
+
+        char page_buf[PAGE_SIZE];
+        memset(page_buf, 0, PAGE_SIZE);
+        memcpy(page_buf, &fhdr, sizeof(IxHashFileHdr));
+        page_id_t dir_page = IX_HASH_INIT_DIR_PAGE;
+        memcpy(page_buf + sizeof(IxHashFileHdr), &dir_page, sizeof(page_id_t));
+        disk_manager_->write_page(fd, IX_FILE_HDR_PAGE, page_buf, PAGE_SIZE);
+        // 初始的桶为空，局部深度为0
+        memset(page_buf, 0, PAGE_SIZE);
+        disk_manager_->write_page(fd, IX_HASH_INIT_BUCKET_PAGE, page_buf, PAGE_SIZE);
+        memset(page_buf, 0, PAGE_SIZE);
+        page_id_t bucket_page = IX_HASH_INIT_BUCKET_PAGE;
+        memcpy(page_buf, &bucket_page, sizeof(page_id_t));
+        disk_manager_->write_page(fd, IX_HASH_INIT_DIR_PAGE, page_buf, PAGE_SIZE);
+
+        disk_manager_->close_file(fd);
+    }
+
     void destroy_index(const std::string &filename, const std::vector<ColMeta>& index_cols) {
         std::string ix_name = get_index_name(filename, index_cols);
         disk_manager_->destroy_file(ix_name);
@@ -156,12 +209,33 @@ class IxManager {
         return std::make_unique<IxIndexHandle>(disk_manager_, buffer_pool_manager_, fd);
     }
 
+    std::unique_ptr<IxHashIndexHandle> open_hash_index(const std::string &filename, const std::vector<ColMeta>& index_cols) {
+        std::string ix_name = get_index_name(filename, index_cols);
+        int fd = disk_manager_->open_file(ix_name);
+        return std::make_unique<IxHashIndexHandle>(disk_manager_, buffer_pool_manager_, fd);
+    }
+
+    std::unique_ptr<IxHashIndexHandle> open_hash_index(const std::string &filename, const std::vector<std::string>& index_cols) {
+        std::string ix_name = get_index_name(filename, index_cols);
+        int fd = disk_manager_->open_file(ix_name);
+        return std::make_unique<IxHashIndexHandle>(disk_manager_, buffer_pool_manager_, fd);
+    }
+
     void close_index(const IxIndexHandle *ih) {
         char* data = new char[ih->file_hdr_->tot_len_];
         ih->file_hdr_->serialize(data);
         disk_manager_->write_page(ih->fd_, IX_FILE_HDR_PAGE, data, ih->file_hdr_->tot_len_);
+        delete[] data;
         // 缓冲区的所有页刷到磁盘，注意这句话必须写在close_file前面
         buffer_pool_manager_->flush_all_pages(ih->fd_);
+        buffer_pool_manager_->delete_all_pages(ih->fd_);
+        disk_manager_->close_file(ih->fd_);
+    }
+
+    void close_hash_index(IxHashIndexHandle *ih) {
+        // 文件头和目录在分裂桶时已经写入缓冲区中的页面
+        buffer_pool_manager_->flush_all_pages(ih->fd_);
+        buffer_pool_manager_->delete_all_pages(ih->fd_);
         disk_manager_->close_file(ih->fd_);
     }
 };
\ No newline at end of file
@@ -0,0 +1,84 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "ix_defs.h"
+
+/**
+ * 非唯一索引中出现多次的key在叶子结点中只存放一次，对应的rid为{第一个posting页面, IX_POSTING_SLOT}。
+ * posting list是按(page_no, slot_no)排序的rid，依次存放在一个页面链表中，每个页面存放连续的一段；
+ * 页面中相邻rid的差值用变长整数编码，页面放不下时分裂为两个页面。只出现一次的key仍然直接存放rid。
+ * posting页面只在持有key所在叶子结点的锁时访问
+ */
+constexpr int IX_POSTING_SLOT = -2;
+
+struct IxPostingHdr {
+    page_id_t next_page;    // 链表中的下一个页面，IX_NO_PAGE表示最后一个页面
+    int num_rids;           // 页面中rid的数量
+    int num_bytes;          // 编码后的长度
+    Rid last;               // 页面中最大的rid，查找rid所在的页面时不需要解码
+};
+
+constexpr int IX_POSTING_CAPACITY = PAGE_SIZE - sizeof(IxPostingHdr);
+
+inline bool ix_is_posting(const Rid &rid) { return rid.slot_no == IX_POSTING_SLOT; }
+
+// rid按照(page_no, slot_no)的顺序映射为无符号整数
+inline uint64_t ix_rid_ord(const Rid &rid) { return (uint64_t)(uint32_t)rid.page_no << 32 | (uint32_t)rid.slot_no; }
+
+inline bool ix_rid_less(const Rid &a, const Rid &b) { return ix_rid_ord(a) < ix_rid_ord(b); }
+
+inline int ix_varint_len(uint64_t val) {
+    int len = 1;
+    while (val >= 0x80) {
+        val >>= 7;
+        len++;
+    }
+    return len;
+}
+
+// 编码n个有序的rid，返回编码后的字节数；dst为nullptr时只计算长度
+inline int ix_posting_encode(const Rid *rids, int n, char *dst) {
+    int len = 0;
+    uint64_t prev = 0;
+    for (int i = 0; i < n; i++) {
+        uint64_t ord = ix_rid_ord(rids[i]);
+        uint64_t delta = ord - prev;
+        prev = ord;
+        do {
+            uint8_t byte = delta & 0x7f;
+            delta >>= 7;
+            if (delta != 0) byte |= 0x80;
+            if (dst != nullptr) dst[len] = (char)byte;
+            len++;
+        } while (delta != 0);
+    }
+    return len;
+}
+
+inline void ix_posting_decode(const char *src, int n, std::vector<Rid> *rids) {
+    uint64_t ord = 0;
+    for (int i = 0; i < n; i++) {
+        uint64_t delta = 0;
+        int shift = 0;
+        uint8_t byte;
+        do {
+            byte = (uint8_t)*src++;
+            delta |= (uint64_t)(byte & 0x7f) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+        ord += delta;
+        rids->push_back(Rid{.page_no = (int)(ord >> 32), .slot_no = (int)(uint32_t)ord});
+    }
+}
@@ -12,22 +12,65 @@ See the Mulan PSL v2 for more details. */
 
 /**
  * @brief 
- * @todo 加上读锁（需要使用缓冲池得到page）
+ * @note 读取叶子结点时加读锁，不同时持有相邻叶子结点的锁
  */
+IxScan::IxScan(const IxIndexHandle *ih, const Iid &lower, const Iid &upper, BufferPoolManager *bpm, bool reverse)
+    : ih_(ih), lower_(lower), upper_(upper), reverse_(reverse), bpm_(bpm) {
+    load_leaf(reverse_ ? upper_.page_no : lower_.page_no);
+    fill();
+}
+
+/**
+ * @brief 进入page_no对应的叶子结点，将其中属于扫描范围的(key, Rid)复制到缓冲区
+ */
+void IxScan::load_leaf(page_id_t page_no) {
+    release_leaf();
+    node_ = ih_->fetch_node(page_no);
+    node_->page->rlatch();
+    assert(node_->is_leaf_page());
+    int size = node_->get_size();
+    int lo = page_no == lower_.page_no ? std::min(lower_.slot_no, size) : 0;
+    int hi = page_no == upper_.page_no ? std::min(upper_.slot_no, size) : size;
+    hi = std::max(lo, hi);
+    page_id_t neighbor = reverse_ ? node_->get_prev_leaf() : node_->get_next_leaf();
+    last_leaf_ = page_no == (reverse_ ? lower_.page_no : upper_.page_no) || neighbor == IX_LEAF_HEADER_PAGE;
+    first_slot_ = lo;
+    int key_len = ih_->file_hdr_->col_tot_len_;
+    keys_.resize((size_t)(hi - lo) * key_len);
+    rids_.clear();
+    slots_.clear();
+    for (int i = lo; i < hi; i++) {
+        ih_->posting_read(*node_->get_rid(i), &rids_);
+        slots_.resize(rids_.size(), i - lo);
+    }
+    node_->get_keys(lo, hi - lo, keys_.data());
+    node_->page->runlatch();
+    pos_ = 0;
+}
+
+void IxScan::release_leaf() {
+    if (node_ == nullptr) return;
+    bpm_->unpin_page(node_->get_page_id(), false);
+    delete node_;
+    node_ = nullptr;
+}
+
+void IxScan::fill() {
+    while (pos_ == rids_.size() && !last_leaf_) {
+        // 叶子结点仍然pin住，读取相邻结点时只需要加读锁
+        node_->page->rlatch();
+        page_id_t neighbor = reverse_ ? node_->get_prev_leaf() : node_->get_next_leaf();
+        node_->page->runlatch();
+        load_leaf(neighbor);
+    }
+}
+
 void IxScan::next() {
     assert(!is_end());
-    IxNodeHandle *node = ih_->fetch_node(iid_.page_no);
-    assert(node->is_leaf_page());
-    assert(iid_.slot_no < node->get_size());
-    // increment slot no
-    iid_.slot_no++;
-    if (iid_.page_no != ih_->file_hdr_->last_leaf_ && iid_.slot_no == node->get_size()) {
-        // go to next leaf
-        iid_.slot_no = 0;
-        iid_.page_no = node->get_next_leaf();
-    }
+    pos_++;
+    fill();
 }
 
-Rid IxScan::rid() const {
-    return ih_->get_rid(iid_);
-}
\ No newline at end of file
+void IxScan::key(char *key) const {
+    ix_decode_key(keys_.data() + slots_[slot()] * ih_->file_hdr_->col_tot_len_, key, ih_->file_hdr_);
+}
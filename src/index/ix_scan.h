@@ -17,22 +17,50 @@ See the Mulan PSL v2 for more details. */
 
 // 用于遍历叶子结点
 // 用于直接遍历叶子结点，而不用findleafpage来得到叶子结点
-// TODO：对page遍历时，要加上读锁
+// 每进入一个叶子结点，将扫描范围内的(key, Rid)一次性复制到缓冲区，next()只在缓冲区中移动；
+// 当前叶子结点保持pin住，直到扫描移动到相邻的叶子结点或者析构。reverse为true时从upper向lower逆序遍历
 class IxScan : public RecScan {
     const IxIndexHandle *ih_;
-    Iid iid_;  // 初始为lower（用于遍历的指针）
-    Iid end_;  // 初始为upper
+    Iid lower_;     // 扫描范围的第一个位置
+    Iid upper_;     // 扫描范围最后一个位置的下一个位置
+    bool reverse_;
     BufferPoolManager *bpm_;
 
+    IxNodeHandle *node_ = nullptr;  // 当前叶子结点，保持pin
+    bool last_leaf_ = false;        // 当前叶子结点是否为扫描范围内的最后一个叶子结点
+    int first_slot_ = 0;            // 缓冲区中第一项在叶子结点中的slot_no
+    std::vector<char> keys_;        // 缓冲区中的key，保存为索引内部的格式，读取时再还原
+    std::vector<Rid> rids_;         // 非唯一索引中posting list展开后，同一个key对应多个rid
+    std::vector<int> slots_;        // 每个rid对应的key在缓冲区中的下标
+    size_t pos_ = 0;                // 当前位置在缓冲区中的下标；逆序遍历时从缓冲区末尾往前对应
+
+    void load_leaf(page_id_t page_no);
+
+    void release_leaf();
+
+    // 当前缓冲区读完时移动到下一个叶子结点，跳过范围内没有key的叶子结点
+    void fill();
+
    public:
-    IxScan(const IxIndexHandle *ih, const Iid &lower, const Iid &upper, BufferPoolManager *bpm)
-        : ih_(ih), iid_(lower), end_(upper), bpm_(bpm) {}
+    IxScan(const IxIndexHandle *ih, const Iid &lower, const Iid &upper, BufferPoolManager *bpm, bool reverse = false);
+
+    ~IxScan() override { release_leaf(); }
+
+    IxScan(const IxScan &) = delete;
+    IxScan &operator=(const IxScan &) = delete;
 
     void next() override;
 
-    bool is_end() const override { return iid_ == end_; }
+    bool is_end() const override { return pos_ == rids_.size(); }
+
+    Rid rid() const override { return rids_[slot()]; }
+
+    // 读取当前索引槽中的key，还原为原始格式
+    void key(char *key) const;
 
-    Rid rid() const override;
+    Iid iid() const { return {.page_no = node_->get_page_no(), .slot_no = first_slot_ + slots_[slot()]}; }
 
-    const Iid &iid() const { return iid_; }
-};
\ No newline at end of file
+   private:
+    // 当前位置在缓冲区中的实际下标
+    size_t slot() const { return reverse_ ? rids_.size() - 1 - pos_ : pos_; }
+};
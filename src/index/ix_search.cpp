@@ -0,0 +1,246 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "ix_search.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "ix_index_handle.h"
+
+namespace {
+
+// 原始格式的数值key
+template <typename T>
+struct NativeKey {
+    using type = T;
+    static T load(const char *p) { return *reinterpret_cast<const T *>(p); }
+};
+
+// IX_FORMAT_NORMALIZED格式的int/float key，大端序的uint32，按无符号数比较
+struct NormalizedKey {
+    using type = uint32_t;
+    static uint32_t load(const char *p) {
+        uint32_t v;
+        memcpy(&v, p, sizeof(uint32_t));
+        return __builtin_bswap32(v);
+    }
+};
+
+// Upper为false时判断key < target，为true时判断key <= target，满足条件的key都排在结果之前
+template <typename T, bool Upper>
+inline bool before(T key, T target) {
+    return Upper ? key <= target : key < target;
+}
+
+/**
+ * 无分支的二分查找，将结果所在的范围缩小到一个cache line，返回范围的起点，n为范围内key的数量
+ * 循环中始终保证结果在[base, base + n]之中
+ */
+template <typename Key, bool Upper>
+inline const char *narrow(const char *base, int &n, typename Key::type target) {
+    constexpr int size = sizeof(typename Key::type);
+    constexpr int window = IX_SEARCH_WINDOW_BYTES / size;
+    while (n > window) {
+        int half = n / 2;
+        base = before<typename Key::type, Upper>(Key::load(base + (half - 1) * size), target) ? base + half * size : base;
+        n -= half;
+    }
+    return base;
+}
+
+template <typename Key, bool Upper>
+int search_numeric(const char *keys, int lo, int hi, const char *target, const IxFileHdr *file_hdr) {
+    constexpr int size = sizeof(typename Key::type);
+    auto t = Key::load(target);
+    int n = hi - lo;
+    const char *base = narrow<Key, Upper>(keys + lo * size, n, t);
+    int cnt = 0;
+    for (int i = 0; i < n; i++) {
+        cnt += before<typename Key::type, Upper>(Key::load(base + i * size), t);
+    }
+    return (base - keys) / size + cnt;
+}
+
+#if defined(__x86_64__)
+/**
+ * 4字节整数key的AVX2版本，Normalized为true时key为大端序的uint32
+ * 大端序的key先在每个32位中翻转字节序，再翻转符号位，转换为有符号数比较
+ */
+template <bool Normalized, bool Upper>
+__attribute__((target("avx2"))) int search_int_avx2(const char *keys, int lo, int hi, const char *target,
+                                                     const IxFileHdr *file_hdr) {
+    using Key = typename std::conditional<Normalized, NormalizedKey, NativeKey<int>>::type;
+    auto t = Key::load(target);
+    int n = hi - lo;
+    const char *base = narrow<Key, Upper>(keys + lo * 4, n, t);
+    const __m256i bswap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                           3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    const __m256i sign = _mm256_set1_epi32((int)0x80000000u);
+    __m256i tv = _mm256_set1_epi32((int)t);
+    if (Normalized) tv = _mm256_xor_si256(tv, sign);
+    int cnt = 0, i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(base + i * 4));
+        if (Normalized) v = _mm256_xor_si256(_mm256_shuffle_epi8(v, bswap), sign);
+        // lower_bound统计key < target的数量，upper_bound统计key <= target，即8 - (key > target)的数量
+        __m256i mask = Upper ? _mm256_cmpgt_epi32(v, tv) : _mm256_cmpgt_epi32(tv, v);
+        int bits = __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(mask)));
+        cnt += Upper ? 8 - bits : bits;
+    }
+    for (; i < n; i++) {
+        cnt += before<typename Key::type, Upper>(Key::load(base + i * 4), t);
+    }
+    return (base - keys) / 4 + cnt;
+}
+
+template <bool Upper>
+__attribute__((target("avx2"))) int search_float_avx2(const char *keys, int lo, int hi, const char *target,
+                                                       const IxFileHdr *file_hdr) {
+    using Key = NativeKey<float>;
+    float t = Key::load(target);
+    int n = hi - lo;
+    const char *base = narrow<Key, Upper>(keys + lo * 4, n, t);
+    __m256 tv = _mm256_set1_ps(t);
+    int cnt = 0, i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 v = _mm256_loadu_ps(reinterpret_cast<const float *>(base + i * 4));
+        __m256 mask = Upper ? _mm256_cmp_ps(v, tv, _CMP_LE_OQ) : _mm256_cmp_ps(v, tv, _CMP_LT_OQ);
+        cnt += __builtin_popcount(_mm256_movemask_ps(mask));
+    }
+    for (; i < n; i++) {
+        cnt += before<float, Upper>(Key::load(base + i * 4), t);
+    }
+    return (base - keys) / 4 + cnt;
+}
+#endif
+
+/**
+ * 长度为len的key按memcmp比较的二分查找
+ * lcp_lo和lcp_hi分别是查找范围左侧和右侧边界的key与target的公共前缀长度，
+ * 范围内的key都有两者中较小的公共前缀，比较时可以直接跳过
+ */
+template <bool Upper>
+int memcmp_search(const char *keys, int lo, int hi, const char *target, int len) {
+    int lcp_lo = 0, lcp_hi = 0;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        const char *key = keys + (size_t)mid * len;
+        int skip = std::min(lcp_lo, lcp_hi);
+        int lcp = skip + ix_common_prefix(key + skip, target + skip, len - skip);
+        int res = lcp == len ? 0 : ((unsigned char)key[lcp] < (unsigned char)target[lcp] ? -1 : 1);
+        if (res < 0 || (Upper && res == 0)) {
+            lo = mid + 1;
+            lcp_lo = lcp;
+        } else {
+            hi = mid;
+            lcp_hi = lcp;
+        }
+    }
+    return lo;
+}
+
+template <bool Upper>
+int search_memcmp(const char *keys, int lo, int hi, const char *target, const IxFileHdr *file_hdr) {
+    return memcmp_search<Upper>(keys, lo, hi, target, file_hdr->col_tot_len_);
+}
+
+/**
+ * IX_FORMAT_COMPRESSED格式的结点，keys指向IxKeyFmt（见ix_defs.h）
+ * 先与公共前缀比较，相同时在去掉前缀的key中查找；存放的key在key_len之后都是0，
+ * 所以target在这之后的字节不全为0时，前key_len个字节与target相同的key也小于target，lower_bound按upper_bound查找
+ */
+template <bool Upper>
+int search_compressed(const char *keys, int lo, int hi, const char *target, const IxFileHdr *file_hdr) {
+    const IxKeyFmt *fmt = reinterpret_cast<const IxKeyFmt *>(keys);
+    const char *prefix = keys + sizeof(IxKeyFmt);
+    int res = memcmp(target, prefix, fmt->prefix_len);
+    if (res != 0) {
+        return res < 0 ? lo : hi;
+    }
+    const char *suffix = target + fmt->prefix_len;
+    int rest = file_hdr->col_tot_len_ - fmt->prefix_len - fmt->key_len;
+    if (Upper || ix_key_siglen(suffix + fmt->key_len, rest) > 0) {
+        return memcmp_search<true>(prefix + fmt->prefix_len, lo, hi, suffix, fmt->key_len);
+    }
+    return memcmp_search<false>(prefix + fmt->prefix_len, lo, hi, suffix, fmt->key_len);
+}
+
+template <bool Upper>
+int search_generic(const char *keys, int lo, int hi, const char *target, const IxFileHdr *file_hdr) {
+    int len = file_hdr->col_tot_len_;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        int res = ix_compare(keys + (size_t)mid * len, target, file_hdr);
+        if (res < 0 || (Upper && res == 0)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+}  // namespace
+
+void ix_init_search(IxFileHdr *file_hdr, bool enable_simd) {
+    bool all_string = std::all_of(file_hdr->col_types_.begin(), file_hdr->col_types_.end(),
+                                  [](ColType type) { return type == TYPE_STRING; });
+    bool normalized = file_hdr->version_ >= IX_FORMAT_NORMALIZED;
+    bool single_numeric = file_hdr->col_num_ == 1 && file_hdr->col_types_[0] != TYPE_STRING;
+#if defined(__x86_64__)
+    bool avx2 = enable_simd && __builtin_cpu_supports("avx2");
+#else
+    bool avx2 = false;
+#endif
+
+    if (file_hdr->version_ >= IX_FORMAT_COMPRESSED) {
+        file_hdr->lower_bound_ = search_compressed<false>;
+        file_hdr->upper_bound_ = search_compressed<true>;
+    } else if (normalized && single_numeric) {
+        // 编码后的int和float都按大端序的uint32比较
+        file_hdr->lower_bound_ = search_numeric<NormalizedKey, false>;
+        file_hdr->upper_bound_ = search_numeric<NormalizedKey, true>;
+#if defined(__x86_64__)
+        if (avx2) {
+            file_hdr->lower_bound_ = search_int_avx2<true, false>;
+            file_hdr->upper_bound_ = search_int_avx2<true, true>;
+        }
+#endif
+    } else if (normalized || all_string) {
+        file_hdr->lower_bound_ = search_memcmp<false>;
+        file_hdr->upper_bound_ = search_memcmp<true>;
+    } else if (single_numeric && file_hdr->col_types_[0] == TYPE_INT) {
+        file_hdr->lower_bound_ = search_numeric<NativeKey<int>, false>;
+        file_hdr->upper_bound_ = search_numeric<NativeKey<int>, true>;
+#if defined(__x86_64__)
+        if (avx2) {
+            file_hdr->lower_bound_ = search_int_avx2<false, false>;
+            file_hdr->upper_bound_ = search_int_avx2<false, true>;
+        }
+#endif
+    } else if (single_numeric) {
+        file_hdr->lower_bound_ = search_numeric<NativeKey<float>, false>;
+        file_hdr->upper_bound_ = search_numeric<NativeKey<float>, true>;
+#if defined(__x86_64__)
+        if (avx2) {
+            file_hdr->lower_bound_ = search_float_avx2<false>;
+            file_hdr->upper_bound_ = search_float_avx2<true>;
+        }
+#endif
+    } else {
+        file_hdr->lower_bound_ = search_generic<false>;
+        file_hdr->upper_bound_ = search_generic<true>;
+    }
+}
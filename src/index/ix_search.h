@@ -0,0 +1,25 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include "ix_defs.h"
+
+constexpr int IX_SEARCH_WINDOW_BYTES = 64;  // 数值key的二分查找缩小到一个cache line后改为线性扫描
+
+/**
+ * 根据索引字段的类型和文件格式为file_hdr选择结点内的查找函数，打开索引时调用一次：
+ * - 单个int/float字段：无分支二分查找，最后一个cache line内线性扫描，CPU支持时使用AVX2
+ * - IX_FORMAT_COMPRESSED格式：先比较结点的公共前缀，再在去掉前缀的key中按memcmp二分查找
+ * - IX_FORMAT_NORMALIZED格式的组合索引或只包含字符串字段：整个key按memcmp比较，二分查找时跳过已知的公共前缀
+ * - IX_FORMAT_RAW格式的其他组合索引：逐个字段调用ix_compare的二分查找
+ * @param enable_simd 为false时不使用AVX2，用于测试
+ */
+void ix_init_search(IxFileHdr *file_hdr, bool enable_simd = true);
@@ -0,0 +1,183 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#include "ix_sorter.h"
+
+#include <algorithm>
+
+IxSorter::IxSorter(DiskManager *disk_manager, std::string run_prefix, std::vector<ColType> col_types,
+                   std::vector<int> col_lens, size_t mem_limit)
+    : disk_manager_(disk_manager),
+      run_prefix_(std::move(run_prefix)),
+      col_types_(std::move(col_types)),
+      col_lens_(std::move(col_lens)) {
+    key_len_ = 0;
+    for (int len : col_lens_) {
+        key_len_ += len;
+    }
+    entry_len_ = key_len_ + sizeof(Rid);
+    entries_per_page_ = PAGE_SIZE / entry_len_;
+    max_buffered_ = std::max<size_t>(1, mem_limit / entry_len_);
+}
+
+IxSorter::~IxSorter() {
+    for (size_t i = 0; i < runs_.size(); i++) {
+        disk_manager_->close_file(runs_[i].fd);
+        disk_manager_->destroy_file(run_prefix_ + ".run" + std::to_string(i));
+    }
+}
+
+/**
+ * @description: 比较两个键值对，先比较key，key相同时按照rid的顺序
+ */
+int IxSorter::compare(const char *a, const char *b) const {
+    int res = ix_compare(a, b, col_types_, col_lens_);
+    if (res != 0) return res;
+    const Rid *ra = reinterpret_cast<const Rid *>(a + key_len_);
+    const Rid *rb = reinterpret_cast<const Rid *>(b + key_len_);
+    if (ra->page_no != rb->page_no) return ra->page_no < rb->page_no ? -1 : 1;
+    if (ra->slot_no != rb->slot_no) return ra->slot_no < rb->slot_no ? -1 : 1;
+    return 0;
+}
+
+/**
+ * @description: 添加一个待排序的键值对
+ * @param {char*} key 键值对的key，长度为索引字段的总长度
+ * @param {Rid&} rid 键值对的rid
+ */
+void IxSorter::add(const char *key, const Rid &rid) {
+    assert(!sorted_);
+    if (buffer_.size() == max_buffered_ * entry_len_) {
+        spill();
+    }
+    size_t offset = buffer_.size();
+    buffer_.resize(offset + entry_len_);
+    memcpy(buffer_.data() + offset, key, key_len_);
+    memcpy(buffer_.data() + offset + key_len_, &rid, sizeof(Rid));
+    if (presorted_ && offset > 0) {
+        presorted_ = compare(buffer_.data() + offset - entry_len_, buffer_.data() + offset) <= 0;
+    }
+    num_entries_++;
+}
+
+/**
+ * @description: 将内存中的键值对排序后写入一个新的临时文件，作为一个有序段
+ */
+void IxSorter::spill() {
+    int n = buffer_.size() / entry_len_;
+    order_.resize(n);
+    for (int i = 0; i < n; i++) order_[i] = i;
+    const char *data = buffer_.data();
+    std::sort(order_.begin(), order_.end(), [&](int a, int b) {
+        return compare(data + (size_t)a * entry_len_, data + (size_t)b * entry_len_) < 0;
+    });
+
+    std::string run_name = run_prefix_ + ".run" + std::to_string(runs_.size());
+    if (disk_manager_->is_file(run_name)) {
+        disk_manager_->destroy_file(run_name);
+    }
+    disk_manager_->create_file(run_name);
+    Run run;
+    run.fd = disk_manager_->open_file(run_name);
+    run.num_entries = n;
+    run.buf.resize(PAGE_SIZE);
+
+    // 有序段按页面写出，每个页面存放entries_per_page_个键值对
+    char page_buf[PAGE_SIZE];
+    for (int i = 0, page_no = 0; i < n; page_no++) {
+        memset(page_buf, 0, PAGE_SIZE);
+        int cnt = std::min(entries_per_page_, n - i);
+        for (int j = 0; j < cnt; j++, i++) {
+            memcpy(page_buf + (size_t)j * entry_len_, data + (size_t)order_[i] * entry_len_, entry_len_);
+        }
+        disk_manager_->write_page(run.fd, page_no, page_buf, PAGE_SIZE);
+    }
+    runs_.push_back(std::move(run));
+    buffer_.clear();
+    order_.clear();
+}
+
+/**
+ * @description: 结束输入并开始输出，之后只能调用next()
+ */
+void IxSorter::sort() {
+    assert(!sorted_);
+    sorted_ = true;
+    if (runs_.empty()) {
+        // 所有键值对都在内存中，直接在内存中排序
+        int n = buffer_.size() / entry_len_;
+        order_.resize(n);
+        for (int i = 0; i < n; i++) order_[i] = i;
+        if (!presorted_) {
+            const char *data = buffer_.data();
+            std::sort(order_.begin(), order_.end(), [&](int a, int b) {
+                return compare(data + (size_t)a * entry_len_, data + (size_t)b * entry_len_) < 0;
+            });
+        }
+        return;
+    }
+    if (!buffer_.empty()) {
+        spill();
+    }
+    std::vector<char>().swap(buffer_);
+    auto greater = [this](int a, int b) { return run_greater(a, b); };
+    for (int i = 0; i < (int)runs_.size(); i++) {
+        load_run_page(runs_[i]);
+        heap_.push_back(i);
+        std::push_heap(heap_.begin(), heap_.end(), greater);
+    }
+}
+
+/**
+ * @description: 读入有序段的下一个页面
+ */
+void IxSorter::load_run_page(Run &run) {
+    int page_no = run.next_entry / entries_per_page_;
+    disk_manager_->read_page(run.fd, page_no, run.buf.data(), PAGE_SIZE);
+    run.buf_entries = std::min(entries_per_page_, run.num_entries - run.next_entry);
+    run.next_entry += run.buf_entries;
+    run.pos = 0;
+}
+
+/**
+ * @description: 按照(key, rid)从小到大的顺序输出下一个键值对
+ * @return {bool} 所有键值对都已经输出时返回false
+ * @param {char*} key 输出的key
+ * @param {Rid*} rid 输出的rid
+ */
+bool IxSorter::next(char *key, Rid *rid) {
+    assert(sorted_);
+    if (runs_.empty()) {
+        if (next_ == order_.size()) return false;
+        const char *entry = buffer_.data() + (size_t)order_[next_++] * entry_len_;
+        memcpy(key, entry, key_len_);
+        memcpy(rid, entry + key_len_, sizeof(Rid));
+        return true;
+    }
+
+    if (heap_.empty()) return false;
+    auto greater = [this](int a, int b) { return run_greater(a, b); };
+    std::pop_heap(heap_.begin(), heap_.end(), greater);
+    Run &run = runs_[heap_.back()];
+    const char *entry = run_top(run);
+    memcpy(key, entry, key_len_);
+    memcpy(rid, entry + key_len_, sizeof(Rid));
+
+    run.pos++;
+    if (run.pos == run.buf_entries) {
+        if (run.next_entry == run.num_entries) {
+            heap_.pop_back();
+            return true;
+        }
+        load_run_page(run);
+    }
+    std::push_heap(heap_.begin(), heap_.end(), greater);
+    return true;
+}
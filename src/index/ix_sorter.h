@@ -0,0 +1,78 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "ix_index_handle.h"
+
+/**
+ * 建立索引时对(key, rid)进行外部排序。
+ * 输入先缓存在内存中，超过内存限制时排序后作为一个有序段写入临时文件，
+ * 输入结束后对所有有序段进行多路归并，按照(key, rid)从小到大依次输出。
+ */
+class IxSorter {
+    struct Run {
+        int fd;                 // 有序段所在的临时文件
+        int num_entries;        // 有序段中的键值对数量
+        int next_entry = 0;     // 下一个要读入页面缓冲区的键值对
+        int pos = 0;            // 当前键值对在页面缓冲区中的下标
+        int buf_entries = 0;    // 页面缓冲区中的键值对数量
+        std::vector<char> buf;  // 页面缓冲区
+    };
+
+    DiskManager *disk_manager_;
+    std::string run_prefix_;            // 临时文件名的前缀
+    std::vector<ColType> col_types_;
+    std::vector<int> col_lens_;
+    int key_len_;
+    int entry_len_;                     // 每个键值对的长度，key_len_ + sizeof(Rid)
+    int entries_per_page_;              // 临时文件中每个页面存放的键值对数量，键值对不跨页面
+    size_t max_buffered_;               // 内存中最多缓存的键值对数量
+
+    std::vector<char> buffer_;          // 尚未写出的键值对
+    std::vector<int> order_;            // 对buffer_排序后的下标
+    std::vector<Run> runs_;             // 已经写入临时文件的有序段
+    std::vector<int> heap_;             // 归并时各有序段的小根堆，堆顶为当前最小的键值对所在的有序段
+    size_t num_entries_ = 0;
+    bool presorted_ = true;             // 输入是否已经有序，按照索引顺序装载的表建立索引时不需要再排序
+    size_t next_ = 0;                   // 只有内存中的有序段时，下一个输出的下标
+    bool sorted_ = false;
+
+   public:
+    IxSorter(DiskManager *disk_manager, std::string run_prefix, std::vector<ColType> col_types,
+             std::vector<int> col_lens, size_t mem_limit = IX_SORT_BUFFER_SIZE);
+
+    ~IxSorter();
+
+    void add(const char *key, const Rid &rid);
+
+    void sort();
+
+    bool next(char *key, Rid *rid);
+
+    size_t size() const { return num_entries_; }
+
+    size_t num_runs() const { return runs_.size(); }
+
+   private:
+    int compare(const char *a, const char *b) const;
+
+    void spill();
+
+    const char *run_top(const Run &run) const { return run.buf.data() + (size_t)run.pos * entry_len_; }
+
+    void load_run_page(Run &run);
+
+    // 用于std::push_heap/pop_heap维护小根堆
+    bool run_greater(int a, int b) const { return compare(run_top(runs_[a]), run_top(runs_[b])) > 0; }
+};
@@ -28,6 +28,7 @@ typedef enum PlanTag{
     T_DropTable,
     T_CreateIndex,
     T_DropIndex,
+    T_Reindex,
     T_SetKnob,
     T_Insert,
     T_Update,
@@ -41,6 +42,8 @@ typedef enum PlanTag{
     T_IndexScan,
     T_NestLoop,
     T_SortMerge,    // sort merge join
+    T_HashJoin,     // hash join
+    T_IndexJoin,    // index nested loop join
     T_Sort,
     T_Projection
 } PlanTag;
@@ -76,6 +79,10 @@ class ScanPlan : public Plan
         size_t len_;                               
         std::vector<Condition> fed_conds_;
         std::vector<std::string> index_col_names_;
+        std::vector<TabCol> proj_cols_;            // 上层算子需要用到的列，为空表示需要所有列
+        bool index_only_ = false;                  // index scan时需要的列都包含在索引中，不需要读取记录
+        bool bitmap_ = false;                      // index scan时先收集Rid、按页面排序后再读取记录（bitmap heap scan）
+        bool reverse_ = false;                     // index scan时按索引逆序扫描
     
 };
 
@@ -171,6 +178,9 @@ class DDLPlan : public Plan
         std::string tab_name_;
         std::vector<std::string> tab_col_names_;
         std::vector<ColDef> cols_;
+        RmLayout layout_ = RM_LAYOUT_NSM;       // create table时指定的页面布局
+        IndexType index_type_ = INDEX_BTREE;    // create index时指定的索引类型
+        bool unique_ = true;                    // create index时是否为唯一索引
 };
 
 // help; show tables; desc tables; begin; abort; commit; rollback语句对应的plan
@@ -10,7 +10,9 @@ See the Mulan PSL v2 for more details. */
 
 #include "planner.h"
 
+#include <cmath>
 #include <memory>
+#include <set>
 
 #include "execution/executor_delete.h"
 #include "execution/executor_index_scan.h"
@@ -22,18 +24,386 @@ See the Mulan PSL v2 for more details. */
 #include "index/ix.h"
 #include "record_printer.h"
 
-// 目前的索引匹配规则为：完全匹配索引字段，且全部为单点查询，不会自动调整where条件的顺序
+/**
+ * @brief 计算索引与表上条件的匹配程度：索引最长的等值条件前缀，加上紧随其后的一个有范围条件的字段
+ *
+ * @return 2 * 等值前缀的字段数 + (下一个字段上有范围条件 ? 1 : 0)；为0表示索引不能缩小扫描范围。
+ *         哈希索引只能查找完整的key，除非每个字段上都有等值条件，否则返回0
+ */
+int Planner::match_index(const std::string &tab_name, const std::vector<Condition> &curr_conds, const IndexMeta &index) {
+    std::set<std::string> eq_cols, range_cols;
+    for (auto &cond : curr_conds) {
+        if (!cond.is_rhs_val || cond.lhs_col.tab_name != tab_name) continue;
+        if (cond.op == OP_EQ) {
+            eq_cols.insert(cond.lhs_col.col_name);
+        } else if (cond.op != OP_NE) {
+            range_cols.insert(cond.lhs_col.col_name);
+        }
+    }
+    size_t num_eq = 0;
+    while (num_eq < index.cols.size() && eq_cols.count(index.cols[num_eq].name)) {
+        num_eq++;
+    }
+    if (index.type == INDEX_HASH) {
+        return num_eq == index.cols.size() ? (int)num_eq * 2 : 0;
+    }
+    bool has_range = num_eq < index.cols.size() && range_cols.count(index.cols[num_eq].name);
+    return (int)num_eq * 2 + (has_range ? 1 : 0);
+}
+
+// 索引匹配规则见match_index，选择匹配程度最高的索引；完整key上都有等值条件时优先选择哈希索引，其次选择较短的索引
 bool Planner::get_index_cols(std::string tab_name, std::vector<Condition> curr_conds, std::vector<std::string>& index_col_names) {
     index_col_names.clear();
-    for(auto& cond: curr_conds) {
-        if(cond.is_rhs_val && cond.op == OP_EQ && cond.lhs_col.tab_name.compare(tab_name) == 0)
-            index_col_names.push_back(cond.lhs_col.col_name);
-    }
     TabMeta& tab = sm_manager_->db_.get_table(tab_name);
-    if(tab.is_index(index_col_names)) return true;
+    const IndexMeta *best = nullptr;
+    int best_score = 0;
+    for (auto& index : tab.indexes) {
+        int score = match_index(tab_name, curr_conds, index);
+        if (score == 0) continue;
+        if (best == nullptr || score > best_score ||
+            (score == best_score && (index.type == INDEX_HASH ||
+                                     (best->type != INDEX_HASH && index.col_tot_len < best->col_tot_len)))) {
+            best = &index;
+            best_score = score;
+        }
+    }
+    if (best == nullptr) return false;
+    for (auto& col : best->cols) {
+        index_col_names.push_back(col.name);
+    }
+    return true;
+}
+
+/**
+ * @brief 连接条件中有左右两侧类型和长度相同的等值条件时，把nested loop join改为hash join
+ */
+void Planner::use_hash_join(std::shared_ptr<Plan> plan) {
+    auto x = std::dynamic_pointer_cast<JoinPlan>(plan);
+    if (x == nullptr) {
+        return;
+    }
+    use_hash_join(x->left_);
+    use_hash_join(x->right_);
+    if (x->tag != T_NestLoop) {
+        return;
+    }
+    for (auto &cond : x->conds_) {
+        if (cond.is_rhs_val || cond.op != OP_EQ || cond.lhs_col.tab_name == cond.rhs_col.tab_name) {
+            continue;
+        }
+        auto lhs_col = sm_manager_->db_.get_table(cond.lhs_col.tab_name).get_col(cond.lhs_col.col_name);
+        auto rhs_col = sm_manager_->db_.get_table(cond.rhs_col.tab_name).get_col(cond.rhs_col.col_name);
+        if (lhs_col->type == rhs_col->type && lhs_col->len == rhs_col->len) {
+            x->tag = T_HashJoin;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief 计划的输出中是否包含表tab_name的列
+ */
+static bool plan_has_table(const std::shared_ptr<Plan> &plan, const std::string &tab_name) {
+    if (auto x = std::dynamic_pointer_cast<ScanPlan>(plan)) {
+        return x->tab_name_ == tab_name;
+    }
+    if (auto x = std::dynamic_pointer_cast<JoinPlan>(plan)) {
+        return plan_has_table(x->left_, tab_name) || plan_has_table(x->right_, tab_name);
+    }
+    if (auto x = std::dynamic_pointer_cast<SortPlan>(plan)) {
+        return plan_has_table(x->subplan_, tab_name);
+    }
+    return false;
+}
+
+static bool same_col(const TabCol &a, const TabCol &b) {
+    return a.tab_name == b.tab_name && a.col_name == b.col_name;
+}
+
+/**
+ * @brief 计划的输出是否已经按列col升序排列
+ *
+ * B+树索引的扫描在col之前的索引字段都有等值条件时按col有序（同generate_sort_plan）；
+ * sort merge join的输出按key有序，key为第一个连接条件，左右两侧的列相等
+ */
+bool Planner::is_sorted_on(const std::shared_ptr<Plan> &plan, const TabCol &col) {
+    if (auto x = std::dynamic_pointer_cast<ScanPlan>(plan)) {
+        if (x->tag != T_IndexScan || x->bitmap_ || x->reverse_ || x->tab_name_ != col.tab_name) {
+            return false;
+        }
+        auto &index = *sm_manager_->db_.get_table(x->tab_name_).get_index_meta(x->index_col_names_);
+        auto pos = std::find_if(index.cols.begin(), index.cols.end(),
+                                [&](const ColMeta &index_col) { return index_col.name == col.col_name; });
+        return index.type == INDEX_BTREE && pos != index.cols.end() &&
+               pos - index.cols.begin() <= match_index(x->tab_name_, x->conds_, index) / 2;
+    }
+    if (auto x = std::dynamic_pointer_cast<JoinPlan>(plan)) {
+        return x->tag == T_SortMerge && (same_col(x->conds_[0].lhs_col, col) || same_col(x->conds_[0].rhs_col, col));
+    }
+    if (auto x = std::dynamic_pointer_cast<SortPlan>(plan)) {
+        return !x->is_desc_ && same_col(x->sel_col_, col);
+    }
     return false;
 }
 
+/**
+ * @brief 选择sort merge join：打开enable_sortmerge_join时用于所有有等值连接条件的join，
+ * 否则只用于左右两侧已经按连接列有序的join。没有按连接列有序的一侧加上排序，选中的条件移到conds_的第一个作为key
+ */
+void Planner::use_sort_merge_join(std::shared_ptr<Plan> plan) {
+    auto x = std::dynamic_pointer_cast<JoinPlan>(plan);
+    if (x == nullptr) {
+        return;
+    }
+    use_sort_merge_join(x->left_);
+    use_sort_merge_join(x->right_);
+    if (x->tag != T_NestLoop && x->tag != T_SortMerge) {
+        return;
+    }
+    for (auto it = x->conds_.begin(); it != x->conds_.end(); it++) {
+        if (it->is_rhs_val || it->op != OP_EQ || it->lhs_col.tab_name == it->rhs_col.tab_name) {
+            continue;
+        }
+        auto lhs_col = sm_manager_->db_.get_table(it->lhs_col.tab_name).get_col(it->lhs_col.col_name);
+        auto rhs_col = sm_manager_->db_.get_table(it->rhs_col.tab_name).get_col(it->rhs_col.col_name);
+        if (lhs_col->type != rhs_col->type || lhs_col->len != rhs_col->len) {
+            continue;
+        }
+        TabCol left_col = it->lhs_col, right_col = it->rhs_col;
+        if (!plan_has_table(x->left_, left_col.tab_name)) {
+            std::swap(left_col, right_col);
+        }
+        bool left_sorted = is_sorted_on(x->left_, left_col), right_sorted = is_sorted_on(x->right_, right_col);
+        if (!enable_sortmerge_join && !(left_sorted && right_sorted)) {
+            continue;
+        }
+        if (!left_sorted) {
+            x->left_ = std::make_shared<SortPlan>(T_Sort, std::move(x->left_), left_col, false);
+        }
+        if (!right_sorted) {
+            x->right_ = std::make_shared<SortPlan>(T_Sort, std::move(x->right_), right_col, false);
+        }
+        std::iter_swap(x->conds_.begin(), it);
+        x->tag = T_SortMerge;
+        return;
+    }
+    // 没有可以作为key的等值条件时只能用nested loop join
+    x->tag = T_NestLoop;
+}
+
+/**
+ * @brief 估计表中的记录数：页面数乘以每页的记录数
+ */
+double Planner::table_rows(const std::string &tab_name) {
+    auto file_hdr = sm_manager_->fhs_.at(tab_name)->get_file_hdr();
+    return (double)std::max(file_hdr.num_pages - 1, 0) * file_hdr.num_records_per_page;
+}
+
+/**
+ * @brief 估计计划输出的记录数
+ *
+ * 扫描上与常量比较的条件，等值条件的选择率按1/10、范围条件按1/3估计；
+ * 有等值连接条件的join按两侧中较大的一侧估计，否则按笛卡尔积估计
+ */
+double Planner::estimate_rows(const std::shared_ptr<Plan> &plan) {
+    if (auto x = std::dynamic_pointer_cast<ScanPlan>(plan)) {
+        double rows = table_rows(x->tab_name_);
+        for (auto &cond : x->conds_) {
+            if (!cond.is_rhs_val || cond.op == OP_NE) continue;
+            rows *= cond.op == OP_EQ ? 0.1 : 1.0 / 3;
+        }
+        return rows;
+    }
+    if (auto x = std::dynamic_pointer_cast<JoinPlan>(plan)) {
+        double left = estimate_rows(x->left_), right = estimate_rows(x->right_);
+        bool equi_join = std::any_of(x->conds_.begin(), x->conds_.end(), [](const Condition &cond) {
+            return !cond.is_rhs_val && cond.op == OP_EQ;
+        });
+        return equi_join ? std::max(left, right) : left * right;
+    }
+    if (auto x = std::dynamic_pointer_cast<SortPlan>(plan)) {
+        return estimate_rows(x->subplan_);
+    }
+    return 0;
+}
+
+/**
+ * @brief 查找index nested loop join在内表上可以使用的B+树索引
+ *
+ * 索引前缀上的每个字段需要有与外表的列类型和长度相同的等值连接条件，或者内表上与常量的等值条件，
+ * 并且其中至少有一个连接条件。选择前缀最长的索引，相同时选择key较短的索引
+ */
+bool Planner::get_join_index(const std::shared_ptr<ScanPlan> &inner, const std::vector<Condition> &join_conds,
+                             std::vector<std::string> &index_col_names) {
+    TabMeta &tab = sm_manager_->db_.get_table(inner->tab_name_);
+    const IndexMeta *best = nullptr;
+    int best_matched = 0;
+    for (auto &index : tab.indexes) {
+        if (index.type != INDEX_BTREE) continue;
+        int num_matched = 0;
+        bool has_join_col = false;
+        for (auto &col : index.cols) {
+            bool join_col = std::any_of(join_conds.begin(), join_conds.end(), [&](const Condition &cond) {
+                if (cond.is_rhs_val || cond.op != OP_EQ) return false;
+                bool lhs_inner = cond.lhs_col.tab_name == inner->tab_name_;
+                bool rhs_inner = cond.rhs_col.tab_name == inner->tab_name_;
+                auto &inner_col = lhs_inner ? cond.lhs_col : cond.rhs_col;
+                auto &outer_col = lhs_inner ? cond.rhs_col : cond.lhs_col;
+                if (lhs_inner == rhs_inner || inner_col.col_name != col.name) return false;
+                auto outer_meta = sm_manager_->db_.get_table(outer_col.tab_name).get_col(outer_col.col_name);
+                return outer_meta->type == col.type && outer_meta->len == col.len;
+            });
+            bool const_col = std::any_of(inner->conds_.begin(), inner->conds_.end(), [&](const Condition &cond) {
+                return cond.is_rhs_val && cond.op == OP_EQ && cond.lhs_col.col_name == col.name &&
+                       cond.rhs_val.type == col.type;
+            });
+            if (!join_col && !const_col) break;
+            has_join_col |= join_col;
+            num_matched++;
+        }
+        if (!has_join_col) continue;
+        if (best == nullptr || num_matched > best_matched ||
+            (num_matched == best_matched && index.col_tot_len < best->col_tot_len)) {
+            best = &index;
+            best_matched = num_matched;
+        }
+    }
+    if (best == nullptr) return false;
+    index_col_names.clear();
+    for (auto &col : best->cols) {
+        index_col_names.push_back(col.name);
+    }
+    return true;
+}
+
+/**
+ * @brief 一侧是可以在连接列上使用B+树索引查找的单表扫描（见get_join_index），并且另一侧估计的记录数较少时，
+ * 把nested loop join改为index nested loop join：每条外表记录在内表的索引上查找一次，不需要扫描内表。
+ * 内表放在右侧，右侧的ScanPlan只提供表名、表上的条件和所用的索引
+ */
+void Planner::use_index_join(std::shared_ptr<Plan> plan) {
+    auto x = std::dynamic_pointer_cast<JoinPlan>(plan);
+    if (x == nullptr) {
+        return;
+    }
+    use_index_join(x->left_);
+    use_index_join(x->right_);
+    if (x->tag != T_NestLoop) {
+        return;
+    }
+    for (int side = 0; side < 2; side++) {
+        auto inner = std::dynamic_pointer_cast<ScanPlan>(side == 0 ? x->right_ : x->left_);
+        auto outer = side == 0 ? x->left_ : x->right_;
+        std::vector<std::string> index_col_names;
+        if (inner == nullptr || !get_join_index(inner, x->conds_, index_col_names)) {
+            continue;
+        }
+        if (estimate_rows(outer) * index_join_probe_cost > table_rows(inner->tab_name_)) {
+            continue;
+        }
+        if (side == 1) {
+            std::swap(x->left_, x->right_);
+        }
+        inner->index_col_names_ = std::move(index_col_names);
+        x->tag = T_IndexJoin;
+        return;
+    }
+}
+
+/**
+ * @brief 判断索引扫描是否使用bitmap heap scan：匹配的记录较多时，按索引顺序读取记录会随机访问并反复fetch同一个页面
+ *
+ * 表中的记录数用页面数乘以每页的记录数估计；索引前缀上每个等值条件的选择率按1/10、范围条件按1/3估计，
+ * 唯一索引完整的key上都有等值条件时最多匹配一条记录
+ */
+bool Planner::use_bitmap_scan(const std::string &tab_name, const std::vector<Condition> &curr_conds,
+                              const std::vector<std::string> &index_col_names) {
+    TabMeta &tab = sm_manager_->db_.get_table(tab_name);
+    auto &index = *tab.get_index_meta(index_col_names);
+    if (index.type != INDEX_BTREE) return false;
+    int score = match_index(tab_name, curr_conds, index);
+    int num_eq = score / 2;
+    if (index.unique && num_eq == index.col_num) return false;
+    double matches = table_rows(tab_name);
+    matches *= std::pow(0.1, num_eq) * (score % 2 == 1 ? 1.0 / 3 : 1.0);
+    return matches > bitmap_scan_threshold;
+}
+
+/**
+ * @brief 查找可以只扫描索引（index-only scan）的B+树索引：索引包含表中所有需要读取的列，且能缩小扫描范围
+ *
+ * @param tab_name 扫描的表名
+ * @param curr_conds 表上的条件
+ * @param proj_cols 表中需要读取的列，见get_proj_cols
+ * @param index_col_names 输入为get_index_cols选中的索引，没有时为空；输出为选中的覆盖索引
+ * @return 是否存在这样的索引。匹配程度（见match_index）不低于index_col_names时才选择覆盖索引，
+ *         此时扫描的索引槽不比原来的索引多，并且省去了读取记录
+ */
+bool Planner::get_covering_index(const std::string &tab_name, const std::vector<Condition> &curr_conds,
+                                 const std::vector<TabCol> &proj_cols, std::vector<std::string> &index_col_names) {
+    if (proj_cols.empty()) return false;
+    TabMeta &tab = sm_manager_->db_.get_table(tab_name);
+    int best_score = 1;
+    if (!index_col_names.empty()) {
+        best_score = std::max(best_score, match_index(tab_name, curr_conds, *tab.get_index_meta(index_col_names)));
+    }
+    const IndexMeta *best = nullptr;
+    for (auto &index : tab.indexes) {
+        if (index.type != INDEX_BTREE) continue;
+        bool covering = std::all_of(proj_cols.begin(), proj_cols.end(), [&](const TabCol &col) {
+            return std::any_of(index.cols.begin(), index.cols.end(),
+                               [&](const ColMeta &index_col) { return index_col.name == col.col_name; });
+        });
+        if (!covering) continue;
+        int score = match_index(tab_name, curr_conds, index);
+        // 匹配程度相同时选择较短的索引
+        if (score > best_score || (score == best_score && (best == nullptr || index.col_tot_len < best->col_tot_len))) {
+            best = &index;
+            best_score = score;
+        }
+    }
+    if (best == nullptr) return false;
+    index_col_names.clear();
+    for (auto &col : best->cols) {
+        index_col_names.push_back(col.name);
+    }
+    return true;
+}
+
+/**
+ * @brief 计算扫描算子需要向上层输出的列，包括投影列、条件中的列和排序列
+ *
+ * @param query 查询
+ * @param tab_name 扫描的表名
+ * @return std::vector<TabCol> 表tab_name中需要输出的列
+ */
+std::vector<TabCol> Planner::get_proj_cols(std::shared_ptr<Query> query, const std::string &tab_name) {
+    std::vector<TabCol> proj_cols;
+    auto add_col = [&](const TabCol &col) {
+        if (col.tab_name != tab_name) return;
+        for (auto &proj_col : proj_cols) {
+            if (proj_col.col_name == col.col_name) return;
+        }
+        proj_cols.push_back(col);
+    };
+    for (auto &sel_col : query->cols) {
+        add_col(sel_col);
+    }
+    for (auto &cond : query->conds) {
+        add_col(cond.lhs_col);
+        if (!cond.is_rhs_val) add_col(cond.rhs_col);
+    }
+    auto x = std::dynamic_pointer_cast<ast::SelectStmt>(query->parse);
+    if (x != nullptr && x->has_sort) {
+        // 排序列可能没有指定表名，这里按列名匹配
+        TabMeta &tab = sm_manager_->db_.get_table(tab_name);
+        if (tab.is_col(x->order->cols->col_name)) {
+            add_col({.tab_name = tab_name, .col_name = x->order->cols->col_name});
+        }
+    }
+    return proj_cols;
+}
+
 /**
  * @brief 表算子条件谓词生成
  *
@@ -130,6 +500,11 @@ std::shared_ptr<Plan> Planner::physical_optimization(std::shared_ptr<Query> quer
     std::shared_ptr<Plan> plan = make_one_rel(query);
     
     // 其他物理优化
+    use_sort_merge_join(plan);
+    use_index_join(plan);
+    if (enable_hash_join) {
+        use_hash_join(plan);
+    }
 
     // 处理orderby
     plan = generate_sort_plan(query, std::move(plan)); 
@@ -145,19 +520,29 @@ std::shared_ptr<Plan> Planner::make_one_rel(std::shared_ptr<Query> query)
     std::vector<std::string> tables = query->tables;
     // // Scan table , 生成表算子列表tab_nodes
     std::vector<std::shared_ptr<Plan>> table_scan_executors(tables.size());
+    std::vector<std::vector<TabCol>> proj_cols(tables.size());
+    for (size_t i = 0; i < tables.size(); i++) {
+        proj_cols[i] = get_proj_cols(query, tables[i]);
+    }
     for (size_t i = 0; i < tables.size(); i++) {
         auto curr_conds = pop_conds(query->conds, tables[i]);
         // int index_no = get_indexNo(tables[i], curr_conds);
         std::vector<std::string> index_col_names;
         bool index_exist = get_index_cols(tables[i], curr_conds, index_col_names);
-        if (index_exist == false) {  // 该表没有索引
+        if (!index_exist) index_col_names.clear();
+        bool index_only = get_covering_index(tables[i], curr_conds, proj_cols[i], index_col_names);
+        if (index_exist == false && !index_only) {  // 该表没有索引
             index_col_names.clear();
             table_scan_executors[i] = 
                 std::make_shared<ScanPlan>(T_SeqScan, sm_manager_, tables[i], curr_conds, index_col_names);
         } else {  // 存在索引
             table_scan_executors[i] =
                 std::make_shared<ScanPlan>(T_IndexScan, sm_manager_, tables[i], curr_conds, index_col_names);
+            auto scan = std::dynamic_pointer_cast<ScanPlan>(table_scan_executors[i]);
+            scan->index_only_ = index_only;
+            scan->bitmap_ = !index_only && use_bitmap_scan(tables[i], curr_conds, index_col_names);
         }
+        std::dynamic_pointer_cast<ScanPlan>(table_scan_executors[i])->proj_cols_ = std::move(proj_cols[i]);
     }
     // 只有一个表，不需要join。
     if(tables.size() == 1)
@@ -280,8 +665,21 @@ std::shared_ptr<Plan> Planner::generate_sort_plan(std::shared_ptr<Query> query,
         if(col.name.compare(x->order->cols->col_name) == 0 )
         sel_col = {.tab_name = col.tab_name, .col_name = col.name};
     }
-    return std::make_shared<SortPlan>(T_Sort, std::move(plan), sel_col, 
-                                    x->order->orderby_dir == ast::OrderBy_DESC);
+    bool is_desc = x->order->orderby_dir == ast::OrderBy_DESC;
+    // 单表上B+树索引的扫描：排序列之前的索引字段都有等值条件时，按索引顺序（或逆序）扫描即可得到有序结果
+    auto scan = std::dynamic_pointer_cast<ScanPlan>(plan);
+    if (scan != nullptr && scan->tag == T_IndexScan && scan->tab_name_ == sel_col.tab_name) {
+        auto &index = *sm_manager_->db_.get_table(scan->tab_name_).get_index_meta(scan->index_col_names_);
+        auto pos = std::find_if(index.cols.begin(), index.cols.end(),
+                                [&](const ColMeta &col) { return col.name == sel_col.col_name; });
+        if (index.type == INDEX_BTREE && pos != index.cols.end() &&
+            pos - index.cols.begin() <= match_index(scan->tab_name_, scan->conds_, index) / 2) {
+            scan->reverse_ = is_desc;
+            scan->bitmap_ = false;
+            return plan;
+        }
+    }
+    return std::make_shared<SortPlan>(T_Sort, std::move(plan), sel_col, is_desc);
 }
 
 
@@ -316,22 +714,31 @@ std::shared_ptr<Plan> Planner::do_planner(std::shared_ptr<Query> query, Context
             if (auto sv_col_def = std::dynamic_pointer_cast<ast::ColDef>(field)) {
                 ColDef col_def = {.name = sv_col_def->col_name,
                                   .type = interp_sv_type(sv_col_def->type_len->type),
-                                  .len = sv_col_def->type_len->len};
+                                  .len = sv_col_def->type_len->len,
+                                  .dict = sv_col_def->dict};
                 col_defs.push_back(col_def);
             } else {
                 throw InternalError("Unexpected field type");
             }
         }
-        plannerRoot = std::make_shared<DDLPlan>(T_CreateTable, x->tab_name, std::vector<std::string>(), col_defs);
+        auto ddl_plan = std::make_shared<DDLPlan>(T_CreateTable, x->tab_name, std::vector<std::string>(), col_defs);
+        ddl_plan->layout_ = x->layout == ast::SV_LAYOUT_PAX ? RM_LAYOUT_PAX : RM_LAYOUT_NSM;
+        plannerRoot = ddl_plan;
     } else if (auto x = std::dynamic_pointer_cast<ast::DropTable>(query->parse)) {
         // drop table;
         plannerRoot = std::make_shared<DDLPlan>(T_DropTable, x->tab_name, std::vector<std::string>(), std::vector<ColDef>());
     } else if (auto x = std::dynamic_pointer_cast<ast::CreateIndex>(query->parse)) {
         // create index;
-        plannerRoot = std::make_shared<DDLPlan>(T_CreateIndex, x->tab_name, x->col_names, std::vector<ColDef>());
+        auto ddl_plan = std::make_shared<DDLPlan>(T_CreateIndex, x->tab_name, x->col_names, std::vector<ColDef>());
+        ddl_plan->index_type_ = x->index_type == ast::SV_INDEX_HASH ? INDEX_HASH : INDEX_BTREE;
+        ddl_plan->unique_ = x->unique;
+        plannerRoot = ddl_plan;
     } else if (auto x = std::dynamic_pointer_cast<ast::DropIndex>(query->parse)) {
         // drop index
         plannerRoot = std::make_shared<DDLPlan>(T_DropIndex, x->tab_name, x->col_names, std::vector<ColDef>());
+    } else if (auto x = std::dynamic_pointer_cast<ast::Reindex>(query->parse)) {
+        // reindex;
+        plannerRoot = std::make_shared<DDLPlan>(T_Reindex, x->tab_name, x->col_names, std::vector<ColDef>());
     } else if (auto x = std::dynamic_pointer_cast<ast::InsertStmt>(query->parse)) {
         // insert;
         plannerRoot = std::make_shared<DMLPlan>(T_Insert, std::shared_ptr<Plan>(),  x->tab_name,  
@@ -350,8 +757,9 @@ std::shared_ptr<Plan> Planner::do_planner(std::shared_ptr<Query> query, Context
             table_scan_executors = 
                 std::make_shared<ScanPlan>(T_SeqScan, sm_manager_, x->tab_name, query->conds, index_col_names);
         } else {  // 存在索引
-            table_scan_executors =
-                std::make_shared<ScanPlan>(T_IndexScan, sm_manager_, x->tab_name, query->conds, index_col_names);
+            auto scan = std::make_shared<ScanPlan>(T_IndexScan, sm_manager_, x->tab_name, query->conds, index_col_names);
+            scan->bitmap_ = use_bitmap_scan(x->tab_name, query->conds, index_col_names);
+            table_scan_executors = scan;
         }
 
         plannerRoot = std::make_shared<DMLPlan>(T_Delete, table_scan_executors, x->tab_name,  
@@ -370,8 +778,9 @@ std::shared_ptr<Plan> Planner::do_planner(std::shared_ptr<Query> query, Context
             table_scan_executors = 
                 std::make_shared<ScanPlan>(T_SeqScan, sm_manager_, x->tab_name, query->conds, index_col_names);
         } else {  // 存在索引
-            table_scan_executors =
-                std::make_shared<ScanPlan>(T_IndexScan, sm_manager_, x->tab_name, query->conds, index_col_names);
+            auto scan = std::make_shared<ScanPlan>(T_IndexScan, sm_manager_, x->tab_name, query->conds, index_col_names);
+            scan->bitmap_ = use_bitmap_scan(x->tab_name, query->conds, index_col_names);
+            table_scan_executors = scan;
         }
         plannerRoot = std::make_shared<DMLPlan>(T_Update, table_scan_executors, x->tab_name,
                                                      std::vector<Value>(), query->conds, 
@@ -32,6 +32,13 @@ class Planner {
 
     bool enable_nestedloop_join = true;
     bool enable_sortmerge_join = false;
+    bool enable_hash_join = true;
+
+    // 估计索引扫描匹配的记录数超过该值时使用bitmap heap scan，见use_bitmap_scan
+    size_t bitmap_scan_threshold = 64;
+
+    // 外表估计的记录数乘以该值不超过内表的记录数时使用index nested loop join，见use_index_join
+    size_t index_join_probe_cost = 4;
 
    public:
     Planner(SmManager *sm_manager) : sm_manager_(sm_manager) {}
@@ -42,6 +49,8 @@ class Planner {
     void set_enable_nestedloop_join(bool set_val) { enable_nestedloop_join = set_val; }
     
     void set_enable_sortmerge_join(bool set_val) { enable_sortmerge_join = set_val; }
+
+    void set_enable_hash_join(bool set_val) { enable_hash_join = set_val; }
     
    private:
     std::shared_ptr<Query> logical_optimization(std::shared_ptr<Query> query, Context *context);
@@ -55,8 +64,33 @@ class Planner {
 
 
     // int get_indexNo(std::string tab_name, std::vector<Condition> curr_conds);
+    int match_index(const std::string &tab_name, const std::vector<Condition> &curr_conds, const IndexMeta &index);
+
     bool get_index_cols(std::string tab_name, std::vector<Condition> curr_conds, std::vector<std::string>& index_col_names);
 
+    bool use_bitmap_scan(const std::string &tab_name, const std::vector<Condition> &curr_conds,
+                         const std::vector<std::string> &index_col_names);
+
+    void use_hash_join(std::shared_ptr<Plan> plan);
+
+    bool is_sorted_on(const std::shared_ptr<Plan> &plan, const TabCol &col);
+
+    void use_sort_merge_join(std::shared_ptr<Plan> plan);
+
+    double table_rows(const std::string &tab_name);
+
+    double estimate_rows(const std::shared_ptr<Plan> &plan);
+
+    bool get_join_index(const std::shared_ptr<ScanPlan> &inner, const std::vector<Condition> &join_conds,
+                        std::vector<std::string> &index_col_names);
+
+    void use_index_join(std::shared_ptr<Plan> plan);
+
+    bool get_covering_index(const std::string &tab_name, const std::vector<Condition> &curr_conds,
+                            const std::vector<TabCol> &proj_cols, std::vector<std::string> &index_col_names);
+
+    std::vector<TabCol> get_proj_cols(std::shared_ptr<Query> query, const std::string &tab_name);
+
     ColType interp_sv_type(ast::SvType sv_type) {
         std::map<ast::SvType, ColType> m = {
             {ast::SV_TYPE_INT, TYPE_INT}, {ast::SV_TYPE_FLOAT, TYPE_FLOAT}, {ast::SV_TYPE_STRING, TYPE_STRING}};
@@ -33,7 +33,15 @@ enum OrderByDir {
 };
 
 enum SetKnobType {
-    EnableNestLoop, EnableSortMerge
+    EnableNestLoop, EnableSortMerge, EnableHashJoin
+};
+
+enum SvLayout {
+    SV_LAYOUT_ROW, SV_LAYOUT_PAX
+};
+
+enum SvIndexType {
+    SV_INDEX_BTREE, SV_INDEX_HASH
 };
 
 // Base class for tree nodes
@@ -72,17 +80,19 @@ struct Field : public TreeNode {
 struct ColDef : public Field {
     std::string col_name;
     std::shared_ptr<TypeLen> type_len;
+    bool dict;
 
-    ColDef(std::string col_name_, std::shared_ptr<TypeLen> type_len_) :
-            col_name(std::move(col_name_)), type_len(std::move(type_len_)) {}
+    ColDef(std::string col_name_, std::shared_ptr<TypeLen> type_len_, bool dict_ = false) :
+            col_name(std::move(col_name_)), type_len(std::move(type_len_)), dict(dict_) {}
 };
 
 struct CreateTable : public TreeNode {
     std::string tab_name;
     std::vector<std::shared_ptr<Field>> fields;
+    SvLayout layout;
 
-    CreateTable(std::string tab_name_, std::vector<std::shared_ptr<Field>> fields_) :
-            tab_name(std::move(tab_name_)), fields(std::move(fields_)) {}
+    CreateTable(std::string tab_name_, std::vector<std::shared_ptr<Field>> fields_, SvLayout layout_ = SV_LAYOUT_ROW) :
+            tab_name(std::move(tab_name_)), fields(std::move(fields_)), layout(layout_) {}
 };
 
 struct DropTable : public TreeNode {
@@ -100,9 +110,12 @@ struct DescTable : public TreeNode {
 struct CreateIndex : public TreeNode {
     std::string tab_name;
     std::vector<std::string> col_names;
+    SvIndexType index_type;
+    bool unique;
 
-    CreateIndex(std::string tab_name_, std::vector<std::string> col_names_) :
-            tab_name(std::move(tab_name_)), col_names(std::move(col_names_)) {}
+    CreateIndex(std::string tab_name_, std::vector<std::string> col_names_, SvIndexType index_type_ = SV_INDEX_BTREE,
+                bool unique_ = true) :
+            tab_name(std::move(tab_name_)), col_names(std::move(col_names_)), index_type(index_type_), unique(unique_) {}
 };
 
 struct DropIndex : public TreeNode {
@@ -113,6 +126,15 @@ struct DropIndex : public TreeNode {
             tab_name(std::move(tab_name_)), col_names(std::move(col_names_)) {}
 };
 
+// 重建索引，使索引中的页面重新变得紧凑、有序
+struct Reindex : public TreeNode {
+    std::string tab_name;
+    std::vector<std::string> col_names;
+
+    Reindex(std::string tab_name_, std::vector<std::string> col_names_) :
+            tab_name(std::move(tab_name_)), col_names(std::move(col_names_)) {}
+};
+
 struct Expr : public TreeNode {
 };
 
@@ -101,6 +101,11 @@ private:
             // print_val(x->col_name, offset);
             for(auto col_name: x->col_names)
                 print_val(col_name, offset);
+        } else if (auto x = std::dynamic_pointer_cast<Reindex>(node)) {
+            std::cout << "REINDEX\n";
+            print_val(x->tab_name, offset);
+            for(auto col_name: x->col_names)
+                print_val(col_name, offset);
         } else if (auto x = std::dynamic_pointer_cast<ColDef>(node)) {
             std::cout << "COL_DEF\n";
             print_val(x->col_name, offset);
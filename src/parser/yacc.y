@@ -22,7 +22,7 @@ using namespace ast;
 
 // keywords
 %token SHOW TABLES CREATE TABLE DROP DESC INSERT INTO VALUES DELETE FROM ASC ORDER BY
-WHERE UPDATE SET SELECT INT CHAR FLOAT INDEX AND JOIN EXIT HELP TXN_BEGIN TXN_COMMIT TXN_ABORT TXN_ROLLBACK ORDER_BY ENABLE_NESTLOOP ENABLE_SORTMERGE
+WHERE UPDATE SET SELECT INT CHAR FLOAT INDEX AND JOIN EXIT HELP TXN_BEGIN TXN_COMMIT TXN_ABORT TXN_ROLLBACK ORDER_BY ENABLE_NESTLOOP ENABLE_SORTMERGE ENABLE_HASHJOIN USING PAX HASH DICT NONUNIQUE REINDEX
 // non-keywords
 %token LEQ NEQ GEQ T_EOF
 
@@ -124,6 +124,10 @@ ddl:
     {
         $$ = std::make_shared<CreateTable>($3, $5);
     }
+    |   CREATE TABLE tbName '(' fieldList ')' USING PAX
+    {
+        $$ = std::make_shared<CreateTable>($3, $5, SV_LAYOUT_PAX);
+    }
     |   DROP TABLE tbName
     {
         $$ = std::make_shared<DropTable>($3);
@@ -136,10 +140,22 @@ ddl:
     {
         $$ = std::make_shared<CreateIndex>($3, $5);
     }
+    |   CREATE INDEX tbName '(' colNameList ')' USING HASH
+    {
+        $$ = std::make_shared<CreateIndex>($3, $5, SV_INDEX_HASH);
+    }
+    |   CREATE NONUNIQUE INDEX tbName '(' colNameList ')'
+    {
+        $$ = std::make_shared<CreateIndex>($4, $6, SV_INDEX_BTREE, false);
+    }
     |   DROP INDEX tbName '(' colNameList ')'
     {
         $$ = std::make_shared<DropIndex>($3, $5);
     }
+    |   REINDEX tbName '(' colNameList ')'
+    {
+        $$ = std::make_shared<Reindex>($2, $4);
+    }
     ;
 dml:
         INSERT INTO tbName VALUES '(' valueList ')'
@@ -189,6 +205,10 @@ field:
     {
         $$ = std::make_shared<ColDef>($1, $2);
     }
+    |   colName type DICT
+    {
+        $$ = std::make_shared<ColDef>($1, $2, true);
+    }
     ;
 
 type:
@@ -403,6 +423,7 @@ opt_asc_desc:
 set_knob_type:
     ENABLE_NESTLOOP { $$ = EnableNestLoop; }
     |   ENABLE_SORTMERGE { $$ = EnableSortMerge; }
+    |   ENABLE_HASHJOIN { $$ = EnableHashJoin; }
     ;
 
 tbName: IDENTIFIER;
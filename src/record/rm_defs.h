@@ -10,6 +10,9 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "defs.h"
 #include "storage/buffer_pool_manager.h"
 
@@ -17,6 +20,13 @@ constexpr int RM_NO_PAGE = -1;
 constexpr int RM_FILE_HDR_PAGE = 0;
 constexpr int RM_FIRST_RECORD_PAGE = 1;
 constexpr int RM_MAX_RECORD_SIZE = 512;
+constexpr int RM_MAX_COLS = 64;
+
+/* 表数据文件中页面的组织方式 */
+enum RmLayout {
+    RM_LAYOUT_NSM = 0,  // 行式布局，每个slot连续存放一条完整记录
+    RM_LAYOUT_PAX = 1   // PAX布局，页面按列划分为若干minipage，同一列的值在页面内连续存放
+};
 
 struct TupleMeta {
     timestamp_t ts_;
@@ -36,6 +46,36 @@ struct RmFileHdr {
     int num_records_per_page;   // 每个页面最多能存储的元组个数
     int first_free_page_no;     // 文件中当前第一个包含空闲空间的页面号（初始化为-1）
     int bitmap_size;            // 每个页面bitmap大小
+    // 以下字段是后来加入的，旧版本的文件头中没有，打开文件时读出为0，见RmFileHandle的构造函数
+    int slot_size;              // 每条记录在页面中实际占用的大小，字典编码的列只存放编码，因此可能小于record_size
+    int layout;                 // 页面布局，取值为RmLayout
+    int num_cols;               // 记录的列数，只有PAX布局或者存在字典编码的列时才会设置
+    int col_lens[RM_MAX_COLS];  // 每一列在slot中占用的长度，PAX布局下各列的minipage按列的顺序依次存放
+    int dict_lens[RM_MAX_COLS]; // 字典编码的列在记录中的原始长度，没有使用字典编码的列为0
+};
+
+/* 字典编码的列在页面中存放的编码 */
+typedef uint16_t RmDictCode;
+
+/* 记录中的一个字段，offset和len需要对应完整的一列，用于按列访问记录 */
+struct RmField {
+    int offset;     // 字段在记录中的偏移
+    int len;        // 字段的长度
+};
+
+/* 原地更新一条记录时产生的增量，只包含值真正发生变化的字段，用于写undo/redo日志 */
+struct RmRecordDelta {
+    std::vector<RmField> fields;    // 发生变化的字段在记录中的位置
+    std::string old_values;         // 各字段的旧值，按fields的顺序依次存放
+    std::string new_values;         // 各字段的新值，按fields的顺序依次存放
+
+    bool empty() const { return fields.empty(); }
+};
+
+/* 表数据文件中一段连续的页面[start_page, end_page)，并行扫描时每次交给一个worker处理 */
+struct RmMorsel {
+    int start_page;
+    int end_page;
 };
 
 /* 表数据文件中每个页面的页头，记录每个页面的元信息 */
@@ -0,0 +1,72 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <deque>
+#include <limits>
+#include <string>
+#include <unordered_map>
+
+#include "errors.h"
+#include "rm_defs.h"
+
+constexpr int RM_MAX_DICT_SIZE = std::numeric_limits<RmDictCode>::max() + 1;
+
+/**
+ * 字典编码的列对应的字典，记录原始值和编码之间的映射。
+ * 编码按照值第一次出现的顺序分配，字典只会增长，因此已经写入页面的编码始终有效。
+ */
+class RmDictionary {
+    int len_;                                           // 原始值的长度
+    std::deque<std::string> values_;                    // values_[code]为编码code对应的原始值，deque保证扩容时已有的值地址不变
+    std::unordered_map<std::string, RmDictCode> codes_; // 原始值到编码的映射
+
+   public:
+    explicit RmDictionary(int len) : len_(len) {}
+
+    int len() const { return len_; }
+
+    size_t size() const { return values_.size(); }
+
+    // 返回原始值val的编码，val不在字典中时返回-1
+    int find(const char *val) const {
+        auto pos = codes_.find(std::string(val, len_));
+        return pos == codes_.end() ? -1 : pos->second;
+    }
+
+    // 返回原始值val的编码，val不在字典中时为其分配新的编码，并将added置为true
+    RmDictCode encode(const char *val, bool *added) {
+        std::string key(val, len_);
+        auto pos = codes_.find(key);
+        if (pos != codes_.end()) {
+            *added = false;
+            return pos->second;
+        }
+        if ((int)values_.size() == RM_MAX_DICT_SIZE) {
+            throw InternalError("Dictionary is full, too many distinct values for a dictionary encoded column");
+        }
+        RmDictCode code = values_.size();
+        values_.push_back(key);
+        codes_.emplace(std::move(key), code);
+        *added = true;
+        return code;
+    }
+
+    // 返回编码code对应的原始值
+    const char *decode(RmDictCode code) const { return values_[code].data(); }
+
+    // 读取页面上存放的编码，编码在slot中不一定对齐
+    static RmDictCode get_code(const char *data) {
+        RmDictCode code;
+        memcpy(&code, data, sizeof(RmDictCode));
+        return code;
+    }
+};
@@ -10,6 +10,8 @@ See the Mulan PSL v2 for more details. */
 
 #include "rm_file_handle.h"
 
+#include <fstream>
+
 /**
  * @description: 获取当前表中记录号为rid的记录
  * @param {Rid&} rid 记录号，指定记录的位置
@@ -22,9 +24,55 @@ std::unique_ptr<RmRecord> RmFileHandle::get_record(const Rid& rid, Context* cont
     // 2. 初始化一个指向RmRecord的指针（赋值其内部的data和size）
     if (context != nullptr) context->lock_mgr_->lock_shared_on_record(context->txn_, rid, fd_);
     RmPageHandle page_handle = fetch_page_handle(rid.page_no);
-    char *data = page_handle.get_slot(rid.slot_no);
-    
-    return std::make_unique<RmRecord>(file_hdr_.record_size, data);
+    auto record = std::make_unique<RmRecord>(file_hdr_.record_size);
+    read_record(page_handle, rid.slot_no, record->data);
+    buffer_pool_manager_->unpin_page(page_handle.page->get_page_id(), false);
+    return record;
+}
+
+/**
+ * @description: 获取当前表中记录号为rid的记录，只读取fields指定的列，其余字节置0
+ * @param {Rid&} rid 记录号，指定记录的位置
+ * @param {vector<RmField>&} fields 需要读取的列，PAX布局下只会访问这些列所在的minipage
+ * @param {Context*} context
+ * @return {unique_ptr<RmRecord>} rid对应的记录对象指针
+ */
+std::unique_ptr<RmRecord> RmFileHandle::get_record(const Rid& rid, const std::vector<RmField>& fields,
+                                                   Context* context) const {
+    if (context != nullptr) context->lock_mgr_->lock_shared_on_record(context->txn_, rid, fd_);
+    RmPageHandle page_handle = fetch_page_handle(rid.page_no);
+    auto record = std::make_unique<RmRecord>(file_hdr_.record_size);
+    read_fields(page_handle, rid.slot_no, fields, record->data);
+    buffer_pool_manager_->unpin_page(page_handle.page->get_page_id(), false);
+    return record;
+}
+
+/**
+ * @description: 读取同一个页面上的多条记录，页面只fetch一次
+ * @param {Rid*} rids 记录号数组，所有记录都位于rids[0].page_no页面上
+ * @param {int} num_rids 记录个数
+ * @param {Context*} context
+ * @return {vector<unique_ptr<RmRecord>>} 与rids一一对应的记录
+ */
+std::vector<std::unique_ptr<RmRecord>> RmFileHandle::get_records(const Rid* rids, int num_rids,
+                                                                Context* context) const {
+    std::vector<std::unique_ptr<RmRecord>> records;
+    if (num_rids == 0) return records;
+    if (context != nullptr) {
+        for (int i = 0; i < num_rids; i++) {
+            context->lock_mgr_->lock_shared_on_record(context->txn_, rids[i], fd_);
+        }
+    }
+    RmPageHandle page_handle = fetch_page_handle(rids[0].page_no);
+    records.reserve(num_rids);
+    for (int i = 0; i < num_rids; i++) {
+        assert(rids[i].page_no == rids[0].page_no);
+        auto record = std::make_unique<RmRecord>(file_hdr_.record_size);
+        read_record(page_handle, rids[i].slot_no, record->data);
+        records.push_back(std::move(record));
+    }
+    buffer_pool_manager_->unpin_page(page_handle.page->get_page_id(), false);
+    return records;
 }
 
 /**
@@ -40,19 +88,22 @@ Rid RmFileHandle::insert_record(char* buf, Context* context) {
     // 3. 将buf复制到空闲slot位置
     // 4. 更新page_handle.page_hdr中的数据结构
     // 注意考虑插入一条记录后页面已满的情况，需要更新file_hdr_.first_free_page_no
-    RmPageHandle new_page_handle = create_new_page_handle();
-    int slot_no = Bitmap::first_bit(false, new_page_handle.bitmap, file_hdr_.num_records_per_page);
+    RmPageHandle page_handle = create_page_handle();
+    int slot_no = Bitmap::first_bit(false, page_handle.bitmap, file_hdr_.num_records_per_page);
 
-    memcpy(new_page_handle.get_slot(slot_no), buf, file_hdr_.record_size);
+    write_record(page_handle, slot_no, buf);
 
-    Bitmap::set(new_page_handle.bitmap, slot_no);
-    new_page_handle.page_hdr->num_records++;
+    Bitmap::set(page_handle.bitmap, slot_no);
+    page_handle.page_hdr->num_records++;
 
     // 如果插入之后当前页满了
-    if (new_page_handle.page_hdr->num_records == new_page_handle.file_hdr->num_records_per_page) {
-        file_hdr_.first_free_page_no = new_page_handle.page_hdr->next_free_page_no;
+    if (page_handle.page_hdr->num_records == file_hdr_.num_records_per_page) {
+        file_hdr_.first_free_page_no = page_handle.page_hdr->next_free_page_no;
     }
-    return Rid{new_page_handle.page->get_page_id().page_no, slot_no};
+    Rid rid = {page_handle.page->get_page_id().page_no, slot_no};
+    update_zone_map(rid.page_no, buf);
+    buffer_pool_manager_->unpin_page(page_handle.page->get_page_id(), true);
+    return rid;
 }
 
 /**
@@ -65,17 +116,40 @@ void RmFileHandle::insert_record(const Rid& rid, char* buf) {
         throw PageNotExistError(disk_manager_->get_file_name(fd_), rid.page_no);
     }
     RmPageHandle rph = fetch_page_handle(rid.page_no);
-    memcpy(rph.get_slot(rid.slot_no), rph.bitmap, file_hdr_.record_size);
-    
+    write_record(rph, rid.slot_no, buf);
+    update_zone_map(rid.page_no, buf);
+
     // 如果指定位置上已经有了值,那么直接返回即可
-    if (Bitmap::is_set(rph.bitmap, rid.slot_no)) return ;
+    if (Bitmap::is_set(rph.bitmap, rid.slot_no)) {
+        buffer_pool_manager_->unpin_page(rph.page->get_page_id(), true);
+        return ;
+    }
 
     // 指定位置上原本并没有值
     Bitmap::set(rph.bitmap, rid.slot_no);
+    rph.page_hdr->num_records++;
+    // 插入后页面变满，需要将其从空闲页面链表中摘除
     if (rph.page_hdr->num_records == file_hdr_.num_records_per_page) {
-        rph.page_hdr->next_free_page_no = file_hdr_.first_free_page_no;
+        int page_no = rid.page_no;
+        if (file_hdr_.first_free_page_no == page_no) {
+            file_hdr_.first_free_page_no = rph.page_hdr->next_free_page_no;
+        } else {
+            int prev_no = file_hdr_.first_free_page_no;
+            while (prev_no != RM_NO_PAGE) {
+                RmPageHandle prev = fetch_page_handle(prev_no);
+                int next_no = prev.page_hdr->next_free_page_no;
+                bool found = next_no == page_no;
+                if (found) {
+                    prev.page_hdr->next_free_page_no = rph.page_hdr->next_free_page_no;
+                }
+                buffer_pool_manager_->unpin_page(prev.page->get_page_id(), found);
+                if (found) break;
+                prev_no = next_no;
+            }
+        }
+        rph.page_hdr->next_free_page_no = RM_NO_PAGE;
     }
-    return ;
+    buffer_pool_manager_->unpin_page(rph.page->get_page_id(), true);
 }
 
 /**
@@ -99,6 +173,7 @@ void RmFileHandle::delete_record(const Rid& rid, Context* context) {
     if (rph.page_hdr->num_records + 1 == file_hdr_.num_records_per_page) {
         release_page_handle(rph);
     }
+    buffer_pool_manager_->unpin_page(rph.page->get_page_id(), true);
 }
 
 
@@ -117,12 +192,276 @@ void RmFileHandle::update_record(const Rid& rid, char* buf, Context* context) {
         throw PageNotExistError(disk_manager_->get_file_name(fd_), rid.page_no);
     }
     RmPageHandle rph = fetch_page_handle(rid.page_no);
-    memcpy(rph.get_slot(rid.slot_no), buf, file_hdr_.record_size);
+    write_record(rph, rid.slot_no, buf);
+    update_zone_map(rid.page_no, buf);
 
     //将页面标记为脏页，并放入LRU链表
     buffer_pool_manager_->unpin_page(rph.page->get_page_id(), true);
 }
 
+/**
+ * @description: 原地更新记录号为rid的记录中的部分字段，只修改值发生变化的字段，不拷贝整条记录
+ * @param {Rid&} rid 要更新的记录的记录号（位置）
+ * @param {vector<RmField>&} fields 需要更新的字段在记录中的位置
+ * @param {char*} buf 按记录格式存放的新值，只有fields对应的部分有效
+ * @param {Context*} context
+ * @return {RmRecordDelta} 值发生变化的字段及其旧值和新值
+ */
+RmRecordDelta RmFileHandle::update_fields(const Rid& rid, const std::vector<RmField>& fields, const char* buf,
+                                          Context* context) {
+    if (rid.page_no >= file_hdr_.num_pages) {
+        throw PageNotExistError(disk_manager_->get_file_name(fd_), rid.page_no);
+    }
+    if (context != nullptr) context->lock_mgr_->lock_exclusive_on_record(context->txn_, rid, fd_);
+    RmPageHandle rph = fetch_page_handle(rid.page_no);
+    RmRecordDelta delta;
+    for (auto &field : fields) {
+        const char *new_value = buf + field.offset;
+        const RmDictionary *dict = get_dictionary(field);
+        char *data = rph.get_field(rid.slot_no, get_slot_field(field));
+        const char *old_value = dict != nullptr ? dict->decode(RmDictionary::get_code(data)) : data;
+        if (memcmp(old_value, new_value, field.len) == 0) {
+            continue;
+        }
+        delta.fields.push_back(field);
+        delta.old_values.append(old_value, field.len);
+        delta.new_values.append(new_value, field.len);
+        if (dict != nullptr) {
+            RmDictCode code = encode_field(get_col_idx(field.offset), new_value);
+            memcpy(data, &code, sizeof(RmDictCode));
+        } else {
+            memcpy(data, new_value, field.len);
+        }
+        update_zone_map(rid.page_no, field, new_value);
+    }
+    buffer_pool_manager_->unpin_page(rph.page->get_page_id(), !delta.empty());
+    return delta;
+}
+
+/**
+ * @description: 获取当前表的zone map，第一次调用时扫描整个文件建立，建立期间持有zone_latch_的写锁，
+ * 并发的插入和更新等待建立完成后再扩大范围
+ * @return {const RmZoneMap*} 当前表的zone map，表中没有需要维护范围的列时返回nullptr
+ */
+const RmZoneMap* RmFileHandle::get_zone_map() const {
+    if (zone_map_ == nullptr) {
+        return nullptr;
+    }
+    {
+        std::shared_lock lock(zone_latch_);
+        if (zone_map_->is_built()) return zone_map_.get();
+    }
+    std::unique_lock lock(zone_latch_);
+    if (zone_map_->is_built()) {
+        return zone_map_.get();
+    }
+    std::vector<char> buf(file_hdr_.record_size);
+    for (int page_no = RM_FIRST_RECORD_PAGE; page_no < file_hdr_.num_pages; page_no++) {
+        RmPageHandle page_handle = fetch_page_handle(page_no);
+        for (int slot_no = Bitmap::first_bit(true, page_handle.bitmap, file_hdr_.num_records_per_page);
+             slot_no < file_hdr_.num_records_per_page;
+             slot_no = Bitmap::next_bit(true, page_handle.bitmap, file_hdr_.num_records_per_page, slot_no)) {
+            read_record(page_handle, slot_no, buf.data());
+            zone_map_->update(page_no, buf.data());
+        }
+        buffer_pool_manager_->unpin_page(page_handle.page->get_page_id(), false);
+    }
+    zone_map_->set_built();
+    return zone_map_.get();
+}
+
+/**
+ * @description: 读取page_handle中slot_no上的记录，存在字典编码的列时需要解码，调用者需要保证页面已经pin住
+ * @param {RmPageHandle&} page_handle 记录所在页面的句柄
+ * @param {int} slot_no 记录所在的slot
+ * @param {char*} buf 读出的记录，长度为record_size
+ */
+void RmFileHandle::read_record(const RmPageHandle& page_handle, int slot_no, char* buf) const {
+    if (!has_dict_) {
+        page_handle.read_record(slot_no, buf);
+        return;
+    }
+    char slot_buf[RM_MAX_RECORD_SIZE];
+    page_handle.read_record(slot_no, slot_buf);
+    decode_record(slot_buf, buf);
+}
+
+/**
+ * @description: 读取page_handle中slot_no上记录的部分字段，其余字节置0，调用者需要保证页面已经pin住
+ * @param {RmPageHandle&} page_handle 记录所在页面的句柄
+ * @param {int} slot_no 记录所在的slot
+ * @param {vector<RmField>&} fields 需要读取的字段在记录中的位置
+ * @param {char*} buf 读出的记录，长度为record_size
+ */
+void RmFileHandle::read_fields(const RmPageHandle& page_handle, int slot_no, const std::vector<RmField>& fields,
+                               char* buf) const {
+    memset(buf, 0, file_hdr_.record_size);
+    for (auto &field : fields) {
+        if (!has_dict_) {
+            memcpy(buf + field.offset, page_handle.get_field(slot_no, field), field.len);
+            continue;
+        }
+        int col_idx = get_col_idx(field.offset);
+        char *data = page_handle.get_field(slot_no, get_slot_field(field));
+        if (dicts_[col_idx] != nullptr) {
+            memcpy(buf + field.offset, dicts_[col_idx]->decode(RmDictionary::get_code(data)), field.len);
+        } else {
+            memcpy(buf + field.offset, data, field.len);
+        }
+    }
+}
+
+/**
+ * @description: 将文件中的记录页面划分为若干段连续的页面，用于并行扫描
+ * @param {int} morsel_size 每一段包含的页面数
+ * @return {vector<RmMorsel>} 按页面号排列的各段页面
+ */
+std::vector<RmMorsel> RmFileHandle::get_morsels(int morsel_size) const {
+    std::vector<RmMorsel> morsels;
+    for (int page_no = RM_FIRST_RECORD_PAGE; page_no < file_hdr_.num_pages; page_no += morsel_size) {
+        morsels.push_back({page_no, std::min(page_no + morsel_size, file_hdr_.num_pages)});
+    }
+    return morsels;
+}
+
+/**
+ * @description: 将记录中的字段映射到slot中实际存放的位置
+ * @param {RmField&} field 字段在记录中的位置
+ * @return {RmField} 字段在slot中的位置，字典编码的列长度为sizeof(RmDictCode)
+ */
+RmField RmFileHandle::get_slot_field(const RmField& field) const {
+    if (!has_dict_) {
+        return field;
+    }
+    int col_idx = get_col_idx(field.offset);
+    RmField slot_field = {0, file_hdr_.col_lens[col_idx]};
+    for (int i = 0; i < col_idx; i++) {
+        slot_field.offset += file_hdr_.col_lens[i];
+    }
+    return slot_field;
+}
+
+/**
+ * @description: 获取字段所在列的字典
+ * @param {RmField&} field 字段在记录中的位置
+ * @return {const RmDictionary*} 字段所在列的字典，该列没有使用字典编码时返回nullptr
+ */
+const RmDictionary* RmFileHandle::get_dictionary(const RmField& field) const {
+    if (!has_dict_) {
+        return nullptr;
+    }
+    return dicts_[get_col_idx(field.offset)].get();
+}
+
+/**
+ * @description: 打开文件时从字典文件中读出所有字典编码列的字典，字典文件中的每一项为列号和该列的一个原始值
+ */
+void RmFileHandle::load_dictionaries() {
+    for (int i = 0; i < file_hdr_.num_cols; i++) {
+        if (file_hdr_.dict_lens[i] > 0) {
+            dicts_.resize(file_hdr_.num_cols);
+            dicts_[i] = std::make_unique<RmDictionary>(file_hdr_.dict_lens[i]);
+            has_dict_ = true;
+        }
+    }
+    if (!has_dict_) {
+        return;
+    }
+    std::ifstream ifs(get_dict_name(disk_manager_->get_file_name(fd_)), std::ios::binary);
+    int col_idx;
+    char val[RM_MAX_RECORD_SIZE];
+    while (ifs.read((char *)&col_idx, sizeof(col_idx))) {
+        if (col_idx < 0 || col_idx >= file_hdr_.num_cols || dicts_[col_idx] == nullptr ||
+            !ifs.read(val, dicts_[col_idx]->len())) {
+            throw InternalError("Corrupted dictionary file of " + disk_manager_->get_file_name(fd_));
+        }
+        bool added;
+        dicts_[col_idx]->encode(val, &added);
+    }
+}
+
+/**
+ * @description: 获取记录中偏移为offset的列的列号
+ */
+int RmFileHandle::get_col_idx(int offset) const {
+    int col_offset = 0;
+    for (int i = 0; i < file_hdr_.num_cols; i++) {
+        if (col_offset == offset) return i;
+        col_offset += file_hdr_.dict_lens[i] > 0 ? file_hdr_.dict_lens[i] : file_hdr_.col_lens[i];
+    }
+    throw InternalError("Invalid field offset: " + std::to_string(offset));
+}
+
+/**
+ * @description: 获取第col_idx列中值val的编码，字典中没有的值会分配新的编码并追加写入字典文件
+ * @param {int} col_idx 字典编码的列的列号
+ * @param {char*} val 原始值
+ * @return {RmDictCode} val的编码
+ */
+RmDictCode RmFileHandle::encode_field(int col_idx, const char* val) {
+    bool added;
+    RmDictCode code = dicts_[col_idx]->encode(val, &added);
+    if (added) {
+        // 新的值需要先写入字典文件，保证页面落盘时其中的编码都能在字典文件中找到
+        std::ofstream ofs(get_dict_name(disk_manager_->get_file_name(fd_)), std::ios::binary | std::ios::app);
+        ofs.write((char *)&col_idx, sizeof(col_idx));
+        ofs.write(val, dicts_[col_idx]->len());
+    }
+    return code;
+}
+
+/**
+ * @description: 将记录编码为slot中存放的格式
+ * @param {char*} buf 原始记录，长度为record_size
+ * @param {char*} slot_buf 编码后的记录，长度为slot_size
+ */
+void RmFileHandle::encode_record(const char* buf, char* slot_buf) {
+    for (int i = 0; i < file_hdr_.num_cols; i++) {
+        if (dicts_[i] == nullptr) {
+            memcpy(slot_buf, buf, file_hdr_.col_lens[i]);
+            buf += file_hdr_.col_lens[i];
+            slot_buf += file_hdr_.col_lens[i];
+            continue;
+        }
+        RmDictCode code = encode_field(i, buf);
+        memcpy(slot_buf, &code, sizeof(RmDictCode));
+        buf += dicts_[i]->len();
+        slot_buf += sizeof(RmDictCode);
+    }
+}
+
+/**
+ * @description: 将slot中存放的记录解码为原始记录
+ * @param {char*} slot_buf slot中存放的记录，长度为slot_size
+ * @param {char*} buf 解码后的原始记录，长度为record_size
+ */
+void RmFileHandle::decode_record(const char* slot_buf, char* buf) const {
+    for (int i = 0; i < file_hdr_.num_cols; i++) {
+        if (dicts_[i] == nullptr) {
+            memcpy(buf, slot_buf, file_hdr_.col_lens[i]);
+            buf += file_hdr_.col_lens[i];
+            slot_buf += file_hdr_.col_lens[i];
+            continue;
+        }
+        memcpy(buf, dicts_[i]->decode(RmDictionary::get_code(slot_buf)), dicts_[i]->len());
+        buf += dicts_[i]->len();
+        slot_buf += sizeof(RmDictCode);
+    }
+}
+
+/**
+ * @description: 将原始记录写入slot_no，存在字典编码的列时需要先编码
+ */
+void RmFileHandle::write_record(RmPageHandle& page_handle, int slot_no, const char* buf) {
+    if (!has_dict_) {
+        page_handle.write_record(slot_no, buf);
+        return;
+    }
+    char slot_buf[RM_MAX_RECORD_SIZE];
+    encode_record(buf, slot_buf);
+    page_handle.write_record(slot_no, slot_buf);
+}
+
 /**
  * 以下函数为辅助函数，仅提供参考，可以选择完成如下函数，也可以删除如下函数，在单元测试中不涉及如下函数接口的直接调用
 */
@@ -153,7 +492,7 @@ RmPageHandle RmFileHandle::create_new_page_handle() {
     // 1.使用缓冲池来创建一个新page
     // 2.更新page handle中的相关信息
     // 3.更新file_hdr_
-    PageId page_id = {fd_, file_hdr_.num_pages + 1};
+    PageId page_id = {fd_, INVALID_PAGE_ID};
     Page *page = buffer_pool_manager_->new_page(&page_id);
 
     RmPageHandle new_page_handle = RmPageHandle(&file_hdr_, page);
@@ -179,12 +518,10 @@ RmPageHandle RmFileHandle::create_page_handle() {
     //     1.1 没有空闲页：使用缓冲池来创建一个新page；可直接调用create_new_page_handle()
     //     1.2 有空闲页：直接获取第一个空闲页
     // 2. 生成page handle并返回给上层
-    if (file_hdr_.first_free_page_no == INVALID_PAGE_ID) {
-        return create_new_page_handle();
+    if (file_hdr_.first_free_page_no != RM_NO_PAGE) {
+        return fetch_page_handle(file_hdr_.first_free_page_no);
     }
-    PageId page_id = {fd_, file_hdr_.first_free_page_no};
-    Page *page = buffer_pool_manager_->fetch_page(page_id);
-    return RmPageHandle(&file_hdr_, page);
+    return create_new_page_handle();
 }
 
 /**
@@ -195,8 +532,6 @@ void RmFileHandle::release_page_handle(RmPageHandle&page_handle) {
     // 当page从已满变成未满，考虑如何更新：
     // 1. page_handle.page_hdr->next_free_page_no
     // 2. file_hdr_.first_free_page_no
-    page_handle.page_hdr->next_free_page_no = page_handle.page->get_page_id().page_no;
+    page_handle.page_hdr->next_free_page_no = file_hdr_.first_free_page_no;
     file_hdr_.first_free_page_no = page_handle.page->get_page_id().page_no;
-
-    return ;
-}
\ No newline at end of file
+}
@@ -13,10 +13,13 @@ See the Mulan PSL v2 for more details. */
 #include <assert.h>
 
 #include <memory>
+#include <shared_mutex>
 
 #include "bitmap.h"
 #include "common/context.h"
 #include "rm_defs.h"
+#include "rm_dictionary.h"
+#include "rm_zone_map.h"
 
 class RmManager;
 
@@ -26,7 +29,7 @@ struct RmPageHandle {
     Page *page;                 // 页面的实际数据，包括页面存储的数据、元信息等
     RmPageHdr *page_hdr;        // page->data的第一部分，存储页面元信息，指针指向首地址，长度为sizeof(RmPageHdr)
     char *bitmap;               // page->data的第二部分，存储页面的bitmap，指针指向首地址，长度为file_hdr->bitmap_size
-    char *slots;                // page->data的第三部分，存储表的记录，指针指向首地址，每个slot的长度为file_hdr->record_size
+    char *slots;                // page->data的第三部分，存储表的记录，指针指向首地址，每个slot的长度为file_hdr->slot_size
 
     RmPageHandle(const RmFileHdr *fhdr_, Page *page_) : file_hdr(fhdr_), page(page_) {
         page_hdr = reinterpret_cast<RmPageHdr *>(page->get_data() + page->OFFSET_PAGE_HDR);
@@ -34,9 +37,51 @@ struct RmPageHandle {
         slots = bitmap + file_hdr->bitmap_size;
     }
 
-    // 返回指定slot_no的slot存储收地址
+    // 返回指定slot_no的slot存储收地址，仅适用于NSM布局
     char* get_slot(int slot_no) const {
-        return slots + slot_no * file_hdr->record_size;  // slots的首地址 + slot个数 * 每个slot的大小(每个record的大小)
+        return slots + slot_no * file_hdr->slot_size;  // slots的首地址 + slot个数 * 每个slot的大小
+    }
+
+    // 返回指定slot_no的记录中field所在的存储首地址，field为字段在slot中的位置
+    char* get_field(int slot_no, const RmField &field) const {
+        if (file_hdr->layout == RM_LAYOUT_PAX) {
+            // 列的minipage大小为 num_records_per_page * len，因此偏移为offset的列，其minipage起始于 num_records_per_page * offset
+            return slots + file_hdr->num_records_per_page * field.offset + slot_no * field.len;
+        }
+        return get_slot(slot_no) + field.offset;
+    }
+
+    // 相邻两个slot中field之间的距离，PAX布局下为列的长度，NSM布局下为slot的长度
+    size_t field_stride(const RmField &field) const {
+        return file_hdr->layout == RM_LAYOUT_PAX ? field.len : file_hdr->slot_size;
+    }
+
+    // 将slot_no上的记录拷贝到buf中，PAX布局下需要从各个minipage中拼出整条记录，buf的长度为slot_size
+    void read_record(int slot_no, char *buf) const {
+        if (file_hdr->layout != RM_LAYOUT_PAX) {
+            memcpy(buf, get_slot(slot_no), file_hdr->slot_size);
+            return;
+        }
+        RmField field = {0, 0};
+        for (int i = 0; i < file_hdr->num_cols; i++) {
+            field.len = file_hdr->col_lens[i];
+            memcpy(buf + field.offset, get_field(slot_no, field), field.len);
+            field.offset += field.len;
+        }
+    }
+
+    // 将buf写入slot_no，PAX布局下需要将记录拆分到各个minipage中，buf的长度为slot_size
+    void write_record(int slot_no, const char *buf) {
+        if (file_hdr->layout != RM_LAYOUT_PAX) {
+            memcpy(get_slot(slot_no), buf, file_hdr->slot_size);
+            return;
+        }
+        RmField field = {0, 0};
+        for (int i = 0; i < file_hdr->num_cols; i++) {
+            field.len = file_hdr->col_lens[i];
+            memcpy(get_field(slot_no, field), buf + field.offset, field.len);
+            field.offset += field.len;
+        }
     }
 };
 
@@ -50,6 +95,10 @@ class RmFileHandle {
     BufferPoolManager *buffer_pool_manager_;
     int fd_;        // 打开文件后产生的文件句柄
     RmFileHdr file_hdr_;    // 文件头，维护当前表文件的元数据
+    mutable std::unique_ptr<RmZoneMap> zone_map_;   // 每个页面中数值列的范围，第一次使用时才建立
+    mutable std::shared_mutex zone_latch_;          // 保护zone_map_中的范围，建立和更新时加写锁，判断页面时加读锁
+    std::vector<std::unique_ptr<RmDictionary>> dicts_;  // dicts_[i]为第i列的字典，没有使用字典编码的列为nullptr
+    bool has_dict_ = false;                         // 是否存在字典编码的列，不存在时slot中存放的就是原始记录
 
    public:
     RmFileHandle(DiskManager *disk_manager, BufferPoolManager *buffer_pool_manager, int fd)
@@ -57,22 +106,73 @@ class RmFileHandle {
         // 注意：这里从磁盘中读出文件描述符为fd的文件的file_hdr，读到内存中
         // 这里实际就是初始化file_hdr，只不过是从磁盘中读出进行初始化
         // init file_hdr_
-        disk_manager_->read_page(fd, RM_FILE_HDR_PAGE, (char *)&file_hdr_, sizeof(file_hdr_));
+        // 旧版本的文件头较短，文件可能在文件头之后就结束了，没有读到的字段为0
+        file_hdr_ = RmFileHdr{};
+        int hdr_size = std::min((int)sizeof(file_hdr_), disk_manager_->get_file_size(disk_manager_->get_file_name(fd)));
+        disk_manager_->read_page(fd, RM_FILE_HDR_PAGE, (char *)&file_hdr_, hdr_size);
+        if (file_hdr_.slot_size == 0) {
+            // 旧版本的文件都是没有字典编码的行式布局
+            file_hdr_.slot_size = file_hdr_.record_size;
+            file_hdr_.layout = RM_LAYOUT_NSM;
+            file_hdr_.num_cols = 0;
+        }
         // disk_manager管理的fd对应的文件中，设置从file_hdr_.num_pages开始分配page_no
         disk_manager_->set_fd2pageno(fd, file_hdr_.num_pages);
+        load_dictionaries();
     }
 
+    // 字典文件的名称，字典中的值按编码顺序追加写入该文件
+    static std::string get_dict_name(const std::string &filename) { return filename + ".dict"; }
+
     RmFileHdr get_file_hdr() { return file_hdr_; }
     int GetFd() { return fd_; }
 
+    // 设置需要维护zone map的数值列，由SmManager在打开表时调用
+    void init_zone_map(std::vector<RmZoneCol> cols) {
+        zone_map_ = cols.empty() ? nullptr : std::make_unique<RmZoneMap>(std::move(cols));
+    }
+
+    const RmZoneMap *get_zone_map() const;
+
+    // 通过zone map判断页面page_no中是否可能存在满足所有谓词的记录，调用者需要先通过get_zone_map建立zone map
+    bool zone_may_match(int page_no, const std::vector<RmZonePred> &preds) const {
+        std::shared_lock lock(zone_latch_);
+        return zone_map_->may_match(page_no, preds);
+    }
+
+    // 返回记录中field在slot中实际存放的位置，字典编码的列在slot中只存放编码
+    RmField get_slot_field(const RmField &field) const;
+
+    // 返回field所在列的字典，该列没有使用字典编码时返回nullptr
+    const RmDictionary *get_dictionary(const RmField &field) const;
+
     /* 判断指定位置上是否已经存在一条记录，通过Bitmap来判断 */
     bool is_record(const Rid &rid) const {
         RmPageHandle page_handle = fetch_page_handle(rid.page_no);
-        return Bitmap::is_set(page_handle.bitmap, rid.slot_no);  // page的slot_no位置上是否有record
+        bool exist = Bitmap::is_set(page_handle.bitmap, rid.slot_no);  // page的slot_no位置上是否有record
+        buffer_pool_manager_->unpin_page(page_handle.page->get_page_id(), false);
+        return exist;
+    }
+
+    /* 将页面的LSN设置为最后一条修改该页面的日志的LSN */
+    void set_page_lsn(int page_no, lsn_t lsn) {
+        RmPageHandle page_handle = fetch_page_handle(page_no);
+        page_handle.page->set_page_lsn(lsn);
+        buffer_pool_manager_->unpin_page(page_handle.page->get_page_id(), true);
     }
 
     std::unique_ptr<RmRecord> get_record(const Rid &rid, Context *context) const;
 
+    std::unique_ptr<RmRecord> get_record(const Rid &rid, const std::vector<RmField> &fields, Context *context) const;
+
+    std::vector<std::unique_ptr<RmRecord>> get_records(const Rid *rids, int num_rids, Context *context) const;
+
+    void read_record(const RmPageHandle &page_handle, int slot_no, char *buf) const;
+
+    void read_fields(const RmPageHandle &page_handle, int slot_no, const std::vector<RmField> &fields, char *buf) const;
+
+    std::vector<RmMorsel> get_morsels(int morsel_size) const;
+
     Rid insert_record(char *buf, Context *context);
 
     void insert_record(const Rid &rid, char *buf);
@@ -81,6 +181,8 @@ class RmFileHandle {
 
     void update_record(const Rid &rid, char *buf, Context *context);
 
+    RmRecordDelta update_fields(const Rid &rid, const std::vector<RmField> &fields, const char *buf, Context *context);
+
     // 辅助函数
     RmPageHandle create_new_page_handle();
 
@@ -90,4 +192,30 @@ class RmFileHandle {
     RmPageHandle create_page_handle();
 
     void release_page_handle(RmPageHandle &page_handle);
+
+    void update_zone_map(int page_no, const char *buf) {
+        if (zone_map_ == nullptr) return;
+        std::unique_lock lock(zone_latch_);
+        if (zone_map_->is_built()) zone_map_->update(page_no, buf);
+    }
+
+    void update_zone_map(int page_no, const RmField &field, const char *data) {
+        if (zone_map_ == nullptr) return;
+        int col_idx = zone_map_->get_col_idx(field.offset);
+        if (col_idx < 0) return;
+        std::unique_lock lock(zone_latch_);
+        if (zone_map_->is_built()) zone_map_->update_col(page_no, col_idx, data);
+    }
+
+    void load_dictionaries();
+
+    int get_col_idx(int offset) const;
+
+    RmDictCode encode_field(int col_idx, const char *val);
+
+    void encode_record(const char *buf, char *slot_buf);
+
+    void decode_record(const char *slot_buf, char *buf) const;
+
+    void write_record(RmPageHandle &page_handle, int slot_no, const char *buf);
 };
\ No newline at end of file
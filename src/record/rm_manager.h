@@ -12,6 +12,8 @@ See the Mulan PSL v2 for more details. */
 
 #include <assert.h>
 
+#include <algorithm>
+
 #include "bitmap.h"
 #include "rm_defs.h"
 #include "rm_file_handle.h"
@@ -32,20 +34,63 @@ class RmManager {
      * @param {int} record_size 表中记录的大小
      */ 
     void create_file(const std::string& filename, int record_size) {
+        create_file(filename, record_size, RM_LAYOUT_NSM, {});
+    }
+
+    /**
+     * @description: 创建表的数据文件并指定页面布局
+     * @param {string&} filename 要创建的文件名称
+     * @param {int} record_size 表中记录的大小
+     * @param {RmLayout} layout 页面布局
+     * @param {vector<int>&} col_lens 每一列的长度，PAX布局下用于划分minipage，长度之和需要等于record_size
+     * @param {vector<bool>&} col_dicts 每一列是否使用字典编码，为空表示所有列都不使用
+     */
+    void create_file(const std::string& filename, int record_size, RmLayout layout, const std::vector<int>& col_lens,
+                     const std::vector<bool>& col_dicts = {}) {
         if (record_size < 1 || record_size > RM_MAX_RECORD_SIZE) {
             throw InvalidRecordSizeError(record_size);
         }
+        bool has_dict = std::find(col_dicts.begin(), col_dicts.end(), true) != col_dicts.end();
+        if (layout == RM_LAYOUT_PAX || has_dict) {
+            int tot_len = 0;
+            for (int len : col_lens) tot_len += len;
+            if (col_lens.empty() || (int)col_lens.size() > RM_MAX_COLS || tot_len != record_size ||
+                (has_dict && col_dicts.size() != col_lens.size())) {
+                throw InternalError("Invalid column layout for file: " + filename);
+            }
+        }
         disk_manager_->create_file(filename);
         int fd = disk_manager_->open_file(filename);
 
         // 初始化file header
         RmFileHdr file_hdr{};
         file_hdr.record_size = record_size;
+        file_hdr.slot_size = record_size;
         file_hdr.num_pages = 1;
         file_hdr.first_free_page_no = RM_NO_PAGE;
-        // We have: sizeof(hdr) + (n + 7) / 8 + n * record_size <= PAGE_SIZE
+        file_hdr.layout = layout;
+        if (layout == RM_LAYOUT_PAX || has_dict) {
+            file_hdr.num_cols = col_lens.size();
+            std::copy(col_lens.begin(), col_lens.end(), file_hdr.col_lens);
+        }
+        if (has_dict) {
+            // 字典编码的列在slot中只存放编码
+            for (int i = 0; i < file_hdr.num_cols; i++) {
+                if (!col_dicts[i]) continue;
+                if (col_lens[i] < (int)sizeof(RmDictCode)) {
+                    disk_manager_->close_file(fd);
+                    disk_manager_->destroy_file(filename);
+                    throw InvalidColLengthError(col_lens[i]);
+                }
+                file_hdr.dict_lens[i] = col_lens[i];
+                file_hdr.col_lens[i] = sizeof(RmDictCode);
+                file_hdr.slot_size -= col_lens[i] - (int)sizeof(RmDictCode);
+            }
+        }
+        // We have: OFFSET_PAGE_HDR + sizeof(page hdr) + (n + 7) / 8 + n * slot_size <= PAGE_SIZE
+        int page_hdr_size = (int)Page::OFFSET_PAGE_HDR + (int)sizeof(RmPageHdr);
         file_hdr.num_records_per_page =
-            (BITMAP_WIDTH * (PAGE_SIZE - 1 - (int)sizeof(RmFileHdr)) + 1) / (1 + record_size * BITMAP_WIDTH);
+            (BITMAP_WIDTH * (PAGE_SIZE - 1 - page_hdr_size) + 1) / (1 + file_hdr.slot_size * BITMAP_WIDTH);
         file_hdr.bitmap_size = (file_hdr.num_records_per_page + BITMAP_WIDTH - 1) / BITMAP_WIDTH;
 
         // 将file header写入磁盘文件（名为file name，文件描述符为fd）中的第0页
@@ -58,7 +103,13 @@ class RmManager {
      * @description: 删除表的数据文件
      * @param {string&} filename 要删除的文件名称
      */    
-    void destroy_file(const std::string& filename) { disk_manager_->destroy_file(filename); }
+    void destroy_file(const std::string& filename) {
+        disk_manager_->destroy_file(filename);
+        std::string dict_name = RmFileHandle::get_dict_name(filename);
+        if (disk_manager_->is_file(dict_name)) {
+            disk_manager_->destroy_file(dict_name);
+        }
+    }
 
     // 注意这里打开文件，创建并返回了record file handle的指针
     /**
@@ -79,6 +130,7 @@ class RmManager {
                                   sizeof(file_handle->file_hdr_));
         // 缓冲区的所有页刷到磁盘，注意这句话必须写在close_file前面
         buffer_pool_manager_->flush_all_pages(file_handle->fd_);
+        buffer_pool_manager_->delete_all_pages(file_handle->fd_);
         disk_manager_->close_file(file_handle->fd_);
     }
 };
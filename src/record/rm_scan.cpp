@@ -22,25 +22,89 @@ RmScan::RmScan(const RmFileHandle *file_handle) : file_handle_(file_handle) {
     next();
 }
 
+/**
+ * @brief 初始化file_handle和rid，扫描时跳过zone map判断不可能满足zone_preds的页面
+ * @param file_handle
+ * @param zone_preds 作用在file_handle的zone map上的谓词
+ */
+RmScan::RmScan(const RmFileHandle *file_handle, std::vector<RmZonePred> zone_preds)
+    : file_handle_(file_handle), zone_preds_(std::move(zone_preds)) {
+    if (!zone_preds_.empty() && file_handle_->get_zone_map() == nullptr) {
+        zone_preds_.clear();
+    }
+    rid_ = {RM_FIRST_RECORD_PAGE, RM_NO_PAGE};
+    next();
+}
+
+/**
+ * @brief 只扫描morsel中的页面，并行扫描时每个worker各自扫描不同的morsel
+ * @param file_handle
+ * @param morsel 需要扫描的页面范围
+ * @param zone_preds 作用在file_handle的zone map上的谓词
+ */
+RmScan::RmScan(const RmFileHandle *file_handle, const RmMorsel &morsel, std::vector<RmZonePred> zone_preds)
+    : file_handle_(file_handle), zone_preds_(std::move(zone_preds)), end_page_(morsel.end_page) {
+    if (!zone_preds_.empty() && file_handle_->get_zone_map() == nullptr) {
+        zone_preds_.clear();
+    }
+    rid_ = {morsel.start_page, RM_NO_PAGE};
+    next();
+}
+
+RmScan::~RmScan() {
+    if (page_ != nullptr) {
+        file_handle_->buffer_pool_manager_->unpin_page(page_->get_page_id(), false);
+    }
+}
+
 /**
  * @brief 找到文件中下一个存放了记录的位置
  */
 void RmScan::next() {
     // Todo:
     // 找到文件中下一个存放了记录的非空闲位置，用rid_来指向这个位置
-    for (int page_no = rid_.page_no; page_no < file_handle_->file_hdr_.num_pages; page_no++) {
-        RmPageHandle rph = file_handle_->fetch_page_handle(page_no);
-        int max_record_per_page = file_handle_->file_hdr_.num_records_per_page;
+    int max_record_per_page = file_handle_->file_hdr_.num_records_per_page;
+    int end_page = file_handle_->file_hdr_.num_pages;
+    if (end_page_ != RM_NO_PAGE && end_page_ < end_page) {
+        end_page = end_page_;
+    }
+    for (int page_no = rid_.page_no; page_no < end_page; page_no++) {
+        if (page_ == nullptr) {
+            if (!zone_preds_.empty() && !file_handle_->zone_may_match(page_no, zone_preds_)) {
+                continue;
+            }
+            page_ = file_handle_->fetch_page_handle(page_no).page;
+        }
+        RmPageHandle rph = page_handle();
         int slot_no = Bitmap::next_bit(true, rph.bitmap, max_record_per_page, rid_.slot_no);
         if (slot_no < max_record_per_page) {
             rid_ = {page_no, slot_no};
             return ;
         }
+        // 当前页面已经扫描完毕，释放该页面
+        file_handle_->buffer_pool_manager_->unpin_page(page_->get_page_id(), false);
+        page_ = nullptr;
         rid_.slot_no = RM_NO_PAGE;
     }
     rid_.page_no = RM_NO_PAGE;
 }
 
+/**
+ * @brief 移动到当前页面中slot_no之后的第一条记录，当前页面中没有时移动到后面的页面
+ * @param slot_no 当前页面中已经处理过的最后一个slot
+ */
+void RmScan::skip(int slot_no) {
+    rid_.slot_no = slot_no;
+    next();
+}
+
+/**
+ * @brief 当前记录所在页面的句柄
+ */
+RmPageHandle RmScan::page_handle() const {
+    return RmPageHandle(&file_handle_->file_hdr_, page_);
+}
+
 /**
  * @brief ​ 判断是否到达文件末尾
  */
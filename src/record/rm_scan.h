@@ -11,17 +11,34 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 
 #include "rm_defs.h"
+#include "rm_zone_map.h"
 
 class RmFileHandle;
+struct RmPageHandle;
 
 class RmScan : public RecScan {
     const RmFileHandle *file_handle_;
     Rid rid_;
+    Page *page_ = nullptr;      // rid_所在的页面，在扫描离开该页面之前一直保持pin
+    std::vector<RmZonePred> zone_preds_;    // 用于跳过页面的谓词，zone map判断不可能满足的页面不会被读取
+    int end_page_ = RM_NO_PAGE;             // 扫描范围的结束页面（不包含），RM_NO_PAGE表示扫描到文件末尾
 public:
     RmScan(const RmFileHandle *file_handle);
 
+    RmScan(const RmFileHandle *file_handle, std::vector<RmZonePred> zone_preds);
+
+    RmScan(const RmFileHandle *file_handle, const RmMorsel &morsel, std::vector<RmZonePred> zone_preds);
+
+    ~RmScan();
+
     void next() override;
 
+    // 跳过当前页面中slot_no及之前的记录，移动到其后的第一条记录，批量扫描时一次处理一个页面中的多条记录
+    void skip(int slot_no);
+
+    // 返回rid_所在页面的句柄，调用者可以直接在页面上读取当前记录的字段
+    RmPageHandle page_handle() const;
+
     bool is_end() const override;
 
     Rid rid() const override;
@@ -0,0 +1,118 @@
+/* Copyright (c) 2023 Renmin University of China
+RMDB is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+        http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "common/common.h"
+#include "rm_defs.h"
+
+/* zone map中记录的数值列 */
+struct RmZoneCol {
+    int offset;     // 列在记录中的偏移
+    ColType type;   // 列的类型，只支持TYPE_INT和TYPE_FLOAT
+};
+
+/* 可以通过zone map判断的谓词：zone map中第col_idx列 op val */
+struct RmZonePred {
+    int col_idx;    // 列在zone map中的下标
+    CompOp op;      // 比较运算符
+    double val;     // 比较的常量
+};
+
+/**
+ * 表数据文件的zone map，记录每个页面中每个数值列的最小值和最大值，扫描时可以跳过不可能有记录满足条件的页面。
+ * zone map只在内存中维护，插入和更新记录时扩大对应页面的范围，删除记录时不缩小范围，因此判断结果总是保守的。
+ */
+class RmZoneMap {
+    struct Zone {
+        double min = std::numeric_limits<double>::infinity();
+        double max = -std::numeric_limits<double>::infinity();
+    };
+
+    std::vector<RmZoneCol> cols_;   // zone map中记录的列
+    std::vector<Zone> zones_;       // zones_[page_no * cols_.size() + i]为第page_no个页面中第i列的范围
+    bool built_ = false;            // 是否已经根据文件中已有的记录建立
+
+   public:
+    explicit RmZoneMap(std::vector<RmZoneCol> cols) : cols_(std::move(cols)) {}
+
+    const std::vector<RmZoneCol> &cols() const { return cols_; }
+
+    bool is_built() const { return built_; }
+
+    void set_built() { built_ = true; }
+
+    // 返回偏移为offset的列在zone map中的下标，不存在时返回-1
+    int get_col_idx(int offset) const {
+        for (size_t i = 0; i < cols_.size(); i++) {
+            if (cols_[i].offset == offset) return i;
+        }
+        return -1;
+    }
+
+    // 页面page_no中新增了一条记录，用它扩大页面的范围
+    void update(int page_no, const char *record) {
+        size_t base = (size_t)page_no * cols_.size();
+        if (zones_.size() < base + cols_.size()) {
+            zones_.resize(base + cols_.size());
+        }
+        for (size_t i = 0; i < cols_.size(); i++) {
+            widen(zones_[base + i], get_value(record + cols_[i].offset, cols_[i].type));
+        }
+    }
+
+    // 页面page_no中一条记录的第col_idx列被修改为data，用它扩大该列的范围
+    void update_col(int page_no, int col_idx, const char *data) {
+        size_t idx = (size_t)page_no * cols_.size() + col_idx;
+        if (zones_.size() <= idx) {
+            zones_.resize((size_t)(page_no + 1) * cols_.size());
+        }
+        widen(zones_[idx], get_value(data, cols_[col_idx].type));
+    }
+
+    // 判断页面page_no中是否可能存在满足所有谓词的记录
+    bool may_match(int page_no, const std::vector<RmZonePred> &preds) const {
+        size_t base = (size_t)page_no * cols_.size();
+        if (zones_.size() < base + cols_.size()) {
+            // 页面上从未记录过范围，说明其中没有记录
+            return false;
+        }
+        for (auto &pred : preds) {
+            const Zone &zone = zones_[base + pred.col_idx];
+            bool match = true;
+            switch (pred.op) {
+                case OP_EQ: match = zone.min <= pred.val && pred.val <= zone.max; break;
+                case OP_NE: match = !(zone.min == pred.val && zone.max == pred.val); break;
+                case OP_LT: match = zone.min < pred.val; break;
+                case OP_GT: match = zone.max > pred.val; break;
+                case OP_LE: match = zone.min <= pred.val; break;
+                case OP_GE: match = zone.max >= pred.val; break;
+            }
+            if (!match) return false;
+        }
+        return true;
+    }
+
+   private:
+    static double get_value(const char *data, ColType type) {
+        if (type == TYPE_INT) {
+            return *reinterpret_cast<const int *>(data);
+        }
+        return *reinterpret_cast<const float *>(data);
+    }
+
+    static void widen(Zone &zone, double val) {
+        if (val < zone.min) zone.min = val;
+        if (val > zone.max) zone.max = val;
+    }
+};
@@ -183,10 +183,90 @@ class DeleteLogRecord: public LogRecord {
 };
 
 /**
- * TODO: update操作的日志记录
+ * update操作的日志记录，只记录发生变化的字段的旧值和新值，分别用于undo和redo
 */
 class UpdateLogRecord: public LogRecord {
+public:
+    UpdateLogRecord() {
+        log_type_ = LogType::UPDATE;
+        lsn_ = INVALID_LSN;
+        log_tot_len_ = LOG_HEADER_SIZE;
+        log_tid_ = INVALID_TXN_ID;
+        prev_lsn_ = INVALID_LSN;
+        table_name_ = nullptr;
+    }
+    UpdateLogRecord(txn_id_t txn_id, const RmRecordDelta& delta, const Rid& rid, std::string table_name)
+        : UpdateLogRecord() {
+        log_tid_ = txn_id;
+        delta_ = delta;
+        rid_ = rid;
+        log_tot_len_ += sizeof(int);
+        log_tot_len_ += delta_.fields.size() * sizeof(RmField);
+        log_tot_len_ += delta_.old_values.size() + delta_.new_values.size();
+        log_tot_len_ += sizeof(Rid);
+        table_name_size_ = table_name.length();
+        table_name_ = new char[table_name_size_];
+        memcpy(table_name_, table_name.c_str(), table_name_size_);
+        log_tot_len_ += sizeof(size_t) + table_name_size_;
+    }
+    UpdateLogRecord(const UpdateLogRecord&) = delete;
+    UpdateLogRecord& operator=(const UpdateLogRecord&) = delete;
+    ~UpdateLogRecord() { delete[] table_name_; }
 
+    // 把update日志记录序列化到dest中，格式为：字段个数 | 各字段的位置 | 旧值 | 新值 | rid | 表名
+    void serialize(char* dest) const override {
+        LogRecord::serialize(dest);
+        int offset = OFFSET_LOG_DATA;
+        int num_fields = delta_.fields.size();
+        memcpy(dest + offset, &num_fields, sizeof(int));
+        offset += sizeof(int);
+        memcpy(dest + offset, delta_.fields.data(), num_fields * sizeof(RmField));
+        offset += num_fields * sizeof(RmField);
+        memcpy(dest + offset, delta_.old_values.data(), delta_.old_values.size());
+        offset += delta_.old_values.size();
+        memcpy(dest + offset, delta_.new_values.data(), delta_.new_values.size());
+        offset += delta_.new_values.size();
+        memcpy(dest + offset, &rid_, sizeof(Rid));
+        offset += sizeof(Rid);
+        memcpy(dest + offset, &table_name_size_, sizeof(size_t));
+        offset += sizeof(size_t);
+        memcpy(dest + offset, table_name_, table_name_size_);
+    }
+    // 从src中反序列化出一条Update日志记录
+    void deserialize(const char* src) override {
+        LogRecord::deserialize(src);
+        int offset = OFFSET_LOG_DATA;
+        int num_fields = *reinterpret_cast<const int*>(src + offset);
+        offset += sizeof(int);
+        const RmField* fields = reinterpret_cast<const RmField*>(src + offset);
+        delta_.fields.assign(fields, fields + num_fields);
+        offset += num_fields * sizeof(RmField);
+        int values_len = 0;
+        for (auto &field : delta_.fields) values_len += field.len;
+        delta_.old_values.assign(src + offset, values_len);
+        offset += values_len;
+        delta_.new_values.assign(src + offset, values_len);
+        offset += values_len;
+        rid_ = *reinterpret_cast<const Rid*>(src + offset);
+        offset += sizeof(Rid);
+        table_name_size_ = *reinterpret_cast<const size_t*>(src + offset);
+        offset += sizeof(size_t);
+        delete[] table_name_;
+        table_name_ = new char[table_name_size_];
+        memcpy(table_name_, src + offset, table_name_size_);
+    }
+    void format_print() override {
+        printf("update record\n");
+        LogRecord::format_print();
+        printf("update fields: %zu\n", delta_.fields.size());
+        printf("update rid: %d, %d\n", rid_.page_no, rid_.slot_no);
+        printf("table name: %.*s\n", (int)table_name_size_, table_name_);
+    }
+
+    RmRecordDelta delta_;       // 发生变化的字段及其旧值和新值
+    Rid rid_;                   // 被更新的记录的位置
+    char* table_name_;          // 被更新记录的表名称
+    size_t table_name_size_;    // 表名称的大小
 };
 
 /* 日志缓冲区，只有一个buffer，因此需要阻塞地去把日志写入缓冲区中 */
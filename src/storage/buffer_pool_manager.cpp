@@ -194,7 +194,10 @@ bool BufferPoolManager::delete_page(PageId page_id) {
     }
     
     page_table_.erase(page_id);
+    // 从replacer中移除该帧，并清空页面号，避免之后复用该帧时误删page_table_中同一页面的新映射
+    replacer_->pin(frame_id);
     page->reset_memory();
+    page->id_.page_no = INVALID_PAGE_ID;
     free_list_.push_back(frame_id);
     return true;
 }
@@ -212,4 +215,32 @@ void BufferPoolManager::flush_all_pages(int fd) {
             page->is_dirty_ = false;
         }
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @description: 将fd对应文件的所有页面写回磁盘，并从缓冲池中移除
+ *              关闭文件之后文件描述符可能被其他文件复用，缓冲池中不能留下旧文件的页面
+ * @param {int} fd 文件句柄
+ */
+void BufferPoolManager::delete_all_pages(int fd) {
+    std::scoped_lock lock{latch_};
+    for (size_t i = 0; i < pool_size_; i++) {
+        Page *page = pages_ + i;
+        if (page->id_.fd != fd || page->id_.page_no == INVALID_PAGE_ID) {
+            continue;
+        }
+        if (page->is_dirty_) {
+            disk_manager_->write_page(fd, page->id_.page_no, page->get_data(), PAGE_SIZE);
+            page->is_dirty_ = false;
+        }
+        // 仍被pin住的页面正在被使用，不能回收，只写回磁盘
+        if (page->pin_count_ > 0) {
+            continue;
+        }
+        page_table_.erase(page->id_);
+        replacer_->pin(i);
+        page->reset_memory();
+        page->id_.page_no = INVALID_PAGE_ID;
+        free_list_.push_back(i);
+    }
+}
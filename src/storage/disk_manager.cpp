@@ -12,6 +12,7 @@ See the Mulan PSL v2 for more details. */
 
 #include <assert.h>    // for assert
 #include <string.h>    // for memset
+#include <stdio.h>     // for rename
 #include <sys/stat.h>  // for stat
 #include <unistd.h>    // for lseek
 
@@ -41,6 +42,7 @@ void DiskManager::write_page(int fd, page_id_t page_no, const char *data, int nu
     ssize_t write_byte = write(fd, data, num_bytes);
     if (write_byte != num_bytes) {
         // 打印错误信息
+        std::lock_guard lock(file_latch_);
         printf("文件: '%s'\n", fd2path_[fd].c_str());
         printf("errno: %s", strerror(errno));
         throw InternalError("DiskManager::write_page Error");
@@ -68,6 +70,7 @@ void DiskManager::read_page(int fd, page_id_t page_no, char *data, int num_bytes
 
     ssize_t read_bytes = read(fd, data, num_bytes);
     if (read_bytes != num_bytes) {
+        std::lock_guard lock(file_latch_);
         printf("file: '%s'\n", fd2path_[fd].c_str());
         printf("errno: %s", strerror(errno));
         throw InternalError("DiskManager::read_page Error");
@@ -148,6 +151,7 @@ void DiskManager::destroy_file(const std::string& path) {
         throw FileNotFoundError(path);
     }
 
+    std::lock_guard lock(file_latch_);
     if (path2fd_.count(path)) {
         throw FileNotClosedError(path);
     }
@@ -170,6 +174,7 @@ int DiskManager::open_file(const std::string& path) {
     if (!is_file(path)) {
         throw FileNotFoundError(path);
     }
+    std::lock_guard lock(file_latch_);
     if (path2fd_.count(path)) {
         throw FileNotClosedError(path);
     }
@@ -193,6 +198,7 @@ void DiskManager::close_file(int fd) {
     // Todo:
     // 调用close()函数
     // 注意不能关闭未打开的文件，并且需要更新文件打开列表
+    std::lock_guard lock(file_latch_);
     if (!fd2path_.count(fd)) {
         throw FileNotOpenError(fd);
     }
@@ -204,6 +210,30 @@ void DiskManager::close_file(int fd) {
     path2fd_.erase(path);
 }
 
+/**
+ * @description: 将文件old_path原子地重命名为new_path，new_path已经存在时被替换
+ * new_path已经打开时，原来的文件句柄仍然指向被替换的文件，此后只能通过该句柄读写和关闭
+ * @param {string} &old_path 未打开的文件路径
+ * @param {string} &new_path 新的文件路径
+ */
+void DiskManager::rename_file(const std::string &old_path, const std::string &new_path) {
+    if (!is_file(old_path)) {
+        throw FileNotFoundError(old_path);
+    }
+    std::lock_guard lock(file_latch_);
+    if (path2fd_.count(old_path)) {
+        throw FileNotClosedError(old_path);
+    }
+    if (rename(old_path.c_str(), new_path.c_str()) < 0) {
+        throw UnixError();
+    }
+    auto pos = path2fd_.find(new_path);
+    if (pos != path2fd_.end()) {
+        fd2path_[pos->second] = "";
+        path2fd_.erase(pos);
+    }
+}
+
 /**
  * @description: 获得文件的大小
  * @return {int} 文件的大小
@@ -221,6 +251,7 @@ int DiskManager::get_file_size(const std::string& file_name) {
  * @param {int} fd 文件句柄
  */
 std::string DiskManager::get_file_name(int fd) {
+    std::lock_guard lock(file_latch_);
     if (!fd2path_.count(fd)) {
         throw FileNotOpenError(fd);
     }
@@ -233,10 +264,14 @@ std::string DiskManager::get_file_name(int fd) {
  * @param {string} &file_name 文件名
  */
 int DiskManager::get_file_fd(const std::string& file_name) {
-    if (!path2fd_.count(file_name)) {
-        return open_file(file_name);
+    {
+        std::lock_guard lock(file_latch_);
+        auto pos = path2fd_.find(file_name);
+        if (pos != path2fd_.end()) {
+            return pos->second;
+        }
     }
-    return path2fd_[file_name];
+    return open_file(file_name);
 }
 
 /**
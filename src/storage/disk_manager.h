@@ -17,6 +17,7 @@ See the Mulan PSL v2 for more details. */
 #include <atomic>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -58,6 +59,8 @@ class DiskManager {
 
     void close_file(int fd);
 
+    void rename_file(const std::string &old_path, const std::string &new_path);
+
     int get_file_size(const std::string &file_name);
 
     std::string get_file_name(int fd);
@@ -93,6 +96,7 @@ class DiskManager {
     // 文件打开列表，用于记录文件是否被打开
     std::unordered_map<std::string, int> path2fd_;  //<Page文件磁盘路径,Page fd>哈希表
     std::unordered_map<int, std::string> fd2path_;  //<Page fd,Page文件磁盘路径>哈希表
+    std::mutex file_latch_;                         // 保护文件打开列表，执行算子的临时文件会在多个线程中打开和关闭
 
     int log_fd_ = -1;                             // WAL日志文件的文件句柄，默认为-1，代表未打开日志文件
     std::atomic<page_id_t> fd2pageno_[MAX_FD]{};  // 文件中已经分配的页面个数，初始值为0
@@ -10,6 +10,8 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <shared_mutex>
+
 #include "common/config.h"
 
 /**
@@ -73,6 +75,15 @@ class Page {
 
     inline void set_page_lsn(lsn_t page_lsn) { memcpy(get_data() + OFFSET_LSN, &page_lsn, sizeof(lsn_t)); }
 
+    /** 页面内容的读写锁，与pin_count_无关，由上层（如B+树）在读写页面内容时使用 */
+    inline void wlatch() { rwlatch_.lock(); }
+
+    inline void wunlatch() { rwlatch_.unlock(); }
+
+    inline void rlatch() { rwlatch_.lock_shared(); }
+
+    inline void runlatch() { rwlatch_.unlock_shared(); }
+
    private:
     void reset_memory() { memset(data_, OFFSET_PAGE_START, PAGE_SIZE); }  // 将data_的PAGE_SIZE个字节填充为0
 
@@ -89,4 +100,7 @@ class Page {
 
     /** The pin count of this page. */
     int pin_count_ = 0;
+
+    /** 页面内容的读写锁 */
+    std::shared_mutex rwlatch_;
 };
\ No newline at end of file
@@ -11,3 +11,9 @@ See the Mulan PSL v2 for more details. */
 
 #include "defs.h"
 #include <string>
+
+/* 索引的类型 */
+enum IndexType {
+    INDEX_BTREE = 0,    // B+树索引，支持等值查询和范围查询
+    INDEX_HASH = 1      // 可扩展哈希索引，只支持完整key的等值查询
+};
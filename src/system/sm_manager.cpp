@@ -19,6 +19,21 @@ See the Mulan PSL v2 for more details. */
 #include "record/rm.h"
 #include "record_printer.h"
 
+/**
+ * @description: 获取表中需要维护zone map的数值列
+ * @param {TabMeta&} tab 表的元数据
+ * @return {vector<RmZoneCol>} 表中所有int和float类型的列
+ */
+static std::vector<RmZoneCol> get_zone_cols(const TabMeta& tab) {
+    std::vector<RmZoneCol> zone_cols;
+    for (auto& col : tab.cols) {
+        if (col.type == TYPE_INT || col.type == TYPE_FLOAT) {
+            zone_cols.push_back({col.offset, col.type});
+        }
+    }
+    return zone_cols;
+}
+
 /**
  * @description: 判断是否为一个文件夹
  * @return {bool} 返回是否为一个文件夹
@@ -97,8 +112,9 @@ void SmManager::open_db(const std::string& db_name) {
 
     for (auto& [table_name, table_info] : db_.tabs_) {
         fhs_[table_name] = rm_manager_->open_file(table_name);
+        fhs_[table_name]->init_zone_map(get_zone_cols(table_info));
         // fhs_.emplace(table_name, rm_manager_->open_file(table_name));
-        /* 这里要后续要加上索引 */
+        // 索引文件在第一次使用时由get_index_handle打开
     }
     return ;
 }
@@ -120,9 +136,25 @@ void SmManager::close_db() {
     for (auto& fh : fhs_) {
         rm_manager_->close_file(fh.second.get());
     }
+    for (auto& ih : ihs_) {
+        ix_manager_->close_index(ih.second.get());
+    }
+    for (auto& hh : hhs_) {
+        ix_manager_->close_hash_index(hh.second.get());
+    }
+    for (auto& ih : retired_ihs_) {
+        ix_manager_->close_index(ih.get());
+    }
+    for (auto& hh : retired_hhs_) {
+        ix_manager_->close_hash_index(hh.get());
+    }
+    retired_ihs_.clear();
+    retired_hhs_.clear();
     db_.name_.clear();
     db_.tabs_.clear();
     fhs_.clear();
+    ihs_.clear();
+    hhs_.clear();
 
     if (chdir("..") < 0) {
         throw UnixError();
@@ -178,16 +210,23 @@ void SmManager::desc_table(const std::string& tab_name, Context* context) {
  * @param {string&} tab_name 表的名称
  * @param {vector<ColDef>&} col_defs 表的字段
  * @param {Context*} context 
+ * @param {RmLayout} layout 表数据文件的页面布局，分析型的宽表可以使用PAX布局
  */
-void SmManager::create_table(const std::string& tab_name, const std::vector<ColDef>& col_defs, Context* context) {
+void SmManager::create_table(const std::string& tab_name, const std::vector<ColDef>& col_defs, Context* context,
+                             RmLayout layout) {
     if (db_.is_table(tab_name)) {
         throw TableExistsError(tab_name);
     }
     // Create table meta
     int curr_offset = 0;
+    std::vector<int> col_lens;
+    std::vector<bool> col_dicts;
     TabMeta tab;
     tab.name = tab_name;
     for (auto &col_def : col_defs) {
+        if (col_def.dict && col_def.type != TYPE_STRING) {
+            throw InternalError("Dictionary encoding is only supported on CHAR columns: " + col_def.name);
+        }
         ColMeta col = {.tab_name = tab_name,
                        .name = col_def.name,
                        .type = col_def.type,
@@ -195,14 +234,17 @@ void SmManager::create_table(const std::string& tab_name, const std::vector<ColD
                        .offset = curr_offset,
                        .index = false};
         curr_offset += col_def.len;
+        col_lens.push_back(col_def.len);
+        col_dicts.push_back(col_def.dict);
         tab.cols.push_back(col);
     }
     // Create & open record file
     int record_size = curr_offset;  // record_size就是col meta所占的大小（表的元数据也是以记录的形式进行存储的）
-    rm_manager_->create_file(tab_name, record_size);
+    rm_manager_->create_file(tab_name, record_size, layout, col_lens, col_dicts);
     db_.tabs_[tab_name] = tab;
     // fhs_[tab_name] = rm_manager_->open_file(tab_name);
     fhs_.emplace(tab_name, rm_manager_->open_file(tab_name));
+    fhs_.at(tab_name)->init_zone_map(get_zone_cols(tab));
 
     flush_meta();
 }
@@ -217,7 +259,10 @@ void SmManager::drop_table(const std::string& tab_name, Context* context) {
         throw TableNotFoundError(tab_name);
     }
     
-    /* 这里记得后面加上删除索引的操作 */
+    TabMeta& tab = db_.get_table(tab_name);
+    while (!tab.indexes.empty()) {
+        drop_index(tab_name, tab.indexes.back().cols, context);
+    }
     if (fhs_.count(tab_name)) {
         rm_manager_->close_file(fhs_[tab_name].get());
         fhs_.erase(tab_name);
@@ -233,9 +278,190 @@ void SmManager::drop_table(const std::string& tab_name, Context* context) {
  * @param {string&} tab_name 表的名称
  * @param {vector<string>&} col_names 索引包含的字段名称
  * @param {Context*} context
+ * @param {IndexType} type 索引的类型，哈希索引只用于完整key的等值查询
+ * @param {bool} unique 是否为唯一索引，非唯一索引只支持B+树
  */
-void SmManager::create_index(const std::string& tab_name, const std::vector<std::string>& col_names, Context* context) {
-    
+void SmManager::create_index(const std::string& tab_name, const std::vector<std::string>& col_names, Context* context,
+                             IndexType type, bool unique) {
+    TabMeta& tab = db_.get_table(tab_name);
+    // 扫描表中的记录建立索引期间不能有写操作，否则新的记录不会进入索引
+    std::unique_lock tab_latch{get_table_latch(tab_name)};
+    if (tab.is_index(col_names)) {
+        throw IndexExistsError(tab_name, col_names);
+    }
+    IndexMeta index = {.tab_name = tab_name, .col_tot_len = 0, .col_num = (int)col_names.size(), .type = type,
+                       .unique = unique || type == INDEX_HASH};
+    for (auto& col_name : col_names) {
+        auto col = tab.get_col(col_name);
+        index.cols.push_back(*col);
+        index.col_tot_len += col->len;
+    }
+    if (type == INDEX_HASH) {
+        build_hash_index(index, tab_name, context);
+    } else {
+        build_btree_index(index, tab_name, context);
+    }
+
+    for (auto& col : index.cols) {
+        tab.get_col(col.name)->index = true;
+    }
+    tab.indexes.push_back(index);
+    flush_meta();
+}
+
+/**
+ * @description: 创建B+树索引文件，并将表中已有的记录排序后自底向上装入B+树
+ * @param {IndexMeta&} index 索引的元数据
+ * @param {string&} filename 索引文件名的前缀，重建索引时与表名不同
+ * @param {Context*} context
+ */
+void SmManager::build_btree_index(const IndexMeta& index, const std::string& filename, Context* context) {
+    const std::string& tab_name = index.tab_name;
+    ix_manager_->create_index(filename, index.cols, index.unique);
+    auto ih = ix_manager_->open_index(filename, index.cols);
+
+    // 扫描表中已有的记录，将(key, rid)排序后自底向上建立B+树，避免逐条插入时的查找和分裂
+    std::vector<ColType> col_types;
+    std::vector<int> col_lens;
+    for (auto& col : index.cols) {
+        col_types.push_back(col.type);
+        col_lens.push_back(col.len);
+    }
+    IxSorter sorter(disk_manager_, ix_manager_->get_index_name(filename, index.cols), col_types, col_lens);
+    RmFileHandle* fh = fhs_.at(tab_name).get();
+    std::vector<char> key(index.col_tot_len);
+    for (RmScan scan(fh); !scan.is_end(); scan.next()) {
+        auto rec = fh->get_record(scan.rid(), context);
+        index.get_key(rec->data, key.data());
+        sorter.add(key.data(), scan.rid());
+    }
+    sorter.sort();
+    bool loaded = ih->bulk_load(&sorter);
+
+    ix_manager_->close_index(ih.get());
+    // 唯一索引中有重复的key时删除建立了一半的索引文件
+    if (!loaded) {
+        ix_manager_->destroy_index(filename, index.cols);
+        throw UniqueViolationError(tab_name, index.get_col_names());
+    }
+}
+
+/**
+ * @description: 创建哈希索引文件，哈希索引没有顺序，逐条插入表中已有的记录
+ * @param {IndexMeta&} index 索引的元数据
+ * @param {string&} filename 索引文件名的前缀，重建索引时与表名不同
+ * @param {Context*} context
+ */
+void SmManager::build_hash_index(const IndexMeta& index, const std::string& filename, Context* context) {
+    ix_manager_->create_hash_index(filename, index.cols);
+    RmFileHandle* fh = fhs_.at(index.tab_name).get();
+    std::vector<char> key(index.col_tot_len);
+    auto hh = ix_manager_->open_hash_index(filename, index.cols);
+    bool loaded = true;
+    for (RmScan scan(fh); !scan.is_end() && loaded; scan.next()) {
+        auto rec = fh->get_record(scan.rid(), context);
+        index.get_key(rec->data, key.data());
+        loaded = hh->insert_entry(key.data(), scan.rid(), nullptr) != IX_NO_PAGE;
+    }
+    ix_manager_->close_hash_index(hh.get());
+    if (!loaded) {
+        ix_manager_->destroy_index(filename, index.cols);
+        throw UniqueViolationError(index.tab_name, index.get_col_names());
+    }
+}
+
+/**
+ * @description: 获取表的写latch：插入、删除和更新在修改记录和索引期间持有共享锁，
+ * 建立、重建和删除索引时持有排他锁，保证扫描表建立索引期间没有写操作，写操作也不会用到正在替换的索引
+ * @return {shared_mutex&} 表的写latch
+ * @param {string&} tab_name 表名称
+ */
+std::shared_mutex& SmManager::get_table_latch(const std::string& tab_name) {
+    std::scoped_lock lock{tab_latches_latch_};
+    return tab_latches_[tab_name];
+}
+
+/**
+ * @description: 获取索引文件的句柄，索引文件尚未打开时先打开并记录在ihs_中
+ * @return {IxIndexHandle*} 索引文件的句柄
+ * @param {string&} tab_name 表名称
+ * @param {vector<string>&} col_names 索引包含的字段名称
+ */
+IxIndexHandle* SmManager::get_index_handle(const std::string& tab_name, const std::vector<std::string>& col_names) {
+    std::string index_name = ix_manager_->get_index_name(tab_name, col_names);
+    std::scoped_lock lock{ihs_latch_};
+    auto pos = ihs_.find(index_name);
+    if (pos == ihs_.end()) {
+        pos = ihs_.emplace(index_name, ix_manager_->open_index(tab_name, col_names)).first;
+    }
+    return pos->second.get();
+}
+
+/**
+ * @description: 获取索引文件的句柄
+ * @return {IxIndexHandle*} 索引文件的句柄
+ * @param {string&} tab_name 表名称
+ * @param {vector<ColMeta>&} cols 索引包含的字段元数据
+ */
+IxIndexHandle* SmManager::get_index_handle(const std::string& tab_name, const std::vector<ColMeta>& cols) {
+    std::vector<std::string> col_names;
+    for (auto& col : cols) {
+        col_names.push_back(col.name);
+    }
+    return get_index_handle(tab_name, col_names);
+}
+
+/**
+ * @description: 获取哈希索引文件的句柄，索引文件尚未打开时先打开并记录在hhs_中
+ * @return {IxHashIndexHandle*} 哈希索引文件的句柄
+ * @param {string&} tab_name 表名称
+ * @param {vector<ColMeta>&} cols 索引包含的字段元数据
+ */
+IxHashIndexHandle* SmManager::get_hash_handle(const std::string& tab_name, const std::vector<ColMeta>& cols) {
+    std::string index_name = ix_manager_->get_index_name(tab_name, cols);
+    std::scoped_lock lock{ihs_latch_};
+    auto pos = hhs_.find(index_name);
+    if (pos == hhs_.end()) {
+        pos = hhs_.emplace(index_name, ix_manager_->open_hash_index(tab_name, cols)).first;
+    }
+    return pos->second.get();
+}
+
+/**
+ * @description: 根据索引的类型，在B+树或哈希索引中插入键值对
+ * @return {bool} 唯一索引中key已经存在时不插入，返回false
+ * @param {string&} tab_name 表名称
+ * @param {IndexMeta&} index 索引的元数据
+ * @param {char*} key 索引字段拼接成的key
+ * @param {Rid&} rid 记录的位置
+ * @param {Transaction*} txn 事务指针
+ */
+bool SmManager::insert_index_entry(const std::string& tab_name, const IndexMeta& index, const char* key,
+                                   const Rid& rid, Transaction* txn) {
+    page_id_t page_no;
+    if (index.type == INDEX_HASH) {
+        page_no = get_hash_handle(tab_name, index.cols)->insert_entry(key, rid, txn);
+    } else {
+        page_no = get_index_handle(tab_name, index.cols)->insert_entry(key, rid, txn);
+    }
+    return page_no != IX_NO_PAGE;
+}
+
+/**
+ * @description: 根据索引的类型，在B+树或哈希索引中删除key对应的记录rid
+ * @param {string&} tab_name 表名称
+ * @param {IndexMeta&} index 索引的元数据
+ * @param {char*} key 索引字段拼接成的key
+ * @param {Rid&} rid 被删除的记录，非唯一索引中同一个key可能对应多条记录
+ * @param {Transaction*} txn 事务指针
+ */
+void SmManager::delete_index_entry(const std::string& tab_name, const IndexMeta& index, const char* key,
+                                   const Rid& rid, Transaction* txn) {
+    if (index.type == INDEX_HASH) {
+        get_hash_handle(tab_name, index.cols)->delete_entry(key, txn);
+    } else {
+        get_index_handle(tab_name, index.cols)->delete_entry(key, rid, txn);
+    }
 }
 
 /**
@@ -245,7 +471,34 @@ void SmManager::create_index(const std::string& tab_name, const std::vector<std:
  * @param {Context*} context
  */
 void SmManager::drop_index(const std::string& tab_name, const std::vector<std::string>& col_names, Context* context) {
-    
+    TabMeta& tab = db_.get_table(tab_name);
+    std::unique_lock tab_latch{get_table_latch(tab_name)};
+    auto index = tab.get_index_meta(col_names);
+    std::string index_name = ix_manager_->get_index_name(tab_name, col_names);
+    {
+        std::scoped_lock lock{ihs_latch_};
+        if (ihs_.count(index_name)) {
+            ix_manager_->close_index(ihs_.at(index_name).get());
+            ihs_.erase(index_name);
+        }
+        if (hhs_.count(index_name)) {
+            ix_manager_->close_hash_index(hhs_.at(index_name).get());
+            hhs_.erase(index_name);
+        }
+    }
+    ix_manager_->destroy_index(tab_name, col_names);
+    tab.indexes.erase(index);
+
+    // 字段不再被任何索引包含时，取消其索引标记
+    for (auto& col : tab.cols) {
+        col.index = false;
+        for (auto& other : tab.indexes) {
+            for (auto& index_col : other.cols) {
+                if (index_col.name == col.name) col.index = true;
+            }
+        }
+    }
+    flush_meta();
 }
 
 /**
@@ -255,5 +508,46 @@ void SmManager::drop_index(const std::string& tab_name, const std::vector<std::s
  * @param {Context*} context
  */
 void SmManager::drop_index(const std::string& tab_name, const std::vector<ColMeta>& cols, Context* context) {
-    
+    std::vector<std::string> col_names;
+    for (auto& col : cols) {
+        col_names.push_back(col.name);
+    }
+    drop_index(tab_name, col_names, context);
+}
+/**
+ * @description: 重建索引：用表中的记录重新建立一个紧凑的索引文件，B+树的叶子结点在文件中按顺序存放，然后原子地替换原来的索引
+ * 重建期间持有表的写latch，阻塞这张表上的插入、删除和更新；正在执行的查询继续使用旧的索引句柄，替换之后的查询使用新的索引
+ * @param {string&} tab_name 表名称
+ * @param {vector<string>&} col_names 索引包含的字段名称
+ * @param {Context*} context
+ */
+void SmManager::reindex(const std::string& tab_name, const std::vector<std::string>& col_names, Context* context) {
+    TabMeta& tab = db_.get_table(tab_name);
+    std::unique_lock tab_latch{get_table_latch(tab_name)};
+    const IndexMeta& index = *tab.get_index_meta(col_names);
+
+    // 先在临时文件中建立新的索引，上一次重建中途失败时可能留下了临时文件
+    std::string tmp_name = tab_name + ".reindex";
+    std::string tmp_file = ix_manager_->get_index_name(tmp_name, index.cols);
+    if (disk_manager_->is_file(tmp_file)) {
+        disk_manager_->destroy_file(tmp_file);
+    }
+    if (index.type == INDEX_HASH) {
+        build_hash_index(index, tmp_name, context);
+    } else {
+        build_btree_index(index, tmp_name, context);
+    }
+
+    // 新文件替换旧文件后，旧句柄的文件描述符仍然指向旧文件，正在使用它的查询不受影响
+    std::string index_name = ix_manager_->get_index_name(tab_name, index.cols);
+    std::scoped_lock lock{ihs_latch_};
+    disk_manager_->rename_file(tmp_file, index_name);
+    if (auto pos = ihs_.find(index_name); pos != ihs_.end()) {
+        retired_ihs_.push_back(std::move(pos->second));
+        ihs_.erase(pos);
+    }
+    if (auto pos = hhs_.find(index_name); pos != hhs_.end()) {
+        retired_hhs_.push_back(std::move(pos->second));
+        hhs_.erase(pos);
+    }
 }
\ No newline at end of file
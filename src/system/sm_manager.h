@@ -10,6 +10,10 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+
 #include "index/ix.h"
 #include "record/rm_file_handle.h"
 #include "sm_defs.h"
@@ -22,6 +26,7 @@ struct ColDef {
     std::string name;  // Column name
     ColType type;      // Type of column
     int len;           // Length of column
+    bool dict = false; // Whether the column is dictionary encoded
 };
 
 /* 系统管理器，负责元数据管理和DDL语句的执行 */
@@ -30,12 +35,23 @@ class SmManager {
     DbMeta db_;             // 当前打开的数据库的元数据
     std::unordered_map<std::string, std::unique_ptr<RmFileHandle>> fhs_;    // file name -> record file handle, 当前数据库中每张表的数据文件
     std::unordered_map<std::string, std::unique_ptr<IxIndexHandle>> ihs_;   // file name -> index file handle, 当前数据库中每个索引的文件
+    std::unordered_map<std::string, std::unique_ptr<IxHashIndexHandle>> hhs_;   // file name -> hash index file handle, 当前数据库中每个哈希索引的文件
    private:
+    std::mutex ihs_latch_;  // 保护ihs_和hhs_，重建索引时在其中原子地替换索引句柄
+    // 重建索引后被替换的旧句柄，可能仍有查询在使用，关闭数据库时再关闭
+    std::vector<std::unique_ptr<IxIndexHandle>> retired_ihs_;
+    std::vector<std::unique_ptr<IxHashIndexHandle>> retired_hhs_;
+    std::mutex tab_latches_latch_;                          // 保护tab_latches_
+    std::map<std::string, std::shared_mutex> tab_latches_;  // 每张表的写latch，见get_table_latch()
     DiskManager* disk_manager_;                     // 创建日志文件的时候要使用
     BufferPoolManager* buffer_pool_manager_;            
     RmManager* rm_manager_;                         // 对表文件进行一些操作
     IxManager* ix_manager_;
 
+    void build_btree_index(const IndexMeta& index, const std::string& filename, Context* context);
+
+    void build_hash_index(const IndexMeta& index, const std::string& filename, Context* context);
+
    public:
     SmManager(DiskManager* disk_manager, BufferPoolManager* buffer_pool_manager, RmManager* rm_manager,
               IxManager* ix_manager)
@@ -52,6 +68,10 @@ class SmManager {
 
     IxManager* get_ix_manager() { return ix_manager_; }  
 
+    DiskManager* get_disk_manager() { return disk_manager_; }
+
+    std::shared_mutex& get_table_latch(const std::string& tab_name);
+
     bool is_dir(const std::string& db_name);
 
     void create_db(const std::string& db_name);
@@ -68,13 +88,29 @@ class SmManager {
 
     void desc_table(const std::string& tab_name, Context* context);
 
-    void create_table(const std::string& tab_name, const std::vector<ColDef>& col_defs, Context* context);
+    void create_table(const std::string& tab_name, const std::vector<ColDef>& col_defs, Context* context,
+                      RmLayout layout = RM_LAYOUT_NSM);
 
     void drop_table(const std::string& tab_name, Context* context);
 
-    void create_index(const std::string& tab_name, const std::vector<std::string>& col_names, Context* context);
+    void create_index(const std::string& tab_name, const std::vector<std::string>& col_names, Context* context,
+                      IndexType type = INDEX_BTREE, bool unique = true);
 
     void drop_index(const std::string& tab_name, const std::vector<std::string>& col_names, Context* context);
+
+    void reindex(const std::string& tab_name, const std::vector<std::string>& col_names, Context* context);
+
+    IxIndexHandle* get_index_handle(const std::string& tab_name, const std::vector<std::string>& col_names);
+
+    IxIndexHandle* get_index_handle(const std::string& tab_name, const std::vector<ColMeta>& cols);
+
+    IxHashIndexHandle* get_hash_handle(const std::string& tab_name, const std::vector<ColMeta>& cols);
+
+    bool insert_index_entry(const std::string& tab_name, const IndexMeta& index, const char* key, const Rid& rid,
+                            Transaction* txn);
+
+    void delete_index_entry(const std::string& tab_name, const IndexMeta& index, const char* key, const Rid& rid,
+                            Transaction* txn);
     
     void drop_index(const std::string& tab_name, const std::vector<ColMeta>& col_names, Context* context);
 };
\ No newline at end of file
@@ -11,8 +11,10 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <map>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -45,9 +47,29 @@ struct IndexMeta {
     int col_tot_len;                // 索引字段长度总和
     int col_num;                    // 索引字段数量
     std::vector<ColMeta> cols;      // 索引包含的字段
+    IndexType type = INDEX_BTREE;   // 索引的类型
+    bool unique = true;             // 是否为唯一索引，非唯一的B+树索引中重复的key用posting list保存
+
+    /* 从记录record中取出索引包含的字段，依次拼接成索引的key，key的长度为col_tot_len */
+    void get_key(const char *record, char *key) const {
+        int offset = 0;
+        for (auto &col : cols) {
+            memcpy(key + offset, record + col.offset, col.len);
+            offset += col.len;
+        }
+    }
+
+    /* 索引包含的字段名称 */
+    std::vector<std::string> get_col_names() const {
+        std::vector<std::string> col_names;
+        for (auto &col : cols) {
+            col_names.push_back(col.name);
+        }
+        return col_names;
+    }
 
     friend std::ostream &operator<<(std::ostream &os, const IndexMeta &index) {
-        os << index.tab_name << " " << index.col_tot_len << " " << index.col_num;
+        os << index.tab_name << " " << index.col_tot_len << " " << index.col_num << " " << index.type << " " << index.unique;
         for(auto& col: index.cols) {
             os << "\n" << col;
         }
@@ -56,6 +78,16 @@ struct IndexMeta {
 
     friend std::istream &operator>>(std::istream &is, IndexMeta &index) {
         is >> index.tab_name >> index.col_tot_len >> index.col_num;
+        // 旧版本的db.meta中这一行没有索引类型和是否唯一，这样的索引都是唯一的B+树索引
+        std::string line;
+        std::getline(is, line);
+        std::istringstream fields(line);
+        if (!(fields >> index.type)) {
+            index.type = INDEX_BTREE;
+        }
+        if (!(fields >> index.unique)) {
+            index.unique = true;
+        }
         for(int i = 0; i < index.col_num; ++i) {
             ColMeta col;
             is >> col;
@@ -76,6 +108,7 @@ struct TabMeta {
     TabMeta(const TabMeta &other) {
         name = other.name;
         for(auto col : other.cols) cols.push_back(col);
+        indexes = other.indexes;
     }
 
     /* 判断当前表中是否存在名为col_name的字段 */
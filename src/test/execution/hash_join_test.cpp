@@ -0,0 +1,219 @@
+#undef NDEBUG
+
+#include <dirent.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "execution/executor_hash_join.h"
+#include "execution/executor_nestedloop_join.h"
+#include "gtest/gtest.h"
+#include "vector_executor.h"
+
+const std::string TEST_DB_NAME = "HashJoinTest_db";  // 以TEST_DB_NAME作为存放测试文件的根目录名
+
+using RowValue = std::tuple<int, float, std::string>;
+using RowValues = std::vector<RowValue>;
+
+class HashJoinTest : public ::testing::Test {
+   public:
+    std::unique_ptr<DiskManager> disk_manager_;
+
+    void SetUp() override {
+        disk_manager_ = std::make_unique<DiskManager>();
+        if (!disk_manager_->is_dir(TEST_DB_NAME)) {
+            disk_manager_->create_dir(TEST_DB_NAME);
+        }
+        if (chdir(TEST_DB_NAME.c_str()) < 0) {
+            throw UnixError();
+        }
+    }
+
+    void TearDown() override {
+        if (chdir("..") < 0) {
+            throw UnixError();
+        }
+        disk_manager_->destroy_dir(TEST_DB_NAME);
+    }
+
+    static Condition join_cond(const std::string &lhs_tab, const std::string &lhs_col, CompOp op,
+                               const std::string &rhs_tab, const std::string &rhs_col) {
+        Condition cond;
+        cond.lhs_col = {lhs_tab, lhs_col};
+        cond.op = op;
+        cond.is_rhs_val = false;
+        cond.rhs_col = {rhs_tab, rhs_col};
+        return cond;
+    }
+
+    // 用逐条接口按顺序读出算子的所有记录
+    static std::vector<std::string> read_rows(AbstractExecutor *exec) {
+        std::vector<std::string> rows;
+        for (exec->beginTuple(); !exec->is_end(); exec->nextTuple()) {
+            auto rec = exec->Next();
+            EXPECT_EQ(rec->size, (int)exec->tupleLen());
+            rows.push_back(std::string(rec->data, rec->size));
+        }
+        return rows;
+    }
+
+    // 用批量接口按顺序读出算子的所有记录
+    static std::vector<std::string> read_batches(AbstractExecutor *exec) {
+        std::vector<std::string> rows;
+        RecordBatch batch;
+        exec->beginTuple();
+        while (exec->NextBatch(&batch)) {
+            for (size_t i = 0; i < batch.size(); i++) {
+                rows.push_back(std::string(batch.get(i), exec->tupleLen()));
+            }
+        }
+        return rows;
+    }
+
+    static std::vector<std::string> sorted(std::vector<std::string> rows) {
+        std::sort(rows.begin(), rows.end());
+        return rows;
+    }
+
+    // 当前目录下的文件个数，即hash join还没有删除的临时文件个数
+    static int num_files() {
+        int cnt = 0;
+        DIR *dir = opendir(".");
+        while (auto entry = readdir(dir)) {
+            if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) {
+                cnt++;
+            }
+        }
+        closedir(dir);
+        return cnt;
+    }
+
+    // 同样的输入和条件用NestedLoopJoinExecutor得到的结果，作为hash join的期望输出
+    static std::vector<std::string> nested_loop_join(const RowValues &left, const RowValues &right,
+                                                     const std::vector<Condition> &conds) {
+        NestedLoopJoinExecutor join(VectorExecutor::make("l", left), VectorExecutor::make("r", right), conds);
+        return read_rows(&join);
+    }
+};
+
+/**
+ * @brief 两侧的key都不重复。内存预算足够时输出顺序与nested loop join相同；
+ * 预算很小时两侧输入溢出到临时文件分区连接，结果作为多重集合与nested loop join相同，读完之后删除临时文件
+ */
+TEST_F(HashJoinTest, UniqueKeysTest) {
+    RowValues left, right;
+    for (int i = 0; i < 3000; i++) {
+        left.emplace_back(i, i / 2.0f, "l" + std::to_string(i % 13));
+    }
+    for (int i = 0; i < 2000; i++) {
+        right.emplace_back(i * 2, (i % 100) * 30.0f, "r" + std::to_string(i % 5));
+    }
+    std::vector<Condition> conds = {join_cond("l", "a", OP_EQ, "r", "a"), join_cond("l", "b", OP_LT, "r", "b")};
+    auto expected = nested_loop_join(left, right, conds);
+    ASSERT_FALSE(expected.empty());
+
+    HashJoinExecutor in_memory(VectorExecutor::make("l", left), VectorExecutor::make("r", right), conds,
+                               disk_manager_.get());
+    EXPECT_EQ(read_rows(&in_memory), expected);
+    EXPECT_EQ(num_files(), 0);
+
+    for (size_t mem_limit : {(size_t)1, (size_t)4096}) {
+        {
+            HashJoinExecutor join(VectorExecutor::make("l", left), VectorExecutor::make("r", right), conds,
+                                  disk_manager_.get(), mem_limit);
+            join.beginTuple();
+            EXPECT_GT(num_files(), 0) << "mem limit " << mem_limit;
+            EXPECT_EQ(sorted(read_rows(&join)), sorted(expected)) << "mem limit " << mem_limit;
+            EXPECT_EQ(sorted(read_batches(&join)), sorted(expected)) << "mem limit " << mem_limit;
+        }
+        EXPECT_EQ(num_files(), 0);
+    }
+}
+
+/**
+ * @brief key严重倾斜：大部分记录的key相同，划分到最大层数之后仍然放不下的分区整个装入内存。
+ * 两列组成的key，结果与nested loop join相同
+ */
+TEST_F(HashJoinTest, SkewedKeysTest) {
+    RowValues left, right;
+    for (int i = 0; i < 300; i++) {
+        int key = i % 3 == 0 ? i : 0;
+        left.emplace_back(key, i * 1.0f, i % 2 == 0 ? "hot" : "cold");
+    }
+    for (int i = 0; i < 3000; i++) {
+        int key = i % 10 == 0 ? i : 0;
+        right.emplace_back(key, i * 0.5f, i % 3 == 0 ? "cold" : "hot");
+    }
+    std::vector<Condition> conds = {join_cond("l", "a", OP_EQ, "r", "a"), join_cond("r", "c", OP_EQ, "l", "c")};
+    auto expected = sorted(nested_loop_join(left, right, conds));
+    ASSERT_GT(expected.size(), (size_t)100000);
+
+    for (size_t mem_limit : {(size_t)1, (size_t)4096, HASH_JOIN_MEMORY_SIZE}) {
+        {
+            HashJoinExecutor join(VectorExecutor::make("l", left), VectorExecutor::make("r", right), conds,
+                                  disk_manager_.get(), mem_limit);
+            EXPECT_EQ(sorted(read_batches(&join)), expected) << "mem limit " << mem_limit;
+        }
+        EXPECT_EQ(num_files(), 0);
+    }
+}
+
+/**
+ * @brief 任一侧为空时没有输出，预算很小时也不会留下临时文件
+ */
+TEST_F(HashJoinTest, EmptyTest) {
+    RowValues rows;
+    for (int i = 0; i < 500; i++) {
+        rows.emplace_back(i % 50, i * 1.0f, "x");
+    }
+    std::vector<Condition> conds = {join_cond("l", "a", OP_EQ, "r", "a")};
+    for (size_t mem_limit : {(size_t)1, HASH_JOIN_MEMORY_SIZE}) {
+        {
+            HashJoinExecutor empty_left(VectorExecutor::make("l", {}), VectorExecutor::make("r", rows), conds,
+                                        disk_manager_.get(), mem_limit);
+            EXPECT_TRUE(read_rows(&empty_left).empty());
+            EXPECT_TRUE(read_batches(&empty_left).empty());
+
+            HashJoinExecutor empty_right(VectorExecutor::make("l", rows), VectorExecutor::make("r", {}), conds,
+                                         disk_manager_.get(), mem_limit);
+            EXPECT_TRUE(read_rows(&empty_right).empty());
+            EXPECT_TRUE(read_batches(&empty_right).empty());
+        }
+        EXPECT_EQ(num_files(), 0);
+    }
+}
+
+/**
+ * @brief 重新beginTuple之后输出同样的结果，包括上一次没有读完、溢出的分区还没有连接就重新开始的情况
+ */
+TEST_F(HashJoinTest, RescanTest) {
+    RowValues left, right;
+    for (int i = 0; i < 2000; i++) {
+        left.emplace_back(i % 400, i * 1.0f, "v");
+    }
+    for (int i = 0; i < 1200; i++) {
+        right.emplace_back(i % 600, i * 1.0f, "v");
+    }
+    std::vector<Condition> conds = {join_cond("l", "a", OP_EQ, "r", "a")};
+    auto expected = sorted(nested_loop_join(left, right, conds));
+    ASSERT_EQ(expected.size(), (size_t)2000 * 2);
+
+    {
+        HashJoinExecutor join(VectorExecutor::make("l", left), VectorExecutor::make("r", right), conds,
+                              disk_manager_.get(), 2048);
+        auto first = read_rows(&join);
+        EXPECT_EQ(sorted(first), expected);
+        // 读到一半时重新开始
+        join.beginTuple();
+        for (int i = 0; i < 1000; i++) {
+            ASSERT_FALSE(join.is_end());
+            join.nextTuple();
+        }
+        EXPECT_EQ(read_rows(&join), first);
+        EXPECT_EQ(read_batches(&join), first);
+    }
+    EXPECT_EQ(num_files(), 0);
+}
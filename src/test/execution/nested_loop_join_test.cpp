@@ -0,0 +1,151 @@
+#undef NDEBUG
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "execution/executor_nestedloop_join.h"
+#include "gtest/gtest.h"
+#include "vector_executor.h"
+
+using RowValue = std::tuple<int, float, std::string>;
+using RowValues = std::vector<RowValue>;
+
+class NestedLoopJoinTest : public ::testing::Test {
+   public:
+    static Condition join_cond(const std::string &lhs_tab, const std::string &lhs_col, CompOp op,
+                               const std::string &rhs_tab, const std::string &rhs_col) {
+        Condition cond;
+        cond.lhs_col = {lhs_tab, lhs_col};
+        cond.op = op;
+        cond.is_rhs_val = false;
+        cond.rhs_col = {rhs_tab, rhs_col};
+        return cond;
+    }
+
+    // 用逐条接口按顺序读出算子的所有记录
+    static std::vector<std::string> read_rows(AbstractExecutor *exec) {
+        std::vector<std::string> rows;
+        for (exec->beginTuple(); !exec->is_end(); exec->nextTuple()) {
+            auto rec = exec->Next();
+            EXPECT_EQ(rec->size, (int)exec->tupleLen());
+            rows.push_back(std::string(rec->data, rec->size));
+        }
+        return rows;
+    }
+
+    // 用批量接口按顺序读出算子的所有记录
+    static std::vector<std::string> read_batches(AbstractExecutor *exec) {
+        std::vector<std::string> rows;
+        RecordBatch batch;
+        exec->beginTuple();
+        while (exec->NextBatch(&batch)) {
+            for (size_t i = 0; i < batch.size(); i++) {
+                rows.push_back(std::string(batch.get(i), exec->tupleLen()));
+            }
+        }
+        return rows;
+    }
+
+    static std::vector<std::string> sorted(std::vector<std::string> rows) {
+        std::sort(rows.begin(), rows.end());
+        return rows;
+    }
+
+    // 两层循环逐对判断pred，得到期望的连接结果（已排序）
+    template <typename Pred>
+    static std::vector<std::string> expected_join(const RowValues &left, const RowValues &right, Pred pred) {
+        auto left_rows = read_rows(VectorExecutor::make("l", left).get());
+        auto right_rows = read_rows(VectorExecutor::make("r", right).get());
+        std::vector<std::string> rows;
+        for (size_t i = 0; i < left.size(); i++) {
+            for (size_t j = 0; j < right.size(); j++) {
+                if (pred(left[i], right[j])) {
+                    rows.push_back(left_rows[i] + right_rows[j]);
+                }
+            }
+        }
+        return sorted(rows);
+    }
+
+    // 左表的a依次递增，key = a % num_keys；右表每个key有两条记录，b和c随key变化
+    static RowValues make_rows(int num_rows, int num_keys, int first = 0) {
+        RowValues rows;
+        for (int i = 0; i < num_rows; i++) {
+            int key = (first + i) % num_keys;
+            rows.emplace_back(key, (first + i) / 4.0f, "k" + std::to_string(key % 7));
+        }
+        return rows;
+    }
+};
+
+/**
+ * @brief 外表被分成多个块，每个块重新扫描一次内表；逐条接口、批量接口和不同的块大小得到相同的结果，
+ * 与两层循环的结果一致。条件包括等值、float之间的比较、左右两侧交换的条件和字符串条件
+ */
+TEST_F(NestedLoopJoinTest, MultiBlockTest) {
+    RowValues left = make_rows(2 * BATCH_SIZE + 300, 50);
+    RowValues right = make_rows(400, 50, 7);
+    std::vector<Condition> conds = {join_cond("l", "a", OP_EQ, "r", "a"), join_cond("r", "b", OP_GT, "l", "b"),
+                                    join_cond("l", "c", OP_EQ, "r", "c")};
+    auto expected = expected_join(left, right, [](const RowValue &l, const RowValue &r) {
+        return std::get<0>(l) == std::get<0>(r) && std::get<1>(r) > std::get<1>(l) && std::get<2>(l) == std::get<2>(r);
+    });
+    ASSERT_FALSE(expected.empty());
+
+    // 块大小为1字节时每次只读入一批外表记录，一共3个块；两批记录的块大小分成2个块；默认的块大小可以放下整个外表
+    for (size_t block_size : {(size_t)1, (size_t)BATCH_SIZE * 12 * 2, JOIN_BLOCK_SIZE}) {
+        size_t num_blocks = block_size == 1 ? 3 : block_size == JOIN_BLOCK_SIZE ? 1 : 2;
+        auto right_exec = VectorExecutor::make("r", right);
+        VectorExecutor *inner = right_exec.get();
+        NestedLoopJoinExecutor join(VectorExecutor::make("l", left), std::move(right_exec), conds, block_size);
+        EXPECT_EQ(sorted(read_rows(&join)), expected) << "block size " << block_size;
+        EXPECT_EQ(inner->num_begins(), (int)num_blocks);
+        EXPECT_EQ(sorted(read_batches(&join)), expected) << "block size " << block_size;
+        EXPECT_EQ(inner->num_begins(), 2 * (int)num_blocks);
+    }
+}
+
+/**
+ * @brief 重新beginTuple之后从头输出同样的结果，包括上一次没有读完就重新开始的情况
+ */
+TEST_F(NestedLoopJoinTest, RescanTest) {
+    RowValues left = make_rows(1500, 20);
+    RowValues right = make_rows(60, 20);
+    std::vector<Condition> conds = {join_cond("l", "a", OP_EQ, "r", "a")};
+    NestedLoopJoinExecutor join(VectorExecutor::make("l", left), VectorExecutor::make("r", right), conds, 1);
+
+    auto first = read_rows(&join);
+    ASSERT_EQ(first.size(), 1500 * 3);
+    EXPECT_EQ(sorted(first), expected_join(left, right, [](const RowValue &l, const RowValue &r) {
+                  return std::get<0>(l) == std::get<0>(r);
+              }));
+    // 读到一半时重新开始
+    join.beginTuple();
+    for (int i = 0; i < 2000; i++) {
+        ASSERT_FALSE(join.is_end());
+        join.nextTuple();
+    }
+    EXPECT_EQ(read_rows(&join), first);
+    EXPECT_EQ(read_batches(&join), first);
+}
+
+/**
+ * @brief 没有条件时输出笛卡尔积，任一侧为空时没有输出
+ */
+TEST_F(NestedLoopJoinTest, CrossProductAndEmptyTest) {
+    RowValues left = make_rows(30, 30), right = make_rows(20, 20);
+    auto always = [](const RowValue &, const RowValue &) { return true; };
+    NestedLoopJoinExecutor cross(VectorExecutor::make("l", left), VectorExecutor::make("r", right), {}, 1);
+    EXPECT_EQ(sorted(read_rows(&cross)), expected_join(left, right, always));
+
+    NestedLoopJoinExecutor empty_left(VectorExecutor::make("l", {}), VectorExecutor::make("r", right), {});
+    EXPECT_TRUE(read_rows(&empty_left).empty());
+    EXPECT_TRUE(read_batches(&empty_left).empty());
+
+    NestedLoopJoinExecutor empty_right(VectorExecutor::make("l", left), VectorExecutor::make("r", {}), {}, 1);
+    EXPECT_TRUE(read_rows(&empty_right).empty());
+    EXPECT_TRUE(read_batches(&empty_right).empty());
+}
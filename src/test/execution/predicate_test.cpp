@@ -0,0 +1,245 @@
+#undef NDEBUG
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "execution/execution_predicate.h"
+#include "gtest/gtest.h"
+
+class CompiledPredicateTest : public ::testing::Test {
+   public:
+    // 记录格式：int a | float b | char c[8] | int d | float e | char f[8]
+    static constexpr int record_size = 32;
+    static constexpr int str_len = 8;
+    const std::vector<int> ints_ = {-2, 0, 3, 7};
+    const std::vector<float> floats_ = {-2.0f, 0.5f, 3.0f, 7.25f};
+    const std::vector<std::string> strs_ = {"", "ab", "abc", "b"};
+    std::vector<ColMeta> cols_;
+    std::vector<std::vector<char>> rows_;
+
+    void SetUp() override {
+        cols_ = {
+            make_col("a", TYPE_INT, 4, 0),   make_col("b", TYPE_FLOAT, 4, 4),  make_col("c", TYPE_STRING, 8, 8),
+            make_col("d", TYPE_INT, 4, 16),  make_col("e", TYPE_FLOAT, 4, 20), make_col("f", TYPE_STRING, 8, 24),
+        };
+        // 左右两组字段取遍所有值的组合，相等、大于和小于的情况都会出现
+        for (size_t i = 0; i < 4 * 4 * 4; i++) {
+            for (size_t j = 0; j < 4 * 4 * 4; j++) {
+                std::vector<char> row(record_size, 0);
+                memcpy(row.data(), &ints_[i % 4], 4);
+                memcpy(row.data() + 4, &floats_[i / 4 % 4], 4);
+                memcpy(row.data() + 8, strs_[i / 16].data(), strs_[i / 16].size());
+                memcpy(row.data() + 16, &ints_[j % 4], 4);
+                memcpy(row.data() + 20, &floats_[j / 4 % 4], 4);
+                memcpy(row.data() + 24, strs_[j / 16].data(), strs_[j / 16].size());
+                rows_.push_back(std::move(row));
+            }
+        }
+    }
+
+    static ColMeta make_col(const std::string &name, ColType type, int len, int offset) {
+        return {.tab_name = "t", .name = name, .type = type, .len = len, .offset = offset, .index = false};
+    }
+
+    static Condition col_cond(const std::string &lhs, CompOp op, const std::string &rhs) {
+        Condition cond;
+        cond.lhs_col = {"t", lhs};
+        cond.op = op;
+        cond.is_rhs_val = false;
+        cond.rhs_col = {"t", rhs};
+        return cond;
+    }
+
+    static Condition val_cond(const std::string &lhs, CompOp op, Value val, int len) {
+        Condition cond;
+        cond.lhs_col = {"t", lhs};
+        cond.op = op;
+        cond.is_rhs_val = true;
+        val.init_raw(len);
+        cond.rhs_val = val;
+        return cond;
+    }
+
+    template <typename T>
+    static bool expected(CompOp op, T lhs, T rhs) {
+        switch (op) {
+            case OP_EQ: return lhs == rhs;
+            case OP_NE: return lhs != rhs;
+            case OP_LT: return lhs < rhs;
+            case OP_GT: return lhs > rhs;
+            case OP_LE: return lhs <= rhs;
+            case OP_GE: return lhs >= rhs;
+        }
+        return false;
+    }
+
+    // 字段的值：数值统一转换为float比较，int之间按int比较，字符串按补零后的字节比较
+    struct FieldVal {
+        ColType type;
+        int int_val;
+        float float_val;
+        std::string str_val;
+    };
+
+    FieldVal field(const char *row, const ColMeta &col) {
+        FieldVal val{col.type, 0, 0, ""};
+        if (col.type == TYPE_INT) {
+            memcpy(&val.int_val, row + col.offset, 4);
+            val.float_val = val.int_val;
+        } else if (col.type == TYPE_FLOAT) {
+            memcpy(&val.float_val, row + col.offset, 4);
+        } else {
+            val.str_val.assign(row + col.offset, col.len);
+        }
+        return val;
+    }
+
+    static bool expected(CompOp op, const FieldVal &lhs, const FieldVal &rhs) {
+        if (lhs.type == TYPE_STRING) {
+            return expected(op, lhs.str_val, rhs.str_val);
+        }
+        if (lhs.type == TYPE_INT && rhs.type == TYPE_INT) {
+            return expected(op, lhs.int_val, rhs.int_val);
+        }
+        return expected(op, lhs.float_val, rhs.float_val);
+    }
+
+    static FieldVal value_field(const Value &val, int len) {
+        FieldVal field{val.type, 0, 0, ""};
+        if (val.type == TYPE_INT) {
+            field.int_val = val.int_val;
+            field.float_val = val.int_val;
+        } else if (val.type == TYPE_FLOAT) {
+            field.float_val = val.float_val;
+        } else {
+            field.str_val = val.str_val;
+            field.str_val.resize(len, '\0');
+        }
+        return field;
+    }
+
+    const ColMeta &col(const std::string &name) {
+        for (auto &c : cols_) {
+            if (c.name == name) return c;
+        }
+        throw ColumnNotFoundError(name);
+    }
+};
+
+static const std::vector<CompOp> all_ops = {OP_EQ, OP_NE, OP_LT, OP_GT, OP_LE, OP_GE};
+
+/**
+ * @brief 列与列比较：每个运算符 × int/float/string以及int与float混合，结果与逐个比较一致
+ */
+TEST_F(CompiledPredicateTest, ColumnColumnTest) {
+    // (左侧列, 右侧列)：int-int、int-float、float-int、float-float、string-string
+    std::vector<std::pair<std::string, std::string>> pairs = {{"a", "d"}, {"a", "e"}, {"b", "d"}, {"b", "e"},
+                                                              {"c", "f"}};
+    for (auto &[lhs, rhs] : pairs) {
+        for (CompOp op : all_ops) {
+            CompiledPredicate pred({col_cond(lhs, op, rhs)}, cols_);
+            int num_true = 0;
+            for (auto &row : rows_) {
+                bool exp = expected(op, field(row.data(), col(lhs)), field(row.data(), col(rhs)));
+                ASSERT_EQ(pred.eval(row.data()), exp) << lhs << " op " << op << " " << rhs;
+                num_true += exp;
+            }
+            // 每种组合都既有满足也有不满足的记录
+            EXPECT_GT(num_true, 0);
+            EXPECT_LT(num_true, (int)rows_.size());
+        }
+    }
+}
+
+/**
+ * @brief 列与常量比较：每个运算符 × int/float/string列，以及int列与float常量、float列与int常量
+ */
+TEST_F(CompiledPredicateTest, ColumnValueTest) {
+    std::vector<std::pair<std::string, Value>> cases;
+    for (int v : {0, 3}) {
+        Value val;
+        val.set_int(v);
+        cases.emplace_back("a", val);
+        cases.emplace_back("b", val);
+    }
+    for (float v : {0.5f, 3.0f}) {
+        Value val;
+        val.set_float(v);
+        cases.emplace_back("a", val);
+        cases.emplace_back("b", val);
+    }
+    for (std::string v : {"ab", "abc"}) {
+        Value val;
+        val.set_str(v);
+        cases.emplace_back("c", val);
+    }
+    for (auto &[lhs, val] : cases) {
+        for (CompOp op : all_ops) {
+            const ColMeta &lhs_col = col(lhs);
+            // 与analyze相同，常量的raw按左侧列的长度生成
+            CompiledPredicate pred({val_cond(lhs, op, val, lhs_col.len)}, cols_);
+            FieldVal rhs = value_field(val, lhs_col.len);
+            for (auto &row : rows_) {
+                ASSERT_EQ(pred.eval(row.data()), expected(op, field(row.data(), lhs_col), rhs))
+                    << lhs << " op " << op << " const";
+            }
+        }
+    }
+}
+
+/**
+ * @brief 多个条件之间是与的关系，没有条件时总是满足
+ */
+TEST_F(CompiledPredicateTest, ConjunctionTest) {
+    CompiledPredicate empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_TRUE(empty.eval(rows_[0].data()));
+
+    Value zero;
+    zero.set_int(0);
+    CompiledPredicate pred({val_cond("a", OP_GT, zero, 4), col_cond("c", OP_EQ, "f"), col_cond("b", OP_LE, "e")},
+                           cols_);
+    EXPECT_FALSE(pred.empty());
+    for (auto &row : rows_) {
+        auto a = field(row.data(), col("a")), b = field(row.data(), col("b"));
+        auto c = field(row.data(), col("c")), e = field(row.data(), col("e")), f = field(row.data(), col("f"));
+        bool exp = a.int_val > 0 && c.str_val == f.str_val && b.float_val <= e.float_val;
+        ASSERT_EQ(pred.eval(row.data()), exp);
+    }
+}
+
+/**
+ * @brief 不能比较的类型和不存在的列在编译时报错
+ */
+TEST_F(CompiledPredicateTest, InvalidConditionTest) {
+    EXPECT_THROW(CompiledPredicate({col_cond("a", OP_EQ, "f")}, cols_), IncompatibleTypeError);
+    EXPECT_THROW(CompiledPredicate({col_cond("c", OP_LT, "e")}, cols_), IncompatibleTypeError);
+    EXPECT_THROW(CompiledPredicate({col_cond("a", OP_EQ, "x")}, cols_), ColumnNotFoundError);
+}
+
+/**
+ * @brief 长度不同的字符串列之间比较：较短的一侧视为补零，只读取各自长度内的字节
+ */
+TEST_F(CompiledPredicateTest, StringLengthTest) {
+    // 记录格式：char x[10] | char y[4]，y位于记录末尾
+    std::vector<ColMeta> cols = {make_col("x", TYPE_STRING, 10, 0), make_col("y", TYPE_STRING, 4, 10)};
+    const std::vector<std::string> xs = {"", "ab", "abc", "abcd", "abcda", "abce", "b"};
+    const std::vector<std::string> ys = {"", "ab", "abc", "abcd", "abd"};
+    for (auto &x : xs) {
+        for (auto &y : ys) {
+            std::vector<char> row(14, 0);
+            memcpy(row.data(), x.data(), x.size());
+            memcpy(row.data() + 10, y.data(), y.size());
+            std::string x_val(10, '\0'), y_val(10, '\0');
+            x_val.replace(0, x.size(), x);
+            y_val.replace(0, y.size(), y);
+            for (CompOp op : {OP_EQ, OP_NE, OP_LT, OP_GT, OP_LE, OP_GE}) {
+                CompiledPredicate xy({col_cond("x", op, "y")}, cols);
+                ASSERT_EQ(xy.eval(row.data()), expected(op, x_val, y_val)) << x << ' ' << op << ' ' << y;
+                CompiledPredicate yx({col_cond("y", op, "x")}, cols);
+                ASSERT_EQ(yx.eval(row.data()), expected(op, y_val, x_val)) << y << ' ' << op << ' ' << x;
+            }
+        }
+    }
+}
@@ -0,0 +1,113 @@
+#undef NDEBUG
+
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "execution/execution_batch.h"
+#include "gtest/gtest.h"
+#include "vector_executor.h"
+
+/**
+ * @brief 追加的记录按行连续存放并被选中，缩短选择向量后只剩选中的记录，满BATCH_SIZE行后不能再追加
+ */
+TEST(RecordBatchTest, AppendAndSelectTest) {
+    RecordBatch batch;
+    batch.reset(sizeof(int));
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(batch.room(), BATCH_SIZE);
+    for (int i = 0; i < (int)BATCH_SIZE; i++) {
+        memcpy(batch.append(), &i, sizeof(int));
+    }
+    EXPECT_TRUE(batch.full());
+    EXPECT_EQ(batch.room(), 0);
+    ASSERT_EQ(batch.size(), BATCH_SIZE);
+    for (int i = 0; i < (int)BATCH_SIZE; i++) {
+        EXPECT_EQ(*(const int *)batch.get(i), i);
+        EXPECT_EQ(batch.data() + i * sizeof(int), batch.get(i));
+    }
+
+    // 只保留偶数，get按选择向量取记录，记录本身不移动
+    auto &sel = batch.sel();
+    size_t num_sel = 0;
+    for (size_t i = 0; i < sel.size(); i++) {
+        if (sel[i] % 2 == 0) sel[num_sel++] = sel[i];
+    }
+    sel.resize(num_sel);
+    ASSERT_EQ(batch.size(), BATCH_SIZE / 2);
+    for (size_t i = 0; i < batch.size(); i++) {
+        EXPECT_EQ(*(const int *)batch.get(i), (int)(2 * i));
+    }
+    // 过滤掉的行仍然占用空间
+    EXPECT_TRUE(batch.full());
+}
+
+/**
+ * @brief reset清空记录和选择向量，之后可以使用更长的记录
+ */
+TEST(RecordBatchTest, ResetTest) {
+    RecordBatch batch;
+    batch.reset(4);
+    memset(batch.append(), 1, 4);
+    batch.reset(100);
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(batch.tuple_len(), 100);
+    EXPECT_EQ(batch.room(), BATCH_SIZE);
+    for (size_t i = 0; i < BATCH_SIZE; i++) {
+        memset(batch.append(), (int)(i & 0x7f), 100);
+    }
+    for (size_t i = 0; i < BATCH_SIZE; i++) {
+        const char *row = batch.get(i);
+        EXPECT_EQ(row[0], (char)(i & 0x7f));
+        EXPECT_EQ(row[99], (char)(i & 0x7f));
+    }
+}
+
+/**
+ * @brief 没有实现批量接口的算子通过默认的NextBatch适配：每批BATCH_SIZE条，最后一批不满，之后返回false；
+ * 重新beginTuple后可以再读一遍
+ */
+TEST(RecordBatchTest, DefaultNextBatchTest) {
+    const int num_rows = 2 * BATCH_SIZE + 100;
+    std::vector<std::tuple<int, float, std::string>> values;
+    for (int i = 0; i < num_rows; i++) {
+        values.emplace_back(i, i / 2.0f, "r" + std::to_string(i));
+    }
+    auto exec = VectorExecutor::make("t", values);
+
+    for (int pass = 0; pass < 2; pass++) {
+        exec->beginTuple();
+        RecordBatch batch;
+        std::vector<size_t> sizes;
+        int next = 0;
+        while (exec->NextBatch(&batch)) {
+            EXPECT_EQ(batch.tuple_len(), exec->tupleLen());
+            sizes.push_back(batch.size());
+            for (size_t i = 0; i < batch.size(); i++, next++) {
+                int a;
+                float b;
+                memcpy(&a, batch.get(i), sizeof(int));
+                memcpy(&b, batch.get(i) + 4, sizeof(float));
+                EXPECT_EQ(a, next);
+                EXPECT_EQ(b, next / 2.0f);
+                EXPECT_EQ(std::string(batch.get(i) + 8), "r" + std::to_string(next));
+            }
+        }
+        EXPECT_EQ(next, num_rows);
+        EXPECT_EQ(sizes, (std::vector<size_t>{BATCH_SIZE, BATCH_SIZE, 100}));
+        EXPECT_TRUE(batch.empty());
+        EXPECT_FALSE(exec->NextBatch(&batch));
+    }
+}
+
+/**
+ * @brief 空的算子第一次调用NextBatch就返回false
+ */
+TEST(RecordBatchTest, EmptyNextBatchTest) {
+    auto exec = VectorExecutor::make("t", {});
+    exec->beginTuple();
+    RecordBatch batch;
+    EXPECT_FALSE(exec->NextBatch(&batch));
+    EXPECT_TRUE(batch.empty());
+}
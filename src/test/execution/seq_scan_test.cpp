@@ -0,0 +1,140 @@
+#undef NDEBUG
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#define private public
+#include "execution/executor_seq_scan.h"
+#undef private
+
+#include "storage/buffer_pool_manager.h"
+
+const std::string TEST_DB_NAME = "SeqScanTest_db";  // 以数据库名作为根目录
+
+int scan_record_cnt = 0;
+
+class SeqScanTest : public ::testing::Test {
+   public:
+    std::unique_ptr<DiskManager> disk_manager_;
+    std::unique_ptr<BufferPoolManager> buffer_pool_manager_;
+    std::unique_ptr<IxManager> ix_manager_;
+    std::unique_ptr<RmManager> rm_;
+    std::unique_ptr<SmManager> sm_;
+
+    void SetUp() override {
+        ::testing::Test::SetUp();
+        disk_manager_ = std::make_unique<DiskManager>();
+        buffer_pool_manager_ = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager_.get());
+        ix_manager_ = std::make_unique<IxManager>(disk_manager_.get(), buffer_pool_manager_.get());
+        rm_ = std::make_unique<RmManager>(disk_manager_.get(), buffer_pool_manager_.get());
+        sm_ = std::make_unique<SmManager>(disk_manager_.get(), buffer_pool_manager_.get(), rm_.get(), ix_manager_.get());
+        if (disk_manager_->is_dir(TEST_DB_NAME)) {
+            std::string cmd = "rm -rf " + TEST_DB_NAME;
+            if (system(cmd.c_str()) < 0) {
+                throw UnixError();
+            }
+        }
+        sm_->create_db(TEST_DB_NAME);
+        if (chdir(TEST_DB_NAME.c_str()) < 0) {
+            throw UnixError();
+        }
+    }
+
+    void TearDown() override {
+        for (auto &fh : sm_->fhs_) {
+            rm_->close_file(fh.second.get());
+        }
+        sm_->fhs_.clear();
+        if (chdir("..") < 0) {
+            throw UnixError();
+        }
+    }
+
+    // 建表t(a int, b int, c char(64))并插入num_rows条记录，第i条记录为(i, i % 1000, "")
+    void create_table(const std::string &tab_name, int num_rows) {
+        sm_->create_table(tab_name, {{"a", TYPE_INT, 4}, {"b", TYPE_INT, 4}, {"c", TYPE_STRING, 64}}, nullptr);
+        auto fh = sm_->fhs_.at(tab_name).get();
+        char row[72] = {};
+        for (int i = 0; i < num_rows; i++) {
+            int b = i % 1000;
+            memcpy(row, &i, sizeof(int));
+            memcpy(row + 4, &b, sizeof(int));
+            fh->insert_record(row, nullptr);
+        }
+    }
+
+    // 条件b < 100
+    static std::vector<Condition> conds(const std::string &tab_name) {
+        Condition cond;
+        cond.lhs_col = {tab_name, "b"};
+        cond.op = OP_LT;
+        cond.is_rhs_val = true;
+        cond.rhs_val.set_int(100);
+        cond.rhs_val.init_raw(sizeof(int));
+        return {cond};
+    }
+
+    static std::vector<int> read_rows(SeqScanExecutor *scan) {
+        std::vector<int> rows;
+        for (scan->beginTuple(); !scan->is_end(); scan->nextTuple()) {
+            rows.push_back(*(int *)scan->Next()->data);
+        }
+        return rows;
+    }
+};
+
+/**
+ * @brief 足够大的表并行扫描，输出顺序与串行扫描相同；重新beginTuple时继续使用已有的worker，
+ * 包括上一次没有读完就重新开始的情况
+ */
+TEST_F(SeqScanTest, ParallelRescanTest) {
+    create_table("t", 30000);
+    ASSERT_GE(sm_->fhs_.at("t")->get_file_hdr().num_pages, SCAN_PARALLEL_MIN_PAGES);
+
+    SeqScanExecutor serial(sm_.get(), "t", conds("t"), nullptr, {}, false);
+    auto expected = read_rows(&serial);
+    EXPECT_FALSE(serial.parallel_);
+    EXPECT_TRUE(serial.workers_.empty());
+    ASSERT_EQ(expected.size(), (size_t)3000);
+
+    SeqScanExecutor parallel(sm_.get(), "t", conds("t"), nullptr);
+    parallel.max_workers_ = 4;
+    EXPECT_EQ(read_rows(&parallel), expected);
+    EXPECT_TRUE(parallel.parallel_);
+    EXPECT_EQ(parallel.workers_.size(), (size_t)4);
+    std::vector<std::thread::id> worker_ids;
+    for (auto &worker : parallel.workers_) {
+        worker_ids.push_back(worker.get_id());
+    }
+
+    for (int round = 0; round < 5; round++) {
+        // 读到一半时重新开始
+        parallel.beginTuple();
+        for (int i = 0; i < 500 * round; i++) {
+            ASSERT_FALSE(parallel.is_end());
+            parallel.nextTuple();
+        }
+        EXPECT_EQ(read_rows(&parallel), expected);
+    }
+    ASSERT_EQ(parallel.workers_.size(), worker_ids.size());
+    for (size_t i = 0; i < worker_ids.size(); i++) {
+        EXPECT_EQ(parallel.workers_[i].get_id(), worker_ids[i]);
+    }
+}
+
+/**
+ * @brief 页面个数少于SCAN_PARALLEL_MIN_PAGES的表串行扫描，不创建worker
+ */
+TEST_F(SeqScanTest, SmallTableTest) {
+    create_table("s", 2000);
+    ASSERT_LT(sm_->fhs_.at("s")->get_file_hdr().num_pages, SCAN_PARALLEL_MIN_PAGES);
+
+    SeqScanExecutor scan(sm_.get(), "s", conds("s"), nullptr);
+    scan.max_workers_ = 4;
+    EXPECT_EQ(read_rows(&scan).size(), (size_t)200);
+    EXPECT_FALSE(scan.parallel_);
+    EXPECT_TRUE(scan.workers_.empty());
+}
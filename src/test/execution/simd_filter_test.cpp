@@ -0,0 +1,108 @@
+#undef NDEBUG
+
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <vector>
+
+#include "execution/execution_simd.h"
+#include "gtest/gtest.h"
+
+class SimdFilterTest : public ::testing::Test {
+   public:
+    // 记录格式：int a | float b | char c[40]，随机打乱候选下标的顺序
+    static constexpr int record_size = 48;
+    static constexpr int num_records = 1000;
+    std::vector<char> rows_;
+    std::vector<int> sel_;
+
+    void SetUp() override {
+        srand((unsigned)time(nullptr));
+        rows_.assign(record_size * num_records, 0);
+        for (int i = 0; i < num_records; i++) {
+            char *row = rows_.data() + i * record_size;
+            int a = rand() % 50 - 25;
+            float b = (rand() % 100) / 4.0f - 12.5f;
+            memcpy(row, &a, sizeof(int));
+            memcpy(row + 4, &b, sizeof(float));
+            // 长度超过32的字符串只在最后几个字节上有区别，覆盖向量比较和memcmp两部分
+            memset(row + 8, 'x', 40);
+            row[8 + 38] = 'a' + rand() % 3;
+        }
+        for (int i = 0; i < num_records; i++) {
+            if (rand() % 4 != 0) {
+                sel_.push_back(i);
+            }
+        }
+        for (size_t i = 1; i < sel_.size(); i++) {
+            std::swap(sel_[i], sel_[rand() % (i + 1)]);
+        }
+    }
+
+    // 用simd_filter和scalar_filter分别过滤sel_，两者的结果必须完全相同，并且与逐个比较的结果一致
+    void check(ColType col_type, int offset, int len, CompOp op, ColType val_type, const char *val,
+               const std::function<bool(const char *)> &expected) {
+        SimdFilter filter;
+        ASSERT_TRUE(make_simd_filter(col_type, len, op, val_type, val, &filter));
+        const char *base = rows_.data() + offset;
+        std::vector<int> simd_sel = sel_, scalar_sel = sel_;
+        simd_sel.resize(simd_filter(filter, base, record_size, simd_sel.data(), simd_sel.size()));
+        scalar_sel.resize(scalar_filter(filter, base, record_size, scalar_sel.data(), scalar_sel.size()));
+        EXPECT_EQ(simd_sel, scalar_sel);
+
+        std::vector<int> expected_sel;
+        for (int slot : sel_) {
+            if (expected(base + slot * record_size)) {
+                expected_sel.push_back(slot);
+            }
+        }
+        EXPECT_EQ(scalar_sel, expected_sel);
+    }
+};
+
+/**
+ * @brief 六种比较运算符在int、float以及int与float混合比较下的结果
+ */
+TEST_F(SimdFilterTest, NumericTest) {
+    std::vector<CompOp> ops = {OP_EQ, OP_NE, OP_LT, OP_GT, OP_LE, OP_GE};
+    for (CompOp op : ops) {
+        auto eval = [op](auto lhs, auto rhs) {
+            switch (op) {
+                case OP_EQ: return lhs == rhs;
+                case OP_NE: return lhs != rhs;
+                case OP_LT: return lhs < rhs;
+                case OP_GT: return lhs > rhs;
+                case OP_LE: return lhs <= rhs;
+                case OP_GE: return lhs >= rhs;
+            }
+            return false;
+        };
+        int int_val = rand() % 50 - 25;
+        float float_val = (rand() % 100) / 4.0f - 12.5f;
+        check(TYPE_INT, 0, sizeof(int), op, TYPE_INT, (const char *)&int_val,
+              [&](const char *data) { return eval(*(const int *)data, int_val); });
+        check(TYPE_INT, 0, sizeof(int), op, TYPE_FLOAT, (const char *)&float_val,
+              [&](const char *data) { return eval(*(const int *)data, float_val); });
+        check(TYPE_FLOAT, 4, sizeof(float), op, TYPE_FLOAT, (const char *)&float_val,
+              [&](const char *data) { return eval(*(const float *)data, float_val); });
+        check(TYPE_FLOAT, 4, sizeof(float), op, TYPE_INT, (const char *)&int_val,
+              [&](const char *data) { return eval(*(const float *)data, int_val); });
+    }
+}
+
+/**
+ * @brief 定长字符串的等值、不等比较，其他运算符不能用过滤内核求值
+ */
+TEST_F(SimdFilterTest, StringTest) {
+    char val[40];
+    memset(val, 'x', 40);
+    val[38] = 'b';
+    check(TYPE_STRING, 8, 40, OP_EQ, TYPE_STRING, val,
+          [&](const char *data) { return memcmp(data, val, 40) == 0; });
+    check(TYPE_STRING, 8, 40, OP_NE, TYPE_STRING, val,
+          [&](const char *data) { return memcmp(data, val, 40) != 0; });
+
+    SimdFilter filter;
+    EXPECT_FALSE(make_simd_filter(TYPE_STRING, 40, OP_LT, TYPE_STRING, val, &filter));
+    EXPECT_FALSE(make_simd_filter(TYPE_STRING, 40, OP_EQ, TYPE_INT, val, &filter));
+}
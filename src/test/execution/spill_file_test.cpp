@@ -0,0 +1,110 @@
+#undef NDEBUG
+
+#include <cstring>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+#include "execution/execution_spill.h"
+#include "gtest/gtest.h"
+
+const std::string TEST_DB_NAME = "SpillFileTest_db";  // 以TEST_DB_NAME作为存放测试文件的根目录名
+
+class SpillFileTest : public ::testing::Test {
+   public:
+    std::unique_ptr<DiskManager> disk_manager_;
+
+    void SetUp() override {
+        disk_manager_ = std::make_unique<DiskManager>();
+        if (!disk_manager_->is_dir(TEST_DB_NAME)) {
+            disk_manager_->create_dir(TEST_DB_NAME);
+        }
+        if (chdir(TEST_DB_NAME.c_str()) < 0) {
+            throw UnixError();
+        }
+        srand((unsigned)time(nullptr));
+    }
+
+    void TearDown() override {
+        if (chdir("..") < 0) {
+            throw UnixError();
+        }
+        disk_manager_->destroy_dir(TEST_DB_NAME);
+    }
+};
+
+/**
+ * @brief 长度不整除页面大小的记录跨越页面写入，rewind之后按写入顺序全部读出，可以重复读取
+ */
+TEST_F(SpillFileTest, WriteAndReadTest) {
+    constexpr size_t tuple_len = 100;
+    constexpr size_t num_tuples = 1000;
+    std::vector<char> tuples(tuple_len * num_tuples);
+    for (auto &ch : tuples) {
+        ch = rand() & 0xff;
+    }
+    {
+        SpillFile file(disk_manager_.get(), "spill.0", tuple_len);
+        for (size_t i = 0; i < num_tuples; i++) {
+            file.append(tuples.data() + i * tuple_len);
+        }
+        EXPECT_EQ(file.size(), num_tuples);
+        EXPECT_EQ(file.bytes(), tuple_len * num_tuples);
+
+        char buf[tuple_len];
+        for (int pass = 0; pass < 2; pass++) {
+            file.rewind();
+            for (size_t i = 0; i < num_tuples; i++) {
+                ASSERT_TRUE(file.read(buf));
+                ASSERT_EQ(memcmp(buf, tuples.data() + i * tuple_len, tuple_len), 0);
+            }
+            EXPECT_FALSE(file.read(buf));
+        }
+    }
+    // 析构时删除临时文件
+    EXPECT_FALSE(disk_manager_->is_file("spill.0"));
+}
+
+/**
+ * @brief 没有写入记录的文件读不出记录
+ */
+TEST_F(SpillFileTest, EmptyTest) {
+    SpillFile file(disk_manager_.get(), "spill.1", 16);
+    file.rewind();
+    char buf[16];
+    EXPECT_EQ(file.size(), 0);
+    EXPECT_FALSE(file.read(buf));
+}
+
+/**
+ * @brief 多个线程同时创建、读写和删除各自的临时文件，共享同一个DiskManager的文件打开列表
+ */
+TEST_F(SpillFileTest, ConcurrentTest) {
+    constexpr size_t tuple_len = 24;
+    constexpr int num_threads = 8;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t] {
+            char tuple[tuple_len];
+            for (int round = 0; round < 200; round++) {
+                SpillFile file(disk_manager_.get(), "spill." + std::to_string(t), tuple_len);
+                for (int i = 0; i < 300; i++) {
+                    memset(tuple, t * 31 + i, tuple_len);
+                    file.append(tuple);
+                }
+                file.rewind();
+                for (int i = 0; i < 300; i++) {
+                    ASSERT_TRUE(file.read(tuple));
+                    ASSERT_EQ(tuple[tuple_len - 1], (char)(t * 31 + i));
+                }
+                ASSERT_FALSE(file.read(tuple));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (int t = 0; t < num_threads; t++) {
+        EXPECT_FALSE(disk_manager_->is_file("spill." + std::to_string(t)));
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "execution/executor_abstract.h"
+
+/**
+ * @brief 测试用的叶子算子：按顺序输出内存中的定长记录，只实现逐条接口，批量接口使用默认的适配
+ */
+class VectorExecutor : public AbstractExecutor {
+   public:
+    // cols中的offset为字段在记录中的偏移，记录长度为最后一个字段的结尾
+    VectorExecutor(std::vector<ColMeta> cols, std::vector<std::vector<char>> rows)
+        : cols_(std::move(cols)), rows_(std::move(rows)) {
+        context_ = nullptr;
+        len_ = cols_.back().offset + cols_.back().len;
+    }
+
+    // 生成表tab_name上的记录，字段依次为int a、float b、char c[str_len]，row_values给出每条记录的(a, b, c)
+    static std::unique_ptr<VectorExecutor> make(const std::string &tab_name,
+                                                const std::vector<std::tuple<int, float, std::string>> &row_values,
+                                                int str_len = 8) {
+        std::vector<ColMeta> cols = {
+            {.tab_name = tab_name, .name = "a", .type = TYPE_INT, .len = 4, .offset = 0, .index = false},
+            {.tab_name = tab_name, .name = "b", .type = TYPE_FLOAT, .len = 4, .offset = 4, .index = false},
+            {.tab_name = tab_name, .name = "c", .type = TYPE_STRING, .len = str_len, .offset = 8, .index = false},
+        };
+        std::vector<std::vector<char>> rows;
+        for (auto &[a, b, c] : row_values) {
+            std::vector<char> row(8 + str_len, 0);
+            memcpy(row.data(), &a, sizeof(int));
+            memcpy(row.data() + 4, &b, sizeof(float));
+            memcpy(row.data() + 8, c.data(), std::min(c.size(), (size_t)str_len));
+            rows.push_back(std::move(row));
+        }
+        return std::make_unique<VectorExecutor>(std::move(cols), std::move(rows));
+    }
+
+    void beginTuple() override {
+        pos_ = 0;
+        num_begins_++;
+    }
+
+    void nextTuple() override { pos_++; }
+
+    bool is_end() const override { return pos_ >= rows_.size(); }
+
+    std::unique_ptr<RmRecord> Next() override {
+        return std::make_unique<RmRecord>(len_, const_cast<char *>(rows_[pos_].data()));
+    }
+
+    Rid &rid() override { return _abstract_rid; }
+
+    size_t tupleLen() const override { return len_; }
+
+    const std::vector<ColMeta> &cols() const override { return cols_; }
+
+    // beginTuple()被调用的次数，用于检查连接算子重新扫描内表的次数
+    int num_begins() const { return num_begins_; }
+
+   private:
+    std::vector<ColMeta> cols_;
+    std::vector<std::vector<char>> rows_;
+    size_t len_;
+    size_t pos_ = 0;
+    int num_begins_ = 0;
+};
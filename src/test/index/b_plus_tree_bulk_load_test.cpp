@@ -0,0 +1,459 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <random>  // for std::default_random_engine
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#define private public
+#include "index/ix.h"
+#undef private  // for use private variables in "ix.h"
+
+#include "record/rm.h"
+#include "storage/buffer_pool_manager.h"
+#include "system/sm.h"
+
+const std::string TEST_DB_NAME = "BPlusTreeBulkLoadTest_db";  // 以数据库名作为根目录
+
+class BPlusTreeBulkLoadTest : public ::testing::Test {
+   public:
+    std::unique_ptr<DiskManager> disk_manager_;
+    std::unique_ptr<BufferPoolManager> buffer_pool_manager_;
+    std::unique_ptr<IxManager> ix_manager_;
+    std::unique_ptr<RmManager> rm_;
+    std::unique_ptr<SmManager> sm_;
+
+    void SetUp() override {
+        ::testing::Test::SetUp();
+        disk_manager_ = std::make_unique<DiskManager>();
+        buffer_pool_manager_ = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager_.get());
+        ix_manager_ = std::make_unique<IxManager>(disk_manager_.get(), buffer_pool_manager_.get());
+        rm_ = std::make_unique<RmManager>(disk_manager_.get(), buffer_pool_manager_.get());
+        sm_ = std::make_unique<SmManager>(disk_manager_.get(), buffer_pool_manager_.get(), rm_.get(), ix_manager_.get());
+
+        if (disk_manager_->is_dir(TEST_DB_NAME)) {
+            std::string cmd = "rm -rf " + TEST_DB_NAME;
+            if (system(cmd.c_str()) < 0) {
+                throw UnixError();
+            }
+        }
+        sm_->create_db(TEST_DB_NAME);
+        if (chdir(TEST_DB_NAME.c_str()) < 0) {
+            throw UnixError();
+        }
+    }
+
+    void TearDown() override {
+        for (auto &fh : sm_->fhs_) {
+            rm_->close_file(fh.second.get());
+        }
+        sm_->fhs_.clear();
+        if (chdir("..") < 0) {
+            throw UnixError();
+        }
+    }
+
+    // 按照叶子结点的顺序读出索引中所有的(key, rid)，同时检查key严格递增
+    std::vector<std::pair<int64_t, Rid>> scan_index(IxIndexHandle *ih) {
+        std::vector<std::pair<int64_t, Rid>> entries;
+        IxScan scan(ih, ih->leaf_begin(), ih->leaf_end(), buffer_pool_manager_.get());
+        while (!scan.is_end()) {
+            IxNodeHandle *node = ih->fetch_node(scan.iid().page_no);
+            int64_t key = 0;
+            char buf[IX_MAX_COL_LEN];
+            ix_decode_key(node->get_key(scan.iid().slot_no, buf), (char *)&key, ih->file_hdr_);
+            buffer_pool_manager_->unpin_page(node->get_page_id(), false);
+            delete node;
+            if (!entries.empty()) {
+                EXPECT_LT(entries.back().first, key);
+            }
+            entries.push_back({key, scan.rid()});
+            scan.next();
+        }
+        return entries;
+    }
+};
+
+/**
+ * @brief 内存限制很小时外部排序需要写出多个有序段，归并后仍然按照(key, rid)有序输出
+ */
+TEST_F(BPlusTreeBulkLoadTest, ExternalSortTest) {
+    const int num_entries = 50000;
+    // 内存中最多缓存约1000个键值对
+    IxSorter sorter(disk_manager_.get(), "sort_test", {TYPE_INT}, {4}, 1000 * (4 + sizeof(Rid)));
+    std::default_random_engine rng(1);
+    for (int i = 0; i < num_entries; i++) {
+        int key = rng() % 10000;
+        sorter.add((const char *)&key, Rid{i / 100, i % 100});
+    }
+    sorter.sort();
+    EXPECT_GT(sorter.num_runs(), 1);
+    EXPECT_EQ(sorter.size(), num_entries);
+
+    int cnt = 0;
+    int key, last_key = -1;
+    Rid rid, last_rid = {-1, -1};
+    while (sorter.next((char *)&key, &rid)) {
+        ASSERT_TRUE(last_key < key || (last_key == key && (last_rid.page_no < rid.page_no ||
+                                                           (last_rid.page_no == rid.page_no && last_rid.slot_no < rid.slot_no))));
+        last_key = key;
+        last_rid = rid;
+        cnt++;
+    }
+    EXPECT_EQ(cnt, num_entries);
+}
+
+/**
+ * @brief 在已有数据的表上创建索引，检查批量建立的B+树，然后继续插入和删除
+ */
+TEST_F(BPlusTreeBulkLoadTest, BuildAndModifyTest) {
+    const int num_rows = 30000;
+    sm_->create_table("t", {{"a", TYPE_INT, 4}, {"b", TYPE_INT, 4}}, nullptr);
+    RmFileHandle *fh = sm_->fhs_.at("t").get();
+
+    std::vector<int> keys;
+    for (int i = 0; i < num_rows; i++) keys.push_back(i * 2);
+    std::shuffle(keys.begin(), keys.end(), std::default_random_engine{});
+    std::map<int, Rid> key2rid;
+    for (int key : keys) {
+        int row[2] = {key, -key};
+        key2rid[key] = fh->insert_record((char *)row, nullptr);
+    }
+
+    sm_->create_index("t", {"a"}, nullptr);
+    auto ih = ix_manager_->open_index("t", std::vector<std::string>{"a"});
+
+    auto entries = scan_index(ih.get());
+    ASSERT_EQ(entries.size(), key2rid.size());
+    auto it = key2rid.begin();
+    for (auto &entry : entries) {
+        EXPECT_EQ(entry.first, it->first);
+        EXPECT_EQ(entry.second, it->second);
+        ++it;
+    }
+    // 叶子结点按照填充因子填充，内部结点自底向上建立
+    IxNodeHandle *root = ih->fetch_node(ih->file_hdr_->root_page_);
+    EXPECT_FALSE(root->is_leaf_page());
+    buffer_pool_manager_->unpin_page(root->get_page_id(), false);
+    delete root;
+    int fill = ih->file_hdr_->btree_order_ * IX_BULK_FILL_FACTOR;
+    int num_leaves = (num_rows + fill - 1) / fill;
+    EXPECT_LE(ih->file_hdr_->num_pages_, IX_INIT_NUM_PAGES + num_leaves + num_leaves / 2);
+
+    // 批量建立的B+树可以继续正常插入和删除：插入奇数key，删除一半偶数key
+    Transaction txn(0);
+    for (int key : keys) {
+        int odd = key + 1;
+        ih->insert_entry((const char *)&odd, Rid{odd, odd}, &txn);
+        key2rid[odd] = Rid{odd, odd};
+    }
+    for (int i = 0; i < num_rows / 2; i++) {
+        ASSERT_TRUE(ih->delete_entry((const char *)&keys[i], &txn));
+        key2rid.erase(keys[i]);
+    }
+    for (auto &[key, rid] : key2rid) {
+        std::vector<Rid> result;
+        ASSERT_TRUE(ih->get_value((const char *)&key, &result, &txn));
+        EXPECT_EQ(result[0], rid);
+    }
+    entries = scan_index(ih.get());
+    EXPECT_EQ(entries.size(), key2rid.size());
+    ix_manager_->close_index(ih.get());
+}
+
+/**
+ * @brief 表中已有重复的key时不能创建唯一索引：抛出异常，删除建立了一半的索引文件，表上也不会有这个索引
+ */
+TEST_F(BPlusTreeBulkLoadTest, UniqueViolationTest) {
+    const int num_rows = 10000;
+    sm_->create_table("t", {{"a", TYPE_INT, 4}, {"b", TYPE_INT, 4}}, nullptr);
+    RmFileHandle *fh = sm_->fhs_.at("t").get();
+    for (int i = 0; i < num_rows; i++) {
+        int row[2] = {i, i};
+        fh->insert_record((char *)row, nullptr);
+    }
+    // 重复的key排在最后，发现重复时已经写满了多个叶子结点
+    int dup[2] = {num_rows - 1, -1};
+    Rid dup_rid = fh->insert_record((char *)dup, nullptr);
+
+    for (auto type : {INDEX_BTREE, INDEX_HASH}) {
+        EXPECT_THROW(sm_->create_index("t", {"a"}, nullptr, type, true), UniqueViolationError);
+        EXPECT_FALSE(ix_manager_->exists("t", std::vector<std::string>{"a"}));
+        EXPECT_FALSE(sm_->db_.get_table("t").is_index({"a"}));
+    }
+
+    // 非唯一索引可以建立；删除重复的记录之后也可以建立唯一索引
+    sm_->create_index("t", {"a"}, nullptr, INDEX_BTREE, false);
+    sm_->drop_index("t", std::vector<std::string>{"a"}, nullptr);
+    fh->delete_record(dup_rid, nullptr);
+    sm_->create_index("t", {"a"}, nullptr);
+    auto ih = ix_manager_->open_index("t", std::vector<std::string>{"a"});
+    auto entries = scan_index(ih.get());
+    ASSERT_EQ(entries.size(), (size_t)num_rows);
+    for (int i = 0; i < num_rows; i++) {
+        EXPECT_EQ(entries[i].first, i);
+    }
+    ix_manager_->close_index(ih.get());
+}
+
+/**
+ * @brief 非唯一索引：批量建立时重复key的rid写成posting list，之后按rid插入和删除，扫描时展开为(key, rid)
+ */
+TEST_F(BPlusTreeBulkLoadTest, NonUniqueIndexTest) {
+    const int num_rows = 20000, num_keys = 5;
+    sm_->create_table("t", {{"a", TYPE_INT, 4}, {"b", TYPE_INT, 4}}, nullptr);
+    RmFileHandle *fh = sm_->fhs_.at("t").get();
+    auto rid_less = [](const Rid &a, const Rid &b) { return ix_rid_less(a, b); };
+    std::map<int, std::vector<Rid>> key2rids;
+    for (int i = 0; i < num_rows; i++) {
+        // 少数key占大部分记录，一个key的rid需要多个posting页面；其余key各只有一条记录
+        int key = i % 4 == 0 ? i : i % num_keys;
+        int row[2] = {key, i};
+        key2rids[key].push_back(fh->insert_record((char *)row, nullptr));
+    }
+    auto check = [&](IxIndexHandle *ih) {
+        size_t total = 0;
+        for (auto &[key, rids] : key2rids) {
+            std::sort(rids.begin(), rids.end(), rid_less);
+            std::vector<Rid> result;
+            ASSERT_EQ(ih->get_value((const char *)&key, &result, nullptr), !rids.empty());
+            ASSERT_EQ(result, rids);
+            total += rids.size();
+        }
+        std::vector<std::pair<int, Rid>> entries;
+        for (IxScan scan(ih, ih->leaf_begin(), ih->leaf_end(), buffer_pool_manager_.get()); !scan.is_end(); scan.next()) {
+            int key;
+            scan.key((char *)&key);
+            entries.push_back({key, scan.rid()});
+        }
+        ASSERT_EQ(entries.size(), total);
+        auto it = entries.begin();
+        for (auto &[key, rids] : key2rids) {
+            for (auto &rid : rids) {
+                ASSERT_EQ(it->first, key);
+                ASSERT_EQ(it->second, rid);
+                ++it;
+            }
+        }
+    };
+
+    sm_->create_index("t", {"a"}, nullptr, INDEX_BTREE, false);
+    EXPECT_FALSE(sm_->db_.get_table("t").indexes[0].unique);
+    auto ih = ix_manager_->open_index("t", std::vector<std::string>{"a"});
+    EXPECT_FALSE(ih->file_hdr_->unique_);
+    check(ih.get());
+
+    // 逐条插入时posting页面放不下会分裂；重复插入同一个(key, rid)不生效
+    Transaction txn(0);
+    for (int i = 0; i < num_rows; i++) {
+        int key = i % num_keys;
+        Rid rid = {num_rows + i, i % 7};
+        ASSERT_NE(ih->insert_entry((const char *)&key, rid, &txn), IX_NO_PAGE);
+        key2rids[key].push_back(rid);
+    }
+    int key0 = 0;
+    EXPECT_EQ(ih->insert_entry((const char *)&key0, key2rids[0][0], &txn), IX_NO_PAGE);
+    check(ih.get());
+
+    // 按rid删除：key 1只剩一条记录后直接存放在叶子结点中，key 2全部删除；不存在的rid删除失败
+    EXPECT_FALSE(ih->delete_entry((const char *)&key0, Rid{-5, 3}, &txn));
+    std::shuffle(key2rids[1].begin(), key2rids[1].end(), std::default_random_engine{});
+    for (int k = 1; k <= 2; k++) {
+        auto &rids = key2rids[k];
+        while (rids.size() > (k == 1 ? 1 : 0)) {
+            ASSERT_TRUE(ih->delete_entry((const char *)&k, rids.back(), &txn));
+            rids.pop_back();
+        }
+    }
+    int key1 = 1;
+    std::vector<Rid> result;
+    ih->get_value((const char *)&key1, &result, nullptr);
+    IxNodeHandle *leaf = ih->fetch_node(ih->leaf_begin().page_no);
+    Rid *ref;
+    char buf[IX_MAX_COL_LEN];
+    ASSERT_TRUE(leaf->leaf_lookup(ih->encode_key((const char *)&key1, buf), &ref));
+    EXPECT_EQ(*ref, result[0]);
+    buffer_pool_manager_->unpin_page(leaf->get_page_id(), false);
+    delete leaf;
+    key2rids.erase(2);
+    check(ih.get());
+    ix_manager_->close_index(ih.get());
+}
+
+/**
+ * @brief 写操作与重建索引并发：写入线程像执行器一样在表的写latch下插入记录和索引项，重建不会丢失任何写入
+ */
+TEST_F(BPlusTreeBulkLoadTest, ConcurrentReindexTest) {
+    const int num_rows = 20000, num_reindex = 5;
+    sm_->create_table("t", {{"a", TYPE_INT, 4}, {"b", TYPE_INT, 4}}, nullptr);
+    sm_->create_index("t", {"a"}, nullptr);
+    auto &index = *sm_->db_.get_table("t").get_index_meta({"a"});
+    RmFileHandle *fh = sm_->fhs_.at("t").get();
+
+    std::thread writer([&] {
+        for (int key = 0; key < num_rows; key++) {
+            std::shared_lock tab_latch{sm_->get_table_latch("t")};
+            int row[2] = {key, -key};
+            Rid rid = fh->insert_record((char *)row, nullptr);
+            ASSERT_TRUE(sm_->insert_index_entry("t", index, (const char *)&key, rid, nullptr));
+        }
+    });
+    for (int i = 0; i < num_reindex; i++) {
+        sm_->reindex("t", {"a"}, nullptr);
+    }
+    writer.join();
+
+    IxIndexHandle *ih = sm_->get_index_handle("t", std::vector<std::string>{"a"});
+    auto entries = scan_index(ih);
+    ASSERT_EQ(entries.size(), (size_t)num_rows);
+    for (int i = 0; i < num_rows; i++) {
+        EXPECT_EQ(entries[i].first, i);
+    }
+}
+
+/**
+ * @brief 大量删除后重建索引：新索引紧凑且叶子结点在文件中顺序存放，重建前打开的扫描继续读取旧索引
+ */
+TEST_F(BPlusTreeBulkLoadTest, ReindexTest) {
+    const int num_rows = 20000;
+    sm_->create_table("t", {{"a", TYPE_INT, 4}, {"b", TYPE_INT, 4}}, nullptr);
+    sm_->create_index("t", {"a"}, nullptr);
+    auto &index = *sm_->db_.get_table("t").get_index_meta({"a"});
+    RmFileHandle *fh = sm_->fhs_.at("t").get();
+
+    // 随机顺序逐条插入，再删除大部分记录，叶子结点变得稀疏且在文件中无序
+    std::vector<int> keys;
+    for (int i = 0; i < num_rows; i++) keys.push_back(i);
+    std::shuffle(keys.begin(), keys.end(), std::default_random_engine{});
+    std::map<int, Rid> key2rid;
+    for (int key : keys) {
+        int row[2] = {key, -key};
+        Rid rid = fh->insert_record((char *)row, nullptr);
+        sm_->insert_index_entry("t", index, (const char *)&key, rid, nullptr);
+        key2rid[key] = rid;
+    }
+    for (int key : keys) {
+        if (key % 10 == 0) continue;
+        sm_->delete_index_entry("t", index, (const char *)&key, key2rid[key], nullptr);
+        fh->delete_record(key2rid[key], nullptr);
+        key2rid.erase(key);
+    }
+    IxIndexHandle *old_ih = sm_->get_index_handle("t", std::vector<std::string>{"a"});
+    // 删除后空闲的页面不会还给文件，比较文件中分配过的页面数
+    int old_pages = disk_manager_->get_fd2pageno(old_ih->fd_);
+    IxScan old_scan(old_ih, old_ih->leaf_begin(), old_ih->leaf_end(), buffer_pool_manager_.get());
+
+    sm_->reindex("t", {"a"}, nullptr);
+    IxIndexHandle *ih = sm_->get_index_handle("t", std::vector<std::string>{"a"});
+    EXPECT_NE(ih, old_ih);
+    EXPECT_LT(disk_manager_->get_fd2pageno(ih->fd_) * 4, old_pages);
+    auto entries = scan_index(ih);
+    ASSERT_EQ(entries.size(), key2rid.size());
+    auto it = key2rid.begin();
+    for (auto &entry : entries) {
+        EXPECT_EQ(entry.first, it->first);
+        EXPECT_EQ(entry.second, it->second);
+        ++it;
+    }
+    // 叶子结点的页面号递增
+    page_id_t last_leaf = IX_NO_PAGE;
+    for (IxScan scan(ih, ih->leaf_begin(), ih->leaf_end(), buffer_pool_manager_.get()); !scan.is_end(); scan.next()) {
+        EXPECT_GE(scan.iid().page_no, last_leaf);
+        last_leaf = scan.iid().page_no;
+    }
+
+    // 重建之后的修改只写入新索引，旧的扫描仍然读到旧索引中的所有key
+    int key = num_rows;
+    Rid rid = {num_rows, 0};
+    sm_->insert_index_entry("t", index, (const char *)&key, rid, nullptr);
+    std::vector<Rid> result;
+    EXPECT_TRUE(ih->get_value((const char *)&key, &result, nullptr));
+    int cnt = 0;
+    for (; !old_scan.is_end(); old_scan.next()) {
+        int old_key;
+        old_scan.key((char *)&old_key);
+        EXPECT_EQ(old_scan.rid(), key2rid.at(old_key));
+        cnt++;
+    }
+    EXPECT_EQ(cnt, key2rid.size());
+}
+
+/**
+ * @brief 在TPC-C的stock表上建立(s_w_id, s_i_id)索引，比较批量建立和逐条插入的耗时
+ */
+TEST_F(BPlusTreeBulkLoadTest, StockIndexBenchmark) {
+    const int num_warehouses = 5, num_items = 10000;
+    // s_i_id, s_w_id, s_quantity, s_dist_01 char(24), s_ytd, s_order_cnt, s_remote_cnt, s_data char(50)
+    std::vector<ColDef> col_defs = {{"s_i_id", TYPE_INT, 4},      {"s_w_id", TYPE_INT, 4},       {"s_quantity", TYPE_INT, 4},
+                                    {"s_dist_01", TYPE_STRING, 24}, {"s_ytd", TYPE_INT, 4},        {"s_order_cnt", TYPE_INT, 4},
+                                    {"s_remote_cnt", TYPE_INT, 4},  {"s_data", TYPE_STRING, 50}};
+    sm_->create_table("stock", col_defs, nullptr);
+    RmFileHandle *fh = sm_->fhs_.at("stock").get();
+    TabMeta &tab = sm_->db_.get_table("stock");
+    int record_size = tab.cols.back().offset + tab.cols.back().len;
+    std::vector<char> buf(record_size, 'x');
+    for (int w = 1; w <= num_warehouses; w++) {
+        for (int i = 1; i <= num_items; i++) {
+            int ints[3] = {i, w, rand() % 91 + 10};
+            memcpy(buf.data(), ints, sizeof(ints));
+            fh->insert_record(buf.data(), nullptr);
+        }
+    }
+
+    // 先取出所有的(key, rid)，只比较建立索引本身的耗时，两种方式都包括最后把索引页面刷到磁盘
+    std::vector<ColMeta> index_cols = {*tab.get_col("s_w_id"), *tab.get_col("s_i_id")};
+    IndexMeta index = {.tab_name = "stock", .col_tot_len = 8, .col_num = 2, .cols = index_cols};
+    std::vector<std::pair<int64_t, Rid>> entries;
+    for (RmScan scan(fh); !scan.is_end(); scan.next()) {
+        auto rec = fh->get_record(scan.rid(), nullptr);
+        int64_t key;
+        index.get_key(rec->data, (char *)&key);
+        entries.push_back({key, scan.rid()});
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    ix_manager_->create_index("stock_insert", index_cols);
+    auto insert_ih = ix_manager_->open_index("stock_insert", index_cols);
+    for (auto &[key, rid] : entries) {
+        insert_ih->insert_entry((const char *)&key, rid, nullptr);
+    }
+    ix_manager_->close_index(insert_ih.get());
+    auto insert_time = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    ix_manager_->create_index("stock_bulk", index_cols);
+    auto bulk_ih = ix_manager_->open_index("stock_bulk", index_cols);
+    {
+        IxSorter sorter(disk_manager_.get(), "stock_bulk", {TYPE_INT, TYPE_INT}, {4, 4});
+        for (auto &[key, rid] : entries) {
+            sorter.add((const char *)&key, rid);
+        }
+        sorter.sort();
+        bulk_ih->bulk_load(&sorter);
+    }
+    ix_manager_->close_index(bulk_ih.get());
+    auto bulk_time = std::chrono::steady_clock::now() - start;
+
+    // 两棵树中的键值对完全相同
+    insert_ih = ix_manager_->open_index("stock_insert", index_cols);
+    bulk_ih = ix_manager_->open_index("stock_bulk", index_cols);
+    IxScan insert_scan(insert_ih.get(), insert_ih->leaf_begin(), insert_ih->leaf_end(), buffer_pool_manager_.get());
+    IxScan bulk_scan(bulk_ih.get(), bulk_ih->leaf_begin(), bulk_ih->leaf_end(), buffer_pool_manager_.get());
+    int cnt = 0;
+    for (; !bulk_scan.is_end(); bulk_scan.next(), insert_scan.next(), cnt++) {
+        ASSERT_FALSE(insert_scan.is_end());
+        ASSERT_EQ(bulk_scan.rid(), insert_scan.rid());
+    }
+    EXPECT_TRUE(insert_scan.is_end());
+    EXPECT_EQ(cnt, num_warehouses * num_items);
+
+    auto us = [](auto d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+    printf("stock(s_w_id, s_i_id), %d rows: repeated insert %ld us (%d pages), bulk build %ld us (%d pages)\n", cnt,
+           us(insert_time), insert_ih->file_hdr_->num_pages_, us(bulk_time), bulk_ih->file_hdr_->num_pages_);
+    EXPECT_LT(bulk_time, insert_time);
+
+    ix_manager_->close_index(insert_ih.get());
+    ix_manager_->close_index(bulk_ih.get());
+}
@@ -0,0 +1,358 @@
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <random>  // for std::default_random_engine
+#include <tuple>
+
+#include "gtest/gtest.h"
+
+#define private public
+#include "index/ix.h"
+#undef private  // for use private variables in "ix.h"
+
+#include "record/rm.h"
+#include "storage/buffer_pool_manager.h"
+#include "system/sm.h"
+
+const std::string TEST_DB_NAME = "BPlusTreeCompressTest_db";  // 以数据库名作为根目录
+
+// TPC-C中的c_last由编号的三位数字对应的三个音节组成
+const char *SYLLABLES[] = {"BAR", "OUGHT", "ABLE", "PRI", "PRES", "ESE", "ANTI", "CALLY", "ATION", "EING"};
+
+struct CustomerKey {
+    int w_id;
+    int d_id;
+    char last[16];
+};
+
+// 统计B+树的形状
+struct TreeStats {
+    int height = 0;
+    int num_pages = 0;
+    int num_internal = 0;  // 不包括根结点
+    int num_children = 0;
+    int num_leaves = 0;
+    int num_entries = 0;
+};
+
+class BPlusTreeCompressTest : public ::testing::Test {
+   public:
+    std::unique_ptr<DiskManager> disk_manager_;
+    std::unique_ptr<BufferPoolManager> buffer_pool_manager_;
+    std::unique_ptr<IxManager> ix_manager_;
+    std::unique_ptr<RmManager> rm_;
+    std::unique_ptr<SmManager> sm_;
+    // customer(c_w_id, c_d_id, c_last)
+    const std::vector<ColMeta> cols_ = {{"customer", "c_w_id", TYPE_INT, 4, 0, false},
+                                        {"customer", "c_d_id", TYPE_INT, 4, 4, false},
+                                        {"customer", "c_last", TYPE_STRING, 16, 8, false}};
+
+    void SetUp() override {
+        ::testing::Test::SetUp();
+        disk_manager_ = std::make_unique<DiskManager>();
+        buffer_pool_manager_ = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager_.get());
+        ix_manager_ = std::make_unique<IxManager>(disk_manager_.get(), buffer_pool_manager_.get());
+        rm_ = std::make_unique<RmManager>(disk_manager_.get(), buffer_pool_manager_.get());
+        sm_ = std::make_unique<SmManager>(disk_manager_.get(), buffer_pool_manager_.get(), rm_.get(), ix_manager_.get());
+
+        if (disk_manager_->is_dir(TEST_DB_NAME)) {
+            std::string cmd = "rm -rf " + TEST_DB_NAME;
+            if (system(cmd.c_str()) < 0) {
+                throw UnixError();
+            }
+        }
+        sm_->create_db(TEST_DB_NAME);
+        if (chdir(TEST_DB_NAME.c_str()) < 0) {
+            throw UnixError();
+        }
+    }
+
+    void TearDown() override {
+        if (chdir("..") < 0) {
+            throw UnixError();
+        }
+    }
+
+    static CustomerKey make_key(int w_id, int d_id, int name) {
+        CustomerKey key;
+        memset(&key, 0, sizeof(key));
+        key.w_id = w_id;
+        key.d_id = d_id;
+        std::string last = std::string(SYLLABLES[name / 100]) + SYLLABLES[name / 10 % 10] + SYLLABLES[name % 10];
+        memcpy(key.last, last.data(), std::min<size_t>(last.size(), sizeof(key.last)));
+        return key;
+    }
+
+    // 与索引中相同的顺序
+    static std::tuple<int, int, std::string> order_of(const CustomerKey &key) {
+        return {key.w_id, key.d_id, std::string(key.last, sizeof(key.last))};
+    }
+
+    // 创建customer索引，version指定索引文件的格式
+    std::unique_ptr<IxIndexHandle> create_index(const std::string &name, int version) {
+        ix_manager_->create_index(name, cols_);
+        auto ih = ix_manager_->open_index(name, cols_);
+        ih->file_hdr_->version_ = version;
+        ix_init_search(ih->file_hdr_);
+        return ih;
+    }
+
+    /**
+     * @brief 检查子树中的所有key都在[low, high)之中（为空表示没有限制），叶子结点中的key严格递增
+     * 压缩格式中内部结点的key只是子树中key的下界：第i个孩子中的key不小于第i个key，且小于第i+1个key
+     */
+    void check_subtree(IxIndexHandle *ih, page_id_t page_no, page_id_t parent, const std::string &low,
+                       const std::string &high, TreeStats *stats, int depth = 1) {
+        IxNodeHandle *node = ih->fetch_node(page_no);
+        EXPECT_EQ(node->get_parent_page_no(), parent);
+        int key_len = ih->file_hdr_->col_tot_len_;
+        int size = node->get_size();
+        char buf[IX_MAX_COL_LEN];
+        auto key_at = [&](int i) { return std::string(node->get_key(i, buf), key_len); };
+        stats->height = std::max(stats->height, depth);
+        if (node->is_leaf_page()) {
+            stats->num_leaves++;
+            stats->num_entries += size;
+            for (int i = 0; i < size; i++) {
+                std::string key = key_at(i);
+                EXPECT_TRUE(low.empty() || low <= key);
+                EXPECT_TRUE(high.empty() || key < high);
+                if (i > 0) {
+                    EXPECT_LT(key_at(i - 1), key);
+                }
+            }
+        } else {
+            if (depth > 1) {
+                stats->num_internal++;
+                stats->num_children += size;
+            }
+            for (int i = 0; i < size; i++) {
+                std::string child_low = i == 0 ? low : key_at(i);
+                std::string child_high = i + 1 < size ? key_at(i + 1) : high;
+                check_subtree(ih, node->value_at(i), page_no, child_low, child_high, stats, depth + 1);
+            }
+        }
+        buffer_pool_manager_->unpin_page(node->get_page_id(), false);
+        delete node;
+    }
+
+    TreeStats check_tree(IxIndexHandle *ih) {
+        TreeStats stats;
+        check_subtree(ih, ih->file_hdr_->root_page_, IX_NO_PAGE, "", "", &stats);
+        stats.num_pages = ih->file_hdr_->num_pages_;
+        return stats;
+    }
+
+    // 按照叶子结点的顺序读出所有的rid
+    std::vector<Rid> scan_index(IxIndexHandle *ih) {
+        std::vector<Rid> rids;
+        for (IxScan scan(ih, ih->leaf_begin(), ih->leaf_end(), buffer_pool_manager_.get()); !scan.is_end(); scan.next()) {
+            rids.push_back(scan.rid());
+        }
+        return rids;
+    }
+
+    static void print_stats(const char *name, const TreeStats &stats) {
+        printf("%s: height %d, %d pages, %d leaves (%.1f keys/leaf), %d internal nodes (fanout %.1f)\n", name,
+               stats.height, stats.num_pages, stats.num_leaves, (double)stats.num_entries / stats.num_leaves,
+               stats.num_internal, stats.num_internal ? (double)stats.num_children / stats.num_internal : 0.0);
+    }
+};
+
+/**
+ * @brief 组合索引默认使用压缩格式，随机插入和删除后与std::map比较查找结果和树的结构
+ */
+TEST_F(BPlusTreeCompressTest, RandomInsertDeleteTest) {
+    auto ih = create_index("customer", IX_FORMAT_COMPRESSED);
+    ix_manager_->close_index(ih.get());
+    ih = ix_manager_->open_index("customer", cols_);
+    ASSERT_EQ(ih->file_hdr_->version_, IX_FORMAT_COMPRESSED);
+
+    std::vector<CustomerKey> keys;
+    for (int w = 1; w <= 4; w++) {
+        for (int d = 1; d <= 10; d++) {
+            for (int name = 0; name < 1000; name++) {
+                keys.push_back(make_key(w, d, name));
+            }
+        }
+    }
+    std::default_random_engine rng(35);
+    std::shuffle(keys.begin(), keys.end(), rng);
+
+    std::map<std::tuple<int, int, std::string>, Rid> mock;
+    Transaction txn(0);
+    auto insert = [&](const CustomerKey &key, int i) {
+        Rid rid = {i / 100, i % 100};
+        ih->insert_entry((const char *)&key, rid, &txn);
+        mock[order_of(key)] = rid;
+    };
+    auto check_all = [&]() {
+        check_tree(ih.get());
+        // 查找所有可能的key，包括不存在的w_id和d_id
+        for (int w = 0; w <= 5; w++) {
+            for (int d = 0; d <= 11; d += 3) {
+                for (int name = 0; name < 1000; name += 7) {
+                    CustomerKey key = make_key(w, d, name);
+                    std::vector<Rid> result;
+                    auto it = mock.find(order_of(key));
+                    ASSERT_EQ(ih->get_value((const char *)&key, &result, &txn), it != mock.end());
+                    if (it != mock.end()) {
+                        ASSERT_EQ(result[0], it->second);
+                    }
+                    auto lower = mock.lower_bound(order_of(key));
+                    Iid iid = ih->lower_bound((const char *)&key);
+                    if (lower == mock.end()) {
+                        ASSERT_EQ(iid, ih->leaf_end());
+                    } else {
+                        ASSERT_EQ(ih->get_rid(iid), lower->second);
+                    }
+                    auto upper = mock.upper_bound(order_of(key));
+                    iid = ih->upper_bound((const char *)&key);
+                    if (upper == mock.end()) {
+                        ASSERT_EQ(iid, ih->leaf_end());
+                    } else {
+                        ASSERT_EQ(ih->get_rid(iid), upper->second);
+                    }
+                }
+            }
+        }
+        auto rids = scan_index(ih.get());
+        ASSERT_EQ(rids.size(), mock.size());
+        auto it = mock.begin();
+        for (auto &rid : rids) {
+            ASSERT_EQ(rid, it->second);
+            ++it;
+        }
+    };
+
+    for (int i = 0; i < (int)keys.size(); i++) {
+        insert(keys[i], i);
+    }
+    check_all();
+
+    // 删除三分之二，再插回其中一半
+    int num_deleted = keys.size() * 2 / 3;
+    for (int i = 0; i < num_deleted; i++) {
+        ASSERT_TRUE(ih->delete_entry((const char *)&keys[i], &txn));
+        mock.erase(order_of(keys[i]));
+    }
+    check_all();
+    for (int i = 0; i < num_deleted; i += 2) {
+        insert(keys[i], i);
+    }
+    check_all();
+
+    // 全部删除
+    std::shuffle(keys.begin(), keys.end(), rng);
+    for (auto &key : keys) {
+        ASSERT_EQ(ih->delete_entry((const char *)&key, &txn), mock.erase(order_of(key)) == 1);
+    }
+    check_all();
+    EXPECT_TRUE(scan_index(ih.get()).empty());
+    ix_manager_->close_index(ih.get());
+}
+
+/**
+ * @brief 分别用不压缩和压缩的格式建立customer(c_w_id, c_d_id, c_last)索引，比较结点的扇出和树的高度
+ */
+TEST_F(BPlusTreeCompressTest, CustomerFanoutTest) {
+    const int num_warehouses = 10;
+    std::vector<CustomerKey> keys;
+    for (int w = 1; w <= num_warehouses; w++) {
+        for (int d = 1; d <= 10; d++) {
+            for (int name = 0; name < 1000; name++) {
+                keys.push_back(make_key(w, d, name));
+            }
+        }
+    }
+    std::vector<CustomerKey> shuffled = keys;
+    std::shuffle(shuffled.begin(), shuffled.end(), std::default_random_engine(1));
+
+    TreeStats stats[2][2];  // [是否压缩][逐条插入/批量建立]
+    int versions[2] = {IX_FORMAT_NORMALIZED, IX_FORMAT_COMPRESSED};
+    for (int c = 0; c < 2; c++) {
+        std::string name = c ? "compressed" : "normalized";
+        auto ih = create_index(name + "_insert", versions[c]);
+        for (int i = 0; i < (int)shuffled.size(); i++) {
+            ih->insert_entry((const char *)&shuffled[i], Rid{i, 0}, nullptr);
+        }
+        stats[c][0] = check_tree(ih.get());
+        EXPECT_EQ(stats[c][0].num_entries, (int)keys.size());
+        ix_manager_->close_index(ih.get());
+
+        ih = create_index(name + "_bulk", versions[c]);
+        {
+            IxSorter sorter(disk_manager_.get(), name + "_bulk", {TYPE_INT, TYPE_INT, TYPE_STRING}, {4, 4, 16});
+            for (int i = 0; i < (int)keys.size(); i++) {
+                sorter.add((const char *)&keys[i], Rid{i, 0});
+            }
+            sorter.sort();
+            ih->bulk_load(&sorter);
+        }
+        stats[c][1] = check_tree(ih.get());
+        EXPECT_EQ(stats[c][1].num_entries, (int)keys.size());
+        ix_manager_->close_index(ih.get());
+    }
+    print_stats("normalized, repeated insert", stats[0][0]);
+    print_stats("compressed, repeated insert", stats[1][0]);
+    print_stats("normalized, bulk build", stats[0][1]);
+    print_stats("compressed, bulk build", stats[1][1]);
+
+    for (int b = 0; b < 2; b++) {
+        EXPECT_LE(stats[1][b].height, stats[0][b].height);
+        EXPECT_LT(stats[1][b].num_pages, stats[0][b].num_pages);
+        EXPECT_LT(stats[1][b].num_leaves * 5, stats[0][b].num_leaves * 4);
+    }
+    // 逐条插入时内部结点按字节数分裂，截断的分隔key使扇出明显增大
+    auto fanout = [&](const TreeStats &s) { return (double)s.num_children / s.num_internal; };
+    EXPECT_GT(fanout(stats[1][0]), fanout(stats[0][0]) * 1.3);
+}
+
+/**
+ * @brief 在压缩格式的索引上正向和逆向扫描[lower_bound(low), upper_bound(high))，key()还原出插入时的原始key
+ */
+TEST_F(BPlusTreeCompressTest, ReverseRangeScanTest) {
+    auto ih = create_index("customer", IX_FORMAT_COMPRESSED);
+    std::map<std::tuple<int, int, std::string>, Rid> mock;
+    std::vector<CustomerKey> keys;
+    for (int w = 1; w <= 2; w++) {
+        for (int d = 1; d <= 10; d++) {
+            for (int name = 0; name < 1000; name += 3) {
+                keys.push_back(make_key(w, d, name));
+            }
+        }
+    }
+    std::shuffle(keys.begin(), keys.end(), std::default_random_engine(40));
+    for (int i = 0; i < (int)keys.size(); i++) {
+        ih->insert_entry((const char *)&keys[i], Rid{i, 0}, nullptr);
+        mock[order_of(keys[i])] = Rid{i, 0};
+    }
+
+    auto check_range = [&](const CustomerKey &low, const CustomerKey &high) {
+        std::vector<std::string> expected;
+        for (auto it = mock.lower_bound(order_of(low)); it != mock.upper_bound(order_of(high)); ++it) {
+            expected.emplace_back((const char *)&keys[it->second.page_no], sizeof(CustomerKey));
+        }
+        Iid lower = ih->lower_bound((const char *)&low);
+        Iid upper = ih->upper_bound((const char *)&high);
+        for (bool reverse : {false, true}) {
+            std::vector<std::string> scanned;
+            for (IxScan scan(ih.get(), lower, upper, buffer_pool_manager_.get(), reverse); !scan.is_end(); scan.next()) {
+                CustomerKey key;
+                scan.key((char *)&key);
+                ASSERT_EQ(scan.rid(), mock.at(order_of(key)));
+                scanned.emplace_back((const char *)&key, sizeof(key));
+            }
+            if (reverse) {
+                std::reverse(scanned.begin(), scanned.end());
+            }
+            ASSERT_EQ(scanned, expected);
+        }
+    };
+    check_range(make_key(0, 0, 0), make_key(3, 0, 0));      // 全部
+    check_range(make_key(1, 3, 0), make_key(1, 3, 999));    // 一个区
+    check_range(make_key(1, 4, 500), make_key(2, 2, 100));  // 跨越多个叶子结点
+    check_range(make_key(1, 5, 1), make_key(1, 5, 1));      // 范围内没有key
+    check_range(make_key(2, 10, 998), make_key(3, 1, 0));   // 到最后一个叶子结点的末尾
+    ix_manager_->close_index(ih.get());
+}
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <chrono>  // NOLINT
 #include <cstdio>
 #include <functional>
@@ -103,7 +104,7 @@ class BPlusTreeConcurrentTest : public ::testing::Test {
                 << "max_size=" << leaf->get_max_size() << ",min_size=" << leaf->get_min_size() << "</TD></TR>\n";
             out << "<TR>";
             for (int i = 0; i < leaf->get_size(); i++) {
-                out << "<TD>" << *reinterpret_cast<int*>(leaf->get_key(i)) << "</TD>\n";
+                out << "<TD>" << leaf->key_at(i) << "</TD>\n";
             }
             out << "</TR>";
             // Print table end
@@ -462,4 +463,51 @@ TEST_F(BPlusTreeConcurrentTest, MixScaleTest) {
         scan.next();
     }
     EXPECT_EQ(size, keys.size() - delete_keys.size());
-}
\ No newline at end of file
+}
+/**
+ * @brief 不同线程数下并发插入和查找互不相交的key，输出吞吐量
+ *
+ * @note 每一轮使用新的key区间，线程之间只在树的结构上竞争
+ */
+TEST_F(BPlusTreeConcurrentTest, ThroughputScaleTest) {
+    const int64_t scale = 10000;
+    const std::vector<int> thread_nums = {1, 2, 4, 8};
+
+    int64_t base = 0;
+    for (int thread_num : thread_nums) {
+        // 第i个线程负责下标模thread_num余i的key
+        std::vector<std::vector<int64_t>> thread_keys(thread_num);
+        std::vector<int64_t> keys;
+        for (int64_t key = base + 1; key <= base + scale; key++) {
+            keys.push_back(key);
+        }
+        std::shuffle(keys.begin(), keys.end(), std::default_random_engine{});
+        for (size_t i = 0; i < keys.size(); i++) {
+            thread_keys[i % thread_num].push_back(keys[i]);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (int i = 0; i < thread_num; i++) {
+            threads.emplace_back(InsertHelper, ih_.get(), std::cref(thread_keys[i]), i);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        // InsertHelper对每个key做一次插入和一次查找
+        printf("%d threads: %ld inserts + %ld lookups in %ld us, %.0f ops/s\n", thread_num, scale, scale, us,
+               2.0 * scale * 1e6 / std::max<int64_t>(us, 1));
+        base += scale;
+    }
+
+    int64_t current_key = 1;
+    IxScan scan(ih_.get(), ih_->leaf_begin(), ih_->leaf_end(), buffer_pool_manager_.get());
+    while (!scan.is_end()) {
+        auto rid = scan.rid();
+        EXPECT_EQ(rid.slot_no, current_key);
+        current_key++;
+        scan.next();
+    }
+    EXPECT_EQ(current_key, base + 1);
+}
@@ -0,0 +1,185 @@
+#include <algorithm>
+#include <map>
+#include <random>  // for std::default_random_engine
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#define private public
+#include "index/ix.h"
+#undef private  // for use private variables in "ix.h"
+
+#include "storage/buffer_pool_manager.h"
+
+const std::string TEST_DB_NAME = "HashIndexTest_db";  // 以数据库名作为根目录
+
+class HashIndexTest : public ::testing::Test {
+   public:
+    std::unique_ptr<DiskManager> disk_manager_;
+    std::unique_ptr<BufferPoolManager> buffer_pool_manager_;
+    std::unique_ptr<IxManager> ix_manager_;
+    // customer(c_w_id, c_d_id, c_id)
+    const std::vector<ColMeta> cols_ = {{"customer", "c_w_id", TYPE_INT, 4, 0, false},
+                                        {"customer", "c_d_id", TYPE_INT, 4, 4, false},
+                                        {"customer", "c_id", TYPE_INT, 4, 8, false}};
+
+    void SetUp() override {
+        ::testing::Test::SetUp();
+        disk_manager_ = std::make_unique<DiskManager>();
+        buffer_pool_manager_ = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager_.get());
+        ix_manager_ = std::make_unique<IxManager>(disk_manager_.get(), buffer_pool_manager_.get());
+        if (disk_manager_->is_dir(TEST_DB_NAME)) {
+            disk_manager_->destroy_dir(TEST_DB_NAME);
+        }
+        disk_manager_->create_dir(TEST_DB_NAME);
+        if (chdir(TEST_DB_NAME.c_str()) < 0) {
+            throw UnixError();
+        }
+        ix_manager_->create_hash_index("customer", cols_);
+    }
+
+    void TearDown() override {
+        if (chdir("..") < 0) {
+            throw UnixError();
+        }
+    }
+
+    static std::array<int, 3> make_key(int i) { return {i / 30000 + 1, i / 3000 % 10 + 1, i % 3000 + 1}; }
+
+    // 检查目录与桶的局部深度一致：指向同一个桶的目录项个数为2^(global_depth - local_depth)
+    void check_dir(IxHashIndexHandle *ih) {
+        std::map<page_id_t, int> refs;
+        for (auto page_no : ih->dir_) {
+            refs[page_no]++;
+        }
+        EXPECT_EQ((int)refs.size(), ih->get_num_buckets());
+        for (auto &[page_no, cnt] : refs) {
+            Page *page = ih->fetch_bucket(page_no);
+            auto hdr = ih->get_bucket_hdr(page);
+            EXPECT_EQ(cnt, 1 << (ih->get_global_depth() - hdr->local_depth));
+            EXPECT_LE(hdr->num_entries, ih->file_hdr_.bucket_capacity);
+            buffer_pool_manager_->unpin_page(page->get_page_id(), false);
+        }
+        // 目录页面不与桶页面重叠，并且页面中的内容与内存中的目录一致
+        EXPECT_EQ(ih->dir_pages_.size(),
+                  (ih->dir_.size() + IX_HASH_DIR_ENTRIES_PER_PAGE - 1) / IX_HASH_DIR_ENTRIES_PER_PAGE);
+        for (size_t i = 0; i < ih->dir_.size(); i++) {
+            page_id_t dir_page_no = ih->dir_pages_[i / IX_HASH_DIR_ENTRIES_PER_PAGE];
+            EXPECT_EQ(refs.count(dir_page_no), 0);
+            Page *page = ih->fetch_bucket(dir_page_no);
+            ASSERT_EQ(reinterpret_cast<page_id_t *>(page->get_data())[i % IX_HASH_DIR_ENTRIES_PER_PAGE], ih->dir_[i]);
+            buffer_pool_manager_->unpin_page(page->get_page_id(), false);
+        }
+    }
+};
+
+/**
+ * @brief 插入、删除后查找，关闭并重新打开索引后结果不变
+ */
+TEST_F(HashIndexTest, InsertDeleteTest) {
+    const int num_keys = 60000;
+    auto ih = ix_manager_->open_hash_index("customer", cols_);
+    EXPECT_EQ(ih->file_hdr_.bucket_capacity, BUCKET_SIZE);
+    for (int i = 0; i < num_keys; i++) {
+        auto key = make_key(i);
+        EXPECT_NE(ih->insert_entry((const char *)key.data(), Rid{i, 0}, nullptr), IX_NO_PAGE);
+    }
+    // 重复的key不插入
+    auto dup = make_key(7);
+    EXPECT_EQ(ih->insert_entry((const char *)dup.data(), Rid{-1, -1}, nullptr), IX_NO_PAGE);
+    EXPECT_GT(ih->get_global_depth(), 0);
+    check_dir(ih.get());
+
+    for (int i = 0; i < num_keys; i += 2) {
+        auto key = make_key(i);
+        EXPECT_TRUE(ih->delete_entry((const char *)key.data(), nullptr));
+    }
+    auto check = [&](IxHashIndexHandle *ih) {
+        for (int i = 0; i < num_keys; i++) {
+            auto key = make_key(i);
+            std::vector<Rid> result;
+            bool found = ih->get_value((const char *)key.data(), &result, nullptr);
+            ASSERT_EQ(found, i % 2 == 1);
+            if (found) {
+                ASSERT_EQ(result.size(), 1);
+                ASSERT_EQ(result[0], (Rid{i, 0}));
+            }
+        }
+        auto absent = make_key(num_keys + 1);
+        std::vector<Rid> result;
+        EXPECT_FALSE(ih->get_value((const char *)absent.data(), &result, nullptr));
+    };
+    check(ih.get());
+    int global_depth = ih->get_global_depth();
+    int num_buckets = ih->get_num_buckets();
+    ix_manager_->close_hash_index(ih.get());
+
+    ih = ix_manager_->open_hash_index("customer", cols_);
+    EXPECT_EQ(ih->get_global_depth(), global_depth);
+    EXPECT_EQ(ih->get_num_buckets(), num_buckets);
+    check_dir(ih.get());
+    check(ih.get());
+    // 重新打开后继续插入，新的桶和目录页面分配在文件末尾，不覆盖已有的目录页面
+    for (int i = 0; i < num_keys; i += 2) {
+        auto key = make_key(i);
+        EXPECT_NE(ih->insert_entry((const char *)key.data(), Rid{i, 1}, nullptr), IX_NO_PAGE);
+    }
+    check_dir(ih.get());
+    ix_manager_->close_hash_index(ih.get());
+
+    ih = ix_manager_->open_hash_index("customer", cols_);
+    for (int i = 0; i < num_keys; i++) {
+        auto key = make_key(i);
+        std::vector<Rid> result;
+        ASSERT_TRUE(ih->get_value((const char *)key.data(), &result, nullptr));
+        ASSERT_EQ(result[0], (Rid{i, i % 2 == 0 ? 1 : 0}));
+    }
+    ix_manager_->close_hash_index(ih.get());
+}
+
+/**
+ * @brief 多个线程并发插入、查找和删除，插入过程中桶不断分裂
+ */
+TEST_F(HashIndexTest, ConcurrentTest) {
+    const int num_threads = 4;
+    const int keys_per_thread = 20000;
+    auto ih = ix_manager_->open_hash_index("customer", cols_);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t]() {
+            std::vector<int> ids(keys_per_thread);
+            for (int i = 0; i < keys_per_thread; i++) {
+                ids[i] = t + i * num_threads;
+            }
+            std::shuffle(ids.begin(), ids.end(), std::default_random_engine(t));
+            for (int id : ids) {
+                auto key = make_key(id);
+                ih->insert_entry((const char *)key.data(), Rid{id, 0}, nullptr);
+                std::vector<Rid> result;
+                ASSERT_TRUE(ih->get_value((const char *)key.data(), &result, nullptr));
+            }
+            // 删除四分之一
+            for (int i = 0; i < keys_per_thread; i += 4) {
+                auto key = make_key(ids[i]);
+                ASSERT_TRUE(ih->delete_entry((const char *)key.data(), nullptr));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    check_dir(ih.get());
+
+    int num_found = 0;
+    for (int id = 0; id < num_threads * keys_per_thread; id++) {
+        auto key = make_key(id);
+        std::vector<Rid> result;
+        if (ih->get_value((const char *)key.data(), &result, nullptr)) {
+            ASSERT_EQ(result[0], (Rid{id, 0}));
+            num_found++;
+        }
+    }
+    EXPECT_EQ(num_found, num_threads * keys_per_thread * 3 / 4);
+    ix_manager_->close_hash_index(ih.get());
+}
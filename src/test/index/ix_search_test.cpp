@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <random>
+
+#include "gtest/gtest.h"
+#include "index/ix.h"
+
+class IxSearchTest : public ::testing::Test {
+   public:
+    std::default_random_engine rng_{2023};
+
+    static IxFileHdr make_hdr(std::vector<ColType> types, std::vector<int> lens, int version = IX_FORMAT_RAW) {
+        IxFileHdr hdr;
+        hdr.version_ = version;
+        hdr.col_num_ = types.size();
+        hdr.col_types_ = std::move(types);
+        hdr.col_lens_ = std::move(lens);
+        hdr.col_tot_len_ = 0;
+        for (int len : hdr.col_lens_) hdr.col_tot_len_ += len;
+        return hdr;
+    }
+
+    // 生成一个随机的key，值域较小以产生重复的key
+    void rand_key(const IxFileHdr &hdr, char *key) {
+        int offset = 0;
+        for (int i = 0; i < hdr.col_num_; i++) {
+            if (hdr.col_types_[i] == TYPE_INT) {
+                int v = (int)(rng_() % 200) - 100;
+                memcpy(key + offset, &v, sizeof(int));
+            } else if (hdr.col_types_[i] == TYPE_FLOAT) {
+                float v = ((int)(rng_() % 200) - 100) / 4.0f;
+                if (rng_() % 50 == 0) v = -0.0f;
+                memcpy(key + offset, &v, sizeof(float));
+            } else {
+                // 字符串有较长的公共前缀，并包含大于0x7f的字节
+                memset(key + offset, 'p', hdr.col_lens_[i]);
+                for (int j = std::max(0, hdr.col_lens_[i] - 3); j < hdr.col_lens_[i]; j++) {
+                    key[offset + j] = "a\x90z"[rng_() % 3];
+                }
+            }
+            offset += hdr.col_lens_[i];
+        }
+    }
+
+    // 生成n个有序的key
+    std::vector<char> sorted_keys(const IxFileHdr &hdr, int n) {
+        int len = hdr.col_tot_len_;
+        std::vector<std::vector<char>> keys(n, std::vector<char>(len));
+        for (auto &key : keys) rand_key(hdr, key.data());
+        std::sort(keys.begin(), keys.end(), [&](const std::vector<char> &a, const std::vector<char> &b) {
+            return ix_compare(a.data(), b.data(), hdr.col_types_, hdr.col_lens_) < 0;
+        });
+        std::vector<char> data;
+        for (auto &key : keys) data.insert(data.end(), key.begin(), key.end());
+        return data;
+    }
+
+    // 用原始格式的key计算正确结果，查找函数在索引格式的key上查找
+    void check(IxFileHdr hdr, bool enable_simd) {
+        ix_init_search(&hdr, enable_simd);
+        int len = hdr.col_tot_len_;
+        std::vector<char> target(len), encoded_target(len);
+        for (int n = 0; n <= 300; n += 7) {
+            auto keys = sorted_keys(hdr, n);
+            std::vector<char> encoded_keys(keys.size());
+            for (int i = 0; i < n; i++) {
+                ix_encode_key(keys.data() + i * len, encoded_keys.data() + i * len, &hdr);
+            }
+            for (int round = 0; round < 50; round++) {
+                rand_key(hdr, target.data());
+                ix_encode_key(target.data(), encoded_target.data(), &hdr);
+                for (int lo = 0; lo <= std::min(n, 1); lo++) {
+                    int lower = lo, upper = lo;
+                    while (lower < n && ix_compare(keys.data() + lower * len, target.data(), hdr.col_types_, hdr.col_lens_) < 0) lower++;
+                    while (upper < n && ix_compare(keys.data() + upper * len, target.data(), hdr.col_types_, hdr.col_lens_) <= 0) upper++;
+                    ASSERT_EQ(hdr.lower_bound_(encoded_keys.data(), lo, n, encoded_target.data(), &hdr), lower) << "n=" << n;
+                    ASSERT_EQ(hdr.upper_bound_(encoded_keys.data(), lo, n, encoded_target.data(), &hdr), upper) << "n=" << n;
+                }
+            }
+        }
+    }
+};
+
+/**
+ * @brief 各种字段类型对应的查找函数与顺序查找的结果一致
+ */
+TEST_F(IxSearchTest, KernelCorrectnessTest) {
+    for (int version : {IX_FORMAT_RAW, IX_FORMAT_NORMALIZED}) {
+        for (bool enable_simd : {false, true}) {
+            check(make_hdr({TYPE_INT}, {4}, version), enable_simd);
+            check(make_hdr({TYPE_FLOAT}, {4}, version), enable_simd);
+            check(make_hdr({TYPE_STRING}, {20}, version), enable_simd);
+            check(make_hdr({TYPE_STRING, TYPE_STRING}, {5, 7}, version), enable_simd);
+            check(make_hdr({TYPE_INT, TYPE_STRING}, {4, 8}, version), enable_simd);
+            check(make_hdr({TYPE_INT, TYPE_INT}, {4, 4}, version), enable_simd);
+            check(make_hdr({TYPE_FLOAT, TYPE_INT, TYPE_STRING}, {4, 4, 6}, version), enable_simd);
+        }
+    }
+}
+
+/**
+ * @brief 编码后的key用memcmp比较的结果与ix_compare一致，并且可以还原
+ */
+TEST_F(IxSearchTest, KeyEncodingTest) {
+    IxFileHdr hdr = make_hdr({TYPE_INT, TYPE_FLOAT, TYPE_STRING}, {4, 4, 6}, IX_FORMAT_NORMALIZED);
+    int len = hdr.col_tot_len_;
+    std::vector<char> a(len), b(len), ea(len), eb(len), decoded(len);
+    for (int round = 0; round < 100000; round++) {
+        rand_key(hdr, a.data());
+        rand_key(hdr, b.data());
+        // 覆盖int和float的极值
+        if (round % 10 == 0) {
+            int extremes[] = {INT32_MIN, INT32_MAX, -1, 0};
+            memcpy(a.data(), &extremes[round / 10 % 4], sizeof(int));
+        }
+        ix_encode_key(a.data(), ea.data(), &hdr);
+        ix_encode_key(b.data(), eb.data(), &hdr);
+        int expected = ix_compare(a.data(), b.data(), hdr.col_types_, hdr.col_lens_);
+        int actual = memcmp(ea.data(), eb.data(), len);
+        ASSERT_EQ(expected < 0, actual < 0);
+        ASSERT_EQ(expected == 0, actual == 0);
+        ix_decode_key(ea.data(), decoded.data(), &hdr);
+        ASSERT_EQ(ix_compare(decoded.data(), a.data(), hdr.col_types_, hdr.col_lens_), 0);
+    }
+}
+
+/**
+ * @brief 文件头中没有版本号的旧索引文件按照IX_FORMAT_RAW格式读取
+ */
+TEST_F(IxSearchTest, FileHeaderVersionTest) {
+    IxFileHdr hdr(IX_NO_PAGE, IX_INIT_NUM_PAGES, IX_INIT_ROOT_PAGE, 1, 4, 100, 404, IX_INIT_ROOT_PAGE, IX_INIT_ROOT_PAGE);
+    hdr.col_types_ = {TYPE_INT};
+    hdr.col_lens_ = {4};
+    hdr.update_tot_len();
+    std::vector<char> buf(hdr.tot_len_);
+    hdr.serialize(buf.data());
+
+    IxFileHdr new_hdr;
+    new_hdr.deserialize(buf.data());
+    EXPECT_EQ(new_hdr.version_, IX_FORMAT_NORMALIZED);
+
+    // 旧格式的文件头没有最后的版本号，tot_len也相应地少4个字节
+    int old_tot_len = hdr.tot_len_ - sizeof(int);
+    memcpy(buf.data(), &old_tot_len, sizeof(int));
+    IxFileHdr old_hdr;
+    old_hdr.deserialize(buf.data());
+    EXPECT_EQ(old_hdr.version_, IX_FORMAT_RAW);
+    EXPECT_EQ(old_hdr.last_leaf_, IX_INIT_ROOT_PAGE);
+}
+
+/**
+ * @brief 在填满的int结点中查找，比较逐字段调用ix_compare的二分查找和按类型选择的查找函数
+ */
+TEST_F(IxSearchTest, IntNodeSearchBenchmark) {
+    // int key的结点最多有(PAGE_SIZE - sizeof(IxPageHdr)) / (4 + sizeof(Rid)) - 1个key
+    const int n = (PAGE_SIZE - sizeof(IxPageHdr)) / (4 + sizeof(Rid)) - 1;
+    const int num_searches = 1000000;
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; i++) keys[i] = i * 3;
+    std::vector<int> targets(num_searches);
+    for (auto &t : targets) t = rng_() % (n * 3);
+
+    auto run = [&](IxFileHdr &hdr) {
+        long sum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int t : targets) {
+            sum += hdr.lower_bound_((const char *)keys.data(), 0, n, (const char *)&t, &hdr);
+        }
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        return std::make_pair(sum, (double)ns / num_searches);
+    };
+
+    // 组合索引使用的通用查找函数，在单个int字段上即为逐次调用ix_compare的二分查找
+    IxFileHdr generic = make_hdr({TYPE_INT}, {4});
+    ix_init_search(&generic);
+    IxFileHdr pair_hdr = make_hdr({TYPE_INT, TYPE_INT}, {4, 4});
+    ix_init_search(&pair_hdr);
+    generic.lower_bound_ = pair_hdr.lower_bound_;
+    generic.upper_bound_ = pair_hdr.upper_bound_;
+    IxFileHdr scalar = make_hdr({TYPE_INT}, {4});
+    ix_init_search(&scalar, false);
+    IxFileHdr simd = make_hdr({TYPE_INT}, {4});
+    ix_init_search(&simd, true);
+
+    auto [generic_sum, generic_ns] = run(generic);
+    auto [scalar_sum, scalar_ns] = run(scalar);
+    auto [simd_sum, simd_ns] = run(simd);
+    EXPECT_EQ(generic_sum, scalar_sum);
+    EXPECT_EQ(generic_sum, simd_sum);
+    printf("%d int keys per node: ix_compare binary search %.1f ns, branchless %.1f ns, branchless + avx2 %.1f ns\n", n,
+           generic_ns, scalar_ns, simd_ns);
+}
+
+/**
+ * @brief 在填满的组合索引结点中查找，比较原始格式逐字段调用ix_compare和编码后memcmp的耗时
+ */
+TEST_F(IxSearchTest, CompositeNodeSearchBenchmark) {
+    // (c_w_id, c_d_id, c_last char(16))
+    IxFileHdr raw = make_hdr({TYPE_INT, TYPE_INT, TYPE_STRING}, {4, 4, 16}, IX_FORMAT_RAW);
+    IxFileHdr normalized = make_hdr({TYPE_INT, TYPE_INT, TYPE_STRING}, {4, 4, 16}, IX_FORMAT_NORMALIZED);
+    ix_init_search(&raw);
+    ix_init_search(&normalized);
+    int len = raw.col_tot_len_;
+    const int n = (PAGE_SIZE - sizeof(IxPageHdr)) / (len + sizeof(Rid)) - 1;
+    const int num_searches = 1000000;
+
+    auto raw_keys = sorted_keys(raw, n);
+    std::vector<char> encoded_keys(raw_keys.size());
+    for (int i = 0; i < n; i++) {
+        ix_encode_key(raw_keys.data() + i * len, encoded_keys.data() + i * len, &normalized);
+    }
+    std::vector<char> raw_targets((size_t)num_searches * len), encoded_targets((size_t)num_searches * len);
+    for (int i = 0; i < num_searches; i++) {
+        rand_key(raw, raw_targets.data() + (size_t)i * len);
+        ix_encode_key(raw_targets.data() + (size_t)i * len, encoded_targets.data() + (size_t)i * len, &normalized);
+    }
+
+    auto run = [&](IxFileHdr &hdr, std::vector<char> &keys, std::vector<char> &targets) {
+        long sum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < num_searches; i++) {
+            sum += hdr.lower_bound_(keys.data(), 0, n, targets.data() + (size_t)i * len, &hdr);
+        }
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        return std::make_pair(sum, (double)ns / num_searches);
+    };
+    auto [raw_sum, raw_ns] = run(raw, raw_keys, raw_targets);
+    auto [normalized_sum, normalized_ns] = run(normalized, encoded_keys, encoded_targets);
+    EXPECT_EQ(raw_sum, normalized_sum);
+    printf("%d (int, int, char(16)) keys per node: ix_compare %.1f ns, normalized memcmp %.1f ns\n", n, raw_ns,
+           normalized_ns);
+}
@@ -0,0 +1,298 @@
+#undef NDEBUG
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "analyze/analyze.h"
+#include "gtest/gtest.h"
+#include "optimizer/planner.h"
+#include "record/rm.h"
+#include "storage/buffer_pool_manager.h"
+#include "system/sm.h"
+
+const std::string TEST_DB_NAME = "PlannerTest_db";  // 以数据库名作为根目录
+
+/**
+ * @brief 解析select语句并生成查询计划，检查planner选择的扫描方式和连接方式。
+ * 表中的记录都在一个页面内，planner估计的表的记录数为每页的记录数
+ */
+class PlannerTest : public ::testing::Test {
+   public:
+    std::unique_ptr<DiskManager> disk_manager_;
+    std::unique_ptr<BufferPoolManager> buffer_pool_manager_;
+    std::unique_ptr<IxManager> ix_manager_;
+    std::unique_ptr<RmManager> rm_;
+    std::unique_ptr<SmManager> sm_;
+    std::unique_ptr<Analyze> analyze_;
+    std::unique_ptr<Planner> planner_;
+
+    void SetUp() override {
+        ::testing::Test::SetUp();
+        disk_manager_ = std::make_unique<DiskManager>();
+        buffer_pool_manager_ = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager_.get());
+        ix_manager_ = std::make_unique<IxManager>(disk_manager_.get(), buffer_pool_manager_.get());
+        rm_ = std::make_unique<RmManager>(disk_manager_.get(), buffer_pool_manager_.get());
+        sm_ = std::make_unique<SmManager>(disk_manager_.get(), buffer_pool_manager_.get(), rm_.get(), ix_manager_.get());
+        analyze_ = std::make_unique<Analyze>(sm_.get());
+        planner_ = std::make_unique<Planner>(sm_.get());
+
+        if (disk_manager_->is_dir(TEST_DB_NAME)) {
+            std::string cmd = "rm -rf " + TEST_DB_NAME;
+            if (system(cmd.c_str()) < 0) {
+                throw UnixError();
+            }
+        }
+        sm_->create_db(TEST_DB_NAME);
+        if (chdir(TEST_DB_NAME.c_str()) < 0) {
+            throw UnixError();
+        }
+    }
+
+    void TearDown() override {
+        for (auto &fh : sm_->fhs_) {
+            rm_->close_file(fh.second.get());
+        }
+        sm_->fhs_.clear();
+        if (chdir("..") < 0) {
+            throw UnixError();
+        }
+    }
+
+    // 建表并插入num_rows条记录，第i条记录的第j列为value(i, j)，float列保存同样的数值，字符串列保存数值的十进制表示
+    template <typename ValueFn>
+    void create_table(const std::string &tab_name, const std::vector<ColDef> &col_defs, int num_rows,
+                      ValueFn value) {
+        sm_->create_table(tab_name, col_defs, nullptr);
+        auto &tab = sm_->db_.get_table(tab_name);
+        auto fh = sm_->fhs_.at(tab_name).get();
+        std::vector<char> row(tab.cols.back().offset + tab.cols.back().len);
+        for (int i = 0; i < num_rows; i++) {
+            for (size_t j = 0; j < tab.cols.size(); j++) {
+                auto &col = tab.cols[j];
+                int val = value(i, (int)j);
+                if (col.type == TYPE_FLOAT) {
+                    float fval = (float)val;
+                    memcpy(row.data() + col.offset, &fval, sizeof(float));
+                } else if (col.type == TYPE_STRING) {
+                    auto str = std::to_string(val);
+                    memset(row.data() + col.offset, 0, col.len);
+                    memcpy(row.data() + col.offset, str.data(), std::min(str.size(), (size_t)col.len));
+                } else {
+                    memcpy(row.data() + col.offset, &val, sizeof(int));
+                }
+            }
+            fh->insert_record(row.data(), nullptr);
+        }
+    }
+
+    // select语句的查询计划中projection之下的部分
+    std::shared_ptr<Plan> plan(const std::string &sql) {
+        YY_BUFFER_STATE buf = yy_scan_string(sql.c_str());
+        EXPECT_EQ(yyparse(), 0) << sql;
+        yy_delete_buffer(buf);
+        auto query = analyze_->do_analyze(ast::parse_tree);
+        auto root = std::dynamic_pointer_cast<DMLPlan>(planner_->do_planner(query, nullptr));
+        auto projection = std::dynamic_pointer_cast<ProjectionPlan>(root->subplan_);
+        return projection->subplan_;
+    }
+
+    static std::shared_ptr<JoinPlan> as_join(const std::shared_ptr<Plan> &plan) {
+        auto join = std::dynamic_pointer_cast<JoinPlan>(plan);
+        EXPECT_NE(join, nullptr);
+        return join;
+    }
+
+    static std::shared_ptr<ScanPlan> as_scan(const std::shared_ptr<Plan> &plan) {
+        auto scan = std::dynamic_pointer_cast<ScanPlan>(plan);
+        EXPECT_NE(scan, nullptr);
+        return scan;
+    }
+};
+
+/**
+ * @brief 两侧都是按连接列有序的B+树索引扫描时，不打开enable_sortmerge也选择sort merge join，并且不加排序；
+ * 索引扫描不按连接列有序时选择hash join
+ */
+TEST_F(PlannerTest, SortMergeOverIndexScanTest) {
+    auto value = [](int i, int j) { return j == 0 ? i : j == 1 ? i % 3 : i % 7; };
+    create_table("x", {{"id", TYPE_INT, 4}, {"g", TYPE_INT, 4}, {"k", TYPE_INT, 4}}, 40, value);
+    create_table("y", {{"id", TYPE_INT, 4}, {"g", TYPE_INT, 4}, {"k", TYPE_INT, 4}}, 40, value);
+    sm_->create_index("x", {"g", "k"}, nullptr, INDEX_BTREE, false);
+    sm_->create_index("y", {"g", "k"}, nullptr, INDEX_BTREE, false);
+
+    auto join = as_join(plan("select x.id, y.id from x, y where x.k = y.k and x.g = 1 and y.g = 2;"));
+    EXPECT_EQ(join->tag, T_SortMerge);
+    for (auto &child : {join->left_, join->right_}) {
+        auto scan = as_scan(child);
+        EXPECT_EQ(scan->tag, T_IndexScan);
+        EXPECT_FALSE(scan->bitmap_);
+        EXPECT_EQ(scan->index_col_names_, std::vector<std::string>({"g", "k"}));
+    }
+
+    // 索引前缀g上不是等值条件，扫描结果不按k有序
+    join = as_join(plan("select x.id, y.id from x, y where x.k = y.k and x.g > 1 and y.g = 2;"));
+    EXPECT_EQ(join->tag, T_HashJoin);
+}
+
+/**
+ * @brief 打开enable_sortmerge时等值连接都使用sort merge join，没有按连接列有序的一侧加上排序；
+ * 连接列的类型不同时不能作为key，退回nested loop join。三表连接时两个join都是sort merge join
+ */
+TEST_F(PlannerTest, SortMergeKnobTest) {
+    auto value = [](int i, int j) { return j == 0 ? i : i % 5; };
+    create_table("a", {{"id", TYPE_INT, 4}, {"k", TYPE_INT, 4}, {"f", TYPE_FLOAT, 4}}, 30, value);
+    create_table("b", {{"id", TYPE_INT, 4}, {"k", TYPE_INT, 4}, {"f", TYPE_FLOAT, 4}}, 30, value);
+    create_table("c", {{"id", TYPE_INT, 4}, {"k", TYPE_INT, 4}}, 30, value);
+    planner_->set_enable_sortmerge_join(true);
+
+    auto join = as_join(plan("select a.id, b.id from a, b where a.k = b.k;"));
+    EXPECT_EQ(join->tag, T_SortMerge);
+    EXPECT_EQ(join->left_->tag, T_Sort);
+    EXPECT_EQ(join->right_->tag, T_Sort);
+
+    join = as_join(plan("select a.id, b.id from a, b where a.k = b.f;"));
+    EXPECT_EQ(join->tag, T_NestLoop);
+
+    join = as_join(plan("select a.id, b.id, c.id from a, b, c where a.k = b.k and b.id = c.id;"));
+    EXPECT_EQ(join->tag, T_SortMerge);
+    // 第二个join的右侧是第一个join，它的输出按a.k有序，需要按b.id重新排序
+    ASSERT_EQ(join->right_->tag, T_Sort);
+    auto inner_join = as_join(std::dynamic_pointer_cast<SortPlan>(join->right_)->subplan_);
+    EXPECT_EQ(inner_join->tag, T_SortMerge);
+
+    // 关闭之后没有索引的等值连接使用hash join
+    planner_->set_enable_sortmerge_join(false);
+    join = as_join(plan("select a.id, b.id from a, b where a.k = b.k;"));
+    EXPECT_EQ(join->tag, T_HashJoin);
+}
+
+/**
+ * @brief 外表估计的记录数较少、内表在连接列上有B+树索引时选择index nested loop join，内表放在右侧，
+ * 选择前缀最长的索引（内表上的常量等值条件也可以作为key的一部分）；外表估计的记录数较多时选择hash join
+ */
+TEST_F(PlannerTest, IndexJoinTest) {
+    create_table("l", {{"id", TYPE_INT, 4}, {"x", TYPE_INT, 4}, {"t", TYPE_STRING, 6}, {"y", TYPE_FLOAT, 4}}, 60,
+                 [](int i, int j) { return j == 0 ? i : j == 1 ? i % 15 : j == 2 ? i % 8 : i % 5; });
+    create_table("r",
+                 {{"a", TYPE_INT, 4}, {"g", TYPE_INT, 4}, {"s", TYPE_STRING, 6}, {"b", TYPE_FLOAT, 4},
+                  {"rid", TYPE_INT, 4}},
+                 80, [](int i, int j) { return j == 0 ? i % 20 : j == 1 ? i % 3 : j == 2 ? i % 10 : i; });
+    create_table("m", {{"id", TYPE_INT, 4}, {"a", TYPE_INT, 4}, {"pad", TYPE_STRING, 16}}, 12,
+                 [](int i, int j) { return j == 0 ? i * 5 : i % 4; });
+    sm_->create_index("r", {"a"}, nullptr, INDEX_BTREE, false);
+    sm_->create_index("r", {"g", "a"}, nullptr, INDEX_BTREE, false);
+    sm_->create_index("r", {"s"}, nullptr, INDEX_BTREE, false);
+
+    // 检查join是以表r为内表、使用索引index_col_names的index join
+    auto expect_index_join = [&](const std::shared_ptr<Plan> &plan, const std::vector<std::string> &index_col_names) {
+        auto join = as_join(plan);
+        EXPECT_EQ(join->tag, T_IndexJoin);
+        auto inner = as_scan(join->right_);
+        EXPECT_EQ(inner->tab_name_, "r");
+        EXPECT_EQ(inner->index_col_names_, index_col_names);
+        return join;
+    };
+
+    auto join = expect_index_join(plan("select l.id, r.rid from l, r where l.x = r.a and l.t = '3';"), {"a"});
+    EXPECT_EQ(as_scan(join->left_)->tab_name_, "l");
+    expect_index_join(plan("select l.id, r.rid from l, r where l.x = r.a and r.g = 1 and l.t = '5';"), {"g", "a"});
+    expect_index_join(plan("select l.id, r.rid from l, r where l.t = r.s and l.x = 7;"), {"s"});
+    join = expect_index_join(plan("select l.id, r.rid from l, r where l.x = r.a and l.y < r.b and l.t = '2';"),
+                             {"a"});
+    EXPECT_EQ(join->conds_.size(), (size_t)2);
+    // 内表写在前面时交换左右两侧
+    join = expect_index_join(plan("select r.rid, l.id from r, l where r.a = l.x and l.t = '1';"), {"a"});
+    EXPECT_EQ(as_scan(join->left_)->tab_name_, "l");
+    // 三表连接：m和l连接的结果估计的记录数较少，作为外表在r上查找
+    join = expect_index_join(
+        plan("select m.id, l.id, r.rid from m, l, r where m.id = l.id and l.x = r.a and m.a = 2 and l.t = '2';"),
+        {"a"});
+    EXPECT_NE(std::dynamic_pointer_cast<JoinPlan>(join->left_), nullptr);
+
+    // 外表上的范围条件估计选出三分之一的记录，逐条查找索引不如hash join
+    join = as_join(plan("select l.id, r.rid from l, r where l.x = r.a and l.id > 10;"));
+    EXPECT_EQ(join->tag, T_HashJoin);
+    join = as_join(plan("select l.id, r.rid from l, r where l.x = r.a and r.g = 2 and l.id >= 30;"));
+    EXPECT_EQ(join->tag, T_HashJoin);
+}
+
+/**
+ * @brief 索引包含表中所有需要读取的列时只扫描索引（index-only scan），需要读取其他列时扫描索引后读取记录
+ */
+TEST_F(PlannerTest, IndexOnlyScanTest) {
+    create_table("cv", {{"w", TYPE_INT, 4}, {"i", TYPE_INT, 4}, {"q", TYPE_INT, 4}, {"d", TYPE_STRING, 8}}, 200,
+                 [](int n, int j) { return j == 0 ? n % 4 : j == 1 ? n : j == 2 ? n * 37 % 100 : n % 10; });
+    sm_->create_index("cv", {"w", "i"}, nullptr);
+    sm_->create_index("cv", {"w", "i", "q"}, nullptr, INDEX_BTREE, false);
+
+    // 检查单表查询的扫描方式，index_col_names为空时为顺序扫描
+    auto expect_scan = [&](const std::string &sql, const std::vector<std::string> &index_col_names, bool index_only) {
+        auto scan = as_scan(plan(sql));
+        EXPECT_EQ(scan->tag, index_col_names.empty() ? T_SeqScan : T_IndexScan) << sql;
+        EXPECT_EQ(scan->index_col_names_, index_col_names) << sql;
+        EXPECT_EQ(scan->index_only_, index_only) << sql;
+    };
+    expect_scan("select q from cv where w = 1 and i = 5;", {"w", "i", "q"}, true);
+    expect_scan("select i, q from cv where w = 2;", {"w", "i", "q"}, true);
+    expect_scan("select i from cv where w = 1 and q > 55;", {"w", "i", "q"}, true);
+    // 条件中的列也需要包含在索引中
+    expect_scan("select i from cv where w = 1 and d = 'd3';", {"w", "i"}, false);
+    expect_scan("select * from cv where w = 1 and i = 5;", {"w", "i"}, false);
+    expect_scan("select d, i from cv where w = 2 and i > 150;", {"w", "i"}, false);
+    // 没有条件能缩小扫描范围时不使用索引
+    expect_scan("select i, q from cv where q > 10;", {}, false);
+}
+
+/**
+ * @brief 复合索引匹配等值前缀加上之后一个字段上的范围条件，只有第一个字段上的范围条件时也可以使用索引；
+ * 第一个字段上没有条件时不能使用索引。匹配字段较多的索引优先
+ */
+TEST_F(PlannerTest, IndexRangeMatchTest) {
+    create_table("rg", {{"a", TYPE_INT, 4}, {"b", TYPE_INT, 4}, {"c", TYPE_FLOAT, 4}, {"d", TYPE_STRING, 4}}, 60,
+                 [](int i, int j) { return j == 0 ? i / 12 : j == 1 ? i % 12 - 2 : j == 2 ? i : i % 3; });
+    sm_->create_index("rg", {"a", "b", "c"}, nullptr);
+    sm_->create_index("rg", {"d"}, nullptr, INDEX_BTREE, false);
+
+    auto expect_scan = [&](const std::string &sql, const std::vector<std::string> &index_col_names) {
+        auto scan = as_scan(plan(sql));
+        EXPECT_EQ(scan->tag, index_col_names.empty() ? T_SeqScan : T_IndexScan) << sql;
+        EXPECT_EQ(scan->index_col_names_, index_col_names) << sql;
+    };
+    std::vector<std::string> abc = {"a", "b", "c"};
+    expect_scan("select * from rg where a = 1 and b > 2;", abc);
+    expect_scan("select * from rg where a = 1 and b >= 3 and b <= 3;", abc);
+    expect_scan("select * from rg where a = 1 and b > 5 and b < 5;", abc);
+    expect_scan("select * from rg where a = 2 and b = 3 and c >= 6.5;", abc);
+    expect_scan("select * from rg where a > 3;", abc);
+    // (a, b)上的等值前缀加范围条件比d上的等值条件匹配的字段多
+    expect_scan("select * from rg where a = 2 and b < 4 and d = '1';", abc);
+    expect_scan("select * from rg where b > 2 and d = '1';", {"d"});
+    expect_scan("select * from rg where b > 2 and c < 4.0;", {});
+}
+
+/**
+ * @brief 估计匹配的记录较多的索引扫描使用bitmap heap scan；匹配较少、只扫描索引、
+ * 或者需要按索引顺序输出（order by）时不使用
+ */
+TEST_F(PlannerTest, BitmapScanTest) {
+    create_table("bm", {{"a", TYPE_INT, 4}, {"b", TYPE_INT, 4}, {"c", TYPE_STRING, 8}}, 2000,
+                 [](int i, int j) { return j == 0 ? i % 10 : j == 1 ? i * 7919 % 2000 : i % 50; });
+    sm_->create_index("bm", {"a", "b"}, nullptr, INDEX_BTREE, false);
+
+    auto expect_bitmap = [&](const std::string &sql, bool bitmap) {
+        auto scan = as_scan(plan(sql));
+        EXPECT_EQ(scan->tag, T_IndexScan) << sql;
+        EXPECT_EQ(scan->bitmap_, bitmap) << sql;
+    };
+    expect_bitmap("select * from bm where a = 3;", true);
+    expect_bitmap("select * from bm where a = 3 and b < 700;", true);
+    expect_bitmap("select * from bm where a > 8 and c = '9';", true);
+    expect_bitmap("select * from bm where a >= 0 and a <= 1 and b < 120;", true);
+    expect_bitmap("select * from bm where a = 3 and b = 700;", false);
+    expect_bitmap("select b from bm where a = 3;", false);
+
+    // 按索引顺序扫描即可按b排序，不加排序
+    expect_bitmap("select * from bm where a = 3 order by b;", false);
+}
@@ -0,0 +1,125 @@
+-- Lab3-查询执行 测试点10：复合索引上的等值前缀与范围条件（开区间和闭区间、空范围、只匹配前缀、字符串和浮点数字段）
+create table rg (a int, b int, c float, d char(4));
+create table rs (s char(4), v int, id int);
+insert into rg values (0, -2, -3.0, 'bb');
+insert into rg values (0, -1, -1.5, 'cc');
+insert into rg values (0, 0, 0.0, 'aa');
+insert into rg values (0, 1, 1.5, 'bb');
+insert into rg values (0, 2, 3.0, 'cc');
+insert into rg values (0, 3, 4.5, 'aa');
+insert into rg values (0, 4, 6.0, 'bb');
+insert into rg values (0, 5, 7.5, 'cc');
+insert into rg values (0, 6, 9.0, 'aa');
+insert into rg values (0, 7, 10.5, 'bb');
+insert into rg values (0, 8, 12.0, 'cc');
+insert into rg values (0, 9, 13.5, 'aa');
+insert into rg values (1, -2, -2.0, 'cc');
+insert into rg values (1, -1, -0.5, 'aa');
+insert into rg values (1, 0, 1.0, 'bb');
+insert into rg values (1, 1, 2.5, 'cc');
+insert into rg values (1, 2, 4.0, 'aa');
+insert into rg values (1, 3, 5.5, 'bb');
+insert into rg values (1, 4, 7.0, 'cc');
+insert into rg values (1, 5, 8.5, 'aa');
+insert into rg values (1, 6, 10.0, 'bb');
+insert into rg values (1, 7, 11.5, 'cc');
+insert into rg values (1, 8, 13.0, 'aa');
+insert into rg values (1, 9, 14.5, 'bb');
+insert into rg values (2, -2, -1.0, 'aa');
+insert into rg values (2, -1, 0.5, 'bb');
+insert into rg values (2, 0, 2.0, 'cc');
+insert into rg values (2, 1, 3.5, 'aa');
+insert into rg values (2, 2, 5.0, 'bb');
+insert into rg values (2, 3, 6.5, 'cc');
+insert into rg values (2, 4, 8.0, 'aa');
+insert into rg values (2, 5, 9.5, 'bb');
+insert into rg values (2, 6, 11.0, 'cc');
+insert into rg values (2, 7, 12.5, 'aa');
+insert into rg values (2, 8, 14.0, 'bb');
+insert into rg values (2, 9, 15.5, 'cc');
+insert into rg values (3, -2, 0.0, 'bb');
+insert into rg values (3, -1, 1.5, 'cc');
+insert into rg values (3, 0, 3.0, 'aa');
+insert into rg values (3, 1, 4.5, 'bb');
+insert into rg values (3, 2, 6.0, 'cc');
+insert into rg values (3, 3, 7.5, 'aa');
+insert into rg values (3, 4, 9.0, 'bb');
+insert into rg values (3, 5, 10.5, 'cc');
+insert into rg values (3, 6, 12.0, 'aa');
+insert into rg values (3, 7, 13.5, 'bb');
+insert into rg values (3, 8, 15.0, 'cc');
+insert into rg values (3, 9, 16.5, 'aa');
+insert into rg values (4, -2, 1.0, 'cc');
+insert into rg values (4, -1, 2.5, 'aa');
+insert into rg values (4, 0, 4.0, 'bb');
+insert into rg values (4, 1, 5.5, 'cc');
+insert into rg values (4, 2, 7.0, 'aa');
+insert into rg values (4, 3, 8.5, 'bb');
+insert into rg values (4, 4, 10.0, 'cc');
+insert into rg values (4, 5, 11.5, 'aa');
+insert into rg values (4, 6, 13.0, 'bb');
+insert into rg values (4, 7, 14.5, 'cc');
+insert into rg values (4, 8, 16.0, 'aa');
+insert into rg values (4, 9, 17.5, 'bb');
+insert into rs values ('aa', 0, 0);
+insert into rs values ('bb', 1, 1);
+insert into rs values ('bc', 2, 2);
+insert into rs values ('cd', 3, 3);
+insert into rs values ('aa', 4, 4);
+insert into rs values ('bb', 5, 5);
+insert into rs values ('bc', 6, 6);
+insert into rs values ('cd', 0, 7);
+insert into rs values ('aa', 1, 8);
+insert into rs values ('bb', 2, 9);
+insert into rs values ('bc', 3, 10);
+insert into rs values ('cd', 4, 11);
+insert into rs values ('aa', 5, 12);
+insert into rs values ('bb', 6, 13);
+insert into rs values ('bc', 0, 14);
+insert into rs values ('cd', 1, 15);
+insert into rs values ('aa', 2, 16);
+insert into rs values ('bb', 3, 17);
+insert into rs values ('bc', 4, 18);
+insert into rs values ('cd', 5, 19);
+insert into rs values ('aa', 6, 20);
+insert into rs values ('bb', 0, 21);
+insert into rs values ('bc', 1, 22);
+insert into rs values ('cd', 2, 23);
+insert into rs values ('aa', 3, 24);
+insert into rs values ('bb', 4, 25);
+insert into rs values ('bc', 5, 26);
+insert into rs values ('cd', 6, 27);
+insert into rs values ('aa', 0, 28);
+insert into rs values ('bb', 1, 29);
+create index rg(a, b, c);
+create nonunique index rs(s, v);
+select * from rg where a = 1 and b > 2;
+select * from rg where a = 1 and b >= 2;
+select * from rg where a = 1 and b < 4;
+select * from rg where a = 1 and b <= 4;
+select * from rg where a = 1 and b > 2 and b <= 6;
+select * from rg where a = 1 and b >= 3 and b <= 3;
+select * from rg where a = 4 and b < 0;
+select * from rg where a = 1 and b > 5 and b < 5;
+select * from rg where a = 1 and b > 100;
+select * from rg where a = 100;
+select * from rg where a = 2;
+select * from rg where a > 3;
+select * from rg where a >= 3 and a < 4;
+select * from rg where a <= 0 and d = 'bb';
+select * from rg where a = 2 and b = 3 and c > 4.0;
+select * from rg where a = 2 and b = 3 and c >= 6.5;
+select * from rg where a = 2 and b = 3 and c < 6.5;
+select * from rg where a = 2 and b = 3 and c < 0.0;
+select * from rg where a = 1 and b > 1 and b > 3;
+select * from rg where a = 1 and b < 8 and b <= 5;
+select a, b from rg where a = 3 and b >= 7;
+select * from rs where s = 'bb' and v > 3;
+select * from rs where s = 'bb' and v <= 3;
+select * from rs where s > 'bb';
+select * from rs where s >= 'bb' and s < 'bd';
+select * from rs where s = 'zz';
+delete from rg where a = 1 and b < 3;
+update rg set d = 'zz' where a = 2 and b >= 5;
+select * from rg where a = 1 and b <= 4;
+select * from rg where a = 2 and b > 3;
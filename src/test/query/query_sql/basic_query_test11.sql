@@ -0,0 +1,4028 @@
+-- Lab3-查询执行 测试点11：bitmap heap scan（索引匹配的记录较多时按页面顺序读取记录，结果与没有索引的同样的表上的顺序扫描相同）
+create table bm (a int, b int, c char(8));
+create table bm_seq (a int, b int, c char(8));
+insert into bm values (0, 0, 'v0');
+insert into bm values (1, 1919, 'v1');
+insert into bm values (2, 1838, 'v2');
+insert into bm values (3, 1757, 'v3');
+insert into bm values (4, 1676, 'v4');
+insert into bm values (5, 1595, 'v5');
+insert into bm values (6, 1514, 'v6');
+insert into bm values (7, 1433, 'v7');
+insert into bm values (8, 1352, 'v8');
+insert into bm values (9, 1271, 'v9');
+insert into bm values (0, 1190, 'v10');
+insert into bm values (1, 1109, 'v11');
+insert into bm values (2, 1028, 'v12');
+insert into bm values (3, 947, 'v13');
+insert into bm values (4, 866, 'v14');
+insert into bm values (5, 785, 'v15');
+insert into bm values (6, 704, 'v16');
+insert into bm values (7, 623, 'v17');
+insert into bm values (8, 542, 'v18');
+insert into bm values (9, 461, 'v19');
+insert into bm values (0, 380, 'v20');
+insert into bm values (1, 299, 'v21');
+insert into bm values (2, 218, 'v22');
+insert into bm values (3, 137, 'v23');
+insert into bm values (4, 56, 'v24');
+insert into bm values (5, 1975, 'v25');
+insert into bm values (6, 1894, 'v26');
+insert into bm values (7, 1813, 'v27');
+insert into bm values (8, 1732, 'v28');
+insert into bm values (9, 1651, 'v29');
+insert into bm values (0, 1570, 'v30');
+insert into bm values (1, 1489, 'v31');
+insert into bm values (2, 1408, 'v32');
+insert into bm values (3, 1327, 'v33');
+insert into bm values (4, 1246, 'v34');
+insert into bm values (5, 1165, 'v35');
+insert into bm values (6, 1084, 'v36');
+insert into bm values (7, 1003, 'v37');
+insert into bm values (8, 922, 'v38');
+insert into bm values (9, 841, 'v39');
+insert into bm values (0, 760, 'v40');
+insert into bm values (1, 679, 'v41');
+insert into bm values (2, 598, 'v42');
+insert into bm values (3, 517, 'v43');
+insert into bm values (4, 436, 'v44');
+insert into bm values (5, 355, 'v45');
+insert into bm values (6, 274, 'v46');
+insert into bm values (7, 193, 'v47');
+insert into bm values (8, 112, 'v48');
+insert into bm values (9, 31, 'v49');
+insert into bm values (0, 1950, 'v0');
+insert into bm values (1, 1869, 'v1');
+insert into bm values (2, 1788, 'v2');
+insert into bm values (3, 1707, 'v3');
+insert into bm values (4, 1626, 'v4');
+insert into bm values (5, 1545, 'v5');
+insert into bm values (6, 1464, 'v6');
+insert into bm values (7, 1383, 'v7');
+insert into bm values (8, 1302, 'v8');
+insert into bm values (9, 1221, 'v9');
+insert into bm values (0, 1140, 'v10');
+insert into bm values (1, 1059, 'v11');
+insert into bm values (2, 978, 'v12');
+insert into bm values (3, 897, 'v13');
+insert into bm values (4, 816, 'v14');
+insert into bm values (5, 735, 'v15');
+insert into bm values (6, 654, 'v16');
+insert into bm values (7, 573, 'v17');
+insert into bm values (8, 492, 'v18');
+insert into bm values (9, 411, 'v19');
+insert into bm values (0, 330, 'v20');
+insert into bm values (1, 249, 'v21');
+insert into bm values (2, 168, 'v22');
+insert into bm values (3, 87, 'v23');
+insert into bm values (4, 6, 'v24');
+insert into bm values (5, 1925, 'v25');
+insert into bm values (6, 1844, 'v26');
+insert into bm values (7, 1763, 'v27');
+insert into bm values (8, 1682, 'v28');
+insert into bm values (9, 1601, 'v29');
+insert into bm values (0, 1520, 'v30');
+insert into bm values (1, 1439, 'v31');
+insert into bm values (2, 1358, 'v32');
+insert into bm values (3, 1277, 'v33');
+insert into bm values (4, 1196, 'v34');
+insert into bm values (5, 1115, 'v35');
+insert into bm values (6, 1034, 'v36');
+insert into bm values (7, 953, 'v37');
+insert into bm values (8, 872, 'v38');
+insert into bm values (9, 791, 'v39');
+insert into bm values (0, 710, 'v40');
+insert into bm values (1, 629, 'v41');
+insert into bm values (2, 548, 'v42');
+insert into bm values (3, 467, 'v43');
+insert into bm values (4, 386, 'v44');
+insert into bm values (5, 305, 'v45');
+insert into bm values (6, 224, 'v46');
+insert into bm values (7, 143, 'v47');
+insert into bm values (8, 62, 'v48');
+insert into bm values (9, 1981, 'v49');
+insert into bm values (0, 1900, 'v0');
+insert into bm values (1, 1819, 'v1');
+insert into bm values (2, 1738, 'v2');
+insert into bm values (3, 1657, 'v3');
+insert into bm values (4, 1576, 'v4');
+insert into bm values (5, 1495, 'v5');
+insert into bm values (6, 1414, 'v6');
+insert into bm values (7, 1333, 'v7');
+insert into bm values (8, 1252, 'v8');
+insert into bm values (9, 1171, 'v9');
+insert into bm values (0, 1090, 'v10');
+insert into bm values (1, 1009, 'v11');
+insert into bm values (2, 928, 'v12');
+insert into bm values (3, 847, 'v13');
+insert into bm values (4, 766, 'v14');
+insert into bm values (5, 685, 'v15');
+insert into bm values (6, 604, 'v16');
+insert into bm values (7, 523, 'v17');
+insert into bm values (8, 442, 'v18');
+insert into bm values (9, 361, 'v19');
+insert into bm values (0, 280, 'v20');
+insert into bm values (1, 199, 'v21');
+insert into bm values (2, 118, 'v22');
+insert into bm values (3, 37, 'v23');
+insert into bm values (4, 1956, 'v24');
+insert into bm values (5, 1875, 'v25');
+insert into bm values (6, 1794, 'v26');
+insert into bm values (7, 1713, 'v27');
+insert into bm values (8, 1632, 'v28');
+insert into bm values (9, 1551, 'v29');
+insert into bm values (0, 1470, 'v30');
+insert into bm values (1, 1389, 'v31');
+insert into bm values (2, 1308, 'v32');
+insert into bm values (3, 1227, 'v33');
+insert into bm values (4, 1146, 'v34');
+insert into bm values (5, 1065, 'v35');
+insert into bm values (6, 984, 'v36');
+insert into bm values (7, 903, 'v37');
+insert into bm values (8, 822, 'v38');
+insert into bm values (9, 741, 'v39');
+insert into bm values (0, 660, 'v40');
+insert into bm values (1, 579, 'v41');
+insert into bm values (2, 498, 'v42');
+insert into bm values (3, 417, 'v43');
+insert into bm values (4, 336, 'v44');
+insert into bm values (5, 255, 'v45');
+insert into bm values (6, 174, 'v46');
+insert into bm values (7, 93, 'v47');
+insert into bm values (8, 12, 'v48');
+insert into bm values (9, 1931, 'v49');
+insert into bm values (0, 1850, 'v0');
+insert into bm values (1, 1769, 'v1');
+insert into bm values (2, 1688, 'v2');
+insert into bm values (3, 1607, 'v3');
+insert into bm values (4, 1526, 'v4');
+insert into bm values (5, 1445, 'v5');
+insert into bm values (6, 1364, 'v6');
+insert into bm values (7, 1283, 'v7');
+insert into bm values (8, 1202, 'v8');
+insert into bm values (9, 1121, 'v9');
+insert into bm values (0, 1040, 'v10');
+insert into bm values (1, 959, 'v11');
+insert into bm values (2, 878, 'v12');
+insert into bm values (3, 797, 'v13');
+insert into bm values (4, 716, 'v14');
+insert into bm values (5, 635, 'v15');
+insert into bm values (6, 554, 'v16');
+insert into bm values (7, 473, 'v17');
+insert into bm values (8, 392, 'v18');
+insert into bm values (9, 311, 'v19');
+insert into bm values (0, 230, 'v20');
+insert into bm values (1, 149, 'v21');
+insert into bm values (2, 68, 'v22');
+insert into bm values (3, 1987, 'v23');
+insert into bm values (4, 1906, 'v24');
+insert into bm values (5, 1825, 'v25');
+insert into bm values (6, 1744, 'v26');
+insert into bm values (7, 1663, 'v27');
+insert into bm values (8, 1582, 'v28');
+insert into bm values (9, 1501, 'v29');
+insert into bm values (0, 1420, 'v30');
+insert into bm values (1, 1339, 'v31');
+insert into bm values (2, 1258, 'v32');
+insert into bm values (3, 1177, 'v33');
+insert into bm values (4, 1096, 'v34');
+insert into bm values (5, 1015, 'v35');
+insert into bm values (6, 934, 'v36');
+insert into bm values (7, 853, 'v37');
+insert into bm values (8, 772, 'v38');
+insert into bm values (9, 691, 'v39');
+insert into bm values (0, 610, 'v40');
+insert into bm values (1, 529, 'v41');
+insert into bm values (2, 448, 'v42');
+insert into bm values (3, 367, 'v43');
+insert into bm values (4, 286, 'v44');
+insert into bm values (5, 205, 'v45');
+insert into bm values (6, 124, 'v46');
+insert into bm values (7, 43, 'v47');
+insert into bm values (8, 1962, 'v48');
+insert into bm values (9, 1881, 'v49');
+insert into bm values (0, 1800, 'v0');
+insert into bm values (1, 1719, 'v1');
+insert into bm values (2, 1638, 'v2');
+insert into bm values (3, 1557, 'v3');
+insert into bm values (4, 1476, 'v4');
+insert into bm values (5, 1395, 'v5');
+insert into bm values (6, 1314, 'v6');
+insert into bm values (7, 1233, 'v7');
+insert into bm values (8, 1152, 'v8');
+insert into bm values (9, 1071, 'v9');
+insert into bm values (0, 990, 'v10');
+insert into bm values (1, 909, 'v11');
+insert into bm values (2, 828, 'v12');
+insert into bm values (3, 747, 'v13');
+insert into bm values (4, 666, 'v14');
+insert into bm values (5, 585, 'v15');
+insert into bm values (6, 504, 'v16');
+insert into bm values (7, 423, 'v17');
+insert into bm values (8, 342, 'v18');
+insert into bm values (9, 261, 'v19');
+insert into bm values (0, 180, 'v20');
+insert into bm values (1, 99, 'v21');
+insert into bm values (2, 18, 'v22');
+insert into bm values (3, 1937, 'v23');
+insert into bm values (4, 1856, 'v24');
+insert into bm values (5, 1775, 'v25');
+insert into bm values (6, 1694, 'v26');
+insert into bm values (7, 1613, 'v27');
+insert into bm values (8, 1532, 'v28');
+insert into bm values (9, 1451, 'v29');
+insert into bm values (0, 1370, 'v30');
+insert into bm values (1, 1289, 'v31');
+insert into bm values (2, 1208, 'v32');
+insert into bm values (3, 1127, 'v33');
+insert into bm values (4, 1046, 'v34');
+insert into bm values (5, 965, 'v35');
+insert into bm values (6, 884, 'v36');
+insert into bm values (7, 803, 'v37');
+insert into bm values (8, 722, 'v38');
+insert into bm values (9, 641, 'v39');
+insert into bm values (0, 560, 'v40');
+insert into bm values (1, 479, 'v41');
+insert into bm values (2, 398, 'v42');
+insert into bm values (3, 317, 'v43');
+insert into bm values (4, 236, 'v44');
+insert into bm values (5, 155, 'v45');
+insert into bm values (6, 74, 'v46');
+insert into bm values (7, 1993, 'v47');
+insert into bm values (8, 1912, 'v48');
+insert into bm values (9, 1831, 'v49');
+insert into bm values (0, 1750, 'v0');
+insert into bm values (1, 1669, 'v1');
+insert into bm values (2, 1588, 'v2');
+insert into bm values (3, 1507, 'v3');
+insert into bm values (4, 1426, 'v4');
+insert into bm values (5, 1345, 'v5');
+insert into bm values (6, 1264, 'v6');
+insert into bm values (7, 1183, 'v7');
+insert into bm values (8, 1102, 'v8');
+insert into bm values (9, 1021, 'v9');
+insert into bm values (0, 940, 'v10');
+insert into bm values (1, 859, 'v11');
+insert into bm values (2, 778, 'v12');
+insert into bm values (3, 697, 'v13');
+insert into bm values (4, 616, 'v14');
+insert into bm values (5, 535, 'v15');
+insert into bm values (6, 454, 'v16');
+insert into bm values (7, 373, 'v17');
+insert into bm values (8, 292, 'v18');
+insert into bm values (9, 211, 'v19');
+insert into bm values (0, 130, 'v20');
+insert into bm values (1, 49, 'v21');
+insert into bm values (2, 1968, 'v22');
+insert into bm values (3, 1887, 'v23');
+insert into bm values (4, 1806, 'v24');
+insert into bm values (5, 1725, 'v25');
+insert into bm values (6, 1644, 'v26');
+insert into bm values (7, 1563, 'v27');
+insert into bm values (8, 1482, 'v28');
+insert into bm values (9, 1401, 'v29');
+insert into bm values (0, 1320, 'v30');
+insert into bm values (1, 1239, 'v31');
+insert into bm values (2, 1158, 'v32');
+insert into bm values (3, 1077, 'v33');
+insert into bm values (4, 996, 'v34');
+insert into bm values (5, 915, 'v35');
+insert into bm values (6, 834, 'v36');
+insert into bm values (7, 753, 'v37');
+insert into bm values (8, 672, 'v38');
+insert into bm values (9, 591, 'v39');
+insert into bm values (0, 510, 'v40');
+insert into bm values (1, 429, 'v41');
+insert into bm values (2, 348, 'v42');
+insert into bm values (3, 267, 'v43');
+insert into bm values (4, 186, 'v44');
+insert into bm values (5, 105, 'v45');
+insert into bm values (6, 24, 'v46');
+insert into bm values (7, 1943, 'v47');
+insert into bm values (8, 1862, 'v48');
+insert into bm values (9, 1781, 'v49');
+insert into bm values (0, 1700, 'v0');
+insert into bm values (1, 1619, 'v1');
+insert into bm values (2, 1538, 'v2');
+insert into bm values (3, 1457, 'v3');
+insert into bm values (4, 1376, 'v4');
+insert into bm values (5, 1295, 'v5');
+insert into bm values (6, 1214, 'v6');
+insert into bm values (7, 1133, 'v7');
+insert into bm values (8, 1052, 'v8');
+insert into bm values (9, 971, 'v9');
+insert into bm values (0, 890, 'v10');
+insert into bm values (1, 809, 'v11');
+insert into bm values (2, 728, 'v12');
+insert into bm values (3, 647, 'v13');
+insert into bm values (4, 566, 'v14');
+insert into bm values (5, 485, 'v15');
+insert into bm values (6, 404, 'v16');
+insert into bm values (7, 323, 'v17');
+insert into bm values (8, 242, 'v18');
+insert into bm values (9, 161, 'v19');
+insert into bm values (0, 80, 'v20');
+insert into bm values (1, 1999, 'v21');
+insert into bm values (2, 1918, 'v22');
+insert into bm values (3, 1837, 'v23');
+insert into bm values (4, 1756, 'v24');
+insert into bm values (5, 1675, 'v25');
+insert into bm values (6, 1594, 'v26');
+insert into bm values (7, 1513, 'v27');
+insert into bm values (8, 1432, 'v28');
+insert into bm values (9, 1351, 'v29');
+insert into bm values (0, 1270, 'v30');
+insert into bm values (1, 1189, 'v31');
+insert into bm values (2, 1108, 'v32');
+insert into bm values (3, 1027, 'v33');
+insert into bm values (4, 946, 'v34');
+insert into bm values (5, 865, 'v35');
+insert into bm values (6, 784, 'v36');
+insert into bm values (7, 703, 'v37');
+insert into bm values (8, 622, 'v38');
+insert into bm values (9, 541, 'v39');
+insert into bm values (0, 460, 'v40');
+insert into bm values (1, 379, 'v41');
+insert into bm values (2, 298, 'v42');
+insert into bm values (3, 217, 'v43');
+insert into bm values (4, 136, 'v44');
+insert into bm values (5, 55, 'v45');
+insert into bm values (6, 1974, 'v46');
+insert into bm values (7, 1893, 'v47');
+insert into bm values (8, 1812, 'v48');
+insert into bm values (9, 1731, 'v49');
+insert into bm values (0, 1650, 'v0');
+insert into bm values (1, 1569, 'v1');
+insert into bm values (2, 1488, 'v2');
+insert into bm values (3, 1407, 'v3');
+insert into bm values (4, 1326, 'v4');
+insert into bm values (5, 1245, 'v5');
+insert into bm values (6, 1164, 'v6');
+insert into bm values (7, 1083, 'v7');
+insert into bm values (8, 1002, 'v8');
+insert into bm values (9, 921, 'v9');
+insert into bm values (0, 840, 'v10');
+insert into bm values (1, 759, 'v11');
+insert into bm values (2, 678, 'v12');
+insert into bm values (3, 597, 'v13');
+insert into bm values (4, 516, 'v14');
+insert into bm values (5, 435, 'v15');
+insert into bm values (6, 354, 'v16');
+insert into bm values (7, 273, 'v17');
+insert into bm values (8, 192, 'v18');
+insert into bm values (9, 111, 'v19');
+insert into bm values (0, 30, 'v20');
+insert into bm values (1, 1949, 'v21');
+insert into bm values (2, 1868, 'v22');
+insert into bm values (3, 1787, 'v23');
+insert into bm values (4, 1706, 'v24');
+insert into bm values (5, 1625, 'v25');
+insert into bm values (6, 1544, 'v26');
+insert into bm values (7, 1463, 'v27');
+insert into bm values (8, 1382, 'v28');
+insert into bm values (9, 1301, 'v29');
+insert into bm values (0, 1220, 'v30');
+insert into bm values (1, 1139, 'v31');
+insert into bm values (2, 1058, 'v32');
+insert into bm values (3, 977, 'v33');
+insert into bm values (4, 896, 'v34');
+insert into bm values (5, 815, 'v35');
+insert into bm values (6, 734, 'v36');
+insert into bm values (7, 653, 'v37');
+insert into bm values (8, 572, 'v38');
+insert into bm values (9, 491, 'v39');
+insert into bm values (0, 410, 'v40');
+insert into bm values (1, 329, 'v41');
+insert into bm values (2, 248, 'v42');
+insert into bm values (3, 167, 'v43');
+insert into bm values (4, 86, 'v44');
+insert into bm values (5, 5, 'v45');
+insert into bm values (6, 1924, 'v46');
+insert into bm values (7, 1843, 'v47');
+insert into bm values (8, 1762, 'v48');
+insert into bm values (9, 1681, 'v49');
+insert into bm values (0, 1600, 'v0');
+insert into bm values (1, 1519, 'v1');
+insert into bm values (2, 1438, 'v2');
+insert into bm values (3, 1357, 'v3');
+insert into bm values (4, 1276, 'v4');
+insert into bm values (5, 1195, 'v5');
+insert into bm values (6, 1114, 'v6');
+insert into bm values (7, 1033, 'v7');
+insert into bm values (8, 952, 'v8');
+insert into bm values (9, 871, 'v9');
+insert into bm values (0, 790, 'v10');
+insert into bm values (1, 709, 'v11');
+insert into bm values (2, 628, 'v12');
+insert into bm values (3, 547, 'v13');
+insert into bm values (4, 466, 'v14');
+insert into bm values (5, 385, 'v15');
+insert into bm values (6, 304, 'v16');
+insert into bm values (7, 223, 'v17');
+insert into bm values (8, 142, 'v18');
+insert into bm values (9, 61, 'v19');
+insert into bm values (0, 1980, 'v20');
+insert into bm values (1, 1899, 'v21');
+insert into bm values (2, 1818, 'v22');
+insert into bm values (3, 1737, 'v23');
+insert into bm values (4, 1656, 'v24');
+insert into bm values (5, 1575, 'v25');
+insert into bm values (6, 1494, 'v26');
+insert into bm values (7, 1413, 'v27');
+insert into bm values (8, 1332, 'v28');
+insert into bm values (9, 1251, 'v29');
+insert into bm values (0, 1170, 'v30');
+insert into bm values (1, 1089, 'v31');
+insert into bm values (2, 1008, 'v32');
+insert into bm values (3, 927, 'v33');
+insert into bm values (4, 846, 'v34');
+insert into bm values (5, 765, 'v35');
+insert into bm values (6, 684, 'v36');
+insert into bm values (7, 603, 'v37');
+insert into bm values (8, 522, 'v38');
+insert into bm values (9, 441, 'v39');
+insert into bm values (0, 360, 'v40');
+insert into bm values (1, 279, 'v41');
+insert into bm values (2, 198, 'v42');
+insert into bm values (3, 117, 'v43');
+insert into bm values (4, 36, 'v44');
+insert into bm values (5, 1955, 'v45');
+insert into bm values (6, 1874, 'v46');
+insert into bm values (7, 1793, 'v47');
+insert into bm values (8, 1712, 'v48');
+insert into bm values (9, 1631, 'v49');
+insert into bm values (0, 1550, 'v0');
+insert into bm values (1, 1469, 'v1');
+insert into bm values (2, 1388, 'v2');
+insert into bm values (3, 1307, 'v3');
+insert into bm values (4, 1226, 'v4');
+insert into bm values (5, 1145, 'v5');
+insert into bm values (6, 1064, 'v6');
+insert into bm values (7, 983, 'v7');
+insert into bm values (8, 902, 'v8');
+insert into bm values (9, 821, 'v9');
+insert into bm values (0, 740, 'v10');
+insert into bm values (1, 659, 'v11');
+insert into bm values (2, 578, 'v12');
+insert into bm values (3, 497, 'v13');
+insert into bm values (4, 416, 'v14');
+insert into bm values (5, 335, 'v15');
+insert into bm values (6, 254, 'v16');
+insert into bm values (7, 173, 'v17');
+insert into bm values (8, 92, 'v18');
+insert into bm values (9, 11, 'v19');
+insert into bm values (0, 1930, 'v20');
+insert into bm values (1, 1849, 'v21');
+insert into bm values (2, 1768, 'v22');
+insert into bm values (3, 1687, 'v23');
+insert into bm values (4, 1606, 'v24');
+insert into bm values (5, 1525, 'v25');
+insert into bm values (6, 1444, 'v26');
+insert into bm values (7, 1363, 'v27');
+insert into bm values (8, 1282, 'v28');
+insert into bm values (9, 1201, 'v29');
+insert into bm values (0, 1120, 'v30');
+insert into bm values (1, 1039, 'v31');
+insert into bm values (2, 958, 'v32');
+insert into bm values (3, 877, 'v33');
+insert into bm values (4, 796, 'v34');
+insert into bm values (5, 715, 'v35');
+insert into bm values (6, 634, 'v36');
+insert into bm values (7, 553, 'v37');
+insert into bm values (8, 472, 'v38');
+insert into bm values (9, 391, 'v39');
+insert into bm values (0, 310, 'v40');
+insert into bm values (1, 229, 'v41');
+insert into bm values (2, 148, 'v42');
+insert into bm values (3, 67, 'v43');
+insert into bm values (4, 1986, 'v44');
+insert into bm values (5, 1905, 'v45');
+insert into bm values (6, 1824, 'v46');
+insert into bm values (7, 1743, 'v47');
+insert into bm values (8, 1662, 'v48');
+insert into bm values (9, 1581, 'v49');
+insert into bm values (0, 1500, 'v0');
+insert into bm values (1, 1419, 'v1');
+insert into bm values (2, 1338, 'v2');
+insert into bm values (3, 1257, 'v3');
+insert into bm values (4, 1176, 'v4');
+insert into bm values (5, 1095, 'v5');
+insert into bm values (6, 1014, 'v6');
+insert into bm values (7, 933, 'v7');
+insert into bm values (8, 852, 'v8');
+insert into bm values (9, 771, 'v9');
+insert into bm values (0, 690, 'v10');
+insert into bm values (1, 609, 'v11');
+insert into bm values (2, 528, 'v12');
+insert into bm values (3, 447, 'v13');
+insert into bm values (4, 366, 'v14');
+insert into bm values (5, 285, 'v15');
+insert into bm values (6, 204, 'v16');
+insert into bm values (7, 123, 'v17');
+insert into bm values (8, 42, 'v18');
+insert into bm values (9, 1961, 'v19');
+insert into bm values (0, 1880, 'v20');
+insert into bm values (1, 1799, 'v21');
+insert into bm values (2, 1718, 'v22');
+insert into bm values (3, 1637, 'v23');
+insert into bm values (4, 1556, 'v24');
+insert into bm values (5, 1475, 'v25');
+insert into bm values (6, 1394, 'v26');
+insert into bm values (7, 1313, 'v27');
+insert into bm values (8, 1232, 'v28');
+insert into bm values (9, 1151, 'v29');
+insert into bm values (0, 1070, 'v30');
+insert into bm values (1, 989, 'v31');
+insert into bm values (2, 908, 'v32');
+insert into bm values (3, 827, 'v33');
+insert into bm values (4, 746, 'v34');
+insert into bm values (5, 665, 'v35');
+insert into bm values (6, 584, 'v36');
+insert into bm values (7, 503, 'v37');
+insert into bm values (8, 422, 'v38');
+insert into bm values (9, 341, 'v39');
+insert into bm values (0, 260, 'v40');
+insert into bm values (1, 179, 'v41');
+insert into bm values (2, 98, 'v42');
+insert into bm values (3, 17, 'v43');
+insert into bm values (4, 1936, 'v44');
+insert into bm values (5, 1855, 'v45');
+insert into bm values (6, 1774, 'v46');
+insert into bm values (7, 1693, 'v47');
+insert into bm values (8, 1612, 'v48');
+insert into bm values (9, 1531, 'v49');
+insert into bm values (0, 1450, 'v0');
+insert into bm values (1, 1369, 'v1');
+insert into bm values (2, 1288, 'v2');
+insert into bm values (3, 1207, 'v3');
+insert into bm values (4, 1126, 'v4');
+insert into bm values (5, 1045, 'v5');
+insert into bm values (6, 964, 'v6');
+insert into bm values (7, 883, 'v7');
+insert into bm values (8, 802, 'v8');
+insert into bm values (9, 721, 'v9');
+insert into bm values (0, 640, 'v10');
+insert into bm values (1, 559, 'v11');
+insert into bm values (2, 478, 'v12');
+insert into bm values (3, 397, 'v13');
+insert into bm values (4, 316, 'v14');
+insert into bm values (5, 235, 'v15');
+insert into bm values (6, 154, 'v16');
+insert into bm values (7, 73, 'v17');
+insert into bm values (8, 1992, 'v18');
+insert into bm values (9, 1911, 'v19');
+insert into bm values (0, 1830, 'v20');
+insert into bm values (1, 1749, 'v21');
+insert into bm values (2, 1668, 'v22');
+insert into bm values (3, 1587, 'v23');
+insert into bm values (4, 1506, 'v24');
+insert into bm values (5, 1425, 'v25');
+insert into bm values (6, 1344, 'v26');
+insert into bm values (7, 1263, 'v27');
+insert into bm values (8, 1182, 'v28');
+insert into bm values (9, 1101, 'v29');
+insert into bm values (0, 1020, 'v30');
+insert into bm values (1, 939, 'v31');
+insert into bm values (2, 858, 'v32');
+insert into bm values (3, 777, 'v33');
+insert into bm values (4, 696, 'v34');
+insert into bm values (5, 615, 'v35');
+insert into bm values (6, 534, 'v36');
+insert into bm values (7, 453, 'v37');
+insert into bm values (8, 372, 'v38');
+insert into bm values (9, 291, 'v39');
+insert into bm values (0, 210, 'v40');
+insert into bm values (1, 129, 'v41');
+insert into bm values (2, 48, 'v42');
+insert into bm values (3, 1967, 'v43');
+insert into bm values (4, 1886, 'v44');
+insert into bm values (5, 1805, 'v45');
+insert into bm values (6, 1724, 'v46');
+insert into bm values (7, 1643, 'v47');
+insert into bm values (8, 1562, 'v48');
+insert into bm values (9, 1481, 'v49');
+insert into bm values (0, 1400, 'v0');
+insert into bm values (1, 1319, 'v1');
+insert into bm values (2, 1238, 'v2');
+insert into bm values (3, 1157, 'v3');
+insert into bm values (4, 1076, 'v4');
+insert into bm values (5, 995, 'v5');
+insert into bm values (6, 914, 'v6');
+insert into bm values (7, 833, 'v7');
+insert into bm values (8, 752, 'v8');
+insert into bm values (9, 671, 'v9');
+insert into bm values (0, 590, 'v10');
+insert into bm values (1, 509, 'v11');
+insert into bm values (2, 428, 'v12');
+insert into bm values (3, 347, 'v13');
+insert into bm values (4, 266, 'v14');
+insert into bm values (5, 185, 'v15');
+insert into bm values (6, 104, 'v16');
+insert into bm values (7, 23, 'v17');
+insert into bm values (8, 1942, 'v18');
+insert into bm values (9, 1861, 'v19');
+insert into bm values (0, 1780, 'v20');
+insert into bm values (1, 1699, 'v21');
+insert into bm values (2, 1618, 'v22');
+insert into bm values (3, 1537, 'v23');
+insert into bm values (4, 1456, 'v24');
+insert into bm values (5, 1375, 'v25');
+insert into bm values (6, 1294, 'v26');
+insert into bm values (7, 1213, 'v27');
+insert into bm values (8, 1132, 'v28');
+insert into bm values (9, 1051, 'v29');
+insert into bm values (0, 970, 'v30');
+insert into bm values (1, 889, 'v31');
+insert into bm values (2, 808, 'v32');
+insert into bm values (3, 727, 'v33');
+insert into bm values (4, 646, 'v34');
+insert into bm values (5, 565, 'v35');
+insert into bm values (6, 484, 'v36');
+insert into bm values (7, 403, 'v37');
+insert into bm values (8, 322, 'v38');
+insert into bm values (9, 241, 'v39');
+insert into bm values (0, 160, 'v40');
+insert into bm values (1, 79, 'v41');
+insert into bm values (2, 1998, 'v42');
+insert into bm values (3, 1917, 'v43');
+insert into bm values (4, 1836, 'v44');
+insert into bm values (5, 1755, 'v45');
+insert into bm values (6, 1674, 'v46');
+insert into bm values (7, 1593, 'v47');
+insert into bm values (8, 1512, 'v48');
+insert into bm values (9, 1431, 'v49');
+insert into bm values (0, 1350, 'v0');
+insert into bm values (1, 1269, 'v1');
+insert into bm values (2, 1188, 'v2');
+insert into bm values (3, 1107, 'v3');
+insert into bm values (4, 1026, 'v4');
+insert into bm values (5, 945, 'v5');
+insert into bm values (6, 864, 'v6');
+insert into bm values (7, 783, 'v7');
+insert into bm values (8, 702, 'v8');
+insert into bm values (9, 621, 'v9');
+insert into bm values (0, 540, 'v10');
+insert into bm values (1, 459, 'v11');
+insert into bm values (2, 378, 'v12');
+insert into bm values (3, 297, 'v13');
+insert into bm values (4, 216, 'v14');
+insert into bm values (5, 135, 'v15');
+insert into bm values (6, 54, 'v16');
+insert into bm values (7, 1973, 'v17');
+insert into bm values (8, 1892, 'v18');
+insert into bm values (9, 1811, 'v19');
+insert into bm values (0, 1730, 'v20');
+insert into bm values (1, 1649, 'v21');
+insert into bm values (2, 1568, 'v22');
+insert into bm values (3, 1487, 'v23');
+insert into bm values (4, 1406, 'v24');
+insert into bm values (5, 1325, 'v25');
+insert into bm values (6, 1244, 'v26');
+insert into bm values (7, 1163, 'v27');
+insert into bm values (8, 1082, 'v28');
+insert into bm values (9, 1001, 'v29');
+insert into bm values (0, 920, 'v30');
+insert into bm values (1, 839, 'v31');
+insert into bm values (2, 758, 'v32');
+insert into bm values (3, 677, 'v33');
+insert into bm values (4, 596, 'v34');
+insert into bm values (5, 515, 'v35');
+insert into bm values (6, 434, 'v36');
+insert into bm values (7, 353, 'v37');
+insert into bm values (8, 272, 'v38');
+insert into bm values (9, 191, 'v39');
+insert into bm values (0, 110, 'v40');
+insert into bm values (1, 29, 'v41');
+insert into bm values (2, 1948, 'v42');
+insert into bm values (3, 1867, 'v43');
+insert into bm values (4, 1786, 'v44');
+insert into bm values (5, 1705, 'v45');
+insert into bm values (6, 1624, 'v46');
+insert into bm values (7, 1543, 'v47');
+insert into bm values (8, 1462, 'v48');
+insert into bm values (9, 1381, 'v49');
+insert into bm values (0, 1300, 'v0');
+insert into bm values (1, 1219, 'v1');
+insert into bm values (2, 1138, 'v2');
+insert into bm values (3, 1057, 'v3');
+insert into bm values (4, 976, 'v4');
+insert into bm values (5, 895, 'v5');
+insert into bm values (6, 814, 'v6');
+insert into bm values (7, 733, 'v7');
+insert into bm values (8, 652, 'v8');
+insert into bm values (9, 571, 'v9');
+insert into bm values (0, 490, 'v10');
+insert into bm values (1, 409, 'v11');
+insert into bm values (2, 328, 'v12');
+insert into bm values (3, 247, 'v13');
+insert into bm values (4, 166, 'v14');
+insert into bm values (5, 85, 'v15');
+insert into bm values (6, 4, 'v16');
+insert into bm values (7, 1923, 'v17');
+insert into bm values (8, 1842, 'v18');
+insert into bm values (9, 1761, 'v19');
+insert into bm values (0, 1680, 'v20');
+insert into bm values (1, 1599, 'v21');
+insert into bm values (2, 1518, 'v22');
+insert into bm values (3, 1437, 'v23');
+insert into bm values (4, 1356, 'v24');
+insert into bm values (5, 1275, 'v25');
+insert into bm values (6, 1194, 'v26');
+insert into bm values (7, 1113, 'v27');
+insert into bm values (8, 1032, 'v28');
+insert into bm values (9, 951, 'v29');
+insert into bm values (0, 870, 'v30');
+insert into bm values (1, 789, 'v31');
+insert into bm values (2, 708, 'v32');
+insert into bm values (3, 627, 'v33');
+insert into bm values (4, 546, 'v34');
+insert into bm values (5, 465, 'v35');
+insert into bm values (6, 384, 'v36');
+insert into bm values (7, 303, 'v37');
+insert into bm values (8, 222, 'v38');
+insert into bm values (9, 141, 'v39');
+insert into bm values (0, 60, 'v40');
+insert into bm values (1, 1979, 'v41');
+insert into bm values (2, 1898, 'v42');
+insert into bm values (3, 1817, 'v43');
+insert into bm values (4, 1736, 'v44');
+insert into bm values (5, 1655, 'v45');
+insert into bm values (6, 1574, 'v46');
+insert into bm values (7, 1493, 'v47');
+insert into bm values (8, 1412, 'v48');
+insert into bm values (9, 1331, 'v49');
+insert into bm values (0, 1250, 'v0');
+insert into bm values (1, 1169, 'v1');
+insert into bm values (2, 1088, 'v2');
+insert into bm values (3, 1007, 'v3');
+insert into bm values (4, 926, 'v4');
+insert into bm values (5, 845, 'v5');
+insert into bm values (6, 764, 'v6');
+insert into bm values (7, 683, 'v7');
+insert into bm values (8, 602, 'v8');
+insert into bm values (9, 521, 'v9');
+insert into bm values (0, 440, 'v10');
+insert into bm values (1, 359, 'v11');
+insert into bm values (2, 278, 'v12');
+insert into bm values (3, 197, 'v13');
+insert into bm values (4, 116, 'v14');
+insert into bm values (5, 35, 'v15');
+insert into bm values (6, 1954, 'v16');
+insert into bm values (7, 1873, 'v17');
+insert into bm values (8, 1792, 'v18');
+insert into bm values (9, 1711, 'v19');
+insert into bm values (0, 1630, 'v20');
+insert into bm values (1, 1549, 'v21');
+insert into bm values (2, 1468, 'v22');
+insert into bm values (3, 1387, 'v23');
+insert into bm values (4, 1306, 'v24');
+insert into bm values (5, 1225, 'v25');
+insert into bm values (6, 1144, 'v26');
+insert into bm values (7, 1063, 'v27');
+insert into bm values (8, 982, 'v28');
+insert into bm values (9, 901, 'v29');
+insert into bm values (0, 820, 'v30');
+insert into bm values (1, 739, 'v31');
+insert into bm values (2, 658, 'v32');
+insert into bm values (3, 577, 'v33');
+insert into bm values (4, 496, 'v34');
+insert into bm values (5, 415, 'v35');
+insert into bm values (6, 334, 'v36');
+insert into bm values (7, 253, 'v37');
+insert into bm values (8, 172, 'v38');
+insert into bm values (9, 91, 'v39');
+insert into bm values (0, 10, 'v40');
+insert into bm values (1, 1929, 'v41');
+insert into bm values (2, 1848, 'v42');
+insert into bm values (3, 1767, 'v43');
+insert into bm values (4, 1686, 'v44');
+insert into bm values (5, 1605, 'v45');
+insert into bm values (6, 1524, 'v46');
+insert into bm values (7, 1443, 'v47');
+insert into bm values (8, 1362, 'v48');
+insert into bm values (9, 1281, 'v49');
+insert into bm values (0, 1200, 'v0');
+insert into bm values (1, 1119, 'v1');
+insert into bm values (2, 1038, 'v2');
+insert into bm values (3, 957, 'v3');
+insert into bm values (4, 876, 'v4');
+insert into bm values (5, 795, 'v5');
+insert into bm values (6, 714, 'v6');
+insert into bm values (7, 633, 'v7');
+insert into bm values (8, 552, 'v8');
+insert into bm values (9, 471, 'v9');
+insert into bm values (0, 390, 'v10');
+insert into bm values (1, 309, 'v11');
+insert into bm values (2, 228, 'v12');
+insert into bm values (3, 147, 'v13');
+insert into bm values (4, 66, 'v14');
+insert into bm values (5, 1985, 'v15');
+insert into bm values (6, 1904, 'v16');
+insert into bm values (7, 1823, 'v17');
+insert into bm values (8, 1742, 'v18');
+insert into bm values (9, 1661, 'v19');
+insert into bm values (0, 1580, 'v20');
+insert into bm values (1, 1499, 'v21');
+insert into bm values (2, 1418, 'v22');
+insert into bm values (3, 1337, 'v23');
+insert into bm values (4, 1256, 'v24');
+insert into bm values (5, 1175, 'v25');
+insert into bm values (6, 1094, 'v26');
+insert into bm values (7, 1013, 'v27');
+insert into bm values (8, 932, 'v28');
+insert into bm values (9, 851, 'v29');
+insert into bm values (0, 770, 'v30');
+insert into bm values (1, 689, 'v31');
+insert into bm values (2, 608, 'v32');
+insert into bm values (3, 527, 'v33');
+insert into bm values (4, 446, 'v34');
+insert into bm values (5, 365, 'v35');
+insert into bm values (6, 284, 'v36');
+insert into bm values (7, 203, 'v37');
+insert into bm values (8, 122, 'v38');
+insert into bm values (9, 41, 'v39');
+insert into bm values (0, 1960, 'v40');
+insert into bm values (1, 1879, 'v41');
+insert into bm values (2, 1798, 'v42');
+insert into bm values (3, 1717, 'v43');
+insert into bm values (4, 1636, 'v44');
+insert into bm values (5, 1555, 'v45');
+insert into bm values (6, 1474, 'v46');
+insert into bm values (7, 1393, 'v47');
+insert into bm values (8, 1312, 'v48');
+insert into bm values (9, 1231, 'v49');
+insert into bm values (0, 1150, 'v0');
+insert into bm values (1, 1069, 'v1');
+insert into bm values (2, 988, 'v2');
+insert into bm values (3, 907, 'v3');
+insert into bm values (4, 826, 'v4');
+insert into bm values (5, 745, 'v5');
+insert into bm values (6, 664, 'v6');
+insert into bm values (7, 583, 'v7');
+insert into bm values (8, 502, 'v8');
+insert into bm values (9, 421, 'v9');
+insert into bm values (0, 340, 'v10');
+insert into bm values (1, 259, 'v11');
+insert into bm values (2, 178, 'v12');
+insert into bm values (3, 97, 'v13');
+insert into bm values (4, 16, 'v14');
+insert into bm values (5, 1935, 'v15');
+insert into bm values (6, 1854, 'v16');
+insert into bm values (7, 1773, 'v17');
+insert into bm values (8, 1692, 'v18');
+insert into bm values (9, 1611, 'v19');
+insert into bm values (0, 1530, 'v20');
+insert into bm values (1, 1449, 'v21');
+insert into bm values (2, 1368, 'v22');
+insert into bm values (3, 1287, 'v23');
+insert into bm values (4, 1206, 'v24');
+insert into bm values (5, 1125, 'v25');
+insert into bm values (6, 1044, 'v26');
+insert into bm values (7, 963, 'v27');
+insert into bm values (8, 882, 'v28');
+insert into bm values (9, 801, 'v29');
+insert into bm values (0, 720, 'v30');
+insert into bm values (1, 639, 'v31');
+insert into bm values (2, 558, 'v32');
+insert into bm values (3, 477, 'v33');
+insert into bm values (4, 396, 'v34');
+insert into bm values (5, 315, 'v35');
+insert into bm values (6, 234, 'v36');
+insert into bm values (7, 153, 'v37');
+insert into bm values (8, 72, 'v38');
+insert into bm values (9, 1991, 'v39');
+insert into bm values (0, 1910, 'v40');
+insert into bm values (1, 1829, 'v41');
+insert into bm values (2, 1748, 'v42');
+insert into bm values (3, 1667, 'v43');
+insert into bm values (4, 1586, 'v44');
+insert into bm values (5, 1505, 'v45');
+insert into bm values (6, 1424, 'v46');
+insert into bm values (7, 1343, 'v47');
+insert into bm values (8, 1262, 'v48');
+insert into bm values (9, 1181, 'v49');
+insert into bm values (0, 1100, 'v0');
+insert into bm values (1, 1019, 'v1');
+insert into bm values (2, 938, 'v2');
+insert into bm values (3, 857, 'v3');
+insert into bm values (4, 776, 'v4');
+insert into bm values (5, 695, 'v5');
+insert into bm values (6, 614, 'v6');
+insert into bm values (7, 533, 'v7');
+insert into bm values (8, 452, 'v8');
+insert into bm values (9, 371, 'v9');
+insert into bm values (0, 290, 'v10');
+insert into bm values (1, 209, 'v11');
+insert into bm values (2, 128, 'v12');
+insert into bm values (3, 47, 'v13');
+insert into bm values (4, 1966, 'v14');
+insert into bm values (5, 1885, 'v15');
+insert into bm values (6, 1804, 'v16');
+insert into bm values (7, 1723, 'v17');
+insert into bm values (8, 1642, 'v18');
+insert into bm values (9, 1561, 'v19');
+insert into bm values (0, 1480, 'v20');
+insert into bm values (1, 1399, 'v21');
+insert into bm values (2, 1318, 'v22');
+insert into bm values (3, 1237, 'v23');
+insert into bm values (4, 1156, 'v24');
+insert into bm values (5, 1075, 'v25');
+insert into bm values (6, 994, 'v26');
+insert into bm values (7, 913, 'v27');
+insert into bm values (8, 832, 'v28');
+insert into bm values (9, 751, 'v29');
+insert into bm values (0, 670, 'v30');
+insert into bm values (1, 589, 'v31');
+insert into bm values (2, 508, 'v32');
+insert into bm values (3, 427, 'v33');
+insert into bm values (4, 346, 'v34');
+insert into bm values (5, 265, 'v35');
+insert into bm values (6, 184, 'v36');
+insert into bm values (7, 103, 'v37');
+insert into bm values (8, 22, 'v38');
+insert into bm values (9, 1941, 'v39');
+insert into bm values (0, 1860, 'v40');
+insert into bm values (1, 1779, 'v41');
+insert into bm values (2, 1698, 'v42');
+insert into bm values (3, 1617, 'v43');
+insert into bm values (4, 1536, 'v44');
+insert into bm values (5, 1455, 'v45');
+insert into bm values (6, 1374, 'v46');
+insert into bm values (7, 1293, 'v47');
+insert into bm values (8, 1212, 'v48');
+insert into bm values (9, 1131, 'v49');
+insert into bm values (0, 1050, 'v0');
+insert into bm values (1, 969, 'v1');
+insert into bm values (2, 888, 'v2');
+insert into bm values (3, 807, 'v3');
+insert into bm values (4, 726, 'v4');
+insert into bm values (5, 645, 'v5');
+insert into bm values (6, 564, 'v6');
+insert into bm values (7, 483, 'v7');
+insert into bm values (8, 402, 'v8');
+insert into bm values (9, 321, 'v9');
+insert into bm values (0, 240, 'v10');
+insert into bm values (1, 159, 'v11');
+insert into bm values (2, 78, 'v12');
+insert into bm values (3, 1997, 'v13');
+insert into bm values (4, 1916, 'v14');
+insert into bm values (5, 1835, 'v15');
+insert into bm values (6, 1754, 'v16');
+insert into bm values (7, 1673, 'v17');
+insert into bm values (8, 1592, 'v18');
+insert into bm values (9, 1511, 'v19');
+insert into bm values (0, 1430, 'v20');
+insert into bm values (1, 1349, 'v21');
+insert into bm values (2, 1268, 'v22');
+insert into bm values (3, 1187, 'v23');
+insert into bm values (4, 1106, 'v24');
+insert into bm values (5, 1025, 'v25');
+insert into bm values (6, 944, 'v26');
+insert into bm values (7, 863, 'v27');
+insert into bm values (8, 782, 'v28');
+insert into bm values (9, 701, 'v29');
+insert into bm values (0, 620, 'v30');
+insert into bm values (1, 539, 'v31');
+insert into bm values (2, 458, 'v32');
+insert into bm values (3, 377, 'v33');
+insert into bm values (4, 296, 'v34');
+insert into bm values (5, 215, 'v35');
+insert into bm values (6, 134, 'v36');
+insert into bm values (7, 53, 'v37');
+insert into bm values (8, 1972, 'v38');
+insert into bm values (9, 1891, 'v39');
+insert into bm values (0, 1810, 'v40');
+insert into bm values (1, 1729, 'v41');
+insert into bm values (2, 1648, 'v42');
+insert into bm values (3, 1567, 'v43');
+insert into bm values (4, 1486, 'v44');
+insert into bm values (5, 1405, 'v45');
+insert into bm values (6, 1324, 'v46');
+insert into bm values (7, 1243, 'v47');
+insert into bm values (8, 1162, 'v48');
+insert into bm values (9, 1081, 'v49');
+insert into bm values (0, 1000, 'v0');
+insert into bm values (1, 919, 'v1');
+insert into bm values (2, 838, 'v2');
+insert into bm values (3, 757, 'v3');
+insert into bm values (4, 676, 'v4');
+insert into bm values (5, 595, 'v5');
+insert into bm values (6, 514, 'v6');
+insert into bm values (7, 433, 'v7');
+insert into bm values (8, 352, 'v8');
+insert into bm values (9, 271, 'v9');
+insert into bm values (0, 190, 'v10');
+insert into bm values (1, 109, 'v11');
+insert into bm values (2, 28, 'v12');
+insert into bm values (3, 1947, 'v13');
+insert into bm values (4, 1866, 'v14');
+insert into bm values (5, 1785, 'v15');
+insert into bm values (6, 1704, 'v16');
+insert into bm values (7, 1623, 'v17');
+insert into bm values (8, 1542, 'v18');
+insert into bm values (9, 1461, 'v19');
+insert into bm values (0, 1380, 'v20');
+insert into bm values (1, 1299, 'v21');
+insert into bm values (2, 1218, 'v22');
+insert into bm values (3, 1137, 'v23');
+insert into bm values (4, 1056, 'v24');
+insert into bm values (5, 975, 'v25');
+insert into bm values (6, 894, 'v26');
+insert into bm values (7, 813, 'v27');
+insert into bm values (8, 732, 'v28');
+insert into bm values (9, 651, 'v29');
+insert into bm values (0, 570, 'v30');
+insert into bm values (1, 489, 'v31');
+insert into bm values (2, 408, 'v32');
+insert into bm values (3, 327, 'v33');
+insert into bm values (4, 246, 'v34');
+insert into bm values (5, 165, 'v35');
+insert into bm values (6, 84, 'v36');
+insert into bm values (7, 3, 'v37');
+insert into bm values (8, 1922, 'v38');
+insert into bm values (9, 1841, 'v39');
+insert into bm values (0, 1760, 'v40');
+insert into bm values (1, 1679, 'v41');
+insert into bm values (2, 1598, 'v42');
+insert into bm values (3, 1517, 'v43');
+insert into bm values (4, 1436, 'v44');
+insert into bm values (5, 1355, 'v45');
+insert into bm values (6, 1274, 'v46');
+insert into bm values (7, 1193, 'v47');
+insert into bm values (8, 1112, 'v48');
+insert into bm values (9, 1031, 'v49');
+insert into bm values (0, 950, 'v0');
+insert into bm values (1, 869, 'v1');
+insert into bm values (2, 788, 'v2');
+insert into bm values (3, 707, 'v3');
+insert into bm values (4, 626, 'v4');
+insert into bm values (5, 545, 'v5');
+insert into bm values (6, 464, 'v6');
+insert into bm values (7, 383, 'v7');
+insert into bm values (8, 302, 'v8');
+insert into bm values (9, 221, 'v9');
+insert into bm values (0, 140, 'v10');
+insert into bm values (1, 59, 'v11');
+insert into bm values (2, 1978, 'v12');
+insert into bm values (3, 1897, 'v13');
+insert into bm values (4, 1816, 'v14');
+insert into bm values (5, 1735, 'v15');
+insert into bm values (6, 1654, 'v16');
+insert into bm values (7, 1573, 'v17');
+insert into bm values (8, 1492, 'v18');
+insert into bm values (9, 1411, 'v19');
+insert into bm values (0, 1330, 'v20');
+insert into bm values (1, 1249, 'v21');
+insert into bm values (2, 1168, 'v22');
+insert into bm values (3, 1087, 'v23');
+insert into bm values (4, 1006, 'v24');
+insert into bm values (5, 925, 'v25');
+insert into bm values (6, 844, 'v26');
+insert into bm values (7, 763, 'v27');
+insert into bm values (8, 682, 'v28');
+insert into bm values (9, 601, 'v29');
+insert into bm values (0, 520, 'v30');
+insert into bm values (1, 439, 'v31');
+insert into bm values (2, 358, 'v32');
+insert into bm values (3, 277, 'v33');
+insert into bm values (4, 196, 'v34');
+insert into bm values (5, 115, 'v35');
+insert into bm values (6, 34, 'v36');
+insert into bm values (7, 1953, 'v37');
+insert into bm values (8, 1872, 'v38');
+insert into bm values (9, 1791, 'v39');
+insert into bm values (0, 1710, 'v40');
+insert into bm values (1, 1629, 'v41');
+insert into bm values (2, 1548, 'v42');
+insert into bm values (3, 1467, 'v43');
+insert into bm values (4, 1386, 'v44');
+insert into bm values (5, 1305, 'v45');
+insert into bm values (6, 1224, 'v46');
+insert into bm values (7, 1143, 'v47');
+insert into bm values (8, 1062, 'v48');
+insert into bm values (9, 981, 'v49');
+insert into bm values (0, 900, 'v0');
+insert into bm values (1, 819, 'v1');
+insert into bm values (2, 738, 'v2');
+insert into bm values (3, 657, 'v3');
+insert into bm values (4, 576, 'v4');
+insert into bm values (5, 495, 'v5');
+insert into bm values (6, 414, 'v6');
+insert into bm values (7, 333, 'v7');
+insert into bm values (8, 252, 'v8');
+insert into bm values (9, 171, 'v9');
+insert into bm values (0, 90, 'v10');
+insert into bm values (1, 9, 'v11');
+insert into bm values (2, 1928, 'v12');
+insert into bm values (3, 1847, 'v13');
+insert into bm values (4, 1766, 'v14');
+insert into bm values (5, 1685, 'v15');
+insert into bm values (6, 1604, 'v16');
+insert into bm values (7, 1523, 'v17');
+insert into bm values (8, 1442, 'v18');
+insert into bm values (9, 1361, 'v19');
+insert into bm values (0, 1280, 'v20');
+insert into bm values (1, 1199, 'v21');
+insert into bm values (2, 1118, 'v22');
+insert into bm values (3, 1037, 'v23');
+insert into bm values (4, 956, 'v24');
+insert into bm values (5, 875, 'v25');
+insert into bm values (6, 794, 'v26');
+insert into bm values (7, 713, 'v27');
+insert into bm values (8, 632, 'v28');
+insert into bm values (9, 551, 'v29');
+insert into bm values (0, 470, 'v30');
+insert into bm values (1, 389, 'v31');
+insert into bm values (2, 308, 'v32');
+insert into bm values (3, 227, 'v33');
+insert into bm values (4, 146, 'v34');
+insert into bm values (5, 65, 'v35');
+insert into bm values (6, 1984, 'v36');
+insert into bm values (7, 1903, 'v37');
+insert into bm values (8, 1822, 'v38');
+insert into bm values (9, 1741, 'v39');
+insert into bm values (0, 1660, 'v40');
+insert into bm values (1, 1579, 'v41');
+insert into bm values (2, 1498, 'v42');
+insert into bm values (3, 1417, 'v43');
+insert into bm values (4, 1336, 'v44');
+insert into bm values (5, 1255, 'v45');
+insert into bm values (6, 1174, 'v46');
+insert into bm values (7, 1093, 'v47');
+insert into bm values (8, 1012, 'v48');
+insert into bm values (9, 931, 'v49');
+insert into bm values (0, 850, 'v0');
+insert into bm values (1, 769, 'v1');
+insert into bm values (2, 688, 'v2');
+insert into bm values (3, 607, 'v3');
+insert into bm values (4, 526, 'v4');
+insert into bm values (5, 445, 'v5');
+insert into bm values (6, 364, 'v6');
+insert into bm values (7, 283, 'v7');
+insert into bm values (8, 202, 'v8');
+insert into bm values (9, 121, 'v9');
+insert into bm values (0, 40, 'v10');
+insert into bm values (1, 1959, 'v11');
+insert into bm values (2, 1878, 'v12');
+insert into bm values (3, 1797, 'v13');
+insert into bm values (4, 1716, 'v14');
+insert into bm values (5, 1635, 'v15');
+insert into bm values (6, 1554, 'v16');
+insert into bm values (7, 1473, 'v17');
+insert into bm values (8, 1392, 'v18');
+insert into bm values (9, 1311, 'v19');
+insert into bm values (0, 1230, 'v20');
+insert into bm values (1, 1149, 'v21');
+insert into bm values (2, 1068, 'v22');
+insert into bm values (3, 987, 'v23');
+insert into bm values (4, 906, 'v24');
+insert into bm values (5, 825, 'v25');
+insert into bm values (6, 744, 'v26');
+insert into bm values (7, 663, 'v27');
+insert into bm values (8, 582, 'v28');
+insert into bm values (9, 501, 'v29');
+insert into bm values (0, 420, 'v30');
+insert into bm values (1, 339, 'v31');
+insert into bm values (2, 258, 'v32');
+insert into bm values (3, 177, 'v33');
+insert into bm values (4, 96, 'v34');
+insert into bm values (5, 15, 'v35');
+insert into bm values (6, 1934, 'v36');
+insert into bm values (7, 1853, 'v37');
+insert into bm values (8, 1772, 'v38');
+insert into bm values (9, 1691, 'v39');
+insert into bm values (0, 1610, 'v40');
+insert into bm values (1, 1529, 'v41');
+insert into bm values (2, 1448, 'v42');
+insert into bm values (3, 1367, 'v43');
+insert into bm values (4, 1286, 'v44');
+insert into bm values (5, 1205, 'v45');
+insert into bm values (6, 1124, 'v46');
+insert into bm values (7, 1043, 'v47');
+insert into bm values (8, 962, 'v48');
+insert into bm values (9, 881, 'v49');
+insert into bm values (0, 800, 'v0');
+insert into bm values (1, 719, 'v1');
+insert into bm values (2, 638, 'v2');
+insert into bm values (3, 557, 'v3');
+insert into bm values (4, 476, 'v4');
+insert into bm values (5, 395, 'v5');
+insert into bm values (6, 314, 'v6');
+insert into bm values (7, 233, 'v7');
+insert into bm values (8, 152, 'v8');
+insert into bm values (9, 71, 'v9');
+insert into bm values (0, 1990, 'v10');
+insert into bm values (1, 1909, 'v11');
+insert into bm values (2, 1828, 'v12');
+insert into bm values (3, 1747, 'v13');
+insert into bm values (4, 1666, 'v14');
+insert into bm values (5, 1585, 'v15');
+insert into bm values (6, 1504, 'v16');
+insert into bm values (7, 1423, 'v17');
+insert into bm values (8, 1342, 'v18');
+insert into bm values (9, 1261, 'v19');
+insert into bm values (0, 1180, 'v20');
+insert into bm values (1, 1099, 'v21');
+insert into bm values (2, 1018, 'v22');
+insert into bm values (3, 937, 'v23');
+insert into bm values (4, 856, 'v24');
+insert into bm values (5, 775, 'v25');
+insert into bm values (6, 694, 'v26');
+insert into bm values (7, 613, 'v27');
+insert into bm values (8, 532, 'v28');
+insert into bm values (9, 451, 'v29');
+insert into bm values (0, 370, 'v30');
+insert into bm values (1, 289, 'v31');
+insert into bm values (2, 208, 'v32');
+insert into bm values (3, 127, 'v33');
+insert into bm values (4, 46, 'v34');
+insert into bm values (5, 1965, 'v35');
+insert into bm values (6, 1884, 'v36');
+insert into bm values (7, 1803, 'v37');
+insert into bm values (8, 1722, 'v38');
+insert into bm values (9, 1641, 'v39');
+insert into bm values (0, 1560, 'v40');
+insert into bm values (1, 1479, 'v41');
+insert into bm values (2, 1398, 'v42');
+insert into bm values (3, 1317, 'v43');
+insert into bm values (4, 1236, 'v44');
+insert into bm values (5, 1155, 'v45');
+insert into bm values (6, 1074, 'v46');
+insert into bm values (7, 993, 'v47');
+insert into bm values (8, 912, 'v48');
+insert into bm values (9, 831, 'v49');
+insert into bm values (0, 750, 'v0');
+insert into bm values (1, 669, 'v1');
+insert into bm values (2, 588, 'v2');
+insert into bm values (3, 507, 'v3');
+insert into bm values (4, 426, 'v4');
+insert into bm values (5, 345, 'v5');
+insert into bm values (6, 264, 'v6');
+insert into bm values (7, 183, 'v7');
+insert into bm values (8, 102, 'v8');
+insert into bm values (9, 21, 'v9');
+insert into bm values (0, 1940, 'v10');
+insert into bm values (1, 1859, 'v11');
+insert into bm values (2, 1778, 'v12');
+insert into bm values (3, 1697, 'v13');
+insert into bm values (4, 1616, 'v14');
+insert into bm values (5, 1535, 'v15');
+insert into bm values (6, 1454, 'v16');
+insert into bm values (7, 1373, 'v17');
+insert into bm values (8, 1292, 'v18');
+insert into bm values (9, 1211, 'v19');
+insert into bm values (0, 1130, 'v20');
+insert into bm values (1, 1049, 'v21');
+insert into bm values (2, 968, 'v22');
+insert into bm values (3, 887, 'v23');
+insert into bm values (4, 806, 'v24');
+insert into bm values (5, 725, 'v25');
+insert into bm values (6, 644, 'v26');
+insert into bm values (7, 563, 'v27');
+insert into bm values (8, 482, 'v28');
+insert into bm values (9, 401, 'v29');
+insert into bm values (0, 320, 'v30');
+insert into bm values (1, 239, 'v31');
+insert into bm values (2, 158, 'v32');
+insert into bm values (3, 77, 'v33');
+insert into bm values (4, 1996, 'v34');
+insert into bm values (5, 1915, 'v35');
+insert into bm values (6, 1834, 'v36');
+insert into bm values (7, 1753, 'v37');
+insert into bm values (8, 1672, 'v38');
+insert into bm values (9, 1591, 'v39');
+insert into bm values (0, 1510, 'v40');
+insert into bm values (1, 1429, 'v41');
+insert into bm values (2, 1348, 'v42');
+insert into bm values (3, 1267, 'v43');
+insert into bm values (4, 1186, 'v44');
+insert into bm values (5, 1105, 'v45');
+insert into bm values (6, 1024, 'v46');
+insert into bm values (7, 943, 'v47');
+insert into bm values (8, 862, 'v48');
+insert into bm values (9, 781, 'v49');
+insert into bm values (0, 700, 'v0');
+insert into bm values (1, 619, 'v1');
+insert into bm values (2, 538, 'v2');
+insert into bm values (3, 457, 'v3');
+insert into bm values (4, 376, 'v4');
+insert into bm values (5, 295, 'v5');
+insert into bm values (6, 214, 'v6');
+insert into bm values (7, 133, 'v7');
+insert into bm values (8, 52, 'v8');
+insert into bm values (9, 1971, 'v9');
+insert into bm values (0, 1890, 'v10');
+insert into bm values (1, 1809, 'v11');
+insert into bm values (2, 1728, 'v12');
+insert into bm values (3, 1647, 'v13');
+insert into bm values (4, 1566, 'v14');
+insert into bm values (5, 1485, 'v15');
+insert into bm values (6, 1404, 'v16');
+insert into bm values (7, 1323, 'v17');
+insert into bm values (8, 1242, 'v18');
+insert into bm values (9, 1161, 'v19');
+insert into bm values (0, 1080, 'v20');
+insert into bm values (1, 999, 'v21');
+insert into bm values (2, 918, 'v22');
+insert into bm values (3, 837, 'v23');
+insert into bm values (4, 756, 'v24');
+insert into bm values (5, 675, 'v25');
+insert into bm values (6, 594, 'v26');
+insert into bm values (7, 513, 'v27');
+insert into bm values (8, 432, 'v28');
+insert into bm values (9, 351, 'v29');
+insert into bm values (0, 270, 'v30');
+insert into bm values (1, 189, 'v31');
+insert into bm values (2, 108, 'v32');
+insert into bm values (3, 27, 'v33');
+insert into bm values (4, 1946, 'v34');
+insert into bm values (5, 1865, 'v35');
+insert into bm values (6, 1784, 'v36');
+insert into bm values (7, 1703, 'v37');
+insert into bm values (8, 1622, 'v38');
+insert into bm values (9, 1541, 'v39');
+insert into bm values (0, 1460, 'v40');
+insert into bm values (1, 1379, 'v41');
+insert into bm values (2, 1298, 'v42');
+insert into bm values (3, 1217, 'v43');
+insert into bm values (4, 1136, 'v44');
+insert into bm values (5, 1055, 'v45');
+insert into bm values (6, 974, 'v46');
+insert into bm values (7, 893, 'v47');
+insert into bm values (8, 812, 'v48');
+insert into bm values (9, 731, 'v49');
+insert into bm values (0, 650, 'v0');
+insert into bm values (1, 569, 'v1');
+insert into bm values (2, 488, 'v2');
+insert into bm values (3, 407, 'v3');
+insert into bm values (4, 326, 'v4');
+insert into bm values (5, 245, 'v5');
+insert into bm values (6, 164, 'v6');
+insert into bm values (7, 83, 'v7');
+insert into bm values (8, 2, 'v8');
+insert into bm values (9, 1921, 'v9');
+insert into bm values (0, 1840, 'v10');
+insert into bm values (1, 1759, 'v11');
+insert into bm values (2, 1678, 'v12');
+insert into bm values (3, 1597, 'v13');
+insert into bm values (4, 1516, 'v14');
+insert into bm values (5, 1435, 'v15');
+insert into bm values (6, 1354, 'v16');
+insert into bm values (7, 1273, 'v17');
+insert into bm values (8, 1192, 'v18');
+insert into bm values (9, 1111, 'v19');
+insert into bm values (0, 1030, 'v20');
+insert into bm values (1, 949, 'v21');
+insert into bm values (2, 868, 'v22');
+insert into bm values (3, 787, 'v23');
+insert into bm values (4, 706, 'v24');
+insert into bm values (5, 625, 'v25');
+insert into bm values (6, 544, 'v26');
+insert into bm values (7, 463, 'v27');
+insert into bm values (8, 382, 'v28');
+insert into bm values (9, 301, 'v29');
+insert into bm values (0, 220, 'v30');
+insert into bm values (1, 139, 'v31');
+insert into bm values (2, 58, 'v32');
+insert into bm values (3, 1977, 'v33');
+insert into bm values (4, 1896, 'v34');
+insert into bm values (5, 1815, 'v35');
+insert into bm values (6, 1734, 'v36');
+insert into bm values (7, 1653, 'v37');
+insert into bm values (8, 1572, 'v38');
+insert into bm values (9, 1491, 'v39');
+insert into bm values (0, 1410, 'v40');
+insert into bm values (1, 1329, 'v41');
+insert into bm values (2, 1248, 'v42');
+insert into bm values (3, 1167, 'v43');
+insert into bm values (4, 1086, 'v44');
+insert into bm values (5, 1005, 'v45');
+insert into bm values (6, 924, 'v46');
+insert into bm values (7, 843, 'v47');
+insert into bm values (8, 762, 'v48');
+insert into bm values (9, 681, 'v49');
+insert into bm values (0, 600, 'v0');
+insert into bm values (1, 519, 'v1');
+insert into bm values (2, 438, 'v2');
+insert into bm values (3, 357, 'v3');
+insert into bm values (4, 276, 'v4');
+insert into bm values (5, 195, 'v5');
+insert into bm values (6, 114, 'v6');
+insert into bm values (7, 33, 'v7');
+insert into bm values (8, 1952, 'v8');
+insert into bm values (9, 1871, 'v9');
+insert into bm values (0, 1790, 'v10');
+insert into bm values (1, 1709, 'v11');
+insert into bm values (2, 1628, 'v12');
+insert into bm values (3, 1547, 'v13');
+insert into bm values (4, 1466, 'v14');
+insert into bm values (5, 1385, 'v15');
+insert into bm values (6, 1304, 'v16');
+insert into bm values (7, 1223, 'v17');
+insert into bm values (8, 1142, 'v18');
+insert into bm values (9, 1061, 'v19');
+insert into bm values (0, 980, 'v20');
+insert into bm values (1, 899, 'v21');
+insert into bm values (2, 818, 'v22');
+insert into bm values (3, 737, 'v23');
+insert into bm values (4, 656, 'v24');
+insert into bm values (5, 575, 'v25');
+insert into bm values (6, 494, 'v26');
+insert into bm values (7, 413, 'v27');
+insert into bm values (8, 332, 'v28');
+insert into bm values (9, 251, 'v29');
+insert into bm values (0, 170, 'v30');
+insert into bm values (1, 89, 'v31');
+insert into bm values (2, 8, 'v32');
+insert into bm values (3, 1927, 'v33');
+insert into bm values (4, 1846, 'v34');
+insert into bm values (5, 1765, 'v35');
+insert into bm values (6, 1684, 'v36');
+insert into bm values (7, 1603, 'v37');
+insert into bm values (8, 1522, 'v38');
+insert into bm values (9, 1441, 'v39');
+insert into bm values (0, 1360, 'v40');
+insert into bm values (1, 1279, 'v41');
+insert into bm values (2, 1198, 'v42');
+insert into bm values (3, 1117, 'v43');
+insert into bm values (4, 1036, 'v44');
+insert into bm values (5, 955, 'v45');
+insert into bm values (6, 874, 'v46');
+insert into bm values (7, 793, 'v47');
+insert into bm values (8, 712, 'v48');
+insert into bm values (9, 631, 'v49');
+insert into bm values (0, 550, 'v0');
+insert into bm values (1, 469, 'v1');
+insert into bm values (2, 388, 'v2');
+insert into bm values (3, 307, 'v3');
+insert into bm values (4, 226, 'v4');
+insert into bm values (5, 145, 'v5');
+insert into bm values (6, 64, 'v6');
+insert into bm values (7, 1983, 'v7');
+insert into bm values (8, 1902, 'v8');
+insert into bm values (9, 1821, 'v9');
+insert into bm values (0, 1740, 'v10');
+insert into bm values (1, 1659, 'v11');
+insert into bm values (2, 1578, 'v12');
+insert into bm values (3, 1497, 'v13');
+insert into bm values (4, 1416, 'v14');
+insert into bm values (5, 1335, 'v15');
+insert into bm values (6, 1254, 'v16');
+insert into bm values (7, 1173, 'v17');
+insert into bm values (8, 1092, 'v18');
+insert into bm values (9, 1011, 'v19');
+insert into bm values (0, 930, 'v20');
+insert into bm values (1, 849, 'v21');
+insert into bm values (2, 768, 'v22');
+insert into bm values (3, 687, 'v23');
+insert into bm values (4, 606, 'v24');
+insert into bm values (5, 525, 'v25');
+insert into bm values (6, 444, 'v26');
+insert into bm values (7, 363, 'v27');
+insert into bm values (8, 282, 'v28');
+insert into bm values (9, 201, 'v29');
+insert into bm values (0, 120, 'v30');
+insert into bm values (1, 39, 'v31');
+insert into bm values (2, 1958, 'v32');
+insert into bm values (3, 1877, 'v33');
+insert into bm values (4, 1796, 'v34');
+insert into bm values (5, 1715, 'v35');
+insert into bm values (6, 1634, 'v36');
+insert into bm values (7, 1553, 'v37');
+insert into bm values (8, 1472, 'v38');
+insert into bm values (9, 1391, 'v39');
+insert into bm values (0, 1310, 'v40');
+insert into bm values (1, 1229, 'v41');
+insert into bm values (2, 1148, 'v42');
+insert into bm values (3, 1067, 'v43');
+insert into bm values (4, 986, 'v44');
+insert into bm values (5, 905, 'v45');
+insert into bm values (6, 824, 'v46');
+insert into bm values (7, 743, 'v47');
+insert into bm values (8, 662, 'v48');
+insert into bm values (9, 581, 'v49');
+insert into bm values (0, 500, 'v0');
+insert into bm values (1, 419, 'v1');
+insert into bm values (2, 338, 'v2');
+insert into bm values (3, 257, 'v3');
+insert into bm values (4, 176, 'v4');
+insert into bm values (5, 95, 'v5');
+insert into bm values (6, 14, 'v6');
+insert into bm values (7, 1933, 'v7');
+insert into bm values (8, 1852, 'v8');
+insert into bm values (9, 1771, 'v9');
+insert into bm values (0, 1690, 'v10');
+insert into bm values (1, 1609, 'v11');
+insert into bm values (2, 1528, 'v12');
+insert into bm values (3, 1447, 'v13');
+insert into bm values (4, 1366, 'v14');
+insert into bm values (5, 1285, 'v15');
+insert into bm values (6, 1204, 'v16');
+insert into bm values (7, 1123, 'v17');
+insert into bm values (8, 1042, 'v18');
+insert into bm values (9, 961, 'v19');
+insert into bm values (0, 880, 'v20');
+insert into bm values (1, 799, 'v21');
+insert into bm values (2, 718, 'v22');
+insert into bm values (3, 637, 'v23');
+insert into bm values (4, 556, 'v24');
+insert into bm values (5, 475, 'v25');
+insert into bm values (6, 394, 'v26');
+insert into bm values (7, 313, 'v27');
+insert into bm values (8, 232, 'v28');
+insert into bm values (9, 151, 'v29');
+insert into bm values (0, 70, 'v30');
+insert into bm values (1, 1989, 'v31');
+insert into bm values (2, 1908, 'v32');
+insert into bm values (3, 1827, 'v33');
+insert into bm values (4, 1746, 'v34');
+insert into bm values (5, 1665, 'v35');
+insert into bm values (6, 1584, 'v36');
+insert into bm values (7, 1503, 'v37');
+insert into bm values (8, 1422, 'v38');
+insert into bm values (9, 1341, 'v39');
+insert into bm values (0, 1260, 'v40');
+insert into bm values (1, 1179, 'v41');
+insert into bm values (2, 1098, 'v42');
+insert into bm values (3, 1017, 'v43');
+insert into bm values (4, 936, 'v44');
+insert into bm values (5, 855, 'v45');
+insert into bm values (6, 774, 'v46');
+insert into bm values (7, 693, 'v47');
+insert into bm values (8, 612, 'v48');
+insert into bm values (9, 531, 'v49');
+insert into bm values (0, 450, 'v0');
+insert into bm values (1, 369, 'v1');
+insert into bm values (2, 288, 'v2');
+insert into bm values (3, 207, 'v3');
+insert into bm values (4, 126, 'v4');
+insert into bm values (5, 45, 'v5');
+insert into bm values (6, 1964, 'v6');
+insert into bm values (7, 1883, 'v7');
+insert into bm values (8, 1802, 'v8');
+insert into bm values (9, 1721, 'v9');
+insert into bm values (0, 1640, 'v10');
+insert into bm values (1, 1559, 'v11');
+insert into bm values (2, 1478, 'v12');
+insert into bm values (3, 1397, 'v13');
+insert into bm values (4, 1316, 'v14');
+insert into bm values (5, 1235, 'v15');
+insert into bm values (6, 1154, 'v16');
+insert into bm values (7, 1073, 'v17');
+insert into bm values (8, 992, 'v18');
+insert into bm values (9, 911, 'v19');
+insert into bm values (0, 830, 'v20');
+insert into bm values (1, 749, 'v21');
+insert into bm values (2, 668, 'v22');
+insert into bm values (3, 587, 'v23');
+insert into bm values (4, 506, 'v24');
+insert into bm values (5, 425, 'v25');
+insert into bm values (6, 344, 'v26');
+insert into bm values (7, 263, 'v27');
+insert into bm values (8, 182, 'v28');
+insert into bm values (9, 101, 'v29');
+insert into bm values (0, 20, 'v30');
+insert into bm values (1, 1939, 'v31');
+insert into bm values (2, 1858, 'v32');
+insert into bm values (3, 1777, 'v33');
+insert into bm values (4, 1696, 'v34');
+insert into bm values (5, 1615, 'v35');
+insert into bm values (6, 1534, 'v36');
+insert into bm values (7, 1453, 'v37');
+insert into bm values (8, 1372, 'v38');
+insert into bm values (9, 1291, 'v39');
+insert into bm values (0, 1210, 'v40');
+insert into bm values (1, 1129, 'v41');
+insert into bm values (2, 1048, 'v42');
+insert into bm values (3, 967, 'v43');
+insert into bm values (4, 886, 'v44');
+insert into bm values (5, 805, 'v45');
+insert into bm values (6, 724, 'v46');
+insert into bm values (7, 643, 'v47');
+insert into bm values (8, 562, 'v48');
+insert into bm values (9, 481, 'v49');
+insert into bm values (0, 400, 'v0');
+insert into bm values (1, 319, 'v1');
+insert into bm values (2, 238, 'v2');
+insert into bm values (3, 157, 'v3');
+insert into bm values (4, 76, 'v4');
+insert into bm values (5, 1995, 'v5');
+insert into bm values (6, 1914, 'v6');
+insert into bm values (7, 1833, 'v7');
+insert into bm values (8, 1752, 'v8');
+insert into bm values (9, 1671, 'v9');
+insert into bm values (0, 1590, 'v10');
+insert into bm values (1, 1509, 'v11');
+insert into bm values (2, 1428, 'v12');
+insert into bm values (3, 1347, 'v13');
+insert into bm values (4, 1266, 'v14');
+insert into bm values (5, 1185, 'v15');
+insert into bm values (6, 1104, 'v16');
+insert into bm values (7, 1023, 'v17');
+insert into bm values (8, 942, 'v18');
+insert into bm values (9, 861, 'v19');
+insert into bm values (0, 780, 'v20');
+insert into bm values (1, 699, 'v21');
+insert into bm values (2, 618, 'v22');
+insert into bm values (3, 537, 'v23');
+insert into bm values (4, 456, 'v24');
+insert into bm values (5, 375, 'v25');
+insert into bm values (6, 294, 'v26');
+insert into bm values (7, 213, 'v27');
+insert into bm values (8, 132, 'v28');
+insert into bm values (9, 51, 'v29');
+insert into bm values (0, 1970, 'v30');
+insert into bm values (1, 1889, 'v31');
+insert into bm values (2, 1808, 'v32');
+insert into bm values (3, 1727, 'v33');
+insert into bm values (4, 1646, 'v34');
+insert into bm values (5, 1565, 'v35');
+insert into bm values (6, 1484, 'v36');
+insert into bm values (7, 1403, 'v37');
+insert into bm values (8, 1322, 'v38');
+insert into bm values (9, 1241, 'v39');
+insert into bm values (0, 1160, 'v40');
+insert into bm values (1, 1079, 'v41');
+insert into bm values (2, 998, 'v42');
+insert into bm values (3, 917, 'v43');
+insert into bm values (4, 836, 'v44');
+insert into bm values (5, 755, 'v45');
+insert into bm values (6, 674, 'v46');
+insert into bm values (7, 593, 'v47');
+insert into bm values (8, 512, 'v48');
+insert into bm values (9, 431, 'v49');
+insert into bm values (0, 350, 'v0');
+insert into bm values (1, 269, 'v1');
+insert into bm values (2, 188, 'v2');
+insert into bm values (3, 107, 'v3');
+insert into bm values (4, 26, 'v4');
+insert into bm values (5, 1945, 'v5');
+insert into bm values (6, 1864, 'v6');
+insert into bm values (7, 1783, 'v7');
+insert into bm values (8, 1702, 'v8');
+insert into bm values (9, 1621, 'v9');
+insert into bm values (0, 1540, 'v10');
+insert into bm values (1, 1459, 'v11');
+insert into bm values (2, 1378, 'v12');
+insert into bm values (3, 1297, 'v13');
+insert into bm values (4, 1216, 'v14');
+insert into bm values (5, 1135, 'v15');
+insert into bm values (6, 1054, 'v16');
+insert into bm values (7, 973, 'v17');
+insert into bm values (8, 892, 'v18');
+insert into bm values (9, 811, 'v19');
+insert into bm values (0, 730, 'v20');
+insert into bm values (1, 649, 'v21');
+insert into bm values (2, 568, 'v22');
+insert into bm values (3, 487, 'v23');
+insert into bm values (4, 406, 'v24');
+insert into bm values (5, 325, 'v25');
+insert into bm values (6, 244, 'v26');
+insert into bm values (7, 163, 'v27');
+insert into bm values (8, 82, 'v28');
+insert into bm values (9, 1, 'v29');
+insert into bm values (0, 1920, 'v30');
+insert into bm values (1, 1839, 'v31');
+insert into bm values (2, 1758, 'v32');
+insert into bm values (3, 1677, 'v33');
+insert into bm values (4, 1596, 'v34');
+insert into bm values (5, 1515, 'v35');
+insert into bm values (6, 1434, 'v36');
+insert into bm values (7, 1353, 'v37');
+insert into bm values (8, 1272, 'v38');
+insert into bm values (9, 1191, 'v39');
+insert into bm values (0, 1110, 'v40');
+insert into bm values (1, 1029, 'v41');
+insert into bm values (2, 948, 'v42');
+insert into bm values (3, 867, 'v43');
+insert into bm values (4, 786, 'v44');
+insert into bm values (5, 705, 'v45');
+insert into bm values (6, 624, 'v46');
+insert into bm values (7, 543, 'v47');
+insert into bm values (8, 462, 'v48');
+insert into bm values (9, 381, 'v49');
+insert into bm values (0, 300, 'v0');
+insert into bm values (1, 219, 'v1');
+insert into bm values (2, 138, 'v2');
+insert into bm values (3, 57, 'v3');
+insert into bm values (4, 1976, 'v4');
+insert into bm values (5, 1895, 'v5');
+insert into bm values (6, 1814, 'v6');
+insert into bm values (7, 1733, 'v7');
+insert into bm values (8, 1652, 'v8');
+insert into bm values (9, 1571, 'v9');
+insert into bm values (0, 1490, 'v10');
+insert into bm values (1, 1409, 'v11');
+insert into bm values (2, 1328, 'v12');
+insert into bm values (3, 1247, 'v13');
+insert into bm values (4, 1166, 'v14');
+insert into bm values (5, 1085, 'v15');
+insert into bm values (6, 1004, 'v16');
+insert into bm values (7, 923, 'v17');
+insert into bm values (8, 842, 'v18');
+insert into bm values (9, 761, 'v19');
+insert into bm values (0, 680, 'v20');
+insert into bm values (1, 599, 'v21');
+insert into bm values (2, 518, 'v22');
+insert into bm values (3, 437, 'v23');
+insert into bm values (4, 356, 'v24');
+insert into bm values (5, 275, 'v25');
+insert into bm values (6, 194, 'v26');
+insert into bm values (7, 113, 'v27');
+insert into bm values (8, 32, 'v28');
+insert into bm values (9, 1951, 'v29');
+insert into bm values (0, 1870, 'v30');
+insert into bm values (1, 1789, 'v31');
+insert into bm values (2, 1708, 'v32');
+insert into bm values (3, 1627, 'v33');
+insert into bm values (4, 1546, 'v34');
+insert into bm values (5, 1465, 'v35');
+insert into bm values (6, 1384, 'v36');
+insert into bm values (7, 1303, 'v37');
+insert into bm values (8, 1222, 'v38');
+insert into bm values (9, 1141, 'v39');
+insert into bm values (0, 1060, 'v40');
+insert into bm values (1, 979, 'v41');
+insert into bm values (2, 898, 'v42');
+insert into bm values (3, 817, 'v43');
+insert into bm values (4, 736, 'v44');
+insert into bm values (5, 655, 'v45');
+insert into bm values (6, 574, 'v46');
+insert into bm values (7, 493, 'v47');
+insert into bm values (8, 412, 'v48');
+insert into bm values (9, 331, 'v49');
+insert into bm values (0, 250, 'v0');
+insert into bm values (1, 169, 'v1');
+insert into bm values (2, 88, 'v2');
+insert into bm values (3, 7, 'v3');
+insert into bm values (4, 1926, 'v4');
+insert into bm values (5, 1845, 'v5');
+insert into bm values (6, 1764, 'v6');
+insert into bm values (7, 1683, 'v7');
+insert into bm values (8, 1602, 'v8');
+insert into bm values (9, 1521, 'v9');
+insert into bm values (0, 1440, 'v10');
+insert into bm values (1, 1359, 'v11');
+insert into bm values (2, 1278, 'v12');
+insert into bm values (3, 1197, 'v13');
+insert into bm values (4, 1116, 'v14');
+insert into bm values (5, 1035, 'v15');
+insert into bm values (6, 954, 'v16');
+insert into bm values (7, 873, 'v17');
+insert into bm values (8, 792, 'v18');
+insert into bm values (9, 711, 'v19');
+insert into bm values (0, 630, 'v20');
+insert into bm values (1, 549, 'v21');
+insert into bm values (2, 468, 'v22');
+insert into bm values (3, 387, 'v23');
+insert into bm values (4, 306, 'v24');
+insert into bm values (5, 225, 'v25');
+insert into bm values (6, 144, 'v26');
+insert into bm values (7, 63, 'v27');
+insert into bm values (8, 1982, 'v28');
+insert into bm values (9, 1901, 'v29');
+insert into bm values (0, 1820, 'v30');
+insert into bm values (1, 1739, 'v31');
+insert into bm values (2, 1658, 'v32');
+insert into bm values (3, 1577, 'v33');
+insert into bm values (4, 1496, 'v34');
+insert into bm values (5, 1415, 'v35');
+insert into bm values (6, 1334, 'v36');
+insert into bm values (7, 1253, 'v37');
+insert into bm values (8, 1172, 'v38');
+insert into bm values (9, 1091, 'v39');
+insert into bm values (0, 1010, 'v40');
+insert into bm values (1, 929, 'v41');
+insert into bm values (2, 848, 'v42');
+insert into bm values (3, 767, 'v43');
+insert into bm values (4, 686, 'v44');
+insert into bm values (5, 605, 'v45');
+insert into bm values (6, 524, 'v46');
+insert into bm values (7, 443, 'v47');
+insert into bm values (8, 362, 'v48');
+insert into bm values (9, 281, 'v49');
+insert into bm values (0, 200, 'v0');
+insert into bm values (1, 119, 'v1');
+insert into bm values (2, 38, 'v2');
+insert into bm values (3, 1957, 'v3');
+insert into bm values (4, 1876, 'v4');
+insert into bm values (5, 1795, 'v5');
+insert into bm values (6, 1714, 'v6');
+insert into bm values (7, 1633, 'v7');
+insert into bm values (8, 1552, 'v8');
+insert into bm values (9, 1471, 'v9');
+insert into bm values (0, 1390, 'v10');
+insert into bm values (1, 1309, 'v11');
+insert into bm values (2, 1228, 'v12');
+insert into bm values (3, 1147, 'v13');
+insert into bm values (4, 1066, 'v14');
+insert into bm values (5, 985, 'v15');
+insert into bm values (6, 904, 'v16');
+insert into bm values (7, 823, 'v17');
+insert into bm values (8, 742, 'v18');
+insert into bm values (9, 661, 'v19');
+insert into bm values (0, 580, 'v20');
+insert into bm values (1, 499, 'v21');
+insert into bm values (2, 418, 'v22');
+insert into bm values (3, 337, 'v23');
+insert into bm values (4, 256, 'v24');
+insert into bm values (5, 175, 'v25');
+insert into bm values (6, 94, 'v26');
+insert into bm values (7, 13, 'v27');
+insert into bm values (8, 1932, 'v28');
+insert into bm values (9, 1851, 'v29');
+insert into bm values (0, 1770, 'v30');
+insert into bm values (1, 1689, 'v31');
+insert into bm values (2, 1608, 'v32');
+insert into bm values (3, 1527, 'v33');
+insert into bm values (4, 1446, 'v34');
+insert into bm values (5, 1365, 'v35');
+insert into bm values (6, 1284, 'v36');
+insert into bm values (7, 1203, 'v37');
+insert into bm values (8, 1122, 'v38');
+insert into bm values (9, 1041, 'v39');
+insert into bm values (0, 960, 'v40');
+insert into bm values (1, 879, 'v41');
+insert into bm values (2, 798, 'v42');
+insert into bm values (3, 717, 'v43');
+insert into bm values (4, 636, 'v44');
+insert into bm values (5, 555, 'v45');
+insert into bm values (6, 474, 'v46');
+insert into bm values (7, 393, 'v47');
+insert into bm values (8, 312, 'v48');
+insert into bm values (9, 231, 'v49');
+insert into bm values (0, 150, 'v0');
+insert into bm values (1, 69, 'v1');
+insert into bm values (2, 1988, 'v2');
+insert into bm values (3, 1907, 'v3');
+insert into bm values (4, 1826, 'v4');
+insert into bm values (5, 1745, 'v5');
+insert into bm values (6, 1664, 'v6');
+insert into bm values (7, 1583, 'v7');
+insert into bm values (8, 1502, 'v8');
+insert into bm values (9, 1421, 'v9');
+insert into bm values (0, 1340, 'v10');
+insert into bm values (1, 1259, 'v11');
+insert into bm values (2, 1178, 'v12');
+insert into bm values (3, 1097, 'v13');
+insert into bm values (4, 1016, 'v14');
+insert into bm values (5, 935, 'v15');
+insert into bm values (6, 854, 'v16');
+insert into bm values (7, 773, 'v17');
+insert into bm values (8, 692, 'v18');
+insert into bm values (9, 611, 'v19');
+insert into bm values (0, 530, 'v20');
+insert into bm values (1, 449, 'v21');
+insert into bm values (2, 368, 'v22');
+insert into bm values (3, 287, 'v23');
+insert into bm values (4, 206, 'v24');
+insert into bm values (5, 125, 'v25');
+insert into bm values (6, 44, 'v26');
+insert into bm values (7, 1963, 'v27');
+insert into bm values (8, 1882, 'v28');
+insert into bm values (9, 1801, 'v29');
+insert into bm values (0, 1720, 'v30');
+insert into bm values (1, 1639, 'v31');
+insert into bm values (2, 1558, 'v32');
+insert into bm values (3, 1477, 'v33');
+insert into bm values (4, 1396, 'v34');
+insert into bm values (5, 1315, 'v35');
+insert into bm values (6, 1234, 'v36');
+insert into bm values (7, 1153, 'v37');
+insert into bm values (8, 1072, 'v38');
+insert into bm values (9, 991, 'v39');
+insert into bm values (0, 910, 'v40');
+insert into bm values (1, 829, 'v41');
+insert into bm values (2, 748, 'v42');
+insert into bm values (3, 667, 'v43');
+insert into bm values (4, 586, 'v44');
+insert into bm values (5, 505, 'v45');
+insert into bm values (6, 424, 'v46');
+insert into bm values (7, 343, 'v47');
+insert into bm values (8, 262, 'v48');
+insert into bm values (9, 181, 'v49');
+insert into bm values (0, 100, 'v0');
+insert into bm values (1, 19, 'v1');
+insert into bm values (2, 1938, 'v2');
+insert into bm values (3, 1857, 'v3');
+insert into bm values (4, 1776, 'v4');
+insert into bm values (5, 1695, 'v5');
+insert into bm values (6, 1614, 'v6');
+insert into bm values (7, 1533, 'v7');
+insert into bm values (8, 1452, 'v8');
+insert into bm values (9, 1371, 'v9');
+insert into bm values (0, 1290, 'v10');
+insert into bm values (1, 1209, 'v11');
+insert into bm values (2, 1128, 'v12');
+insert into bm values (3, 1047, 'v13');
+insert into bm values (4, 966, 'v14');
+insert into bm values (5, 885, 'v15');
+insert into bm values (6, 804, 'v16');
+insert into bm values (7, 723, 'v17');
+insert into bm values (8, 642, 'v18');
+insert into bm values (9, 561, 'v19');
+insert into bm values (0, 480, 'v20');
+insert into bm values (1, 399, 'v21');
+insert into bm values (2, 318, 'v22');
+insert into bm values (3, 237, 'v23');
+insert into bm values (4, 156, 'v24');
+insert into bm values (5, 75, 'v25');
+insert into bm values (6, 1994, 'v26');
+insert into bm values (7, 1913, 'v27');
+insert into bm values (8, 1832, 'v28');
+insert into bm values (9, 1751, 'v29');
+insert into bm values (0, 1670, 'v30');
+insert into bm values (1, 1589, 'v31');
+insert into bm values (2, 1508, 'v32');
+insert into bm values (3, 1427, 'v33');
+insert into bm values (4, 1346, 'v34');
+insert into bm values (5, 1265, 'v35');
+insert into bm values (6, 1184, 'v36');
+insert into bm values (7, 1103, 'v37');
+insert into bm values (8, 1022, 'v38');
+insert into bm values (9, 941, 'v39');
+insert into bm values (0, 860, 'v40');
+insert into bm values (1, 779, 'v41');
+insert into bm values (2, 698, 'v42');
+insert into bm values (3, 617, 'v43');
+insert into bm values (4, 536, 'v44');
+insert into bm values (5, 455, 'v45');
+insert into bm values (6, 374, 'v46');
+insert into bm values (7, 293, 'v47');
+insert into bm values (8, 212, 'v48');
+insert into bm values (9, 131, 'v49');
+insert into bm values (0, 50, 'v0');
+insert into bm values (1, 1969, 'v1');
+insert into bm values (2, 1888, 'v2');
+insert into bm values (3, 1807, 'v3');
+insert into bm values (4, 1726, 'v4');
+insert into bm values (5, 1645, 'v5');
+insert into bm values (6, 1564, 'v6');
+insert into bm values (7, 1483, 'v7');
+insert into bm values (8, 1402, 'v8');
+insert into bm values (9, 1321, 'v9');
+insert into bm values (0, 1240, 'v10');
+insert into bm values (1, 1159, 'v11');
+insert into bm values (2, 1078, 'v12');
+insert into bm values (3, 997, 'v13');
+insert into bm values (4, 916, 'v14');
+insert into bm values (5, 835, 'v15');
+insert into bm values (6, 754, 'v16');
+insert into bm values (7, 673, 'v17');
+insert into bm values (8, 592, 'v18');
+insert into bm values (9, 511, 'v19');
+insert into bm values (0, 430, 'v20');
+insert into bm values (1, 349, 'v21');
+insert into bm values (2, 268, 'v22');
+insert into bm values (3, 187, 'v23');
+insert into bm values (4, 106, 'v24');
+insert into bm values (5, 25, 'v25');
+insert into bm values (6, 1944, 'v26');
+insert into bm values (7, 1863, 'v27');
+insert into bm values (8, 1782, 'v28');
+insert into bm values (9, 1701, 'v29');
+insert into bm values (0, 1620, 'v30');
+insert into bm values (1, 1539, 'v31');
+insert into bm values (2, 1458, 'v32');
+insert into bm values (3, 1377, 'v33');
+insert into bm values (4, 1296, 'v34');
+insert into bm values (5, 1215, 'v35');
+insert into bm values (6, 1134, 'v36');
+insert into bm values (7, 1053, 'v37');
+insert into bm values (8, 972, 'v38');
+insert into bm values (9, 891, 'v39');
+insert into bm values (0, 810, 'v40');
+insert into bm values (1, 729, 'v41');
+insert into bm values (2, 648, 'v42');
+insert into bm values (3, 567, 'v43');
+insert into bm values (4, 486, 'v44');
+insert into bm values (5, 405, 'v45');
+insert into bm values (6, 324, 'v46');
+insert into bm values (7, 243, 'v47');
+insert into bm values (8, 162, 'v48');
+insert into bm values (9, 81, 'v49');
+insert into bm_seq values (0, 0, 'v0');
+insert into bm_seq values (1, 1919, 'v1');
+insert into bm_seq values (2, 1838, 'v2');
+insert into bm_seq values (3, 1757, 'v3');
+insert into bm_seq values (4, 1676, 'v4');
+insert into bm_seq values (5, 1595, 'v5');
+insert into bm_seq values (6, 1514, 'v6');
+insert into bm_seq values (7, 1433, 'v7');
+insert into bm_seq values (8, 1352, 'v8');
+insert into bm_seq values (9, 1271, 'v9');
+insert into bm_seq values (0, 1190, 'v10');
+insert into bm_seq values (1, 1109, 'v11');
+insert into bm_seq values (2, 1028, 'v12');
+insert into bm_seq values (3, 947, 'v13');
+insert into bm_seq values (4, 866, 'v14');
+insert into bm_seq values (5, 785, 'v15');
+insert into bm_seq values (6, 704, 'v16');
+insert into bm_seq values (7, 623, 'v17');
+insert into bm_seq values (8, 542, 'v18');
+insert into bm_seq values (9, 461, 'v19');
+insert into bm_seq values (0, 380, 'v20');
+insert into bm_seq values (1, 299, 'v21');
+insert into bm_seq values (2, 218, 'v22');
+insert into bm_seq values (3, 137, 'v23');
+insert into bm_seq values (4, 56, 'v24');
+insert into bm_seq values (5, 1975, 'v25');
+insert into bm_seq values (6, 1894, 'v26');
+insert into bm_seq values (7, 1813, 'v27');
+insert into bm_seq values (8, 1732, 'v28');
+insert into bm_seq values (9, 1651, 'v29');
+insert into bm_seq values (0, 1570, 'v30');
+insert into bm_seq values (1, 1489, 'v31');
+insert into bm_seq values (2, 1408, 'v32');
+insert into bm_seq values (3, 1327, 'v33');
+insert into bm_seq values (4, 1246, 'v34');
+insert into bm_seq values (5, 1165, 'v35');
+insert into bm_seq values (6, 1084, 'v36');
+insert into bm_seq values (7, 1003, 'v37');
+insert into bm_seq values (8, 922, 'v38');
+insert into bm_seq values (9, 841, 'v39');
+insert into bm_seq values (0, 760, 'v40');
+insert into bm_seq values (1, 679, 'v41');
+insert into bm_seq values (2, 598, 'v42');
+insert into bm_seq values (3, 517, 'v43');
+insert into bm_seq values (4, 436, 'v44');
+insert into bm_seq values (5, 355, 'v45');
+insert into bm_seq values (6, 274, 'v46');
+insert into bm_seq values (7, 193, 'v47');
+insert into bm_seq values (8, 112, 'v48');
+insert into bm_seq values (9, 31, 'v49');
+insert into bm_seq values (0, 1950, 'v0');
+insert into bm_seq values (1, 1869, 'v1');
+insert into bm_seq values (2, 1788, 'v2');
+insert into bm_seq values (3, 1707, 'v3');
+insert into bm_seq values (4, 1626, 'v4');
+insert into bm_seq values (5, 1545, 'v5');
+insert into bm_seq values (6, 1464, 'v6');
+insert into bm_seq values (7, 1383, 'v7');
+insert into bm_seq values (8, 1302, 'v8');
+insert into bm_seq values (9, 1221, 'v9');
+insert into bm_seq values (0, 1140, 'v10');
+insert into bm_seq values (1, 1059, 'v11');
+insert into bm_seq values (2, 978, 'v12');
+insert into bm_seq values (3, 897, 'v13');
+insert into bm_seq values (4, 816, 'v14');
+insert into bm_seq values (5, 735, 'v15');
+insert into bm_seq values (6, 654, 'v16');
+insert into bm_seq values (7, 573, 'v17');
+insert into bm_seq values (8, 492, 'v18');
+insert into bm_seq values (9, 411, 'v19');
+insert into bm_seq values (0, 330, 'v20');
+insert into bm_seq values (1, 249, 'v21');
+insert into bm_seq values (2, 168, 'v22');
+insert into bm_seq values (3, 87, 'v23');
+insert into bm_seq values (4, 6, 'v24');
+insert into bm_seq values (5, 1925, 'v25');
+insert into bm_seq values (6, 1844, 'v26');
+insert into bm_seq values (7, 1763, 'v27');
+insert into bm_seq values (8, 1682, 'v28');
+insert into bm_seq values (9, 1601, 'v29');
+insert into bm_seq values (0, 1520, 'v30');
+insert into bm_seq values (1, 1439, 'v31');
+insert into bm_seq values (2, 1358, 'v32');
+insert into bm_seq values (3, 1277, 'v33');
+insert into bm_seq values (4, 1196, 'v34');
+insert into bm_seq values (5, 1115, 'v35');
+insert into bm_seq values (6, 1034, 'v36');
+insert into bm_seq values (7, 953, 'v37');
+insert into bm_seq values (8, 872, 'v38');
+insert into bm_seq values (9, 791, 'v39');
+insert into bm_seq values (0, 710, 'v40');
+insert into bm_seq values (1, 629, 'v41');
+insert into bm_seq values (2, 548, 'v42');
+insert into bm_seq values (3, 467, 'v43');
+insert into bm_seq values (4, 386, 'v44');
+insert into bm_seq values (5, 305, 'v45');
+insert into bm_seq values (6, 224, 'v46');
+insert into bm_seq values (7, 143, 'v47');
+insert into bm_seq values (8, 62, 'v48');
+insert into bm_seq values (9, 1981, 'v49');
+insert into bm_seq values (0, 1900, 'v0');
+insert into bm_seq values (1, 1819, 'v1');
+insert into bm_seq values (2, 1738, 'v2');
+insert into bm_seq values (3, 1657, 'v3');
+insert into bm_seq values (4, 1576, 'v4');
+insert into bm_seq values (5, 1495, 'v5');
+insert into bm_seq values (6, 1414, 'v6');
+insert into bm_seq values (7, 1333, 'v7');
+insert into bm_seq values (8, 1252, 'v8');
+insert into bm_seq values (9, 1171, 'v9');
+insert into bm_seq values (0, 1090, 'v10');
+insert into bm_seq values (1, 1009, 'v11');
+insert into bm_seq values (2, 928, 'v12');
+insert into bm_seq values (3, 847, 'v13');
+insert into bm_seq values (4, 766, 'v14');
+insert into bm_seq values (5, 685, 'v15');
+insert into bm_seq values (6, 604, 'v16');
+insert into bm_seq values (7, 523, 'v17');
+insert into bm_seq values (8, 442, 'v18');
+insert into bm_seq values (9, 361, 'v19');
+insert into bm_seq values (0, 280, 'v20');
+insert into bm_seq values (1, 199, 'v21');
+insert into bm_seq values (2, 118, 'v22');
+insert into bm_seq values (3, 37, 'v23');
+insert into bm_seq values (4, 1956, 'v24');
+insert into bm_seq values (5, 1875, 'v25');
+insert into bm_seq values (6, 1794, 'v26');
+insert into bm_seq values (7, 1713, 'v27');
+insert into bm_seq values (8, 1632, 'v28');
+insert into bm_seq values (9, 1551, 'v29');
+insert into bm_seq values (0, 1470, 'v30');
+insert into bm_seq values (1, 1389, 'v31');
+insert into bm_seq values (2, 1308, 'v32');
+insert into bm_seq values (3, 1227, 'v33');
+insert into bm_seq values (4, 1146, 'v34');
+insert into bm_seq values (5, 1065, 'v35');
+insert into bm_seq values (6, 984, 'v36');
+insert into bm_seq values (7, 903, 'v37');
+insert into bm_seq values (8, 822, 'v38');
+insert into bm_seq values (9, 741, 'v39');
+insert into bm_seq values (0, 660, 'v40');
+insert into bm_seq values (1, 579, 'v41');
+insert into bm_seq values (2, 498, 'v42');
+insert into bm_seq values (3, 417, 'v43');
+insert into bm_seq values (4, 336, 'v44');
+insert into bm_seq values (5, 255, 'v45');
+insert into bm_seq values (6, 174, 'v46');
+insert into bm_seq values (7, 93, 'v47');
+insert into bm_seq values (8, 12, 'v48');
+insert into bm_seq values (9, 1931, 'v49');
+insert into bm_seq values (0, 1850, 'v0');
+insert into bm_seq values (1, 1769, 'v1');
+insert into bm_seq values (2, 1688, 'v2');
+insert into bm_seq values (3, 1607, 'v3');
+insert into bm_seq values (4, 1526, 'v4');
+insert into bm_seq values (5, 1445, 'v5');
+insert into bm_seq values (6, 1364, 'v6');
+insert into bm_seq values (7, 1283, 'v7');
+insert into bm_seq values (8, 1202, 'v8');
+insert into bm_seq values (9, 1121, 'v9');
+insert into bm_seq values (0, 1040, 'v10');
+insert into bm_seq values (1, 959, 'v11');
+insert into bm_seq values (2, 878, 'v12');
+insert into bm_seq values (3, 797, 'v13');
+insert into bm_seq values (4, 716, 'v14');
+insert into bm_seq values (5, 635, 'v15');
+insert into bm_seq values (6, 554, 'v16');
+insert into bm_seq values (7, 473, 'v17');
+insert into bm_seq values (8, 392, 'v18');
+insert into bm_seq values (9, 311, 'v19');
+insert into bm_seq values (0, 230, 'v20');
+insert into bm_seq values (1, 149, 'v21');
+insert into bm_seq values (2, 68, 'v22');
+insert into bm_seq values (3, 1987, 'v23');
+insert into bm_seq values (4, 1906, 'v24');
+insert into bm_seq values (5, 1825, 'v25');
+insert into bm_seq values (6, 1744, 'v26');
+insert into bm_seq values (7, 1663, 'v27');
+insert into bm_seq values (8, 1582, 'v28');
+insert into bm_seq values (9, 1501, 'v29');
+insert into bm_seq values (0, 1420, 'v30');
+insert into bm_seq values (1, 1339, 'v31');
+insert into bm_seq values (2, 1258, 'v32');
+insert into bm_seq values (3, 1177, 'v33');
+insert into bm_seq values (4, 1096, 'v34');
+insert into bm_seq values (5, 1015, 'v35');
+insert into bm_seq values (6, 934, 'v36');
+insert into bm_seq values (7, 853, 'v37');
+insert into bm_seq values (8, 772, 'v38');
+insert into bm_seq values (9, 691, 'v39');
+insert into bm_seq values (0, 610, 'v40');
+insert into bm_seq values (1, 529, 'v41');
+insert into bm_seq values (2, 448, 'v42');
+insert into bm_seq values (3, 367, 'v43');
+insert into bm_seq values (4, 286, 'v44');
+insert into bm_seq values (5, 205, 'v45');
+insert into bm_seq values (6, 124, 'v46');
+insert into bm_seq values (7, 43, 'v47');
+insert into bm_seq values (8, 1962, 'v48');
+insert into bm_seq values (9, 1881, 'v49');
+insert into bm_seq values (0, 1800, 'v0');
+insert into bm_seq values (1, 1719, 'v1');
+insert into bm_seq values (2, 1638, 'v2');
+insert into bm_seq values (3, 1557, 'v3');
+insert into bm_seq values (4, 1476, 'v4');
+insert into bm_seq values (5, 1395, 'v5');
+insert into bm_seq values (6, 1314, 'v6');
+insert into bm_seq values (7, 1233, 'v7');
+insert into bm_seq values (8, 1152, 'v8');
+insert into bm_seq values (9, 1071, 'v9');
+insert into bm_seq values (0, 990, 'v10');
+insert into bm_seq values (1, 909, 'v11');
+insert into bm_seq values (2, 828, 'v12');
+insert into bm_seq values (3, 747, 'v13');
+insert into bm_seq values (4, 666, 'v14');
+insert into bm_seq values (5, 585, 'v15');
+insert into bm_seq values (6, 504, 'v16');
+insert into bm_seq values (7, 423, 'v17');
+insert into bm_seq values (8, 342, 'v18');
+insert into bm_seq values (9, 261, 'v19');
+insert into bm_seq values (0, 180, 'v20');
+insert into bm_seq values (1, 99, 'v21');
+insert into bm_seq values (2, 18, 'v22');
+insert into bm_seq values (3, 1937, 'v23');
+insert into bm_seq values (4, 1856, 'v24');
+insert into bm_seq values (5, 1775, 'v25');
+insert into bm_seq values (6, 1694, 'v26');
+insert into bm_seq values (7, 1613, 'v27');
+insert into bm_seq values (8, 1532, 'v28');
+insert into bm_seq values (9, 1451, 'v29');
+insert into bm_seq values (0, 1370, 'v30');
+insert into bm_seq values (1, 1289, 'v31');
+insert into bm_seq values (2, 1208, 'v32');
+insert into bm_seq values (3, 1127, 'v33');
+insert into bm_seq values (4, 1046, 'v34');
+insert into bm_seq values (5, 965, 'v35');
+insert into bm_seq values (6, 884, 'v36');
+insert into bm_seq values (7, 803, 'v37');
+insert into bm_seq values (8, 722, 'v38');
+insert into bm_seq values (9, 641, 'v39');
+insert into bm_seq values (0, 560, 'v40');
+insert into bm_seq values (1, 479, 'v41');
+insert into bm_seq values (2, 398, 'v42');
+insert into bm_seq values (3, 317, 'v43');
+insert into bm_seq values (4, 236, 'v44');
+insert into bm_seq values (5, 155, 'v45');
+insert into bm_seq values (6, 74, 'v46');
+insert into bm_seq values (7, 1993, 'v47');
+insert into bm_seq values (8, 1912, 'v48');
+insert into bm_seq values (9, 1831, 'v49');
+insert into bm_seq values (0, 1750, 'v0');
+insert into bm_seq values (1, 1669, 'v1');
+insert into bm_seq values (2, 1588, 'v2');
+insert into bm_seq values (3, 1507, 'v3');
+insert into bm_seq values (4, 1426, 'v4');
+insert into bm_seq values (5, 1345, 'v5');
+insert into bm_seq values (6, 1264, 'v6');
+insert into bm_seq values (7, 1183, 'v7');
+insert into bm_seq values (8, 1102, 'v8');
+insert into bm_seq values (9, 1021, 'v9');
+insert into bm_seq values (0, 940, 'v10');
+insert into bm_seq values (1, 859, 'v11');
+insert into bm_seq values (2, 778, 'v12');
+insert into bm_seq values (3, 697, 'v13');
+insert into bm_seq values (4, 616, 'v14');
+insert into bm_seq values (5, 535, 'v15');
+insert into bm_seq values (6, 454, 'v16');
+insert into bm_seq values (7, 373, 'v17');
+insert into bm_seq values (8, 292, 'v18');
+insert into bm_seq values (9, 211, 'v19');
+insert into bm_seq values (0, 130, 'v20');
+insert into bm_seq values (1, 49, 'v21');
+insert into bm_seq values (2, 1968, 'v22');
+insert into bm_seq values (3, 1887, 'v23');
+insert into bm_seq values (4, 1806, 'v24');
+insert into bm_seq values (5, 1725, 'v25');
+insert into bm_seq values (6, 1644, 'v26');
+insert into bm_seq values (7, 1563, 'v27');
+insert into bm_seq values (8, 1482, 'v28');
+insert into bm_seq values (9, 1401, 'v29');
+insert into bm_seq values (0, 1320, 'v30');
+insert into bm_seq values (1, 1239, 'v31');
+insert into bm_seq values (2, 1158, 'v32');
+insert into bm_seq values (3, 1077, 'v33');
+insert into bm_seq values (4, 996, 'v34');
+insert into bm_seq values (5, 915, 'v35');
+insert into bm_seq values (6, 834, 'v36');
+insert into bm_seq values (7, 753, 'v37');
+insert into bm_seq values (8, 672, 'v38');
+insert into bm_seq values (9, 591, 'v39');
+insert into bm_seq values (0, 510, 'v40');
+insert into bm_seq values (1, 429, 'v41');
+insert into bm_seq values (2, 348, 'v42');
+insert into bm_seq values (3, 267, 'v43');
+insert into bm_seq values (4, 186, 'v44');
+insert into bm_seq values (5, 105, 'v45');
+insert into bm_seq values (6, 24, 'v46');
+insert into bm_seq values (7, 1943, 'v47');
+insert into bm_seq values (8, 1862, 'v48');
+insert into bm_seq values (9, 1781, 'v49');
+insert into bm_seq values (0, 1700, 'v0');
+insert into bm_seq values (1, 1619, 'v1');
+insert into bm_seq values (2, 1538, 'v2');
+insert into bm_seq values (3, 1457, 'v3');
+insert into bm_seq values (4, 1376, 'v4');
+insert into bm_seq values (5, 1295, 'v5');
+insert into bm_seq values (6, 1214, 'v6');
+insert into bm_seq values (7, 1133, 'v7');
+insert into bm_seq values (8, 1052, 'v8');
+insert into bm_seq values (9, 971, 'v9');
+insert into bm_seq values (0, 890, 'v10');
+insert into bm_seq values (1, 809, 'v11');
+insert into bm_seq values (2, 728, 'v12');
+insert into bm_seq values (3, 647, 'v13');
+insert into bm_seq values (4, 566, 'v14');
+insert into bm_seq values (5, 485, 'v15');
+insert into bm_seq values (6, 404, 'v16');
+insert into bm_seq values (7, 323, 'v17');
+insert into bm_seq values (8, 242, 'v18');
+insert into bm_seq values (9, 161, 'v19');
+insert into bm_seq values (0, 80, 'v20');
+insert into bm_seq values (1, 1999, 'v21');
+insert into bm_seq values (2, 1918, 'v22');
+insert into bm_seq values (3, 1837, 'v23');
+insert into bm_seq values (4, 1756, 'v24');
+insert into bm_seq values (5, 1675, 'v25');
+insert into bm_seq values (6, 1594, 'v26');
+insert into bm_seq values (7, 1513, 'v27');
+insert into bm_seq values (8, 1432, 'v28');
+insert into bm_seq values (9, 1351, 'v29');
+insert into bm_seq values (0, 1270, 'v30');
+insert into bm_seq values (1, 1189, 'v31');
+insert into bm_seq values (2, 1108, 'v32');
+insert into bm_seq values (3, 1027, 'v33');
+insert into bm_seq values (4, 946, 'v34');
+insert into bm_seq values (5, 865, 'v35');
+insert into bm_seq values (6, 784, 'v36');
+insert into bm_seq values (7, 703, 'v37');
+insert into bm_seq values (8, 622, 'v38');
+insert into bm_seq values (9, 541, 'v39');
+insert into bm_seq values (0, 460, 'v40');
+insert into bm_seq values (1, 379, 'v41');
+insert into bm_seq values (2, 298, 'v42');
+insert into bm_seq values (3, 217, 'v43');
+insert into bm_seq values (4, 136, 'v44');
+insert into bm_seq values (5, 55, 'v45');
+insert into bm_seq values (6, 1974, 'v46');
+insert into bm_seq values (7, 1893, 'v47');
+insert into bm_seq values (8, 1812, 'v48');
+insert into bm_seq values (9, 1731, 'v49');
+insert into bm_seq values (0, 1650, 'v0');
+insert into bm_seq values (1, 1569, 'v1');
+insert into bm_seq values (2, 1488, 'v2');
+insert into bm_seq values (3, 1407, 'v3');
+insert into bm_seq values (4, 1326, 'v4');
+insert into bm_seq values (5, 1245, 'v5');
+insert into bm_seq values (6, 1164, 'v6');
+insert into bm_seq values (7, 1083, 'v7');
+insert into bm_seq values (8, 1002, 'v8');
+insert into bm_seq values (9, 921, 'v9');
+insert into bm_seq values (0, 840, 'v10');
+insert into bm_seq values (1, 759, 'v11');
+insert into bm_seq values (2, 678, 'v12');
+insert into bm_seq values (3, 597, 'v13');
+insert into bm_seq values (4, 516, 'v14');
+insert into bm_seq values (5, 435, 'v15');
+insert into bm_seq values (6, 354, 'v16');
+insert into bm_seq values (7, 273, 'v17');
+insert into bm_seq values (8, 192, 'v18');
+insert into bm_seq values (9, 111, 'v19');
+insert into bm_seq values (0, 30, 'v20');
+insert into bm_seq values (1, 1949, 'v21');
+insert into bm_seq values (2, 1868, 'v22');
+insert into bm_seq values (3, 1787, 'v23');
+insert into bm_seq values (4, 1706, 'v24');
+insert into bm_seq values (5, 1625, 'v25');
+insert into bm_seq values (6, 1544, 'v26');
+insert into bm_seq values (7, 1463, 'v27');
+insert into bm_seq values (8, 1382, 'v28');
+insert into bm_seq values (9, 1301, 'v29');
+insert into bm_seq values (0, 1220, 'v30');
+insert into bm_seq values (1, 1139, 'v31');
+insert into bm_seq values (2, 1058, 'v32');
+insert into bm_seq values (3, 977, 'v33');
+insert into bm_seq values (4, 896, 'v34');
+insert into bm_seq values (5, 815, 'v35');
+insert into bm_seq values (6, 734, 'v36');
+insert into bm_seq values (7, 653, 'v37');
+insert into bm_seq values (8, 572, 'v38');
+insert into bm_seq values (9, 491, 'v39');
+insert into bm_seq values (0, 410, 'v40');
+insert into bm_seq values (1, 329, 'v41');
+insert into bm_seq values (2, 248, 'v42');
+insert into bm_seq values (3, 167, 'v43');
+insert into bm_seq values (4, 86, 'v44');
+insert into bm_seq values (5, 5, 'v45');
+insert into bm_seq values (6, 1924, 'v46');
+insert into bm_seq values (7, 1843, 'v47');
+insert into bm_seq values (8, 1762, 'v48');
+insert into bm_seq values (9, 1681, 'v49');
+insert into bm_seq values (0, 1600, 'v0');
+insert into bm_seq values (1, 1519, 'v1');
+insert into bm_seq values (2, 1438, 'v2');
+insert into bm_seq values (3, 1357, 'v3');
+insert into bm_seq values (4, 1276, 'v4');
+insert into bm_seq values (5, 1195, 'v5');
+insert into bm_seq values (6, 1114, 'v6');
+insert into bm_seq values (7, 1033, 'v7');
+insert into bm_seq values (8, 952, 'v8');
+insert into bm_seq values (9, 871, 'v9');
+insert into bm_seq values (0, 790, 'v10');
+insert into bm_seq values (1, 709, 'v11');
+insert into bm_seq values (2, 628, 'v12');
+insert into bm_seq values (3, 547, 'v13');
+insert into bm_seq values (4, 466, 'v14');
+insert into bm_seq values (5, 385, 'v15');
+insert into bm_seq values (6, 304, 'v16');
+insert into bm_seq values (7, 223, 'v17');
+insert into bm_seq values (8, 142, 'v18');
+insert into bm_seq values (9, 61, 'v19');
+insert into bm_seq values (0, 1980, 'v20');
+insert into bm_seq values (1, 1899, 'v21');
+insert into bm_seq values (2, 1818, 'v22');
+insert into bm_seq values (3, 1737, 'v23');
+insert into bm_seq values (4, 1656, 'v24');
+insert into bm_seq values (5, 1575, 'v25');
+insert into bm_seq values (6, 1494, 'v26');
+insert into bm_seq values (7, 1413, 'v27');
+insert into bm_seq values (8, 1332, 'v28');
+insert into bm_seq values (9, 1251, 'v29');
+insert into bm_seq values (0, 1170, 'v30');
+insert into bm_seq values (1, 1089, 'v31');
+insert into bm_seq values (2, 1008, 'v32');
+insert into bm_seq values (3, 927, 'v33');
+insert into bm_seq values (4, 846, 'v34');
+insert into bm_seq values (5, 765, 'v35');
+insert into bm_seq values (6, 684, 'v36');
+insert into bm_seq values (7, 603, 'v37');
+insert into bm_seq values (8, 522, 'v38');
+insert into bm_seq values (9, 441, 'v39');
+insert into bm_seq values (0, 360, 'v40');
+insert into bm_seq values (1, 279, 'v41');
+insert into bm_seq values (2, 198, 'v42');
+insert into bm_seq values (3, 117, 'v43');
+insert into bm_seq values (4, 36, 'v44');
+insert into bm_seq values (5, 1955, 'v45');
+insert into bm_seq values (6, 1874, 'v46');
+insert into bm_seq values (7, 1793, 'v47');
+insert into bm_seq values (8, 1712, 'v48');
+insert into bm_seq values (9, 1631, 'v49');
+insert into bm_seq values (0, 1550, 'v0');
+insert into bm_seq values (1, 1469, 'v1');
+insert into bm_seq values (2, 1388, 'v2');
+insert into bm_seq values (3, 1307, 'v3');
+insert into bm_seq values (4, 1226, 'v4');
+insert into bm_seq values (5, 1145, 'v5');
+insert into bm_seq values (6, 1064, 'v6');
+insert into bm_seq values (7, 983, 'v7');
+insert into bm_seq values (8, 902, 'v8');
+insert into bm_seq values (9, 821, 'v9');
+insert into bm_seq values (0, 740, 'v10');
+insert into bm_seq values (1, 659, 'v11');
+insert into bm_seq values (2, 578, 'v12');
+insert into bm_seq values (3, 497, 'v13');
+insert into bm_seq values (4, 416, 'v14');
+insert into bm_seq values (5, 335, 'v15');
+insert into bm_seq values (6, 254, 'v16');
+insert into bm_seq values (7, 173, 'v17');
+insert into bm_seq values (8, 92, 'v18');
+insert into bm_seq values (9, 11, 'v19');
+insert into bm_seq values (0, 1930, 'v20');
+insert into bm_seq values (1, 1849, 'v21');
+insert into bm_seq values (2, 1768, 'v22');
+insert into bm_seq values (3, 1687, 'v23');
+insert into bm_seq values (4, 1606, 'v24');
+insert into bm_seq values (5, 1525, 'v25');
+insert into bm_seq values (6, 1444, 'v26');
+insert into bm_seq values (7, 1363, 'v27');
+insert into bm_seq values (8, 1282, 'v28');
+insert into bm_seq values (9, 1201, 'v29');
+insert into bm_seq values (0, 1120, 'v30');
+insert into bm_seq values (1, 1039, 'v31');
+insert into bm_seq values (2, 958, 'v32');
+insert into bm_seq values (3, 877, 'v33');
+insert into bm_seq values (4, 796, 'v34');
+insert into bm_seq values (5, 715, 'v35');
+insert into bm_seq values (6, 634, 'v36');
+insert into bm_seq values (7, 553, 'v37');
+insert into bm_seq values (8, 472, 'v38');
+insert into bm_seq values (9, 391, 'v39');
+insert into bm_seq values (0, 310, 'v40');
+insert into bm_seq values (1, 229, 'v41');
+insert into bm_seq values (2, 148, 'v42');
+insert into bm_seq values (3, 67, 'v43');
+insert into bm_seq values (4, 1986, 'v44');
+insert into bm_seq values (5, 1905, 'v45');
+insert into bm_seq values (6, 1824, 'v46');
+insert into bm_seq values (7, 1743, 'v47');
+insert into bm_seq values (8, 1662, 'v48');
+insert into bm_seq values (9, 1581, 'v49');
+insert into bm_seq values (0, 1500, 'v0');
+insert into bm_seq values (1, 1419, 'v1');
+insert into bm_seq values (2, 1338, 'v2');
+insert into bm_seq values (3, 1257, 'v3');
+insert into bm_seq values (4, 1176, 'v4');
+insert into bm_seq values (5, 1095, 'v5');
+insert into bm_seq values (6, 1014, 'v6');
+insert into bm_seq values (7, 933, 'v7');
+insert into bm_seq values (8, 852, 'v8');
+insert into bm_seq values (9, 771, 'v9');
+insert into bm_seq values (0, 690, 'v10');
+insert into bm_seq values (1, 609, 'v11');
+insert into bm_seq values (2, 528, 'v12');
+insert into bm_seq values (3, 447, 'v13');
+insert into bm_seq values (4, 366, 'v14');
+insert into bm_seq values (5, 285, 'v15');
+insert into bm_seq values (6, 204, 'v16');
+insert into bm_seq values (7, 123, 'v17');
+insert into bm_seq values (8, 42, 'v18');
+insert into bm_seq values (9, 1961, 'v19');
+insert into bm_seq values (0, 1880, 'v20');
+insert into bm_seq values (1, 1799, 'v21');
+insert into bm_seq values (2, 1718, 'v22');
+insert into bm_seq values (3, 1637, 'v23');
+insert into bm_seq values (4, 1556, 'v24');
+insert into bm_seq values (5, 1475, 'v25');
+insert into bm_seq values (6, 1394, 'v26');
+insert into bm_seq values (7, 1313, 'v27');
+insert into bm_seq values (8, 1232, 'v28');
+insert into bm_seq values (9, 1151, 'v29');
+insert into bm_seq values (0, 1070, 'v30');
+insert into bm_seq values (1, 989, 'v31');
+insert into bm_seq values (2, 908, 'v32');
+insert into bm_seq values (3, 827, 'v33');
+insert into bm_seq values (4, 746, 'v34');
+insert into bm_seq values (5, 665, 'v35');
+insert into bm_seq values (6, 584, 'v36');
+insert into bm_seq values (7, 503, 'v37');
+insert into bm_seq values (8, 422, 'v38');
+insert into bm_seq values (9, 341, 'v39');
+insert into bm_seq values (0, 260, 'v40');
+insert into bm_seq values (1, 179, 'v41');
+insert into bm_seq values (2, 98, 'v42');
+insert into bm_seq values (3, 17, 'v43');
+insert into bm_seq values (4, 1936, 'v44');
+insert into bm_seq values (5, 1855, 'v45');
+insert into bm_seq values (6, 1774, 'v46');
+insert into bm_seq values (7, 1693, 'v47');
+insert into bm_seq values (8, 1612, 'v48');
+insert into bm_seq values (9, 1531, 'v49');
+insert into bm_seq values (0, 1450, 'v0');
+insert into bm_seq values (1, 1369, 'v1');
+insert into bm_seq values (2, 1288, 'v2');
+insert into bm_seq values (3, 1207, 'v3');
+insert into bm_seq values (4, 1126, 'v4');
+insert into bm_seq values (5, 1045, 'v5');
+insert into bm_seq values (6, 964, 'v6');
+insert into bm_seq values (7, 883, 'v7');
+insert into bm_seq values (8, 802, 'v8');
+insert into bm_seq values (9, 721, 'v9');
+insert into bm_seq values (0, 640, 'v10');
+insert into bm_seq values (1, 559, 'v11');
+insert into bm_seq values (2, 478, 'v12');
+insert into bm_seq values (3, 397, 'v13');
+insert into bm_seq values (4, 316, 'v14');
+insert into bm_seq values (5, 235, 'v15');
+insert into bm_seq values (6, 154, 'v16');
+insert into bm_seq values (7, 73, 'v17');
+insert into bm_seq values (8, 1992, 'v18');
+insert into bm_seq values (9, 1911, 'v19');
+insert into bm_seq values (0, 1830, 'v20');
+insert into bm_seq values (1, 1749, 'v21');
+insert into bm_seq values (2, 1668, 'v22');
+insert into bm_seq values (3, 1587, 'v23');
+insert into bm_seq values (4, 1506, 'v24');
+insert into bm_seq values (5, 1425, 'v25');
+insert into bm_seq values (6, 1344, 'v26');
+insert into bm_seq values (7, 1263, 'v27');
+insert into bm_seq values (8, 1182, 'v28');
+insert into bm_seq values (9, 1101, 'v29');
+insert into bm_seq values (0, 1020, 'v30');
+insert into bm_seq values (1, 939, 'v31');
+insert into bm_seq values (2, 858, 'v32');
+insert into bm_seq values (3, 777, 'v33');
+insert into bm_seq values (4, 696, 'v34');
+insert into bm_seq values (5, 615, 'v35');
+insert into bm_seq values (6, 534, 'v36');
+insert into bm_seq values (7, 453, 'v37');
+insert into bm_seq values (8, 372, 'v38');
+insert into bm_seq values (9, 291, 'v39');
+insert into bm_seq values (0, 210, 'v40');
+insert into bm_seq values (1, 129, 'v41');
+insert into bm_seq values (2, 48, 'v42');
+insert into bm_seq values (3, 1967, 'v43');
+insert into bm_seq values (4, 1886, 'v44');
+insert into bm_seq values (5, 1805, 'v45');
+insert into bm_seq values (6, 1724, 'v46');
+insert into bm_seq values (7, 1643, 'v47');
+insert into bm_seq values (8, 1562, 'v48');
+insert into bm_seq values (9, 1481, 'v49');
+insert into bm_seq values (0, 1400, 'v0');
+insert into bm_seq values (1, 1319, 'v1');
+insert into bm_seq values (2, 1238, 'v2');
+insert into bm_seq values (3, 1157, 'v3');
+insert into bm_seq values (4, 1076, 'v4');
+insert into bm_seq values (5, 995, 'v5');
+insert into bm_seq values (6, 914, 'v6');
+insert into bm_seq values (7, 833, 'v7');
+insert into bm_seq values (8, 752, 'v8');
+insert into bm_seq values (9, 671, 'v9');
+insert into bm_seq values (0, 590, 'v10');
+insert into bm_seq values (1, 509, 'v11');
+insert into bm_seq values (2, 428, 'v12');
+insert into bm_seq values (3, 347, 'v13');
+insert into bm_seq values (4, 266, 'v14');
+insert into bm_seq values (5, 185, 'v15');
+insert into bm_seq values (6, 104, 'v16');
+insert into bm_seq values (7, 23, 'v17');
+insert into bm_seq values (8, 1942, 'v18');
+insert into bm_seq values (9, 1861, 'v19');
+insert into bm_seq values (0, 1780, 'v20');
+insert into bm_seq values (1, 1699, 'v21');
+insert into bm_seq values (2, 1618, 'v22');
+insert into bm_seq values (3, 1537, 'v23');
+insert into bm_seq values (4, 1456, 'v24');
+insert into bm_seq values (5, 1375, 'v25');
+insert into bm_seq values (6, 1294, 'v26');
+insert into bm_seq values (7, 1213, 'v27');
+insert into bm_seq values (8, 1132, 'v28');
+insert into bm_seq values (9, 1051, 'v29');
+insert into bm_seq values (0, 970, 'v30');
+insert into bm_seq values (1, 889, 'v31');
+insert into bm_seq values (2, 808, 'v32');
+insert into bm_seq values (3, 727, 'v33');
+insert into bm_seq values (4, 646, 'v34');
+insert into bm_seq values (5, 565, 'v35');
+insert into bm_seq values (6, 484, 'v36');
+insert into bm_seq values (7, 403, 'v37');
+insert into bm_seq values (8, 322, 'v38');
+insert into bm_seq values (9, 241, 'v39');
+insert into bm_seq values (0, 160, 'v40');
+insert into bm_seq values (1, 79, 'v41');
+insert into bm_seq values (2, 1998, 'v42');
+insert into bm_seq values (3, 1917, 'v43');
+insert into bm_seq values (4, 1836, 'v44');
+insert into bm_seq values (5, 1755, 'v45');
+insert into bm_seq values (6, 1674, 'v46');
+insert into bm_seq values (7, 1593, 'v47');
+insert into bm_seq values (8, 1512, 'v48');
+insert into bm_seq values (9, 1431, 'v49');
+insert into bm_seq values (0, 1350, 'v0');
+insert into bm_seq values (1, 1269, 'v1');
+insert into bm_seq values (2, 1188, 'v2');
+insert into bm_seq values (3, 1107, 'v3');
+insert into bm_seq values (4, 1026, 'v4');
+insert into bm_seq values (5, 945, 'v5');
+insert into bm_seq values (6, 864, 'v6');
+insert into bm_seq values (7, 783, 'v7');
+insert into bm_seq values (8, 702, 'v8');
+insert into bm_seq values (9, 621, 'v9');
+insert into bm_seq values (0, 540, 'v10');
+insert into bm_seq values (1, 459, 'v11');
+insert into bm_seq values (2, 378, 'v12');
+insert into bm_seq values (3, 297, 'v13');
+insert into bm_seq values (4, 216, 'v14');
+insert into bm_seq values (5, 135, 'v15');
+insert into bm_seq values (6, 54, 'v16');
+insert into bm_seq values (7, 1973, 'v17');
+insert into bm_seq values (8, 1892, 'v18');
+insert into bm_seq values (9, 1811, 'v19');
+insert into bm_seq values (0, 1730, 'v20');
+insert into bm_seq values (1, 1649, 'v21');
+insert into bm_seq values (2, 1568, 'v22');
+insert into bm_seq values (3, 1487, 'v23');
+insert into bm_seq values (4, 1406, 'v24');
+insert into bm_seq values (5, 1325, 'v25');
+insert into bm_seq values (6, 1244, 'v26');
+insert into bm_seq values (7, 1163, 'v27');
+insert into bm_seq values (8, 1082, 'v28');
+insert into bm_seq values (9, 1001, 'v29');
+insert into bm_seq values (0, 920, 'v30');
+insert into bm_seq values (1, 839, 'v31');
+insert into bm_seq values (2, 758, 'v32');
+insert into bm_seq values (3, 677, 'v33');
+insert into bm_seq values (4, 596, 'v34');
+insert into bm_seq values (5, 515, 'v35');
+insert into bm_seq values (6, 434, 'v36');
+insert into bm_seq values (7, 353, 'v37');
+insert into bm_seq values (8, 272, 'v38');
+insert into bm_seq values (9, 191, 'v39');
+insert into bm_seq values (0, 110, 'v40');
+insert into bm_seq values (1, 29, 'v41');
+insert into bm_seq values (2, 1948, 'v42');
+insert into bm_seq values (3, 1867, 'v43');
+insert into bm_seq values (4, 1786, 'v44');
+insert into bm_seq values (5, 1705, 'v45');
+insert into bm_seq values (6, 1624, 'v46');
+insert into bm_seq values (7, 1543, 'v47');
+insert into bm_seq values (8, 1462, 'v48');
+insert into bm_seq values (9, 1381, 'v49');
+insert into bm_seq values (0, 1300, 'v0');
+insert into bm_seq values (1, 1219, 'v1');
+insert into bm_seq values (2, 1138, 'v2');
+insert into bm_seq values (3, 1057, 'v3');
+insert into bm_seq values (4, 976, 'v4');
+insert into bm_seq values (5, 895, 'v5');
+insert into bm_seq values (6, 814, 'v6');
+insert into bm_seq values (7, 733, 'v7');
+insert into bm_seq values (8, 652, 'v8');
+insert into bm_seq values (9, 571, 'v9');
+insert into bm_seq values (0, 490, 'v10');
+insert into bm_seq values (1, 409, 'v11');
+insert into bm_seq values (2, 328, 'v12');
+insert into bm_seq values (3, 247, 'v13');
+insert into bm_seq values (4, 166, 'v14');
+insert into bm_seq values (5, 85, 'v15');
+insert into bm_seq values (6, 4, 'v16');
+insert into bm_seq values (7, 1923, 'v17');
+insert into bm_seq values (8, 1842, 'v18');
+insert into bm_seq values (9, 1761, 'v19');
+insert into bm_seq values (0, 1680, 'v20');
+insert into bm_seq values (1, 1599, 'v21');
+insert into bm_seq values (2, 1518, 'v22');
+insert into bm_seq values (3, 1437, 'v23');
+insert into bm_seq values (4, 1356, 'v24');
+insert into bm_seq values (5, 1275, 'v25');
+insert into bm_seq values (6, 1194, 'v26');
+insert into bm_seq values (7, 1113, 'v27');
+insert into bm_seq values (8, 1032, 'v28');
+insert into bm_seq values (9, 951, 'v29');
+insert into bm_seq values (0, 870, 'v30');
+insert into bm_seq values (1, 789, 'v31');
+insert into bm_seq values (2, 708, 'v32');
+insert into bm_seq values (3, 627, 'v33');
+insert into bm_seq values (4, 546, 'v34');
+insert into bm_seq values (5, 465, 'v35');
+insert into bm_seq values (6, 384, 'v36');
+insert into bm_seq values (7, 303, 'v37');
+insert into bm_seq values (8, 222, 'v38');
+insert into bm_seq values (9, 141, 'v39');
+insert into bm_seq values (0, 60, 'v40');
+insert into bm_seq values (1, 1979, 'v41');
+insert into bm_seq values (2, 1898, 'v42');
+insert into bm_seq values (3, 1817, 'v43');
+insert into bm_seq values (4, 1736, 'v44');
+insert into bm_seq values (5, 1655, 'v45');
+insert into bm_seq values (6, 1574, 'v46');
+insert into bm_seq values (7, 1493, 'v47');
+insert into bm_seq values (8, 1412, 'v48');
+insert into bm_seq values (9, 1331, 'v49');
+insert into bm_seq values (0, 1250, 'v0');
+insert into bm_seq values (1, 1169, 'v1');
+insert into bm_seq values (2, 1088, 'v2');
+insert into bm_seq values (3, 1007, 'v3');
+insert into bm_seq values (4, 926, 'v4');
+insert into bm_seq values (5, 845, 'v5');
+insert into bm_seq values (6, 764, 'v6');
+insert into bm_seq values (7, 683, 'v7');
+insert into bm_seq values (8, 602, 'v8');
+insert into bm_seq values (9, 521, 'v9');
+insert into bm_seq values (0, 440, 'v10');
+insert into bm_seq values (1, 359, 'v11');
+insert into bm_seq values (2, 278, 'v12');
+insert into bm_seq values (3, 197, 'v13');
+insert into bm_seq values (4, 116, 'v14');
+insert into bm_seq values (5, 35, 'v15');
+insert into bm_seq values (6, 1954, 'v16');
+insert into bm_seq values (7, 1873, 'v17');
+insert into bm_seq values (8, 1792, 'v18');
+insert into bm_seq values (9, 1711, 'v19');
+insert into bm_seq values (0, 1630, 'v20');
+insert into bm_seq values (1, 1549, 'v21');
+insert into bm_seq values (2, 1468, 'v22');
+insert into bm_seq values (3, 1387, 'v23');
+insert into bm_seq values (4, 1306, 'v24');
+insert into bm_seq values (5, 1225, 'v25');
+insert into bm_seq values (6, 1144, 'v26');
+insert into bm_seq values (7, 1063, 'v27');
+insert into bm_seq values (8, 982, 'v28');
+insert into bm_seq values (9, 901, 'v29');
+insert into bm_seq values (0, 820, 'v30');
+insert into bm_seq values (1, 739, 'v31');
+insert into bm_seq values (2, 658, 'v32');
+insert into bm_seq values (3, 577, 'v33');
+insert into bm_seq values (4, 496, 'v34');
+insert into bm_seq values (5, 415, 'v35');
+insert into bm_seq values (6, 334, 'v36');
+insert into bm_seq values (7, 253, 'v37');
+insert into bm_seq values (8, 172, 'v38');
+insert into bm_seq values (9, 91, 'v39');
+insert into bm_seq values (0, 10, 'v40');
+insert into bm_seq values (1, 1929, 'v41');
+insert into bm_seq values (2, 1848, 'v42');
+insert into bm_seq values (3, 1767, 'v43');
+insert into bm_seq values (4, 1686, 'v44');
+insert into bm_seq values (5, 1605, 'v45');
+insert into bm_seq values (6, 1524, 'v46');
+insert into bm_seq values (7, 1443, 'v47');
+insert into bm_seq values (8, 1362, 'v48');
+insert into bm_seq values (9, 1281, 'v49');
+insert into bm_seq values (0, 1200, 'v0');
+insert into bm_seq values (1, 1119, 'v1');
+insert into bm_seq values (2, 1038, 'v2');
+insert into bm_seq values (3, 957, 'v3');
+insert into bm_seq values (4, 876, 'v4');
+insert into bm_seq values (5, 795, 'v5');
+insert into bm_seq values (6, 714, 'v6');
+insert into bm_seq values (7, 633, 'v7');
+insert into bm_seq values (8, 552, 'v8');
+insert into bm_seq values (9, 471, 'v9');
+insert into bm_seq values (0, 390, 'v10');
+insert into bm_seq values (1, 309, 'v11');
+insert into bm_seq values (2, 228, 'v12');
+insert into bm_seq values (3, 147, 'v13');
+insert into bm_seq values (4, 66, 'v14');
+insert into bm_seq values (5, 1985, 'v15');
+insert into bm_seq values (6, 1904, 'v16');
+insert into bm_seq values (7, 1823, 'v17');
+insert into bm_seq values (8, 1742, 'v18');
+insert into bm_seq values (9, 1661, 'v19');
+insert into bm_seq values (0, 1580, 'v20');
+insert into bm_seq values (1, 1499, 'v21');
+insert into bm_seq values (2, 1418, 'v22');
+insert into bm_seq values (3, 1337, 'v23');
+insert into bm_seq values (4, 1256, 'v24');
+insert into bm_seq values (5, 1175, 'v25');
+insert into bm_seq values (6, 1094, 'v26');
+insert into bm_seq values (7, 1013, 'v27');
+insert into bm_seq values (8, 932, 'v28');
+insert into bm_seq values (9, 851, 'v29');
+insert into bm_seq values (0, 770, 'v30');
+insert into bm_seq values (1, 689, 'v31');
+insert into bm_seq values (2, 608, 'v32');
+insert into bm_seq values (3, 527, 'v33');
+insert into bm_seq values (4, 446, 'v34');
+insert into bm_seq values (5, 365, 'v35');
+insert into bm_seq values (6, 284, 'v36');
+insert into bm_seq values (7, 203, 'v37');
+insert into bm_seq values (8, 122, 'v38');
+insert into bm_seq values (9, 41, 'v39');
+insert into bm_seq values (0, 1960, 'v40');
+insert into bm_seq values (1, 1879, 'v41');
+insert into bm_seq values (2, 1798, 'v42');
+insert into bm_seq values (3, 1717, 'v43');
+insert into bm_seq values (4, 1636, 'v44');
+insert into bm_seq values (5, 1555, 'v45');
+insert into bm_seq values (6, 1474, 'v46');
+insert into bm_seq values (7, 1393, 'v47');
+insert into bm_seq values (8, 1312, 'v48');
+insert into bm_seq values (9, 1231, 'v49');
+insert into bm_seq values (0, 1150, 'v0');
+insert into bm_seq values (1, 1069, 'v1');
+insert into bm_seq values (2, 988, 'v2');
+insert into bm_seq values (3, 907, 'v3');
+insert into bm_seq values (4, 826, 'v4');
+insert into bm_seq values (5, 745, 'v5');
+insert into bm_seq values (6, 664, 'v6');
+insert into bm_seq values (7, 583, 'v7');
+insert into bm_seq values (8, 502, 'v8');
+insert into bm_seq values (9, 421, 'v9');
+insert into bm_seq values (0, 340, 'v10');
+insert into bm_seq values (1, 259, 'v11');
+insert into bm_seq values (2, 178, 'v12');
+insert into bm_seq values (3, 97, 'v13');
+insert into bm_seq values (4, 16, 'v14');
+insert into bm_seq values (5, 1935, 'v15');
+insert into bm_seq values (6, 1854, 'v16');
+insert into bm_seq values (7, 1773, 'v17');
+insert into bm_seq values (8, 1692, 'v18');
+insert into bm_seq values (9, 1611, 'v19');
+insert into bm_seq values (0, 1530, 'v20');
+insert into bm_seq values (1, 1449, 'v21');
+insert into bm_seq values (2, 1368, 'v22');
+insert into bm_seq values (3, 1287, 'v23');
+insert into bm_seq values (4, 1206, 'v24');
+insert into bm_seq values (5, 1125, 'v25');
+insert into bm_seq values (6, 1044, 'v26');
+insert into bm_seq values (7, 963, 'v27');
+insert into bm_seq values (8, 882, 'v28');
+insert into bm_seq values (9, 801, 'v29');
+insert into bm_seq values (0, 720, 'v30');
+insert into bm_seq values (1, 639, 'v31');
+insert into bm_seq values (2, 558, 'v32');
+insert into bm_seq values (3, 477, 'v33');
+insert into bm_seq values (4, 396, 'v34');
+insert into bm_seq values (5, 315, 'v35');
+insert into bm_seq values (6, 234, 'v36');
+insert into bm_seq values (7, 153, 'v37');
+insert into bm_seq values (8, 72, 'v38');
+insert into bm_seq values (9, 1991, 'v39');
+insert into bm_seq values (0, 1910, 'v40');
+insert into bm_seq values (1, 1829, 'v41');
+insert into bm_seq values (2, 1748, 'v42');
+insert into bm_seq values (3, 1667, 'v43');
+insert into bm_seq values (4, 1586, 'v44');
+insert into bm_seq values (5, 1505, 'v45');
+insert into bm_seq values (6, 1424, 'v46');
+insert into bm_seq values (7, 1343, 'v47');
+insert into bm_seq values (8, 1262, 'v48');
+insert into bm_seq values (9, 1181, 'v49');
+insert into bm_seq values (0, 1100, 'v0');
+insert into bm_seq values (1, 1019, 'v1');
+insert into bm_seq values (2, 938, 'v2');
+insert into bm_seq values (3, 857, 'v3');
+insert into bm_seq values (4, 776, 'v4');
+insert into bm_seq values (5, 695, 'v5');
+insert into bm_seq values (6, 614, 'v6');
+insert into bm_seq values (7, 533, 'v7');
+insert into bm_seq values (8, 452, 'v8');
+insert into bm_seq values (9, 371, 'v9');
+insert into bm_seq values (0, 290, 'v10');
+insert into bm_seq values (1, 209, 'v11');
+insert into bm_seq values (2, 128, 'v12');
+insert into bm_seq values (3, 47, 'v13');
+insert into bm_seq values (4, 1966, 'v14');
+insert into bm_seq values (5, 1885, 'v15');
+insert into bm_seq values (6, 1804, 'v16');
+insert into bm_seq values (7, 1723, 'v17');
+insert into bm_seq values (8, 1642, 'v18');
+insert into bm_seq values (9, 1561, 'v19');
+insert into bm_seq values (0, 1480, 'v20');
+insert into bm_seq values (1, 1399, 'v21');
+insert into bm_seq values (2, 1318, 'v22');
+insert into bm_seq values (3, 1237, 'v23');
+insert into bm_seq values (4, 1156, 'v24');
+insert into bm_seq values (5, 1075, 'v25');
+insert into bm_seq values (6, 994, 'v26');
+insert into bm_seq values (7, 913, 'v27');
+insert into bm_seq values (8, 832, 'v28');
+insert into bm_seq values (9, 751, 'v29');
+insert into bm_seq values (0, 670, 'v30');
+insert into bm_seq values (1, 589, 'v31');
+insert into bm_seq values (2, 508, 'v32');
+insert into bm_seq values (3, 427, 'v33');
+insert into bm_seq values (4, 346, 'v34');
+insert into bm_seq values (5, 265, 'v35');
+insert into bm_seq values (6, 184, 'v36');
+insert into bm_seq values (7, 103, 'v37');
+insert into bm_seq values (8, 22, 'v38');
+insert into bm_seq values (9, 1941, 'v39');
+insert into bm_seq values (0, 1860, 'v40');
+insert into bm_seq values (1, 1779, 'v41');
+insert into bm_seq values (2, 1698, 'v42');
+insert into bm_seq values (3, 1617, 'v43');
+insert into bm_seq values (4, 1536, 'v44');
+insert into bm_seq values (5, 1455, 'v45');
+insert into bm_seq values (6, 1374, 'v46');
+insert into bm_seq values (7, 1293, 'v47');
+insert into bm_seq values (8, 1212, 'v48');
+insert into bm_seq values (9, 1131, 'v49');
+insert into bm_seq values (0, 1050, 'v0');
+insert into bm_seq values (1, 969, 'v1');
+insert into bm_seq values (2, 888, 'v2');
+insert into bm_seq values (3, 807, 'v3');
+insert into bm_seq values (4, 726, 'v4');
+insert into bm_seq values (5, 645, 'v5');
+insert into bm_seq values (6, 564, 'v6');
+insert into bm_seq values (7, 483, 'v7');
+insert into bm_seq values (8, 402, 'v8');
+insert into bm_seq values (9, 321, 'v9');
+insert into bm_seq values (0, 240, 'v10');
+insert into bm_seq values (1, 159, 'v11');
+insert into bm_seq values (2, 78, 'v12');
+insert into bm_seq values (3, 1997, 'v13');
+insert into bm_seq values (4, 1916, 'v14');
+insert into bm_seq values (5, 1835, 'v15');
+insert into bm_seq values (6, 1754, 'v16');
+insert into bm_seq values (7, 1673, 'v17');
+insert into bm_seq values (8, 1592, 'v18');
+insert into bm_seq values (9, 1511, 'v19');
+insert into bm_seq values (0, 1430, 'v20');
+insert into bm_seq values (1, 1349, 'v21');
+insert into bm_seq values (2, 1268, 'v22');
+insert into bm_seq values (3, 1187, 'v23');
+insert into bm_seq values (4, 1106, 'v24');
+insert into bm_seq values (5, 1025, 'v25');
+insert into bm_seq values (6, 944, 'v26');
+insert into bm_seq values (7, 863, 'v27');
+insert into bm_seq values (8, 782, 'v28');
+insert into bm_seq values (9, 701, 'v29');
+insert into bm_seq values (0, 620, 'v30');
+insert into bm_seq values (1, 539, 'v31');
+insert into bm_seq values (2, 458, 'v32');
+insert into bm_seq values (3, 377, 'v33');
+insert into bm_seq values (4, 296, 'v34');
+insert into bm_seq values (5, 215, 'v35');
+insert into bm_seq values (6, 134, 'v36');
+insert into bm_seq values (7, 53, 'v37');
+insert into bm_seq values (8, 1972, 'v38');
+insert into bm_seq values (9, 1891, 'v39');
+insert into bm_seq values (0, 1810, 'v40');
+insert into bm_seq values (1, 1729, 'v41');
+insert into bm_seq values (2, 1648, 'v42');
+insert into bm_seq values (3, 1567, 'v43');
+insert into bm_seq values (4, 1486, 'v44');
+insert into bm_seq values (5, 1405, 'v45');
+insert into bm_seq values (6, 1324, 'v46');
+insert into bm_seq values (7, 1243, 'v47');
+insert into bm_seq values (8, 1162, 'v48');
+insert into bm_seq values (9, 1081, 'v49');
+insert into bm_seq values (0, 1000, 'v0');
+insert into bm_seq values (1, 919, 'v1');
+insert into bm_seq values (2, 838, 'v2');
+insert into bm_seq values (3, 757, 'v3');
+insert into bm_seq values (4, 676, 'v4');
+insert into bm_seq values (5, 595, 'v5');
+insert into bm_seq values (6, 514, 'v6');
+insert into bm_seq values (7, 433, 'v7');
+insert into bm_seq values (8, 352, 'v8');
+insert into bm_seq values (9, 271, 'v9');
+insert into bm_seq values (0, 190, 'v10');
+insert into bm_seq values (1, 109, 'v11');
+insert into bm_seq values (2, 28, 'v12');
+insert into bm_seq values (3, 1947, 'v13');
+insert into bm_seq values (4, 1866, 'v14');
+insert into bm_seq values (5, 1785, 'v15');
+insert into bm_seq values (6, 1704, 'v16');
+insert into bm_seq values (7, 1623, 'v17');
+insert into bm_seq values (8, 1542, 'v18');
+insert into bm_seq values (9, 1461, 'v19');
+insert into bm_seq values (0, 1380, 'v20');
+insert into bm_seq values (1, 1299, 'v21');
+insert into bm_seq values (2, 1218, 'v22');
+insert into bm_seq values (3, 1137, 'v23');
+insert into bm_seq values (4, 1056, 'v24');
+insert into bm_seq values (5, 975, 'v25');
+insert into bm_seq values (6, 894, 'v26');
+insert into bm_seq values (7, 813, 'v27');
+insert into bm_seq values (8, 732, 'v28');
+insert into bm_seq values (9, 651, 'v29');
+insert into bm_seq values (0, 570, 'v30');
+insert into bm_seq values (1, 489, 'v31');
+insert into bm_seq values (2, 408, 'v32');
+insert into bm_seq values (3, 327, 'v33');
+insert into bm_seq values (4, 246, 'v34');
+insert into bm_seq values (5, 165, 'v35');
+insert into bm_seq values (6, 84, 'v36');
+insert into bm_seq values (7, 3, 'v37');
+insert into bm_seq values (8, 1922, 'v38');
+insert into bm_seq values (9, 1841, 'v39');
+insert into bm_seq values (0, 1760, 'v40');
+insert into bm_seq values (1, 1679, 'v41');
+insert into bm_seq values (2, 1598, 'v42');
+insert into bm_seq values (3, 1517, 'v43');
+insert into bm_seq values (4, 1436, 'v44');
+insert into bm_seq values (5, 1355, 'v45');
+insert into bm_seq values (6, 1274, 'v46');
+insert into bm_seq values (7, 1193, 'v47');
+insert into bm_seq values (8, 1112, 'v48');
+insert into bm_seq values (9, 1031, 'v49');
+insert into bm_seq values (0, 950, 'v0');
+insert into bm_seq values (1, 869, 'v1');
+insert into bm_seq values (2, 788, 'v2');
+insert into bm_seq values (3, 707, 'v3');
+insert into bm_seq values (4, 626, 'v4');
+insert into bm_seq values (5, 545, 'v5');
+insert into bm_seq values (6, 464, 'v6');
+insert into bm_seq values (7, 383, 'v7');
+insert into bm_seq values (8, 302, 'v8');
+insert into bm_seq values (9, 221, 'v9');
+insert into bm_seq values (0, 140, 'v10');
+insert into bm_seq values (1, 59, 'v11');
+insert into bm_seq values (2, 1978, 'v12');
+insert into bm_seq values (3, 1897, 'v13');
+insert into bm_seq values (4, 1816, 'v14');
+insert into bm_seq values (5, 1735, 'v15');
+insert into bm_seq values (6, 1654, 'v16');
+insert into bm_seq values (7, 1573, 'v17');
+insert into bm_seq values (8, 1492, 'v18');
+insert into bm_seq values (9, 1411, 'v19');
+insert into bm_seq values (0, 1330, 'v20');
+insert into bm_seq values (1, 1249, 'v21');
+insert into bm_seq values (2, 1168, 'v22');
+insert into bm_seq values (3, 1087, 'v23');
+insert into bm_seq values (4, 1006, 'v24');
+insert into bm_seq values (5, 925, 'v25');
+insert into bm_seq values (6, 844, 'v26');
+insert into bm_seq values (7, 763, 'v27');
+insert into bm_seq values (8, 682, 'v28');
+insert into bm_seq values (9, 601, 'v29');
+insert into bm_seq values (0, 520, 'v30');
+insert into bm_seq values (1, 439, 'v31');
+insert into bm_seq values (2, 358, 'v32');
+insert into bm_seq values (3, 277, 'v33');
+insert into bm_seq values (4, 196, 'v34');
+insert into bm_seq values (5, 115, 'v35');
+insert into bm_seq values (6, 34, 'v36');
+insert into bm_seq values (7, 1953, 'v37');
+insert into bm_seq values (8, 1872, 'v38');
+insert into bm_seq values (9, 1791, 'v39');
+insert into bm_seq values (0, 1710, 'v40');
+insert into bm_seq values (1, 1629, 'v41');
+insert into bm_seq values (2, 1548, 'v42');
+insert into bm_seq values (3, 1467, 'v43');
+insert into bm_seq values (4, 1386, 'v44');
+insert into bm_seq values (5, 1305, 'v45');
+insert into bm_seq values (6, 1224, 'v46');
+insert into bm_seq values (7, 1143, 'v47');
+insert into bm_seq values (8, 1062, 'v48');
+insert into bm_seq values (9, 981, 'v49');
+insert into bm_seq values (0, 900, 'v0');
+insert into bm_seq values (1, 819, 'v1');
+insert into bm_seq values (2, 738, 'v2');
+insert into bm_seq values (3, 657, 'v3');
+insert into bm_seq values (4, 576, 'v4');
+insert into bm_seq values (5, 495, 'v5');
+insert into bm_seq values (6, 414, 'v6');
+insert into bm_seq values (7, 333, 'v7');
+insert into bm_seq values (8, 252, 'v8');
+insert into bm_seq values (9, 171, 'v9');
+insert into bm_seq values (0, 90, 'v10');
+insert into bm_seq values (1, 9, 'v11');
+insert into bm_seq values (2, 1928, 'v12');
+insert into bm_seq values (3, 1847, 'v13');
+insert into bm_seq values (4, 1766, 'v14');
+insert into bm_seq values (5, 1685, 'v15');
+insert into bm_seq values (6, 1604, 'v16');
+insert into bm_seq values (7, 1523, 'v17');
+insert into bm_seq values (8, 1442, 'v18');
+insert into bm_seq values (9, 1361, 'v19');
+insert into bm_seq values (0, 1280, 'v20');
+insert into bm_seq values (1, 1199, 'v21');
+insert into bm_seq values (2, 1118, 'v22');
+insert into bm_seq values (3, 1037, 'v23');
+insert into bm_seq values (4, 956, 'v24');
+insert into bm_seq values (5, 875, 'v25');
+insert into bm_seq values (6, 794, 'v26');
+insert into bm_seq values (7, 713, 'v27');
+insert into bm_seq values (8, 632, 'v28');
+insert into bm_seq values (9, 551, 'v29');
+insert into bm_seq values (0, 470, 'v30');
+insert into bm_seq values (1, 389, 'v31');
+insert into bm_seq values (2, 308, 'v32');
+insert into bm_seq values (3, 227, 'v33');
+insert into bm_seq values (4, 146, 'v34');
+insert into bm_seq values (5, 65, 'v35');
+insert into bm_seq values (6, 1984, 'v36');
+insert into bm_seq values (7, 1903, 'v37');
+insert into bm_seq values (8, 1822, 'v38');
+insert into bm_seq values (9, 1741, 'v39');
+insert into bm_seq values (0, 1660, 'v40');
+insert into bm_seq values (1, 1579, 'v41');
+insert into bm_seq values (2, 1498, 'v42');
+insert into bm_seq values (3, 1417, 'v43');
+insert into bm_seq values (4, 1336, 'v44');
+insert into bm_seq values (5, 1255, 'v45');
+insert into bm_seq values (6, 1174, 'v46');
+insert into bm_seq values (7, 1093, 'v47');
+insert into bm_seq values (8, 1012, 'v48');
+insert into bm_seq values (9, 931, 'v49');
+insert into bm_seq values (0, 850, 'v0');
+insert into bm_seq values (1, 769, 'v1');
+insert into bm_seq values (2, 688, 'v2');
+insert into bm_seq values (3, 607, 'v3');
+insert into bm_seq values (4, 526, 'v4');
+insert into bm_seq values (5, 445, 'v5');
+insert into bm_seq values (6, 364, 'v6');
+insert into bm_seq values (7, 283, 'v7');
+insert into bm_seq values (8, 202, 'v8');
+insert into bm_seq values (9, 121, 'v9');
+insert into bm_seq values (0, 40, 'v10');
+insert into bm_seq values (1, 1959, 'v11');
+insert into bm_seq values (2, 1878, 'v12');
+insert into bm_seq values (3, 1797, 'v13');
+insert into bm_seq values (4, 1716, 'v14');
+insert into bm_seq values (5, 1635, 'v15');
+insert into bm_seq values (6, 1554, 'v16');
+insert into bm_seq values (7, 1473, 'v17');
+insert into bm_seq values (8, 1392, 'v18');
+insert into bm_seq values (9, 1311, 'v19');
+insert into bm_seq values (0, 1230, 'v20');
+insert into bm_seq values (1, 1149, 'v21');
+insert into bm_seq values (2, 1068, 'v22');
+insert into bm_seq values (3, 987, 'v23');
+insert into bm_seq values (4, 906, 'v24');
+insert into bm_seq values (5, 825, 'v25');
+insert into bm_seq values (6, 744, 'v26');
+insert into bm_seq values (7, 663, 'v27');
+insert into bm_seq values (8, 582, 'v28');
+insert into bm_seq values (9, 501, 'v29');
+insert into bm_seq values (0, 420, 'v30');
+insert into bm_seq values (1, 339, 'v31');
+insert into bm_seq values (2, 258, 'v32');
+insert into bm_seq values (3, 177, 'v33');
+insert into bm_seq values (4, 96, 'v34');
+insert into bm_seq values (5, 15, 'v35');
+insert into bm_seq values (6, 1934, 'v36');
+insert into bm_seq values (7, 1853, 'v37');
+insert into bm_seq values (8, 1772, 'v38');
+insert into bm_seq values (9, 1691, 'v39');
+insert into bm_seq values (0, 1610, 'v40');
+insert into bm_seq values (1, 1529, 'v41');
+insert into bm_seq values (2, 1448, 'v42');
+insert into bm_seq values (3, 1367, 'v43');
+insert into bm_seq values (4, 1286, 'v44');
+insert into bm_seq values (5, 1205, 'v45');
+insert into bm_seq values (6, 1124, 'v46');
+insert into bm_seq values (7, 1043, 'v47');
+insert into bm_seq values (8, 962, 'v48');
+insert into bm_seq values (9, 881, 'v49');
+insert into bm_seq values (0, 800, 'v0');
+insert into bm_seq values (1, 719, 'v1');
+insert into bm_seq values (2, 638, 'v2');
+insert into bm_seq values (3, 557, 'v3');
+insert into bm_seq values (4, 476, 'v4');
+insert into bm_seq values (5, 395, 'v5');
+insert into bm_seq values (6, 314, 'v6');
+insert into bm_seq values (7, 233, 'v7');
+insert into bm_seq values (8, 152, 'v8');
+insert into bm_seq values (9, 71, 'v9');
+insert into bm_seq values (0, 1990, 'v10');
+insert into bm_seq values (1, 1909, 'v11');
+insert into bm_seq values (2, 1828, 'v12');
+insert into bm_seq values (3, 1747, 'v13');
+insert into bm_seq values (4, 1666, 'v14');
+insert into bm_seq values (5, 1585, 'v15');
+insert into bm_seq values (6, 1504, 'v16');
+insert into bm_seq values (7, 1423, 'v17');
+insert into bm_seq values (8, 1342, 'v18');
+insert into bm_seq values (9, 1261, 'v19');
+insert into bm_seq values (0, 1180, 'v20');
+insert into bm_seq values (1, 1099, 'v21');
+insert into bm_seq values (2, 1018, 'v22');
+insert into bm_seq values (3, 937, 'v23');
+insert into bm_seq values (4, 856, 'v24');
+insert into bm_seq values (5, 775, 'v25');
+insert into bm_seq values (6, 694, 'v26');
+insert into bm_seq values (7, 613, 'v27');
+insert into bm_seq values (8, 532, 'v28');
+insert into bm_seq values (9, 451, 'v29');
+insert into bm_seq values (0, 370, 'v30');
+insert into bm_seq values (1, 289, 'v31');
+insert into bm_seq values (2, 208, 'v32');
+insert into bm_seq values (3, 127, 'v33');
+insert into bm_seq values (4, 46, 'v34');
+insert into bm_seq values (5, 1965, 'v35');
+insert into bm_seq values (6, 1884, 'v36');
+insert into bm_seq values (7, 1803, 'v37');
+insert into bm_seq values (8, 1722, 'v38');
+insert into bm_seq values (9, 1641, 'v39');
+insert into bm_seq values (0, 1560, 'v40');
+insert into bm_seq values (1, 1479, 'v41');
+insert into bm_seq values (2, 1398, 'v42');
+insert into bm_seq values (3, 1317, 'v43');
+insert into bm_seq values (4, 1236, 'v44');
+insert into bm_seq values (5, 1155, 'v45');
+insert into bm_seq values (6, 1074, 'v46');
+insert into bm_seq values (7, 993, 'v47');
+insert into bm_seq values (8, 912, 'v48');
+insert into bm_seq values (9, 831, 'v49');
+insert into bm_seq values (0, 750, 'v0');
+insert into bm_seq values (1, 669, 'v1');
+insert into bm_seq values (2, 588, 'v2');
+insert into bm_seq values (3, 507, 'v3');
+insert into bm_seq values (4, 426, 'v4');
+insert into bm_seq values (5, 345, 'v5');
+insert into bm_seq values (6, 264, 'v6');
+insert into bm_seq values (7, 183, 'v7');
+insert into bm_seq values (8, 102, 'v8');
+insert into bm_seq values (9, 21, 'v9');
+insert into bm_seq values (0, 1940, 'v10');
+insert into bm_seq values (1, 1859, 'v11');
+insert into bm_seq values (2, 1778, 'v12');
+insert into bm_seq values (3, 1697, 'v13');
+insert into bm_seq values (4, 1616, 'v14');
+insert into bm_seq values (5, 1535, 'v15');
+insert into bm_seq values (6, 1454, 'v16');
+insert into bm_seq values (7, 1373, 'v17');
+insert into bm_seq values (8, 1292, 'v18');
+insert into bm_seq values (9, 1211, 'v19');
+insert into bm_seq values (0, 1130, 'v20');
+insert into bm_seq values (1, 1049, 'v21');
+insert into bm_seq values (2, 968, 'v22');
+insert into bm_seq values (3, 887, 'v23');
+insert into bm_seq values (4, 806, 'v24');
+insert into bm_seq values (5, 725, 'v25');
+insert into bm_seq values (6, 644, 'v26');
+insert into bm_seq values (7, 563, 'v27');
+insert into bm_seq values (8, 482, 'v28');
+insert into bm_seq values (9, 401, 'v29');
+insert into bm_seq values (0, 320, 'v30');
+insert into bm_seq values (1, 239, 'v31');
+insert into bm_seq values (2, 158, 'v32');
+insert into bm_seq values (3, 77, 'v33');
+insert into bm_seq values (4, 1996, 'v34');
+insert into bm_seq values (5, 1915, 'v35');
+insert into bm_seq values (6, 1834, 'v36');
+insert into bm_seq values (7, 1753, 'v37');
+insert into bm_seq values (8, 1672, 'v38');
+insert into bm_seq values (9, 1591, 'v39');
+insert into bm_seq values (0, 1510, 'v40');
+insert into bm_seq values (1, 1429, 'v41');
+insert into bm_seq values (2, 1348, 'v42');
+insert into bm_seq values (3, 1267, 'v43');
+insert into bm_seq values (4, 1186, 'v44');
+insert into bm_seq values (5, 1105, 'v45');
+insert into bm_seq values (6, 1024, 'v46');
+insert into bm_seq values (7, 943, 'v47');
+insert into bm_seq values (8, 862, 'v48');
+insert into bm_seq values (9, 781, 'v49');
+insert into bm_seq values (0, 700, 'v0');
+insert into bm_seq values (1, 619, 'v1');
+insert into bm_seq values (2, 538, 'v2');
+insert into bm_seq values (3, 457, 'v3');
+insert into bm_seq values (4, 376, 'v4');
+insert into bm_seq values (5, 295, 'v5');
+insert into bm_seq values (6, 214, 'v6');
+insert into bm_seq values (7, 133, 'v7');
+insert into bm_seq values (8, 52, 'v8');
+insert into bm_seq values (9, 1971, 'v9');
+insert into bm_seq values (0, 1890, 'v10');
+insert into bm_seq values (1, 1809, 'v11');
+insert into bm_seq values (2, 1728, 'v12');
+insert into bm_seq values (3, 1647, 'v13');
+insert into bm_seq values (4, 1566, 'v14');
+insert into bm_seq values (5, 1485, 'v15');
+insert into bm_seq values (6, 1404, 'v16');
+insert into bm_seq values (7, 1323, 'v17');
+insert into bm_seq values (8, 1242, 'v18');
+insert into bm_seq values (9, 1161, 'v19');
+insert into bm_seq values (0, 1080, 'v20');
+insert into bm_seq values (1, 999, 'v21');
+insert into bm_seq values (2, 918, 'v22');
+insert into bm_seq values (3, 837, 'v23');
+insert into bm_seq values (4, 756, 'v24');
+insert into bm_seq values (5, 675, 'v25');
+insert into bm_seq values (6, 594, 'v26');
+insert into bm_seq values (7, 513, 'v27');
+insert into bm_seq values (8, 432, 'v28');
+insert into bm_seq values (9, 351, 'v29');
+insert into bm_seq values (0, 270, 'v30');
+insert into bm_seq values (1, 189, 'v31');
+insert into bm_seq values (2, 108, 'v32');
+insert into bm_seq values (3, 27, 'v33');
+insert into bm_seq values (4, 1946, 'v34');
+insert into bm_seq values (5, 1865, 'v35');
+insert into bm_seq values (6, 1784, 'v36');
+insert into bm_seq values (7, 1703, 'v37');
+insert into bm_seq values (8, 1622, 'v38');
+insert into bm_seq values (9, 1541, 'v39');
+insert into bm_seq values (0, 1460, 'v40');
+insert into bm_seq values (1, 1379, 'v41');
+insert into bm_seq values (2, 1298, 'v42');
+insert into bm_seq values (3, 1217, 'v43');
+insert into bm_seq values (4, 1136, 'v44');
+insert into bm_seq values (5, 1055, 'v45');
+insert into bm_seq values (6, 974, 'v46');
+insert into bm_seq values (7, 893, 'v47');
+insert into bm_seq values (8, 812, 'v48');
+insert into bm_seq values (9, 731, 'v49');
+insert into bm_seq values (0, 650, 'v0');
+insert into bm_seq values (1, 569, 'v1');
+insert into bm_seq values (2, 488, 'v2');
+insert into bm_seq values (3, 407, 'v3');
+insert into bm_seq values (4, 326, 'v4');
+insert into bm_seq values (5, 245, 'v5');
+insert into bm_seq values (6, 164, 'v6');
+insert into bm_seq values (7, 83, 'v7');
+insert into bm_seq values (8, 2, 'v8');
+insert into bm_seq values (9, 1921, 'v9');
+insert into bm_seq values (0, 1840, 'v10');
+insert into bm_seq values (1, 1759, 'v11');
+insert into bm_seq values (2, 1678, 'v12');
+insert into bm_seq values (3, 1597, 'v13');
+insert into bm_seq values (4, 1516, 'v14');
+insert into bm_seq values (5, 1435, 'v15');
+insert into bm_seq values (6, 1354, 'v16');
+insert into bm_seq values (7, 1273, 'v17');
+insert into bm_seq values (8, 1192, 'v18');
+insert into bm_seq values (9, 1111, 'v19');
+insert into bm_seq values (0, 1030, 'v20');
+insert into bm_seq values (1, 949, 'v21');
+insert into bm_seq values (2, 868, 'v22');
+insert into bm_seq values (3, 787, 'v23');
+insert into bm_seq values (4, 706, 'v24');
+insert into bm_seq values (5, 625, 'v25');
+insert into bm_seq values (6, 544, 'v26');
+insert into bm_seq values (7, 463, 'v27');
+insert into bm_seq values (8, 382, 'v28');
+insert into bm_seq values (9, 301, 'v29');
+insert into bm_seq values (0, 220, 'v30');
+insert into bm_seq values (1, 139, 'v31');
+insert into bm_seq values (2, 58, 'v32');
+insert into bm_seq values (3, 1977, 'v33');
+insert into bm_seq values (4, 1896, 'v34');
+insert into bm_seq values (5, 1815, 'v35');
+insert into bm_seq values (6, 1734, 'v36');
+insert into bm_seq values (7, 1653, 'v37');
+insert into bm_seq values (8, 1572, 'v38');
+insert into bm_seq values (9, 1491, 'v39');
+insert into bm_seq values (0, 1410, 'v40');
+insert into bm_seq values (1, 1329, 'v41');
+insert into bm_seq values (2, 1248, 'v42');
+insert into bm_seq values (3, 1167, 'v43');
+insert into bm_seq values (4, 1086, 'v44');
+insert into bm_seq values (5, 1005, 'v45');
+insert into bm_seq values (6, 924, 'v46');
+insert into bm_seq values (7, 843, 'v47');
+insert into bm_seq values (8, 762, 'v48');
+insert into bm_seq values (9, 681, 'v49');
+insert into bm_seq values (0, 600, 'v0');
+insert into bm_seq values (1, 519, 'v1');
+insert into bm_seq values (2, 438, 'v2');
+insert into bm_seq values (3, 357, 'v3');
+insert into bm_seq values (4, 276, 'v4');
+insert into bm_seq values (5, 195, 'v5');
+insert into bm_seq values (6, 114, 'v6');
+insert into bm_seq values (7, 33, 'v7');
+insert into bm_seq values (8, 1952, 'v8');
+insert into bm_seq values (9, 1871, 'v9');
+insert into bm_seq values (0, 1790, 'v10');
+insert into bm_seq values (1, 1709, 'v11');
+insert into bm_seq values (2, 1628, 'v12');
+insert into bm_seq values (3, 1547, 'v13');
+insert into bm_seq values (4, 1466, 'v14');
+insert into bm_seq values (5, 1385, 'v15');
+insert into bm_seq values (6, 1304, 'v16');
+insert into bm_seq values (7, 1223, 'v17');
+insert into bm_seq values (8, 1142, 'v18');
+insert into bm_seq values (9, 1061, 'v19');
+insert into bm_seq values (0, 980, 'v20');
+insert into bm_seq values (1, 899, 'v21');
+insert into bm_seq values (2, 818, 'v22');
+insert into bm_seq values (3, 737, 'v23');
+insert into bm_seq values (4, 656, 'v24');
+insert into bm_seq values (5, 575, 'v25');
+insert into bm_seq values (6, 494, 'v26');
+insert into bm_seq values (7, 413, 'v27');
+insert into bm_seq values (8, 332, 'v28');
+insert into bm_seq values (9, 251, 'v29');
+insert into bm_seq values (0, 170, 'v30');
+insert into bm_seq values (1, 89, 'v31');
+insert into bm_seq values (2, 8, 'v32');
+insert into bm_seq values (3, 1927, 'v33');
+insert into bm_seq values (4, 1846, 'v34');
+insert into bm_seq values (5, 1765, 'v35');
+insert into bm_seq values (6, 1684, 'v36');
+insert into bm_seq values (7, 1603, 'v37');
+insert into bm_seq values (8, 1522, 'v38');
+insert into bm_seq values (9, 1441, 'v39');
+insert into bm_seq values (0, 1360, 'v40');
+insert into bm_seq values (1, 1279, 'v41');
+insert into bm_seq values (2, 1198, 'v42');
+insert into bm_seq values (3, 1117, 'v43');
+insert into bm_seq values (4, 1036, 'v44');
+insert into bm_seq values (5, 955, 'v45');
+insert into bm_seq values (6, 874, 'v46');
+insert into bm_seq values (7, 793, 'v47');
+insert into bm_seq values (8, 712, 'v48');
+insert into bm_seq values (9, 631, 'v49');
+insert into bm_seq values (0, 550, 'v0');
+insert into bm_seq values (1, 469, 'v1');
+insert into bm_seq values (2, 388, 'v2');
+insert into bm_seq values (3, 307, 'v3');
+insert into bm_seq values (4, 226, 'v4');
+insert into bm_seq values (5, 145, 'v5');
+insert into bm_seq values (6, 64, 'v6');
+insert into bm_seq values (7, 1983, 'v7');
+insert into bm_seq values (8, 1902, 'v8');
+insert into bm_seq values (9, 1821, 'v9');
+insert into bm_seq values (0, 1740, 'v10');
+insert into bm_seq values (1, 1659, 'v11');
+insert into bm_seq values (2, 1578, 'v12');
+insert into bm_seq values (3, 1497, 'v13');
+insert into bm_seq values (4, 1416, 'v14');
+insert into bm_seq values (5, 1335, 'v15');
+insert into bm_seq values (6, 1254, 'v16');
+insert into bm_seq values (7, 1173, 'v17');
+insert into bm_seq values (8, 1092, 'v18');
+insert into bm_seq values (9, 1011, 'v19');
+insert into bm_seq values (0, 930, 'v20');
+insert into bm_seq values (1, 849, 'v21');
+insert into bm_seq values (2, 768, 'v22');
+insert into bm_seq values (3, 687, 'v23');
+insert into bm_seq values (4, 606, 'v24');
+insert into bm_seq values (5, 525, 'v25');
+insert into bm_seq values (6, 444, 'v26');
+insert into bm_seq values (7, 363, 'v27');
+insert into bm_seq values (8, 282, 'v28');
+insert into bm_seq values (9, 201, 'v29');
+insert into bm_seq values (0, 120, 'v30');
+insert into bm_seq values (1, 39, 'v31');
+insert into bm_seq values (2, 1958, 'v32');
+insert into bm_seq values (3, 1877, 'v33');
+insert into bm_seq values (4, 1796, 'v34');
+insert into bm_seq values (5, 1715, 'v35');
+insert into bm_seq values (6, 1634, 'v36');
+insert into bm_seq values (7, 1553, 'v37');
+insert into bm_seq values (8, 1472, 'v38');
+insert into bm_seq values (9, 1391, 'v39');
+insert into bm_seq values (0, 1310, 'v40');
+insert into bm_seq values (1, 1229, 'v41');
+insert into bm_seq values (2, 1148, 'v42');
+insert into bm_seq values (3, 1067, 'v43');
+insert into bm_seq values (4, 986, 'v44');
+insert into bm_seq values (5, 905, 'v45');
+insert into bm_seq values (6, 824, 'v46');
+insert into bm_seq values (7, 743, 'v47');
+insert into bm_seq values (8, 662, 'v48');
+insert into bm_seq values (9, 581, 'v49');
+insert into bm_seq values (0, 500, 'v0');
+insert into bm_seq values (1, 419, 'v1');
+insert into bm_seq values (2, 338, 'v2');
+insert into bm_seq values (3, 257, 'v3');
+insert into bm_seq values (4, 176, 'v4');
+insert into bm_seq values (5, 95, 'v5');
+insert into bm_seq values (6, 14, 'v6');
+insert into bm_seq values (7, 1933, 'v7');
+insert into bm_seq values (8, 1852, 'v8');
+insert into bm_seq values (9, 1771, 'v9');
+insert into bm_seq values (0, 1690, 'v10');
+insert into bm_seq values (1, 1609, 'v11');
+insert into bm_seq values (2, 1528, 'v12');
+insert into bm_seq values (3, 1447, 'v13');
+insert into bm_seq values (4, 1366, 'v14');
+insert into bm_seq values (5, 1285, 'v15');
+insert into bm_seq values (6, 1204, 'v16');
+insert into bm_seq values (7, 1123, 'v17');
+insert into bm_seq values (8, 1042, 'v18');
+insert into bm_seq values (9, 961, 'v19');
+insert into bm_seq values (0, 880, 'v20');
+insert into bm_seq values (1, 799, 'v21');
+insert into bm_seq values (2, 718, 'v22');
+insert into bm_seq values (3, 637, 'v23');
+insert into bm_seq values (4, 556, 'v24');
+insert into bm_seq values (5, 475, 'v25');
+insert into bm_seq values (6, 394, 'v26');
+insert into bm_seq values (7, 313, 'v27');
+insert into bm_seq values (8, 232, 'v28');
+insert into bm_seq values (9, 151, 'v29');
+insert into bm_seq values (0, 70, 'v30');
+insert into bm_seq values (1, 1989, 'v31');
+insert into bm_seq values (2, 1908, 'v32');
+insert into bm_seq values (3, 1827, 'v33');
+insert into bm_seq values (4, 1746, 'v34');
+insert into bm_seq values (5, 1665, 'v35');
+insert into bm_seq values (6, 1584, 'v36');
+insert into bm_seq values (7, 1503, 'v37');
+insert into bm_seq values (8, 1422, 'v38');
+insert into bm_seq values (9, 1341, 'v39');
+insert into bm_seq values (0, 1260, 'v40');
+insert into bm_seq values (1, 1179, 'v41');
+insert into bm_seq values (2, 1098, 'v42');
+insert into bm_seq values (3, 1017, 'v43');
+insert into bm_seq values (4, 936, 'v44');
+insert into bm_seq values (5, 855, 'v45');
+insert into bm_seq values (6, 774, 'v46');
+insert into bm_seq values (7, 693, 'v47');
+insert into bm_seq values (8, 612, 'v48');
+insert into bm_seq values (9, 531, 'v49');
+insert into bm_seq values (0, 450, 'v0');
+insert into bm_seq values (1, 369, 'v1');
+insert into bm_seq values (2, 288, 'v2');
+insert into bm_seq values (3, 207, 'v3');
+insert into bm_seq values (4, 126, 'v4');
+insert into bm_seq values (5, 45, 'v5');
+insert into bm_seq values (6, 1964, 'v6');
+insert into bm_seq values (7, 1883, 'v7');
+insert into bm_seq values (8, 1802, 'v8');
+insert into bm_seq values (9, 1721, 'v9');
+insert into bm_seq values (0, 1640, 'v10');
+insert into bm_seq values (1, 1559, 'v11');
+insert into bm_seq values (2, 1478, 'v12');
+insert into bm_seq values (3, 1397, 'v13');
+insert into bm_seq values (4, 1316, 'v14');
+insert into bm_seq values (5, 1235, 'v15');
+insert into bm_seq values (6, 1154, 'v16');
+insert into bm_seq values (7, 1073, 'v17');
+insert into bm_seq values (8, 992, 'v18');
+insert into bm_seq values (9, 911, 'v19');
+insert into bm_seq values (0, 830, 'v20');
+insert into bm_seq values (1, 749, 'v21');
+insert into bm_seq values (2, 668, 'v22');
+insert into bm_seq values (3, 587, 'v23');
+insert into bm_seq values (4, 506, 'v24');
+insert into bm_seq values (5, 425, 'v25');
+insert into bm_seq values (6, 344, 'v26');
+insert into bm_seq values (7, 263, 'v27');
+insert into bm_seq values (8, 182, 'v28');
+insert into bm_seq values (9, 101, 'v29');
+insert into bm_seq values (0, 20, 'v30');
+insert into bm_seq values (1, 1939, 'v31');
+insert into bm_seq values (2, 1858, 'v32');
+insert into bm_seq values (3, 1777, 'v33');
+insert into bm_seq values (4, 1696, 'v34');
+insert into bm_seq values (5, 1615, 'v35');
+insert into bm_seq values (6, 1534, 'v36');
+insert into bm_seq values (7, 1453, 'v37');
+insert into bm_seq values (8, 1372, 'v38');
+insert into bm_seq values (9, 1291, 'v39');
+insert into bm_seq values (0, 1210, 'v40');
+insert into bm_seq values (1, 1129, 'v41');
+insert into bm_seq values (2, 1048, 'v42');
+insert into bm_seq values (3, 967, 'v43');
+insert into bm_seq values (4, 886, 'v44');
+insert into bm_seq values (5, 805, 'v45');
+insert into bm_seq values (6, 724, 'v46');
+insert into bm_seq values (7, 643, 'v47');
+insert into bm_seq values (8, 562, 'v48');
+insert into bm_seq values (9, 481, 'v49');
+insert into bm_seq values (0, 400, 'v0');
+insert into bm_seq values (1, 319, 'v1');
+insert into bm_seq values (2, 238, 'v2');
+insert into bm_seq values (3, 157, 'v3');
+insert into bm_seq values (4, 76, 'v4');
+insert into bm_seq values (5, 1995, 'v5');
+insert into bm_seq values (6, 1914, 'v6');
+insert into bm_seq values (7, 1833, 'v7');
+insert into bm_seq values (8, 1752, 'v8');
+insert into bm_seq values (9, 1671, 'v9');
+insert into bm_seq values (0, 1590, 'v10');
+insert into bm_seq values (1, 1509, 'v11');
+insert into bm_seq values (2, 1428, 'v12');
+insert into bm_seq values (3, 1347, 'v13');
+insert into bm_seq values (4, 1266, 'v14');
+insert into bm_seq values (5, 1185, 'v15');
+insert into bm_seq values (6, 1104, 'v16');
+insert into bm_seq values (7, 1023, 'v17');
+insert into bm_seq values (8, 942, 'v18');
+insert into bm_seq values (9, 861, 'v19');
+insert into bm_seq values (0, 780, 'v20');
+insert into bm_seq values (1, 699, 'v21');
+insert into bm_seq values (2, 618, 'v22');
+insert into bm_seq values (3, 537, 'v23');
+insert into bm_seq values (4, 456, 'v24');
+insert into bm_seq values (5, 375, 'v25');
+insert into bm_seq values (6, 294, 'v26');
+insert into bm_seq values (7, 213, 'v27');
+insert into bm_seq values (8, 132, 'v28');
+insert into bm_seq values (9, 51, 'v29');
+insert into bm_seq values (0, 1970, 'v30');
+insert into bm_seq values (1, 1889, 'v31');
+insert into bm_seq values (2, 1808, 'v32');
+insert into bm_seq values (3, 1727, 'v33');
+insert into bm_seq values (4, 1646, 'v34');
+insert into bm_seq values (5, 1565, 'v35');
+insert into bm_seq values (6, 1484, 'v36');
+insert into bm_seq values (7, 1403, 'v37');
+insert into bm_seq values (8, 1322, 'v38');
+insert into bm_seq values (9, 1241, 'v39');
+insert into bm_seq values (0, 1160, 'v40');
+insert into bm_seq values (1, 1079, 'v41');
+insert into bm_seq values (2, 998, 'v42');
+insert into bm_seq values (3, 917, 'v43');
+insert into bm_seq values (4, 836, 'v44');
+insert into bm_seq values (5, 755, 'v45');
+insert into bm_seq values (6, 674, 'v46');
+insert into bm_seq values (7, 593, 'v47');
+insert into bm_seq values (8, 512, 'v48');
+insert into bm_seq values (9, 431, 'v49');
+insert into bm_seq values (0, 350, 'v0');
+insert into bm_seq values (1, 269, 'v1');
+insert into bm_seq values (2, 188, 'v2');
+insert into bm_seq values (3, 107, 'v3');
+insert into bm_seq values (4, 26, 'v4');
+insert into bm_seq values (5, 1945, 'v5');
+insert into bm_seq values (6, 1864, 'v6');
+insert into bm_seq values (7, 1783, 'v7');
+insert into bm_seq values (8, 1702, 'v8');
+insert into bm_seq values (9, 1621, 'v9');
+insert into bm_seq values (0, 1540, 'v10');
+insert into bm_seq values (1, 1459, 'v11');
+insert into bm_seq values (2, 1378, 'v12');
+insert into bm_seq values (3, 1297, 'v13');
+insert into bm_seq values (4, 1216, 'v14');
+insert into bm_seq values (5, 1135, 'v15');
+insert into bm_seq values (6, 1054, 'v16');
+insert into bm_seq values (7, 973, 'v17');
+insert into bm_seq values (8, 892, 'v18');
+insert into bm_seq values (9, 811, 'v19');
+insert into bm_seq values (0, 730, 'v20');
+insert into bm_seq values (1, 649, 'v21');
+insert into bm_seq values (2, 568, 'v22');
+insert into bm_seq values (3, 487, 'v23');
+insert into bm_seq values (4, 406, 'v24');
+insert into bm_seq values (5, 325, 'v25');
+insert into bm_seq values (6, 244, 'v26');
+insert into bm_seq values (7, 163, 'v27');
+insert into bm_seq values (8, 82, 'v28');
+insert into bm_seq values (9, 1, 'v29');
+insert into bm_seq values (0, 1920, 'v30');
+insert into bm_seq values (1, 1839, 'v31');
+insert into bm_seq values (2, 1758, 'v32');
+insert into bm_seq values (3, 1677, 'v33');
+insert into bm_seq values (4, 1596, 'v34');
+insert into bm_seq values (5, 1515, 'v35');
+insert into bm_seq values (6, 1434, 'v36');
+insert into bm_seq values (7, 1353, 'v37');
+insert into bm_seq values (8, 1272, 'v38');
+insert into bm_seq values (9, 1191, 'v39');
+insert into bm_seq values (0, 1110, 'v40');
+insert into bm_seq values (1, 1029, 'v41');
+insert into bm_seq values (2, 948, 'v42');
+insert into bm_seq values (3, 867, 'v43');
+insert into bm_seq values (4, 786, 'v44');
+insert into bm_seq values (5, 705, 'v45');
+insert into bm_seq values (6, 624, 'v46');
+insert into bm_seq values (7, 543, 'v47');
+insert into bm_seq values (8, 462, 'v48');
+insert into bm_seq values (9, 381, 'v49');
+insert into bm_seq values (0, 300, 'v0');
+insert into bm_seq values (1, 219, 'v1');
+insert into bm_seq values (2, 138, 'v2');
+insert into bm_seq values (3, 57, 'v3');
+insert into bm_seq values (4, 1976, 'v4');
+insert into bm_seq values (5, 1895, 'v5');
+insert into bm_seq values (6, 1814, 'v6');
+insert into bm_seq values (7, 1733, 'v7');
+insert into bm_seq values (8, 1652, 'v8');
+insert into bm_seq values (9, 1571, 'v9');
+insert into bm_seq values (0, 1490, 'v10');
+insert into bm_seq values (1, 1409, 'v11');
+insert into bm_seq values (2, 1328, 'v12');
+insert into bm_seq values (3, 1247, 'v13');
+insert into bm_seq values (4, 1166, 'v14');
+insert into bm_seq values (5, 1085, 'v15');
+insert into bm_seq values (6, 1004, 'v16');
+insert into bm_seq values (7, 923, 'v17');
+insert into bm_seq values (8, 842, 'v18');
+insert into bm_seq values (9, 761, 'v19');
+insert into bm_seq values (0, 680, 'v20');
+insert into bm_seq values (1, 599, 'v21');
+insert into bm_seq values (2, 518, 'v22');
+insert into bm_seq values (3, 437, 'v23');
+insert into bm_seq values (4, 356, 'v24');
+insert into bm_seq values (5, 275, 'v25');
+insert into bm_seq values (6, 194, 'v26');
+insert into bm_seq values (7, 113, 'v27');
+insert into bm_seq values (8, 32, 'v28');
+insert into bm_seq values (9, 1951, 'v29');
+insert into bm_seq values (0, 1870, 'v30');
+insert into bm_seq values (1, 1789, 'v31');
+insert into bm_seq values (2, 1708, 'v32');
+insert into bm_seq values (3, 1627, 'v33');
+insert into bm_seq values (4, 1546, 'v34');
+insert into bm_seq values (5, 1465, 'v35');
+insert into bm_seq values (6, 1384, 'v36');
+insert into bm_seq values (7, 1303, 'v37');
+insert into bm_seq values (8, 1222, 'v38');
+insert into bm_seq values (9, 1141, 'v39');
+insert into bm_seq values (0, 1060, 'v40');
+insert into bm_seq values (1, 979, 'v41');
+insert into bm_seq values (2, 898, 'v42');
+insert into bm_seq values (3, 817, 'v43');
+insert into bm_seq values (4, 736, 'v44');
+insert into bm_seq values (5, 655, 'v45');
+insert into bm_seq values (6, 574, 'v46');
+insert into bm_seq values (7, 493, 'v47');
+insert into bm_seq values (8, 412, 'v48');
+insert into bm_seq values (9, 331, 'v49');
+insert into bm_seq values (0, 250, 'v0');
+insert into bm_seq values (1, 169, 'v1');
+insert into bm_seq values (2, 88, 'v2');
+insert into bm_seq values (3, 7, 'v3');
+insert into bm_seq values (4, 1926, 'v4');
+insert into bm_seq values (5, 1845, 'v5');
+insert into bm_seq values (6, 1764, 'v6');
+insert into bm_seq values (7, 1683, 'v7');
+insert into bm_seq values (8, 1602, 'v8');
+insert into bm_seq values (9, 1521, 'v9');
+insert into bm_seq values (0, 1440, 'v10');
+insert into bm_seq values (1, 1359, 'v11');
+insert into bm_seq values (2, 1278, 'v12');
+insert into bm_seq values (3, 1197, 'v13');
+insert into bm_seq values (4, 1116, 'v14');
+insert into bm_seq values (5, 1035, 'v15');
+insert into bm_seq values (6, 954, 'v16');
+insert into bm_seq values (7, 873, 'v17');
+insert into bm_seq values (8, 792, 'v18');
+insert into bm_seq values (9, 711, 'v19');
+insert into bm_seq values (0, 630, 'v20');
+insert into bm_seq values (1, 549, 'v21');
+insert into bm_seq values (2, 468, 'v22');
+insert into bm_seq values (3, 387, 'v23');
+insert into bm_seq values (4, 306, 'v24');
+insert into bm_seq values (5, 225, 'v25');
+insert into bm_seq values (6, 144, 'v26');
+insert into bm_seq values (7, 63, 'v27');
+insert into bm_seq values (8, 1982, 'v28');
+insert into bm_seq values (9, 1901, 'v29');
+insert into bm_seq values (0, 1820, 'v30');
+insert into bm_seq values (1, 1739, 'v31');
+insert into bm_seq values (2, 1658, 'v32');
+insert into bm_seq values (3, 1577, 'v33');
+insert into bm_seq values (4, 1496, 'v34');
+insert into bm_seq values (5, 1415, 'v35');
+insert into bm_seq values (6, 1334, 'v36');
+insert into bm_seq values (7, 1253, 'v37');
+insert into bm_seq values (8, 1172, 'v38');
+insert into bm_seq values (9, 1091, 'v39');
+insert into bm_seq values (0, 1010, 'v40');
+insert into bm_seq values (1, 929, 'v41');
+insert into bm_seq values (2, 848, 'v42');
+insert into bm_seq values (3, 767, 'v43');
+insert into bm_seq values (4, 686, 'v44');
+insert into bm_seq values (5, 605, 'v45');
+insert into bm_seq values (6, 524, 'v46');
+insert into bm_seq values (7, 443, 'v47');
+insert into bm_seq values (8, 362, 'v48');
+insert into bm_seq values (9, 281, 'v49');
+insert into bm_seq values (0, 200, 'v0');
+insert into bm_seq values (1, 119, 'v1');
+insert into bm_seq values (2, 38, 'v2');
+insert into bm_seq values (3, 1957, 'v3');
+insert into bm_seq values (4, 1876, 'v4');
+insert into bm_seq values (5, 1795, 'v5');
+insert into bm_seq values (6, 1714, 'v6');
+insert into bm_seq values (7, 1633, 'v7');
+insert into bm_seq values (8, 1552, 'v8');
+insert into bm_seq values (9, 1471, 'v9');
+insert into bm_seq values (0, 1390, 'v10');
+insert into bm_seq values (1, 1309, 'v11');
+insert into bm_seq values (2, 1228, 'v12');
+insert into bm_seq values (3, 1147, 'v13');
+insert into bm_seq values (4, 1066, 'v14');
+insert into bm_seq values (5, 985, 'v15');
+insert into bm_seq values (6, 904, 'v16');
+insert into bm_seq values (7, 823, 'v17');
+insert into bm_seq values (8, 742, 'v18');
+insert into bm_seq values (9, 661, 'v19');
+insert into bm_seq values (0, 580, 'v20');
+insert into bm_seq values (1, 499, 'v21');
+insert into bm_seq values (2, 418, 'v22');
+insert into bm_seq values (3, 337, 'v23');
+insert into bm_seq values (4, 256, 'v24');
+insert into bm_seq values (5, 175, 'v25');
+insert into bm_seq values (6, 94, 'v26');
+insert into bm_seq values (7, 13, 'v27');
+insert into bm_seq values (8, 1932, 'v28');
+insert into bm_seq values (9, 1851, 'v29');
+insert into bm_seq values (0, 1770, 'v30');
+insert into bm_seq values (1, 1689, 'v31');
+insert into bm_seq values (2, 1608, 'v32');
+insert into bm_seq values (3, 1527, 'v33');
+insert into bm_seq values (4, 1446, 'v34');
+insert into bm_seq values (5, 1365, 'v35');
+insert into bm_seq values (6, 1284, 'v36');
+insert into bm_seq values (7, 1203, 'v37');
+insert into bm_seq values (8, 1122, 'v38');
+insert into bm_seq values (9, 1041, 'v39');
+insert into bm_seq values (0, 960, 'v40');
+insert into bm_seq values (1, 879, 'v41');
+insert into bm_seq values (2, 798, 'v42');
+insert into bm_seq values (3, 717, 'v43');
+insert into bm_seq values (4, 636, 'v44');
+insert into bm_seq values (5, 555, 'v45');
+insert into bm_seq values (6, 474, 'v46');
+insert into bm_seq values (7, 393, 'v47');
+insert into bm_seq values (8, 312, 'v48');
+insert into bm_seq values (9, 231, 'v49');
+insert into bm_seq values (0, 150, 'v0');
+insert into bm_seq values (1, 69, 'v1');
+insert into bm_seq values (2, 1988, 'v2');
+insert into bm_seq values (3, 1907, 'v3');
+insert into bm_seq values (4, 1826, 'v4');
+insert into bm_seq values (5, 1745, 'v5');
+insert into bm_seq values (6, 1664, 'v6');
+insert into bm_seq values (7, 1583, 'v7');
+insert into bm_seq values (8, 1502, 'v8');
+insert into bm_seq values (9, 1421, 'v9');
+insert into bm_seq values (0, 1340, 'v10');
+insert into bm_seq values (1, 1259, 'v11');
+insert into bm_seq values (2, 1178, 'v12');
+insert into bm_seq values (3, 1097, 'v13');
+insert into bm_seq values (4, 1016, 'v14');
+insert into bm_seq values (5, 935, 'v15');
+insert into bm_seq values (6, 854, 'v16');
+insert into bm_seq values (7, 773, 'v17');
+insert into bm_seq values (8, 692, 'v18');
+insert into bm_seq values (9, 611, 'v19');
+insert into bm_seq values (0, 530, 'v20');
+insert into bm_seq values (1, 449, 'v21');
+insert into bm_seq values (2, 368, 'v22');
+insert into bm_seq values (3, 287, 'v23');
+insert into bm_seq values (4, 206, 'v24');
+insert into bm_seq values (5, 125, 'v25');
+insert into bm_seq values (6, 44, 'v26');
+insert into bm_seq values (7, 1963, 'v27');
+insert into bm_seq values (8, 1882, 'v28');
+insert into bm_seq values (9, 1801, 'v29');
+insert into bm_seq values (0, 1720, 'v30');
+insert into bm_seq values (1, 1639, 'v31');
+insert into bm_seq values (2, 1558, 'v32');
+insert into bm_seq values (3, 1477, 'v33');
+insert into bm_seq values (4, 1396, 'v34');
+insert into bm_seq values (5, 1315, 'v35');
+insert into bm_seq values (6, 1234, 'v36');
+insert into bm_seq values (7, 1153, 'v37');
+insert into bm_seq values (8, 1072, 'v38');
+insert into bm_seq values (9, 991, 'v39');
+insert into bm_seq values (0, 910, 'v40');
+insert into bm_seq values (1, 829, 'v41');
+insert into bm_seq values (2, 748, 'v42');
+insert into bm_seq values (3, 667, 'v43');
+insert into bm_seq values (4, 586, 'v44');
+insert into bm_seq values (5, 505, 'v45');
+insert into bm_seq values (6, 424, 'v46');
+insert into bm_seq values (7, 343, 'v47');
+insert into bm_seq values (8, 262, 'v48');
+insert into bm_seq values (9, 181, 'v49');
+insert into bm_seq values (0, 100, 'v0');
+insert into bm_seq values (1, 19, 'v1');
+insert into bm_seq values (2, 1938, 'v2');
+insert into bm_seq values (3, 1857, 'v3');
+insert into bm_seq values (4, 1776, 'v4');
+insert into bm_seq values (5, 1695, 'v5');
+insert into bm_seq values (6, 1614, 'v6');
+insert into bm_seq values (7, 1533, 'v7');
+insert into bm_seq values (8, 1452, 'v8');
+insert into bm_seq values (9, 1371, 'v9');
+insert into bm_seq values (0, 1290, 'v10');
+insert into bm_seq values (1, 1209, 'v11');
+insert into bm_seq values (2, 1128, 'v12');
+insert into bm_seq values (3, 1047, 'v13');
+insert into bm_seq values (4, 966, 'v14');
+insert into bm_seq values (5, 885, 'v15');
+insert into bm_seq values (6, 804, 'v16');
+insert into bm_seq values (7, 723, 'v17');
+insert into bm_seq values (8, 642, 'v18');
+insert into bm_seq values (9, 561, 'v19');
+insert into bm_seq values (0, 480, 'v20');
+insert into bm_seq values (1, 399, 'v21');
+insert into bm_seq values (2, 318, 'v22');
+insert into bm_seq values (3, 237, 'v23');
+insert into bm_seq values (4, 156, 'v24');
+insert into bm_seq values (5, 75, 'v25');
+insert into bm_seq values (6, 1994, 'v26');
+insert into bm_seq values (7, 1913, 'v27');
+insert into bm_seq values (8, 1832, 'v28');
+insert into bm_seq values (9, 1751, 'v29');
+insert into bm_seq values (0, 1670, 'v30');
+insert into bm_seq values (1, 1589, 'v31');
+insert into bm_seq values (2, 1508, 'v32');
+insert into bm_seq values (3, 1427, 'v33');
+insert into bm_seq values (4, 1346, 'v34');
+insert into bm_seq values (5, 1265, 'v35');
+insert into bm_seq values (6, 1184, 'v36');
+insert into bm_seq values (7, 1103, 'v37');
+insert into bm_seq values (8, 1022, 'v38');
+insert into bm_seq values (9, 941, 'v39');
+insert into bm_seq values (0, 860, 'v40');
+insert into bm_seq values (1, 779, 'v41');
+insert into bm_seq values (2, 698, 'v42');
+insert into bm_seq values (3, 617, 'v43');
+insert into bm_seq values (4, 536, 'v44');
+insert into bm_seq values (5, 455, 'v45');
+insert into bm_seq values (6, 374, 'v46');
+insert into bm_seq values (7, 293, 'v47');
+insert into bm_seq values (8, 212, 'v48');
+insert into bm_seq values (9, 131, 'v49');
+insert into bm_seq values (0, 50, 'v0');
+insert into bm_seq values (1, 1969, 'v1');
+insert into bm_seq values (2, 1888, 'v2');
+insert into bm_seq values (3, 1807, 'v3');
+insert into bm_seq values (4, 1726, 'v4');
+insert into bm_seq values (5, 1645, 'v5');
+insert into bm_seq values (6, 1564, 'v6');
+insert into bm_seq values (7, 1483, 'v7');
+insert into bm_seq values (8, 1402, 'v8');
+insert into bm_seq values (9, 1321, 'v9');
+insert into bm_seq values (0, 1240, 'v10');
+insert into bm_seq values (1, 1159, 'v11');
+insert into bm_seq values (2, 1078, 'v12');
+insert into bm_seq values (3, 997, 'v13');
+insert into bm_seq values (4, 916, 'v14');
+insert into bm_seq values (5, 835, 'v15');
+insert into bm_seq values (6, 754, 'v16');
+insert into bm_seq values (7, 673, 'v17');
+insert into bm_seq values (8, 592, 'v18');
+insert into bm_seq values (9, 511, 'v19');
+insert into bm_seq values (0, 430, 'v20');
+insert into bm_seq values (1, 349, 'v21');
+insert into bm_seq values (2, 268, 'v22');
+insert into bm_seq values (3, 187, 'v23');
+insert into bm_seq values (4, 106, 'v24');
+insert into bm_seq values (5, 25, 'v25');
+insert into bm_seq values (6, 1944, 'v26');
+insert into bm_seq values (7, 1863, 'v27');
+insert into bm_seq values (8, 1782, 'v28');
+insert into bm_seq values (9, 1701, 'v29');
+insert into bm_seq values (0, 1620, 'v30');
+insert into bm_seq values (1, 1539, 'v31');
+insert into bm_seq values (2, 1458, 'v32');
+insert into bm_seq values (3, 1377, 'v33');
+insert into bm_seq values (4, 1296, 'v34');
+insert into bm_seq values (5, 1215, 'v35');
+insert into bm_seq values (6, 1134, 'v36');
+insert into bm_seq values (7, 1053, 'v37');
+insert into bm_seq values (8, 972, 'v38');
+insert into bm_seq values (9, 891, 'v39');
+insert into bm_seq values (0, 810, 'v40');
+insert into bm_seq values (1, 729, 'v41');
+insert into bm_seq values (2, 648, 'v42');
+insert into bm_seq values (3, 567, 'v43');
+insert into bm_seq values (4, 486, 'v44');
+insert into bm_seq values (5, 405, 'v45');
+insert into bm_seq values (6, 324, 'v46');
+insert into bm_seq values (7, 243, 'v47');
+insert into bm_seq values (8, 162, 'v48');
+insert into bm_seq values (9, 81, 'v49');
+create nonunique index bm(a, b);
+select * from bm where a = 3 and b < 700;
+select * from bm_seq where a = 3 and b < 700;
+select * from bm where a = 3 and b >= 1900;
+select * from bm_seq where a = 3 and b >= 1900;
+select * from bm where a > 8 and c = 'v9';
+select * from bm_seq where a > 8 and c = 'v9';
+select c, b from bm where a = 2 and b < 500 and c = 'v42';
+select c, b from bm_seq where a = 2 and b < 500 and c = 'v42';
+select * from bm where a = 7 and b > 1995;
+select * from bm_seq where a = 7 and b > 1995;
+select * from bm where a >= 0 and a <= 1 and b < 120;
+select * from bm_seq where a >= 0 and a <= 1 and b < 120;
+select a, b from bm where b = 77;
+select a, b from bm_seq where b = 77;
+delete from bm where a = 4 and b > 100;
+update bm set c = 'u' where a = 1 and b < 300;
+insert into bm values (4, 2500, 'late');
+delete from bm_seq where a = 4 and b > 100;
+update bm_seq set c = 'u' where a = 1 and b < 300;
+insert into bm_seq values (4, 2500, 'late');
+select * from bm where a = 4;
+select * from bm_seq where a = 4;
+select * from bm where a = 1 and b < 400;
+select * from bm_seq where a = 1 and b < 400;
@@ -0,0 +1,86 @@
+-- Lab3-查询执行 测试点6：hash join（多列key、额外的连接条件、两侧重复key、空的build侧、关闭hash join）
+create table hj_l (id int, k1 int, k2 char(4), v float);
+create table hj_r (id int, k1 int, k2 char(4), w float);
+create table hj_e (id int, k1 int, k2 char(4), w float);
+insert into hj_l values (0, 0, 'aa', 0.0);
+insert into hj_l values (1, 1, 'aa', 0.5);
+insert into hj_l values (2, 2, 'aa', 1.0);
+insert into hj_l values (3, 3, 'aa', 1.5);
+insert into hj_l values (4, 4, 'aa', 2.0);
+insert into hj_l values (5, 5, 'aa', 2.5);
+insert into hj_l values (6, 0, 'bb', 3.0);
+insert into hj_l values (7, 1, 'bb', 3.5);
+insert into hj_l values (8, 2, 'bb', 4.0);
+insert into hj_l values (9, 3, 'bb', 0.0);
+insert into hj_l values (10, 4, 'bb', 0.5);
+insert into hj_l values (11, 5, 'bb', 1.0);
+insert into hj_l values (12, 0, 'aa', 1.5);
+insert into hj_l values (13, 1, 'aa', 2.0);
+insert into hj_l values (14, 2, 'aa', 2.5);
+insert into hj_l values (15, 3, 'aa', 3.0);
+insert into hj_l values (16, 4, 'aa', 3.5);
+insert into hj_l values (17, 5, 'aa', 4.0);
+insert into hj_l values (18, 0, 'bb', 0.0);
+insert into hj_l values (19, 1, 'bb', 0.5);
+insert into hj_l values (20, 2, 'bb', 1.0);
+insert into hj_l values (21, 3, 'bb', 1.5);
+insert into hj_l values (22, 4, 'bb', 2.0);
+insert into hj_l values (23, 5, 'bb', 2.5);
+insert into hj_l values (24, 0, 'aa', 3.0);
+insert into hj_l values (25, 1, 'aa', 3.5);
+insert into hj_l values (26, 2, 'aa', 4.0);
+insert into hj_l values (27, 3, 'aa', 0.0);
+insert into hj_l values (28, 4, 'aa', 0.5);
+insert into hj_l values (29, 5, 'aa', 1.0);
+insert into hj_l values (30, 0, 'bb', 1.5);
+insert into hj_l values (31, 1, 'bb', 2.0);
+insert into hj_l values (32, 2, 'bb', 2.5);
+insert into hj_l values (33, 3, 'bb', 3.0);
+insert into hj_l values (34, 4, 'bb', 3.5);
+insert into hj_l values (35, 5, 'bb', 4.0);
+insert into hj_l values (36, 0, 'aa', 0.0);
+insert into hj_l values (37, 1, 'aa', 0.5);
+insert into hj_l values (38, 2, 'aa', 1.0);
+insert into hj_l values (39, 3, 'aa', 1.5);
+insert into hj_r values (100, 0, 'aa', 0.00);
+insert into hj_r values (101, 1, 'bb', 0.75);
+insert into hj_r values (102, 2, 'aa', 1.50);
+insert into hj_r values (103, 3, 'bb', 2.25);
+insert into hj_r values (104, 4, 'aa', 3.00);
+insert into hj_r values (105, 0, 'bb', 3.75);
+insert into hj_r values (106, 1, 'aa', 4.50);
+insert into hj_r values (107, 2, 'bb', 0.00);
+insert into hj_r values (108, 3, 'aa', 0.75);
+insert into hj_r values (109, 4, 'bb', 1.50);
+insert into hj_r values (110, 0, 'aa', 2.25);
+insert into hj_r values (111, 1, 'bb', 3.00);
+insert into hj_r values (112, 2, 'aa', 3.75);
+insert into hj_r values (113, 3, 'bb', 4.50);
+insert into hj_r values (114, 4, 'aa', 0.00);
+insert into hj_r values (115, 0, 'bb', 0.75);
+insert into hj_r values (116, 1, 'aa', 1.50);
+insert into hj_r values (117, 2, 'bb', 2.25);
+insert into hj_r values (118, 3, 'aa', 3.00);
+insert into hj_r values (119, 4, 'bb', 3.75);
+insert into hj_r values (120, 0, 'aa', 4.50);
+insert into hj_r values (121, 1, 'bb', 0.00);
+insert into hj_r values (122, 2, 'aa', 0.75);
+insert into hj_r values (123, 3, 'bb', 1.50);
+insert into hj_r values (124, 4, 'aa', 2.25);
+insert into hj_r values (125, 0, 'bb', 3.00);
+insert into hj_r values (126, 1, 'aa', 3.75);
+insert into hj_r values (127, 2, 'bb', 4.50);
+insert into hj_r values (128, 3, 'aa', 0.00);
+insert into hj_r values (129, 4, 'bb', 0.75);
+select hj_l.id, hj_r.id, hj_l.k2 from hj_l, hj_r where hj_l.k1 = hj_r.k1 and hj_l.k2 = hj_r.k2;
+select hj_l.id, hj_r.id, hj_r.w from hj_l, hj_r where hj_l.k1 = hj_r.k1 and hj_l.v < hj_r.w;
+select hj_r.id, hj_l.id, hj_l.v from hj_l, hj_r where hj_r.k1 = hj_l.k1 and hj_l.id < 20;
+select * from hj_l, hj_e where hj_l.k1 = hj_e.k1;
+select * from hj_e, hj_l where hj_e.k1 = hj_l.k1;
+select hj_l.id, hj_r.id from hj_l, hj_r where hj_l.k1 = hj_r.k1 and hj_r.w > 100.0;
+select hj_l.id, hj_r.id from hj_r, hj_l where hj_l.k1 = hj_r.k1 and hj_l.k2 = 'cc';
+set enable_hashjoin = false;
+select hj_l.id, hj_r.id, hj_l.k2 from hj_l, hj_r where hj_l.k1 = hj_r.k1 and hj_l.k2 = hj_r.k2;
+select hj_l.id, hj_r.id, hj_r.w from hj_l, hj_r where hj_l.k1 = hj_r.k1 and hj_l.v < hj_r.w;
+select hj_r.id, hj_l.id, hj_l.v from hj_l, hj_r where hj_r.k1 = hj_l.k1 and hj_l.id < 20;
+set enable_hashjoin = true;
@@ -0,0 +1,160 @@
+-- Lab3-查询执行 测试点7：sort merge join（两侧重复key、字符串key、额外的连接条件、int与float的key、索引扫描有序时的merge join、三表连接）
+create table mj_a (id int, k int, s char(4), f float);
+create table mj_b (id int, k int, s char(4), f float);
+create table mj_c (id int, s char(4), g int);
+create table mj_x (id int, g int, k int);
+create table mj_y (id int, g int, k int);
+insert into mj_a values (0, 0, 'ab', 0.0);
+insert into mj_a values (1, 1, 'cd', 1.0);
+insert into mj_a values (2, 2, 'ef', 2.0);
+insert into mj_a values (3, 3, 'gh', 3.0);
+insert into mj_a values (4, 4, 'ab', 4.0);
+insert into mj_a values (5, 0, 'cd', 5.0);
+insert into mj_a values (6, 1, 'ef', 0.0);
+insert into mj_a values (7, 2, 'gh', 1.0);
+insert into mj_a values (8, 3, 'ab', 2.0);
+insert into mj_a values (9, 4, 'cd', 3.0);
+insert into mj_a values (10, 0, 'ef', 4.0);
+insert into mj_a values (11, 1, 'gh', 5.0);
+insert into mj_a values (12, 2, 'ab', 0.0);
+insert into mj_a values (13, 3, 'cd', 1.0);
+insert into mj_a values (14, 4, 'ef', 2.0);
+insert into mj_a values (15, 0, 'gh', 3.0);
+insert into mj_a values (16, 1, 'ab', 4.0);
+insert into mj_a values (17, 2, 'cd', 5.0);
+insert into mj_a values (18, 3, 'ef', 0.0);
+insert into mj_a values (19, 4, 'gh', 1.0);
+insert into mj_a values (20, 0, 'ab', 2.0);
+insert into mj_a values (21, 1, 'cd', 3.0);
+insert into mj_a values (22, 2, 'ef', 4.0);
+insert into mj_a values (23, 3, 'gh', 5.0);
+insert into mj_a values (24, 4, 'ab', 0.0);
+insert into mj_a values (25, 0, 'cd', 1.0);
+insert into mj_a values (26, 1, 'ef', 2.0);
+insert into mj_a values (27, 2, 'gh', 3.0);
+insert into mj_a values (28, 3, 'ab', 4.0);
+insert into mj_a values (29, 4, 'cd', 5.0);
+insert into mj_b values (100, -1, 'cd', 0.0);
+insert into mj_b values (101, 0, 'ef', 1.0);
+insert into mj_b values (102, 1, 'xy', 2.0);
+insert into mj_b values (103, 2, 'cd', 3.0);
+insert into mj_b values (104, 3, 'ef', 0.0);
+insert into mj_b values (105, 4, 'xy', 1.0);
+insert into mj_b values (106, 5, 'cd', 2.0);
+insert into mj_b values (107, -1, 'ef', 3.0);
+insert into mj_b values (108, 0, 'xy', 0.0);
+insert into mj_b values (109, 1, 'cd', 1.0);
+insert into mj_b values (110, 2, 'ef', 2.0);
+insert into mj_b values (111, 3, 'xy', 3.0);
+insert into mj_b values (112, 4, 'cd', 0.0);
+insert into mj_b values (113, 5, 'ef', 1.0);
+insert into mj_b values (114, -1, 'xy', 2.0);
+insert into mj_b values (115, 0, 'cd', 3.0);
+insert into mj_b values (116, 1, 'ef', 0.0);
+insert into mj_b values (117, 2, 'xy', 1.0);
+insert into mj_b values (118, 3, 'cd', 2.0);
+insert into mj_b values (119, 4, 'ef', 3.0);
+insert into mj_b values (120, 5, 'xy', 0.0);
+insert into mj_b values (121, -1, 'cd', 1.0);
+insert into mj_b values (122, 0, 'ef', 2.0);
+insert into mj_b values (123, 1, 'xy', 3.0);
+insert into mj_c values (200, 'ab', 0);
+insert into mj_c values (201, 'cd', 1);
+insert into mj_c values (202, 'ef', 2);
+insert into mj_c values (203, 'zz', 3);
+insert into mj_c values (204, 'ab', 4);
+insert into mj_c values (205, 'cd', 5);
+insert into mj_c values (206, 'ef', 6);
+insert into mj_c values (207, 'zz', 7);
+insert into mj_c values (208, 'ab', 8);
+insert into mj_c values (209, 'cd', 9);
+insert into mj_x values (300, 0, 0);
+insert into mj_x values (301, 1, 7);
+insert into mj_x values (302, 0, 5);
+insert into mj_x values (303, 1, 3);
+insert into mj_x values (304, 0, 1);
+insert into mj_x values (305, 1, 8);
+insert into mj_x values (306, 0, 6);
+insert into mj_x values (307, 1, 4);
+insert into mj_x values (308, 0, 2);
+insert into mj_x values (309, 1, 0);
+insert into mj_x values (310, 0, 7);
+insert into mj_x values (311, 1, 5);
+insert into mj_x values (312, 0, 3);
+insert into mj_x values (313, 1, 1);
+insert into mj_x values (314, 0, 8);
+insert into mj_x values (315, 1, 6);
+insert into mj_x values (316, 0, 4);
+insert into mj_x values (317, 1, 2);
+insert into mj_x values (318, 0, 0);
+insert into mj_x values (319, 1, 7);
+insert into mj_x values (320, 0, 5);
+insert into mj_x values (321, 1, 3);
+insert into mj_x values (322, 0, 1);
+insert into mj_x values (323, 1, 8);
+insert into mj_x values (324, 0, 6);
+insert into mj_x values (325, 1, 4);
+insert into mj_x values (326, 0, 2);
+insert into mj_x values (327, 1, 0);
+insert into mj_x values (328, 0, 7);
+insert into mj_x values (329, 1, 5);
+insert into mj_x values (330, 0, 3);
+insert into mj_x values (331, 1, 1);
+insert into mj_x values (332, 0, 8);
+insert into mj_x values (333, 1, 6);
+insert into mj_x values (334, 0, 4);
+insert into mj_x values (335, 1, 2);
+insert into mj_x values (336, 0, 0);
+insert into mj_x values (337, 1, 7);
+insert into mj_x values (338, 0, 5);
+insert into mj_x values (339, 1, 3);
+insert into mj_y values (310, 0, 0);
+insert into mj_y values (311, 1, 5);
+insert into mj_y values (312, 2, 10);
+insert into mj_y values (313, 0, 4);
+insert into mj_y values (314, 1, 9);
+insert into mj_y values (315, 2, 3);
+insert into mj_y values (316, 0, 8);
+insert into mj_y values (317, 1, 2);
+insert into mj_y values (318, 2, 7);
+insert into mj_y values (319, 0, 1);
+insert into mj_y values (320, 1, 6);
+insert into mj_y values (321, 2, 0);
+insert into mj_y values (322, 0, 5);
+insert into mj_y values (323, 1, 10);
+insert into mj_y values (324, 2, 4);
+insert into mj_y values (325, 0, 9);
+insert into mj_y values (326, 1, 3);
+insert into mj_y values (327, 2, 8);
+insert into mj_y values (328, 0, 2);
+insert into mj_y values (329, 1, 7);
+insert into mj_y values (330, 2, 1);
+insert into mj_y values (331, 0, 6);
+insert into mj_y values (332, 1, 0);
+insert into mj_y values (333, 2, 5);
+insert into mj_y values (334, 0, 10);
+insert into mj_y values (335, 1, 4);
+insert into mj_y values (336, 2, 9);
+insert into mj_y values (337, 0, 3);
+insert into mj_y values (338, 1, 8);
+insert into mj_y values (339, 2, 2);
+insert into mj_y values (340, 0, 7);
+insert into mj_y values (341, 1, 1);
+insert into mj_y values (342, 2, 6);
+insert into mj_y values (343, 0, 0);
+insert into mj_y values (344, 1, 5);
+insert into mj_y values (345, 2, 10);
+create nonunique index mj_x(g, k);
+create nonunique index mj_y(g, k);
+set enable_sortmerge = true;
+select mj_a.id, mj_b.id, mj_a.k from mj_a, mj_b where mj_a.k = mj_b.k;
+select mj_a.id, mj_b.id, mj_a.s from mj_a, mj_b where mj_b.s = mj_a.s;
+select mj_a.id, mj_b.id, mj_a.f, mj_b.f from mj_a, mj_b where mj_a.k = mj_b.k and mj_a.f > mj_b.f;
+select mj_a.id, mj_b.id, mj_a.k, mj_b.f from mj_a, mj_b where mj_a.k = mj_b.f;
+select mj_a.id, mj_b.id from mj_a, mj_b where mj_a.k = mj_b.k and mj_b.k > 100;
+select mj_a.id, mj_b.id, mj_c.id from mj_a, mj_b, mj_c where mj_a.k = mj_b.k and mj_b.s = mj_c.s;
+select mj_x.id, mj_y.id, mj_x.k from mj_x, mj_y where mj_x.k = mj_y.k and mj_x.g = 1 and mj_y.g = 0;
+set enable_sortmerge = false;
+select mj_x.id, mj_y.id, mj_x.k from mj_x, mj_y where mj_x.k = mj_y.k and mj_x.g = 1 and mj_y.g = 0;
+select mj_x.id, mj_y.id, mj_y.k from mj_x, mj_y where mj_y.k = mj_x.k and mj_x.g = 0 and mj_y.g = 2 and mj_x.id > mj_y.id;
+select mj_a.id, mj_b.id, mj_c.id from mj_a, mj_b, mj_c where mj_a.k = mj_b.k and mj_b.s = mj_c.s;
@@ -0,0 +1,168 @@
+-- Lab3-查询执行 测试点8：index nested loop join（单列key、常量与连接列组成的key、字符串key、额外的连接条件、交换左右两侧、三表连接、外表较大时不使用索引）
+create table ij_l (id int, x int, t char(6), y float);
+create table ij_r (a int, g int, s char(6), b float, rid int);
+create table ij_m (id int, a int, pad char(16));
+insert into ij_l values (0, 0, 'k0', 0.0);
+insert into ij_l values (1, 1, 'k1', 1.0);
+insert into ij_l values (2, 2, 'k2', 2.0);
+insert into ij_l values (3, 3, 'k3', 3.0);
+insert into ij_l values (4, 4, 'k4', 4.0);
+insert into ij_l values (5, 5, 'k5', 0.0);
+insert into ij_l values (6, 6, 'k6', 1.0);
+insert into ij_l values (7, 7, 'k7', 2.0);
+insert into ij_l values (8, 8, 'k0', 3.0);
+insert into ij_l values (9, 9, 'k1', 4.0);
+insert into ij_l values (10, 10, 'k2', 0.0);
+insert into ij_l values (11, 11, 'k3', 1.0);
+insert into ij_l values (12, 12, 'k4', 2.0);
+insert into ij_l values (13, 13, 'k5', 3.0);
+insert into ij_l values (14, 14, 'k6', 4.0);
+insert into ij_l values (15, 0, 'k7', 0.0);
+insert into ij_l values (16, 1, 'k0', 1.0);
+insert into ij_l values (17, 2, 'k1', 2.0);
+insert into ij_l values (18, 3, 'k2', 3.0);
+insert into ij_l values (19, 4, 'k3', 4.0);
+insert into ij_l values (20, 5, 'k4', 0.0);
+insert into ij_l values (21, 6, 'k5', 1.0);
+insert into ij_l values (22, 7, 'k6', 2.0);
+insert into ij_l values (23, 8, 'k7', 3.0);
+insert into ij_l values (24, 9, 'k0', 4.0);
+insert into ij_l values (25, 10, 'k1', 0.0);
+insert into ij_l values (26, 11, 'k2', 1.0);
+insert into ij_l values (27, 12, 'k3', 2.0);
+insert into ij_l values (28, 13, 'k4', 3.0);
+insert into ij_l values (29, 14, 'k5', 4.0);
+insert into ij_l values (30, 0, 'k6', 0.0);
+insert into ij_l values (31, 1, 'k7', 1.0);
+insert into ij_l values (32, 2, 'k0', 2.0);
+insert into ij_l values (33, 3, 'k1', 3.0);
+insert into ij_l values (34, 4, 'k2', 4.0);
+insert into ij_l values (35, 5, 'k3', 0.0);
+insert into ij_l values (36, 6, 'k4', 1.0);
+insert into ij_l values (37, 7, 'k5', 2.0);
+insert into ij_l values (38, 8, 'k6', 3.0);
+insert into ij_l values (39, 9, 'k7', 4.0);
+insert into ij_l values (40, 10, 'k0', 0.0);
+insert into ij_l values (41, 11, 'k1', 1.0);
+insert into ij_l values (42, 12, 'k2', 2.0);
+insert into ij_l values (43, 13, 'k3', 3.0);
+insert into ij_l values (44, 14, 'k4', 4.0);
+insert into ij_l values (45, 0, 'k5', 0.0);
+insert into ij_l values (46, 1, 'k6', 1.0);
+insert into ij_l values (47, 2, 'k7', 2.0);
+insert into ij_l values (48, 3, 'k0', 3.0);
+insert into ij_l values (49, 4, 'k1', 4.0);
+insert into ij_l values (50, 5, 'k2', 0.0);
+insert into ij_l values (51, 6, 'k3', 1.0);
+insert into ij_l values (52, 7, 'k4', 2.0);
+insert into ij_l values (53, 8, 'k5', 3.0);
+insert into ij_l values (54, 9, 'k6', 4.0);
+insert into ij_l values (55, 10, 'k7', 0.0);
+insert into ij_l values (56, 11, 'k0', 1.0);
+insert into ij_l values (57, 12, 'k1', 2.0);
+insert into ij_l values (58, 13, 'k2', 3.0);
+insert into ij_l values (59, 14, 'k3', 4.0);
+insert into ij_r values (0, 0, 'k0', 0.0, 500);
+insert into ij_r values (1, 1, 'k1', 1.0, 501);
+insert into ij_r values (2, 2, 'k2', 2.0, 502);
+insert into ij_r values (3, 0, 'k3', 3.0, 503);
+insert into ij_r values (4, 1, 'k4', 4.0, 504);
+insert into ij_r values (5, 2, 'k5', 5.0, 505);
+insert into ij_r values (6, 0, 'k6', 0.0, 506);
+insert into ij_r values (7, 1, 'k7', 1.0, 507);
+insert into ij_r values (8, 2, 'k8', 2.0, 508);
+insert into ij_r values (9, 0, 'k9', 3.0, 509);
+insert into ij_r values (10, 1, 'k0', 4.0, 510);
+insert into ij_r values (11, 2, 'k1', 5.0, 511);
+insert into ij_r values (12, 0, 'k2', 0.0, 512);
+insert into ij_r values (13, 1, 'k3', 1.0, 513);
+insert into ij_r values (14, 2, 'k4', 2.0, 514);
+insert into ij_r values (15, 0, 'k5', 3.0, 515);
+insert into ij_r values (16, 1, 'k6', 4.0, 516);
+insert into ij_r values (17, 2, 'k7', 5.0, 517);
+insert into ij_r values (18, 0, 'k8', 0.0, 518);
+insert into ij_r values (19, 1, 'k9', 1.0, 519);
+insert into ij_r values (0, 2, 'k0', 2.0, 520);
+insert into ij_r values (1, 0, 'k1', 3.0, 521);
+insert into ij_r values (2, 1, 'k2', 4.0, 522);
+insert into ij_r values (3, 2, 'k3', 5.0, 523);
+insert into ij_r values (4, 0, 'k4', 0.0, 524);
+insert into ij_r values (5, 1, 'k5', 1.0, 525);
+insert into ij_r values (6, 2, 'k6', 2.0, 526);
+insert into ij_r values (7, 0, 'k7', 3.0, 527);
+insert into ij_r values (8, 1, 'k8', 4.0, 528);
+insert into ij_r values (9, 2, 'k9', 5.0, 529);
+insert into ij_r values (10, 0, 'k0', 0.0, 530);
+insert into ij_r values (11, 1, 'k1', 1.0, 531);
+insert into ij_r values (12, 2, 'k2', 2.0, 532);
+insert into ij_r values (13, 0, 'k3', 3.0, 533);
+insert into ij_r values (14, 1, 'k4', 4.0, 534);
+insert into ij_r values (15, 2, 'k5', 5.0, 535);
+insert into ij_r values (16, 0, 'k6', 0.0, 536);
+insert into ij_r values (17, 1, 'k7', 1.0, 537);
+insert into ij_r values (18, 2, 'k8', 2.0, 538);
+insert into ij_r values (19, 0, 'k9', 3.0, 539);
+insert into ij_r values (0, 1, 'k0', 4.0, 540);
+insert into ij_r values (1, 2, 'k1', 5.0, 541);
+insert into ij_r values (2, 0, 'k2', 0.0, 542);
+insert into ij_r values (3, 1, 'k3', 1.0, 543);
+insert into ij_r values (4, 2, 'k4', 2.0, 544);
+insert into ij_r values (5, 0, 'k5', 3.0, 545);
+insert into ij_r values (6, 1, 'k6', 4.0, 546);
+insert into ij_r values (7, 2, 'k7', 5.0, 547);
+insert into ij_r values (8, 0, 'k8', 0.0, 548);
+insert into ij_r values (9, 1, 'k9', 1.0, 549);
+insert into ij_r values (10, 2, 'k0', 2.0, 550);
+insert into ij_r values (11, 0, 'k1', 3.0, 551);
+insert into ij_r values (12, 1, 'k2', 4.0, 552);
+insert into ij_r values (13, 2, 'k3', 5.0, 553);
+insert into ij_r values (14, 0, 'k4', 0.0, 554);
+insert into ij_r values (15, 1, 'k5', 1.0, 555);
+insert into ij_r values (16, 2, 'k6', 2.0, 556);
+insert into ij_r values (17, 0, 'k7', 3.0, 557);
+insert into ij_r values (18, 1, 'k8', 4.0, 558);
+insert into ij_r values (19, 2, 'k9', 5.0, 559);
+insert into ij_r values (0, 0, 'k0', 0.0, 560);
+insert into ij_r values (1, 1, 'k1', 1.0, 561);
+insert into ij_r values (2, 2, 'k2', 2.0, 562);
+insert into ij_r values (3, 0, 'k3', 3.0, 563);
+insert into ij_r values (4, 1, 'k4', 4.0, 564);
+insert into ij_r values (5, 2, 'k5', 5.0, 565);
+insert into ij_r values (6, 0, 'k6', 0.0, 566);
+insert into ij_r values (7, 1, 'k7', 1.0, 567);
+insert into ij_r values (8, 2, 'k8', 2.0, 568);
+insert into ij_r values (9, 0, 'k9', 3.0, 569);
+insert into ij_r values (10, 1, 'k0', 4.0, 570);
+insert into ij_r values (11, 2, 'k1', 5.0, 571);
+insert into ij_r values (12, 0, 'k2', 0.0, 572);
+insert into ij_r values (13, 1, 'k3', 1.0, 573);
+insert into ij_r values (14, 2, 'k4', 2.0, 574);
+insert into ij_r values (15, 0, 'k5', 3.0, 575);
+insert into ij_r values (16, 1, 'k6', 4.0, 576);
+insert into ij_r values (17, 2, 'k7', 5.0, 577);
+insert into ij_r values (18, 0, 'k8', 0.0, 578);
+insert into ij_r values (19, 1, 'k9', 1.0, 579);
+insert into ij_m values (0, 0, 'm0');
+insert into ij_m values (5, 1, 'm1');
+insert into ij_m values (10, 2, 'm2');
+insert into ij_m values (15, 3, 'm3');
+insert into ij_m values (20, 0, 'm4');
+insert into ij_m values (25, 1, 'm5');
+insert into ij_m values (30, 2, 'm6');
+insert into ij_m values (35, 3, 'm7');
+insert into ij_m values (40, 0, 'm8');
+insert into ij_m values (45, 1, 'm9');
+insert into ij_m values (50, 2, 'm10');
+insert into ij_m values (55, 3, 'm11');
+create nonunique index ij_r(a);
+create nonunique index ij_r(g, a);
+create nonunique index ij_r(s);
+select ij_l.id, ij_r.rid, ij_r.a from ij_l, ij_r where ij_l.x = ij_r.a and ij_l.t = 'k3';
+select ij_l.id, ij_r.rid, ij_r.g from ij_l, ij_r where ij_l.x = ij_r.a and ij_r.g = 1 and ij_l.t = 'k5';
+select ij_l.id, ij_r.rid from ij_l, ij_r where ij_l.x = ij_r.a and ij_r.g = 5 and ij_l.t = 'k5';
+select ij_l.id, ij_r.rid, ij_r.s from ij_l, ij_r where ij_l.t = ij_r.s and ij_l.x = 7;
+select ij_l.id, ij_r.rid, ij_l.y, ij_r.b from ij_l, ij_r where ij_l.x = ij_r.a and ij_l.y < ij_r.b and ij_l.t = 'k2';
+select ij_r.rid, ij_l.id from ij_r, ij_l where ij_r.a = ij_l.x and ij_l.t = 'k1';
+select ij_m.id, ij_l.id, ij_r.rid from ij_m, ij_l, ij_r where ij_m.id = ij_l.id and ij_l.x = ij_r.a and ij_m.a = 2 and ij_l.t = 'k2';
+select ij_l.id, ij_r.rid from ij_l, ij_r where ij_l.x = ij_r.a and ij_l.id > 10;
+select ij_l.id, ij_r.rid from ij_l, ij_r where ij_l.x = ij_r.a and ij_r.g = 2 and ij_l.id >= 30;
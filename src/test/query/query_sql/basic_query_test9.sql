@@ -0,0 +1,220 @@
+-- Lab3-查询执行 测试点9：index-only scan（索引包含所有需要的列时只扫描索引，以及不能只扫描索引的查询）
+create table cv (w int, i int, q int, d char(8));
+insert into cv values (0, 0, 0, 'd0');
+insert into cv values (1, 1, 37, 'd1');
+insert into cv values (2, 2, 74, 'd2');
+insert into cv values (3, 3, 11, 'd3');
+insert into cv values (0, 4, 48, 'd4');
+insert into cv values (1, 5, 85, 'd5');
+insert into cv values (2, 6, 22, 'd6');
+insert into cv values (3, 7, 59, 'd7');
+insert into cv values (0, 8, 96, 'd8');
+insert into cv values (1, 9, 33, 'd9');
+insert into cv values (2, 10, 70, 'd0');
+insert into cv values (3, 11, 7, 'd1');
+insert into cv values (0, 12, 44, 'd2');
+insert into cv values (1, 13, 81, 'd3');
+insert into cv values (2, 14, 18, 'd4');
+insert into cv values (3, 15, 55, 'd5');
+insert into cv values (0, 16, 92, 'd6');
+insert into cv values (1, 17, 29, 'd7');
+insert into cv values (2, 18, 66, 'd8');
+insert into cv values (3, 19, 3, 'd9');
+insert into cv values (0, 20, 40, 'd0');
+insert into cv values (1, 21, 77, 'd1');
+insert into cv values (2, 22, 14, 'd2');
+insert into cv values (3, 23, 51, 'd3');
+insert into cv values (0, 24, 88, 'd4');
+insert into cv values (1, 25, 25, 'd5');
+insert into cv values (2, 26, 62, 'd6');
+insert into cv values (3, 27, 99, 'd7');
+insert into cv values (0, 28, 36, 'd8');
+insert into cv values (1, 29, 73, 'd9');
+insert into cv values (2, 30, 10, 'd0');
+insert into cv values (3, 31, 47, 'd1');
+insert into cv values (0, 32, 84, 'd2');
+insert into cv values (1, 33, 21, 'd3');
+insert into cv values (2, 34, 58, 'd4');
+insert into cv values (3, 35, 95, 'd5');
+insert into cv values (0, 36, 32, 'd6');
+insert into cv values (1, 37, 69, 'd7');
+insert into cv values (2, 38, 6, 'd8');
+insert into cv values (3, 39, 43, 'd9');
+insert into cv values (0, 40, 80, 'd0');
+insert into cv values (1, 41, 17, 'd1');
+insert into cv values (2, 42, 54, 'd2');
+insert into cv values (3, 43, 91, 'd3');
+insert into cv values (0, 44, 28, 'd4');
+insert into cv values (1, 45, 65, 'd5');
+insert into cv values (2, 46, 2, 'd6');
+insert into cv values (3, 47, 39, 'd7');
+insert into cv values (0, 48, 76, 'd8');
+insert into cv values (1, 49, 13, 'd9');
+insert into cv values (2, 50, 50, 'd0');
+insert into cv values (3, 51, 87, 'd1');
+insert into cv values (0, 52, 24, 'd2');
+insert into cv values (1, 53, 61, 'd3');
+insert into cv values (2, 54, 98, 'd4');
+insert into cv values (3, 55, 35, 'd5');
+insert into cv values (0, 56, 72, 'd6');
+insert into cv values (1, 57, 9, 'd7');
+insert into cv values (2, 58, 46, 'd8');
+insert into cv values (3, 59, 83, 'd9');
+insert into cv values (0, 60, 20, 'd0');
+insert into cv values (1, 61, 57, 'd1');
+insert into cv values (2, 62, 94, 'd2');
+insert into cv values (3, 63, 31, 'd3');
+insert into cv values (0, 64, 68, 'd4');
+insert into cv values (1, 65, 5, 'd5');
+insert into cv values (2, 66, 42, 'd6');
+insert into cv values (3, 67, 79, 'd7');
+insert into cv values (0, 68, 16, 'd8');
+insert into cv values (1, 69, 53, 'd9');
+insert into cv values (2, 70, 90, 'd0');
+insert into cv values (3, 71, 27, 'd1');
+insert into cv values (0, 72, 64, 'd2');
+insert into cv values (1, 73, 1, 'd3');
+insert into cv values (2, 74, 38, 'd4');
+insert into cv values (3, 75, 75, 'd5');
+insert into cv values (0, 76, 12, 'd6');
+insert into cv values (1, 77, 49, 'd7');
+insert into cv values (2, 78, 86, 'd8');
+insert into cv values (3, 79, 23, 'd9');
+insert into cv values (0, 80, 60, 'd0');
+insert into cv values (1, 81, 97, 'd1');
+insert into cv values (2, 82, 34, 'd2');
+insert into cv values (3, 83, 71, 'd3');
+insert into cv values (0, 84, 8, 'd4');
+insert into cv values (1, 85, 45, 'd5');
+insert into cv values (2, 86, 82, 'd6');
+insert into cv values (3, 87, 19, 'd7');
+insert into cv values (0, 88, 56, 'd8');
+insert into cv values (1, 89, 93, 'd9');
+insert into cv values (2, 90, 30, 'd0');
+insert into cv values (3, 91, 67, 'd1');
+insert into cv values (0, 92, 4, 'd2');
+insert into cv values (1, 93, 41, 'd3');
+insert into cv values (2, 94, 78, 'd4');
+insert into cv values (3, 95, 15, 'd5');
+insert into cv values (0, 96, 52, 'd6');
+insert into cv values (1, 97, 89, 'd7');
+insert into cv values (2, 98, 26, 'd8');
+insert into cv values (3, 99, 63, 'd9');
+insert into cv values (0, 100, 0, 'd0');
+insert into cv values (1, 101, 37, 'd1');
+insert into cv values (2, 102, 74, 'd2');
+insert into cv values (3, 103, 11, 'd3');
+insert into cv values (0, 104, 48, 'd4');
+insert into cv values (1, 105, 85, 'd5');
+insert into cv values (2, 106, 22, 'd6');
+insert into cv values (3, 107, 59, 'd7');
+insert into cv values (0, 108, 96, 'd8');
+insert into cv values (1, 109, 33, 'd9');
+insert into cv values (2, 110, 70, 'd0');
+insert into cv values (3, 111, 7, 'd1');
+insert into cv values (0, 112, 44, 'd2');
+insert into cv values (1, 113, 81, 'd3');
+insert into cv values (2, 114, 18, 'd4');
+insert into cv values (3, 115, 55, 'd5');
+insert into cv values (0, 116, 92, 'd6');
+insert into cv values (1, 117, 29, 'd7');
+insert into cv values (2, 118, 66, 'd8');
+insert into cv values (3, 119, 3, 'd9');
+insert into cv values (0, 120, 40, 'd0');
+insert into cv values (1, 121, 77, 'd1');
+insert into cv values (2, 122, 14, 'd2');
+insert into cv values (3, 123, 51, 'd3');
+insert into cv values (0, 124, 88, 'd4');
+insert into cv values (1, 125, 25, 'd5');
+insert into cv values (2, 126, 62, 'd6');
+insert into cv values (3, 127, 99, 'd7');
+insert into cv values (0, 128, 36, 'd8');
+insert into cv values (1, 129, 73, 'd9');
+insert into cv values (2, 130, 10, 'd0');
+insert into cv values (3, 131, 47, 'd1');
+insert into cv values (0, 132, 84, 'd2');
+insert into cv values (1, 133, 21, 'd3');
+insert into cv values (2, 134, 58, 'd4');
+insert into cv values (3, 135, 95, 'd5');
+insert into cv values (0, 136, 32, 'd6');
+insert into cv values (1, 137, 69, 'd7');
+insert into cv values (2, 138, 6, 'd8');
+insert into cv values (3, 139, 43, 'd9');
+insert into cv values (0, 140, 80, 'd0');
+insert into cv values (1, 141, 17, 'd1');
+insert into cv values (2, 142, 54, 'd2');
+insert into cv values (3, 143, 91, 'd3');
+insert into cv values (0, 144, 28, 'd4');
+insert into cv values (1, 145, 65, 'd5');
+insert into cv values (2, 146, 2, 'd6');
+insert into cv values (3, 147, 39, 'd7');
+insert into cv values (0, 148, 76, 'd8');
+insert into cv values (1, 149, 13, 'd9');
+insert into cv values (2, 150, 50, 'd0');
+insert into cv values (3, 151, 87, 'd1');
+insert into cv values (0, 152, 24, 'd2');
+insert into cv values (1, 153, 61, 'd3');
+insert into cv values (2, 154, 98, 'd4');
+insert into cv values (3, 155, 35, 'd5');
+insert into cv values (0, 156, 72, 'd6');
+insert into cv values (1, 157, 9, 'd7');
+insert into cv values (2, 158, 46, 'd8');
+insert into cv values (3, 159, 83, 'd9');
+insert into cv values (0, 160, 20, 'd0');
+insert into cv values (1, 161, 57, 'd1');
+insert into cv values (2, 162, 94, 'd2');
+insert into cv values (3, 163, 31, 'd3');
+insert into cv values (0, 164, 68, 'd4');
+insert into cv values (1, 165, 5, 'd5');
+insert into cv values (2, 166, 42, 'd6');
+insert into cv values (3, 167, 79, 'd7');
+insert into cv values (0, 168, 16, 'd8');
+insert into cv values (1, 169, 53, 'd9');
+insert into cv values (2, 170, 90, 'd0');
+insert into cv values (3, 171, 27, 'd1');
+insert into cv values (0, 172, 64, 'd2');
+insert into cv values (1, 173, 1, 'd3');
+insert into cv values (2, 174, 38, 'd4');
+insert into cv values (3, 175, 75, 'd5');
+insert into cv values (0, 176, 12, 'd6');
+insert into cv values (1, 177, 49, 'd7');
+insert into cv values (2, 178, 86, 'd8');
+insert into cv values (3, 179, 23, 'd9');
+insert into cv values (0, 180, 60, 'd0');
+insert into cv values (1, 181, 97, 'd1');
+insert into cv values (2, 182, 34, 'd2');
+insert into cv values (3, 183, 71, 'd3');
+insert into cv values (0, 184, 8, 'd4');
+insert into cv values (1, 185, 45, 'd5');
+insert into cv values (2, 186, 82, 'd6');
+insert into cv values (3, 187, 19, 'd7');
+insert into cv values (0, 188, 56, 'd8');
+insert into cv values (1, 189, 93, 'd9');
+insert into cv values (2, 190, 30, 'd0');
+insert into cv values (3, 191, 67, 'd1');
+insert into cv values (0, 192, 4, 'd2');
+insert into cv values (1, 193, 41, 'd3');
+insert into cv values (2, 194, 78, 'd4');
+insert into cv values (3, 195, 15, 'd5');
+insert into cv values (0, 196, 52, 'd6');
+insert into cv values (1, 197, 89, 'd7');
+insert into cv values (2, 198, 26, 'd8');
+insert into cv values (3, 199, 63, 'd9');
+create index cv(w, i);
+create nonunique index cv(w, i, q);
+select q from cv where w = 1 and i = 5;
+select i, q from cv where w = 2;
+select i from cv where w = 1 and q > 55;
+select i, q from cv where w = 3 and i >= 100 and i < 140;
+select w, i from cv where w > 2 and i <= 31;
+select i from cv where w = 9;
+select * from cv where w = 1 and i = 5;
+select d, i from cv where w = 2 and i > 150;
+select q, d from cv where w = 0 and q < 20;
+update cv set q = 1000 where w = 1 and i < 20;
+select i, q from cv where w = 1 and q >= 1000;
+select i, q from cv where w = 1 and i < 30;
+delete from cv where w = 2 and i > 100;
+select i, q from cv where w = 2;
+insert into cv values (2, 1001, 7, 'new');
+select i, q from cv where w = 2 and i > 90;
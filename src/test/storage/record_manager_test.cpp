@@ -4,10 +4,13 @@
 #include "record/rm.h"
 #undef private  // for use private variables in "rm.h"
 
+#include <atomic>
 #include <cassert>
 #include <cstring>
 #include <ctime>
 #include <iostream>
+#include <random>
+#include <thread>
 #include <unordered_map>
 
 #include "gtest/gtest.h"
@@ -223,4 +226,505 @@ TEST(RecordManagerTest, MultipleFilesTest) {
         std::string filename = filenames[i];
         rm_manager->destroy_file(filename);
     }
-}
\ No newline at end of file
+}
+/**
+ * @brief 测试PAX布局下记录的增删改查，以及按列读取记录
+ */
+TEST(RecordManagerTest, PaxLayoutTest) {
+    srand((unsigned)time(nullptr));
+    char *result = new char[BUFFER_LENGTH];
+    int offset = 0;
+    Context *context = new Context(nullptr, nullptr, nullptr, result, &offset);
+
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    std::string filename = "pax.txt";
+    if (disk_manager->is_file(filename)) {
+        disk_manager->destroy_file(filename);
+    }
+    // 随机将记录划分为若干列
+    std::vector<int> col_lens;
+    int record_size = 0;
+    int num_cols = 1 + rand() % 10;
+    for (int i = 0; i < num_cols; i++) {
+        col_lens.push_back(1 + rand() % 32);
+        record_size += col_lens.back();
+    }
+    rm_manager->create_file(filename, record_size, RM_LAYOUT_PAX, col_lens);
+    auto file_handle = rm_manager->open_file(filename);
+    assert(file_handle->file_hdr_.layout == RM_LAYOUT_PAX);
+    assert(file_handle->file_hdr_.num_cols == num_cols);
+
+    std::unordered_map<Rid, std::string, rid_hash_t, rid_equal_t> mock;
+    char write_buf[PAGE_SIZE];
+    for (int round = 0; round < 2000; round++) {
+        double insert_prob = 1. - mock.size() / 500.;
+        double dice = rand() * 1. / RAND_MAX;
+        if (mock.empty() || dice < insert_prob) {
+            rand_buf(record_size, write_buf);
+            Rid rid = file_handle->insert_record(write_buf, context);
+            mock[rid] = std::string(write_buf, record_size);
+        } else {
+            auto it = mock.begin();
+            std::advance(it, rand() % mock.size());
+            auto rid = it->first;
+            if (rand() % 2 == 0) {
+                rand_buf(record_size, write_buf);
+                file_handle->update_record(rid, write_buf, context);
+                mock[rid] = std::string(write_buf, record_size);
+            } else {
+                file_handle->delete_record(rid, context);
+                mock.erase(rid);
+            }
+        }
+        if (round % 100 == 0) {
+            rm_manager->close_file(file_handle.get());
+            file_handle = rm_manager->open_file(filename);
+            check_equal(file_handle.get(), mock);
+        }
+    }
+    check_equal(file_handle.get(), mock);
+
+    // 按列读取：只拷贝指定的列，其余字节为0，并且与整条记录中对应的列一致
+    int col_offset = 0;
+    for (int i = 0; i < num_cols; i++) {
+        std::vector<RmField> fields = {{col_offset, col_lens[i]}};
+        for (auto &entry : mock) {
+            auto rec = file_handle->get_record(entry.first, fields, context);
+            assert(memcmp(rec->data + col_offset, entry.second.c_str() + col_offset, col_lens[i]) == 0);
+            for (int j = 0; j < record_size; j++) {
+                if (j < col_offset || j >= col_offset + col_lens[i]) assert(rec->data[j] == 0);
+            }
+            RmPageHandle page_handle = file_handle->fetch_page_handle(entry.first.page_no);
+            assert(memcmp(page_handle.get_field(entry.first.slot_no, fields[0]), entry.second.c_str() + col_offset,
+                          col_lens[i]) == 0);
+            buffer_pool_manager->unpin_page(page_handle.page->get_page_id(), false);
+        }
+        col_offset += col_lens[i];
+    }
+
+    rm_manager->close_file(file_handle.get());
+    rm_manager->destroy_file(filename);
+}
+
+/**
+ * @brief 字典编码的列：随机插入、更新、删除并重新打开文件后，记录内容不变，页面中只存放编码
+ */
+TEST(RecordManagerTest, DictEncodingTest) {
+    srand((unsigned)time(nullptr));
+    char *result = new char[BUFFER_LENGTH];
+    int offset = 0;
+    Context *context = new Context(nullptr, nullptr, nullptr, result, &offset);
+
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    // 记录格式：char c_credit[2] dict | int c_id | char c_state[16] dict | char c_data[20]
+    std::vector<int> col_lens = {2, 4, 16, 20};
+    std::vector<bool> col_dicts = {true, false, true, false};
+    const int record_size = 42;
+    const char *credits[] = {"GC", "BC"};
+    const char *states[] = {"beijing", "shanghai", "guangdong", "zhejiang", "sichuan"};
+
+    for (RmLayout layout : {RM_LAYOUT_NSM, RM_LAYOUT_PAX}) {
+        std::string filename = "dict.txt";
+        if (disk_manager->is_file(filename)) {
+            rm_manager->destroy_file(filename);
+        }
+        rm_manager->create_file(filename, record_size, layout, col_lens, col_dicts);
+        assert(disk_manager->is_file(filename));
+        auto file_handle = rm_manager->open_file(filename);
+        assert(file_handle->file_hdr_.record_size == record_size);
+        assert(file_handle->file_hdr_.slot_size == 2 + 4 + 2 + 20);
+
+        std::unordered_map<Rid, std::string, rid_hash_t, rid_equal_t> mock;
+        char write_buf[record_size];
+        auto rand_record = [&]() {
+            rand_buf(record_size, write_buf);
+            memset(write_buf, 0, 2);
+            memcpy(write_buf, credits[rand() % 2], 2);
+            memset(write_buf + 6, 0, 16);
+            const char *state = states[rand() % 5];
+            memcpy(write_buf + 6, state, strlen(state));
+        };
+        for (int round = 0; round < 2000; round++) {
+            double insert_prob = 1. - mock.size() / 500.;
+            double dice = rand() * 1. / RAND_MAX;
+            if (mock.empty() || dice < insert_prob) {
+                rand_record();
+                Rid rid = file_handle->insert_record(write_buf, context);
+                mock[rid] = std::string(write_buf, record_size);
+            } else {
+                auto it = mock.begin();
+                std::advance(it, rand() % mock.size());
+                auto rid = it->first;
+                if (rand() % 2 == 0) {
+                    rand_record();
+                    file_handle->update_record(rid, write_buf, context);
+                    mock[rid] = std::string(write_buf, record_size);
+                } else {
+                    file_handle->delete_record(rid, context);
+                    mock.erase(rid);
+                }
+            }
+            if (round % 100 == 0) {
+                // 重新打开文件时字典从字典文件中恢复
+                rm_manager->close_file(file_handle.get());
+                file_handle = rm_manager->open_file(filename);
+                check_equal(file_handle.get(), mock);
+            }
+        }
+        check_equal(file_handle.get(), mock);
+
+        // 页面中字典编码的列存放的是编码，与字典中原始值的编码一致
+        RmField state_field = {6, 16};
+        const RmDictionary *dict = file_handle->get_dictionary(state_field);
+        assert(dict != nullptr && dict->size() == 5);
+        assert(file_handle->get_dictionary({2, 4}) == nullptr);
+        RmField slot_field = file_handle->get_slot_field(state_field);
+        assert(slot_field.offset == 2 + 4 && slot_field.len == (int)sizeof(RmDictCode));
+        for (auto &entry : mock) {
+            RmPageHandle page_handle = file_handle->fetch_page_handle(entry.first.page_no);
+            RmDictCode code = RmDictionary::get_code(page_handle.get_field(entry.first.slot_no, slot_field));
+            assert(dict->find(entry.second.c_str() + 6) == code);
+            assert(memcmp(dict->decode(code), entry.second.c_str() + 6, 16) == 0);
+            buffer_pool_manager->unpin_page(page_handle.page->get_page_id(), false);
+
+            auto rec = file_handle->get_record(entry.first, {state_field}, context);
+            assert(memcmp(rec->data + 6, entry.second.c_str() + 6, 16) == 0);
+        }
+
+        rm_manager->close_file(file_handle.get());
+        rm_manager->destroy_file(filename);
+        assert(!disk_manager->is_file(RmFileHandle::get_dict_name(filename)));
+    }
+}
+
+/**
+ * @brief 多个线程各自扫描不同的morsel，合起来恰好覆盖全表扫描的每一条记录
+ */
+TEST(RecordManagerTest, MorselScanTest) {
+    srand((unsigned)time(nullptr));
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    std::string filename = "morsel.txt";
+    if (disk_manager->is_file(filename)) {
+        disk_manager->destroy_file(filename);
+    }
+    const int record_size = 100;
+    rm_manager->create_file(filename, record_size);
+    auto file_handle = rm_manager->open_file(filename);
+
+    std::unordered_map<Rid, std::string, rid_hash_t, rid_equal_t> mock;
+    char write_buf[record_size];
+    for (int i = 0; i < 20000; i++) {
+        rand_buf(record_size, write_buf);
+        Rid rid = file_handle->insert_record(write_buf, nullptr);
+        mock[rid] = std::string(write_buf, record_size);
+    }
+    // 随机删除一部分记录，使页面中出现空洞
+    for (int i = 0; i < 5000; i++) {
+        auto it = mock.begin();
+        std::advance(it, rand() % mock.size());
+        file_handle->delete_record(it->first, nullptr);
+        mock.erase(it);
+    }
+
+    for (int morsel_size : {1, 7, 64, 1 << 20}) {
+        auto morsels = file_handle->get_morsels(morsel_size);
+        int expected_page = RM_FIRST_RECORD_PAGE;
+        for (auto &morsel : morsels) {
+            assert(morsel.start_page == expected_page && morsel.end_page > morsel.start_page);
+            expected_page = morsel.end_page;
+        }
+        assert(expected_page == file_handle->file_hdr_.num_pages);
+
+        const int num_threads = 4;
+        std::vector<std::vector<std::pair<Rid, std::string>>> scanned(num_threads);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < num_threads; t++) {
+            threads.emplace_back([&, t] {
+                char buf[record_size];
+                for (size_t i = t; i < morsels.size(); i += num_threads) {
+                    for (RmScan scan(file_handle.get(), morsels[i], {}); !scan.is_end(); scan.next()) {
+                        assert(scan.rid().page_no >= morsels[i].start_page && scan.rid().page_no < morsels[i].end_page);
+                        file_handle->read_record(scan.page_handle(), scan.rid().slot_no, buf);
+                        scanned[t].emplace_back(scan.rid(), std::string(buf, record_size));
+                    }
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        size_t num_scanned = 0;
+        for (auto &records : scanned) {
+            for (auto &entry : records) {
+                assert(mock.count(entry.first) && mock[entry.first] == entry.second);
+            }
+            num_scanned += records.size();
+        }
+        assert(num_scanned == mock.size());
+    }
+
+    rm_manager->close_file(file_handle.get());
+    rm_manager->destroy_file(filename);
+}
+
+/**
+ * @brief 原地更新部分字段：只有值发生变化的字段会写入页面并出现在增量中，页面的pin计数保持平衡
+ */
+TEST(RecordManagerTest, UpdateFieldsTest) {
+    srand((unsigned)time(nullptr));
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    // 记录格式：int s_i_id | int s_quantity | char s_dist[24] | char s_data[8] dict
+    std::vector<int> col_lens = {4, 4, 24, 8};
+    const int record_size = 40;
+    for (RmLayout layout : {RM_LAYOUT_NSM, RM_LAYOUT_PAX}) {
+        std::string filename = "update_fields.txt";
+        if (disk_manager->is_file(filename)) {
+            rm_manager->destroy_file(filename);
+        }
+        rm_manager->create_file(filename, record_size, layout, col_lens, {false, false, false, true});
+        auto file_handle = rm_manager->open_file(filename);
+        file_handle->init_zone_map({{0, TYPE_INT}, {4, TYPE_INT}});
+        assert(file_handle->get_zone_map() != nullptr);
+
+        std::unordered_map<Rid, std::string, rid_hash_t, rid_equal_t> mock;
+        char buf[record_size];
+        for (int i = 0; i < 1000; i++) {
+            rand_buf(record_size, buf);
+            *(int *)(buf + 4) = rand() % 10;
+            memcpy(buf + 32, i % 2 ? "ORIGINAL" : "GENERIC ", 8);
+            Rid rid = file_handle->insert_record(buf, nullptr);
+            mock[rid] = std::string(buf, record_size);
+        }
+
+        std::vector<RmField> fields = {{4, 4}, {32, 8}};
+        for (int round = 0; round < 2000; round++) {
+            auto it = mock.begin();
+            std::advance(it, rand() % mock.size());
+            char set_buf[record_size];
+            rand_buf(record_size, set_buf);
+            *(int *)(set_buf + 4) = rand() % 10;
+            memcpy(set_buf + 32, rand() % 2 ? "ORIGINAL" : "GENERIC ", 8);
+
+            std::string &expected = it->second;
+            RmRecordDelta delta = file_handle->update_fields(it->first, fields, set_buf, nullptr);
+            size_t value_offset = 0;
+            size_t num_changed = 0;
+            for (auto &field : fields) {
+                if (memcmp(expected.data() + field.offset, set_buf + field.offset, field.len) == 0) continue;
+                assert(num_changed < delta.fields.size());
+                assert(delta.fields[num_changed].offset == field.offset);
+                assert(delta.old_values.compare(value_offset, field.len, expected.data() + field.offset, field.len) == 0);
+                assert(delta.new_values.compare(value_offset, field.len, set_buf + field.offset, field.len) == 0);
+                expected.replace(field.offset, field.len, set_buf + field.offset, field.len);
+                value_offset += field.len;
+                num_changed++;
+            }
+            assert(delta.fields.size() == num_changed);
+            assert(delta.old_values.size() == value_offset && delta.new_values.size() == value_offset);
+
+            // 更新之后页面不应该仍然被pin住
+            Page *page = buffer_pool_manager->fetch_page({file_handle->GetFd(), it->first.page_no});
+            assert(page->pin_count_ == 1);
+            buffer_pool_manager->unpin_page(page->get_page_id(), false);
+        }
+        check_equal(file_handle.get(), mock);
+
+        // zone map需要覆盖更新后的值
+        for (auto &entry : mock) {
+            int quantity = *(int *)(entry.second.data() + 4);
+            assert(file_handle->get_zone_map()->may_match(entry.first.page_no, {{1, OP_EQ, (double)quantity}}));
+        }
+
+        rm_manager->close_file(file_handle.get());
+        rm_manager->destroy_file(filename);
+    }
+}
+
+/**
+ * @brief 多个线程通过zone map扫描的同时，另一个线程插入记录并原地更新字段：
+ * zone map只建立一次，扫描不会跳过任何记录，结束后zone map覆盖所有记录的值
+ */
+TEST(RecordManagerTest, ZoneMapConcurrencyTest) {
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    // 记录格式：int a | int b | char c[8]
+    const int record_size = 16;
+    std::string filename = "zone_map.txt";
+    if (disk_manager->is_file(filename)) {
+        rm_manager->destroy_file(filename);
+    }
+    rm_manager->create_file(filename, record_size);
+    auto file_handle = rm_manager->open_file(filename);
+    file_handle->init_zone_map({{0, TYPE_INT}, {4, TYPE_INT}});
+
+    const int num_records = 5000;
+    std::vector<Rid> rids;
+    char buf[record_size] = {};
+    for (int i = 0; i < num_records; i++) {
+        *(int *)buf = i;
+        rids.push_back(file_handle->insert_record(buf, nullptr));
+    }
+
+    // zone map在扫描线程中第一次使用时建立，同时另一个线程在修改记录
+    const int num_scanners = 3;
+    std::atomic<bool> done = false;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_scanners; t++) {
+        threads.emplace_back([&] {
+            while (!done) {
+                size_t cnt = 0;
+                for (RmScan scan(file_handle.get(), {{1, OP_GE, 0.0}}); !scan.is_end(); scan.next()) {
+                    cnt++;
+                }
+                ASSERT_GE(cnt, (size_t)num_records);
+            }
+        });
+    }
+    std::thread writer([&] {
+        std::default_random_engine rng(7);
+        std::vector<RmField> fields = {{4, 4}};
+        char set_buf[record_size] = {};
+        for (int round = 0; round < 20000; round++) {
+            if (round % 10 == 0) {
+                // 插入的记录落在新的页面上时zone map需要扩大
+                *(int *)set_buf = num_records + round;
+                *(int *)(set_buf + 4) = 0;
+                rids.push_back(file_handle->insert_record(set_buf, nullptr));
+            } else {
+                *(int *)(set_buf + 4) = rng() % 1000;
+                file_handle->update_fields(rids[rng() % rids.size()], fields, set_buf, nullptr);
+            }
+        }
+        done = true;
+    });
+    writer.join();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    char *result = new char[BUFFER_LENGTH];
+    int offset = 0;
+    Context *context = new Context(nullptr, nullptr, nullptr, result, &offset);
+    const RmZoneMap *zone_map = file_handle->get_zone_map();
+    for (auto &rid : rids) {
+        auto rec = file_handle->get_record(rid, context);
+        double a = *(int *)rec->data, b = *(int *)(rec->data + 4);
+        assert(zone_map->may_match(rid.page_no, {{0, OP_EQ, a}, {1, OP_EQ, b}}));
+    }
+
+    rm_manager->close_file(file_handle.get());
+    rm_manager->destroy_file(filename);
+}
+
+/**
+ * @brief 打开旧版本格式的文件：文件头只有前5个字段，第1页是按旧格式写入的记录，
+ * 读出的记录不变，并且可以继续插入、更新、删除
+ */
+TEST(RecordManagerTest, BaselineHeaderTest) {
+    srand((unsigned)time(nullptr));
+    char *result = new char[BUFFER_LENGTH];
+    int offset = 0;
+    Context *context = new Context(nullptr, nullptr, nullptr, result, &offset);
+
+    auto disk_manager = std::make_unique<DiskManager>();
+    auto buffer_pool_manager = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager.get());
+    auto rm_manager = std::make_unique<RmManager>(disk_manager.get(), buffer_pool_manager.get());
+
+    std::string filename = "baseline.txt";
+    if (disk_manager->is_file(filename)) {
+        disk_manager->destroy_file(filename);
+    }
+
+    // 旧版本的文件头
+    struct {
+        int record_size;
+        int num_pages;
+        int num_records_per_page;
+        int first_free_page_no;
+        int bitmap_size;
+    } old_hdr;
+    const int record_size = 37;
+    old_hdr.record_size = record_size;
+    old_hdr.num_pages = 2;
+    old_hdr.num_records_per_page =
+        (BITMAP_WIDTH * (PAGE_SIZE - 1 - (int)sizeof(old_hdr)) + 1) / (1 + record_size * BITMAP_WIDTH);
+    old_hdr.first_free_page_no = 1;
+    old_hdr.bitmap_size = (old_hdr.num_records_per_page + BITMAP_WIDTH - 1) / BITMAP_WIDTH;
+
+    // 旧版本的数据页：page hdr、bitmap、按record_size排列的slot
+    std::unordered_map<Rid, std::string, rid_hash_t, rid_equal_t> mock;
+    char page[PAGE_SIZE] = {};
+    RmPageHdr page_hdr = {RM_NO_PAGE, 0};
+    char *bitmap = page + Page::OFFSET_PAGE_HDR + sizeof(RmPageHdr);
+    char *slots = bitmap + old_hdr.bitmap_size;
+    for (int slot_no = 0; slot_no < old_hdr.num_records_per_page; slot_no += 3) {
+        rand_buf(record_size, slots + slot_no * record_size);
+        Bitmap::set(bitmap, slot_no);
+        page_hdr.num_records++;
+        mock[Rid{1, slot_no}] = std::string(slots + slot_no * record_size, record_size);
+    }
+    memcpy(page + Page::OFFSET_PAGE_HDR, &page_hdr, sizeof(page_hdr));
+
+    disk_manager->create_file(filename);
+    int fd = disk_manager->open_file(filename);
+    disk_manager->write_page(fd, RM_FILE_HDR_PAGE, (char *)&old_hdr, sizeof(old_hdr));
+    disk_manager->write_page(fd, 1, page, PAGE_SIZE);
+    disk_manager->close_file(fd);
+
+    auto file_handle = rm_manager->open_file(filename);
+    assert(file_handle->file_hdr_.record_size == record_size);
+    assert(file_handle->file_hdr_.slot_size == record_size);
+    assert(file_handle->file_hdr_.layout == RM_LAYOUT_NSM);
+    assert(file_handle->file_hdr_.num_cols == 0);
+    assert(file_handle->file_hdr_.num_pages == 2);
+    check_equal(file_handle.get(), mock);
+
+    char write_buf[PAGE_SIZE];
+    for (int round = 0; round < 1000; round++) {
+        double insert_prob = 1. - mock.size() / 300.;
+        double dice = rand() * 1. / RAND_MAX;
+        if (mock.empty() || dice < insert_prob) {
+            rand_buf(record_size, write_buf);
+            Rid rid = file_handle->insert_record(write_buf, context);
+            mock[rid] = std::string(write_buf, record_size);
+        } else {
+            auto it = mock.begin();
+            std::advance(it, rand() % mock.size());
+            auto rid = it->first;
+            if (rand() % 2 == 0) {
+                rand_buf(record_size, write_buf);
+                file_handle->update_record(rid, write_buf, context);
+                mock[rid] = std::string(write_buf, record_size);
+            } else {
+                file_handle->delete_record(rid, context);
+                mock.erase(rid);
+            }
+        }
+        if (round % 100 == 0) {
+            rm_manager->close_file(file_handle.get());
+            file_handle = rm_manager->open_file(filename);
+            check_equal(file_handle.get(), mock);
+        }
+    }
+    rm_manager->close_file(file_handle.get());
+    file_handle = rm_manager->open_file(filename);
+    assert(file_handle->file_hdr_.slot_size == record_size);
+    check_equal(file_handle.get(), mock);
+
+    rm_manager->close_file(file_handle.get());
+    rm_manager->destroy_file(filename);
+}
@@ -0,0 +1,197 @@
+#undef NDEBUG
+
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <set>
+
+#include "gtest/gtest.h"
+#include "record/rm.h"
+
+struct RidLess {
+    bool operator()(const Rid &x, const Rid &y) const {
+        return x.page_no < y.page_no || (x.page_no == y.page_no && x.slot_no < y.slot_no);
+    }
+};
+
+class ZoneMapTest : public ::testing::Test {
+   public:
+    std::unique_ptr<DiskManager> disk_manager_;
+    std::unique_ptr<BufferPoolManager> buffer_pool_manager_;
+    std::unique_ptr<RmManager> rm_manager_;
+
+    void SetUp() override {
+        disk_manager_ = std::make_unique<DiskManager>();
+        buffer_pool_manager_ = std::make_unique<BufferPoolManager>(BUFFER_POOL_SIZE, disk_manager_.get());
+        rm_manager_ = std::make_unique<RmManager>(disk_manager_.get(), buffer_pool_manager_.get());
+    }
+
+    void create_file(const std::string &filename, int record_size) {
+        if (disk_manager_->is_file(filename)) {
+            disk_manager_->destroy_file(filename);
+        }
+        rm_manager_->create_file(filename, record_size);
+    }
+
+    static bool eval(double lhs, CompOp op, double rhs) {
+        switch (op) {
+            case OP_EQ: return lhs == rhs;
+            case OP_NE: return lhs != rhs;
+            case OP_LT: return lhs < rhs;
+            case OP_GT: return lhs > rhs;
+            case OP_LE: return lhs <= rhs;
+            case OP_GE: return lhs >= rhs;
+        }
+        return false;
+    }
+};
+
+/**
+ * @brief 随机插入、更新、删除记录后，带zone map谓词的扫描不能漏掉任何满足条件的记录
+ */
+TEST_F(ZoneMapTest, PruneCorrectnessTest) {
+    srand((unsigned)time(nullptr));
+    // 记录格式：int a | float b | char c[8]
+    const int record_size = 16;
+    std::string filename = "zone_map_test.txt";
+    create_file(filename, record_size);
+    auto fh = rm_manager_->open_file(filename);
+    fh->init_zone_map({{0, TYPE_INT}, {4, TYPE_FLOAT}});
+
+    std::vector<Rid> rids;
+    char buf[record_size];
+    auto rand_record = [&](int base) {
+        memset(buf, 0, record_size);
+        int a = base + rand() % 100;
+        float b = (rand() % 10000) / 10.0f;
+        memcpy(buf, &a, sizeof(int));
+        memcpy(buf + 4, &b, sizeof(float));
+    };
+    // 先插入一部分记录，再建立zone map，之后的修改需要增量维护
+    for (int i = 0; i < 5000; i++) {
+        rand_record(i / 50);
+        rids.push_back(fh->insert_record(buf, nullptr));
+    }
+    ASSERT_NE(fh->get_zone_map(), nullptr);
+    for (int i = 0; i < 5000; i++) {
+        int op = rand() % 3;
+        if (op == 0) {
+            rand_record(rand() % 200);
+            rids.push_back(fh->insert_record(buf, nullptr));
+        } else if (op == 1 && !rids.empty()) {
+            rand_record(rand() % 200);
+            fh->update_record(rids[rand() % rids.size()], buf, nullptr);
+        } else if (!rids.empty()) {
+            int idx = rand() % rids.size();
+            fh->delete_record(rids[idx], nullptr);
+            rids.erase(rids.begin() + idx);
+        }
+    }
+
+    const CompOp ops[] = {OP_EQ, OP_NE, OP_LT, OP_GT, OP_LE, OP_GE};
+    for (int round = 0; round < 50; round++) {
+        std::vector<RmZonePred> preds = {{0, ops[rand() % 6], (double)(rand() % 300)}};
+        if (rand() % 2) preds.push_back({1, ops[rand() % 6], (rand() % 10000) / 10.0});
+
+        std::set<Rid, RidLess> expected;
+        for (RmScan scan(fh.get()); !scan.is_end(); scan.next()) {
+            auto rec = fh->get_record(scan.rid(), nullptr);
+            bool match = true;
+            for (auto &pred : preds) {
+                double val = pred.col_idx == 0 ? *(int *)rec->data : *(float *)(rec->data + 4);
+                match = match && eval(val, pred.op, pred.val);
+            }
+            if (match) expected.insert(scan.rid());
+        }
+        std::set<Rid, RidLess> scanned;
+        for (RmScan scan(fh.get(), preds); !scan.is_end(); scan.next()) {
+            scanned.insert(scan.rid());
+        }
+        for (auto &rid : expected) {
+            ASSERT_TRUE(scanned.count(rid)) << "page " << rid.page_no << " was skipped by mistake";
+        }
+    }
+    rm_manager_->close_file(fh.get());
+    rm_manager_->destroy_file(filename);
+}
+
+/**
+ * @brief 按仓库顺序装载的order_line表上，比较 ol_w_id = 3 的全表扫描和zone map剪枝扫描
+ */
+TEST_F(ZoneMapTest, ClusteredOrderLineBenchmark) {
+    // ol_o_id, ol_d_id, ol_w_id, ol_number, ol_i_id, ol_supply_w_id, ol_delivery_d char(19),
+    // ol_quantity, ol_amount float, ol_dist_info char(24)
+    const int ol_w_id_offset = 8;
+    const int record_size = 6 * 4 + 19 + 4 + 4 + 24;
+    const int num_warehouses = 10, num_districts = 10, num_orders = 300, num_lines = 10;
+    std::string filename = "order_line_bench.txt";
+    create_file(filename, record_size);
+    auto fh = rm_manager_->open_file(filename);
+    std::vector<RmZoneCol> zone_cols;
+    for (int i = 0; i < 6; i++) zone_cols.push_back({i * 4, TYPE_INT});
+    zone_cols.push_back({6 * 4 + 19, TYPE_INT});
+    zone_cols.push_back({6 * 4 + 19 + 4, TYPE_FLOAT});
+    fh->init_zone_map(zone_cols);
+
+    char buf[record_size];
+    memset(buf, 'x', record_size);
+    for (int w = 1; w <= num_warehouses; w++) {
+        for (int d = 1; d <= num_districts; d++) {
+            for (int o = 1; o <= num_orders; o++) {
+                for (int n = 1; n <= num_lines; n++) {
+                    int ints[6] = {o, d, w, n, rand() % 100000 + 1, w};
+                    memcpy(buf, ints, sizeof(ints));
+                    fh->insert_record(buf, nullptr);
+                }
+            }
+        }
+    }
+    int num_pages = fh->get_file_hdr().num_pages;
+    int target_w = 3;
+
+    auto count_matches = [&](RmScan &scan, int &pages) {
+        int cnt = 0;
+        int last_page = RM_NO_PAGE;
+        for (; !scan.is_end(); scan.next()) {
+            if (scan.rid().page_no != last_page) {
+                last_page = scan.rid().page_no;
+                pages++;
+            }
+            RmPageHandle page_handle = scan.page_handle();
+            int w_id = *(int *)page_handle.get_field(scan.rid().slot_no, {ol_w_id_offset, 4});
+            if (w_id == target_w) cnt++;
+        }
+        return cnt;
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    int full_pages = 0;
+    RmScan full_scan(fh.get());
+    int full_cnt = count_matches(full_scan, full_pages);
+    auto full_time = std::chrono::steady_clock::now() - start;
+
+    // 第一次使用zone map时需要建立，单独计时
+    start = std::chrono::steady_clock::now();
+    ASSERT_NE(fh->get_zone_map(), nullptr);
+    auto build_time = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    int pruned_pages = 0;
+    RmScan pruned_scan(fh.get(), {{2, OP_EQ, (double)target_w}});
+    int pruned_cnt = count_matches(pruned_scan, pruned_pages);
+    auto pruned_time = std::chrono::steady_clock::now() - start;
+
+    ASSERT_EQ(full_cnt, num_districts * num_orders * num_lines);
+    ASSERT_EQ(pruned_cnt, full_cnt);
+    ASSERT_LT(pruned_pages, full_pages / 5);
+
+    auto us = [](auto d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+    std::cout << "order_line: " << num_pages << " pages, " << full_cnt << " rows with ol_w_id = " << target_w << "\n"
+              << "full scan:   " << full_pages << " pages, " << us(full_time) << " us\n"
+              << "zone map:    " << pruned_pages << " pages, " << us(pruned_time) << " us"
+              << " (build " << us(build_time) << " us)\n";
+
+    rm_manager_->close_file(fh.get());
+    rm_manager_->destroy_file(filename);
+}
@@ -0,0 +1,92 @@
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "system/sm_meta.h"
+
+/**
+ * @brief 旧版本的db.meta中索引没有类型和是否唯一，读出的索引为唯一的B+树索引，之后的索引和表仍然能正确读出
+ */
+TEST(SmMetaTest, OldFormatTest) {
+    std::istringstream is(
+        "db\n"
+        "2\n"
+        "t\n"
+        "2\n"
+        "t a 0 4 0 1\n"
+        "t b 2 8 4 1\n"
+        "2\n"
+        "t 4 1\n"
+        "t a 0 4 0 1\n"
+        "t 12 2\n"
+        "t a 0 4 0 1\n"
+        "t b 2 8 4 1\n"
+        "\n"
+        "u\n"
+        "1\n"
+        "u c 1 4 0 0\n"
+        "0\n"
+        "\n");
+    DbMeta db;
+    is >> db;
+
+    auto &t = db.get_table("t");
+    ASSERT_EQ(t.indexes.size(), 2);
+    EXPECT_EQ(t.indexes[0].type, INDEX_BTREE);
+    EXPECT_TRUE(t.indexes[0].unique);
+    ASSERT_EQ(t.indexes[0].cols.size(), 1);
+    EXPECT_EQ(t.indexes[0].cols[0].name, "a");
+    EXPECT_EQ(t.indexes[1].type, INDEX_BTREE);
+    EXPECT_TRUE(t.indexes[1].unique);
+    EXPECT_EQ(t.indexes[1].col_tot_len, 12);
+    ASSERT_EQ(t.indexes[1].cols.size(), 2);
+    EXPECT_EQ(t.indexes[1].cols[1].name, "b");
+    EXPECT_EQ(t.indexes[1].cols[1].type, TYPE_STRING);
+
+    auto &u = db.get_table("u");
+    ASSERT_EQ(u.cols.size(), 1);
+    EXPECT_EQ(u.cols[0].type, TYPE_FLOAT);
+    EXPECT_TRUE(u.indexes.empty());
+}
+
+/**
+ * @brief 只有索引类型、没有是否唯一的db.meta，读出的索引是唯一索引
+ */
+TEST(SmMetaTest, TypeOnlyFormatTest) {
+    std::istringstream is(
+        "t 4 1 1\n"
+        "t a 0 4 0 1\n"
+        "t 4 1 0\n"
+        "t b 0 4 4 1\n");
+    IndexMeta hash, btree;
+    is >> hash >> btree;
+    EXPECT_EQ(hash.type, INDEX_HASH);
+    EXPECT_TRUE(hash.unique);
+    EXPECT_EQ(btree.type, INDEX_BTREE);
+    EXPECT_TRUE(btree.unique);
+    ASSERT_EQ(btree.cols.size(), 1);
+    EXPECT_EQ(btree.cols[0].name, "b");
+}
+
+/**
+ * @brief 当前格式写出的索引元数据读回后不变
+ */
+TEST(SmMetaTest, RoundTripTest) {
+    IndexMeta index = {.tab_name = "t", .col_tot_len = 4, .col_num = 1, .type = INDEX_HASH, .unique = true};
+    index.cols.push_back({.tab_name = "t", .name = "a", .type = TYPE_INT, .len = 4, .offset = 0, .index = true});
+    IndexMeta non_unique = index;
+    non_unique.type = INDEX_BTREE;
+    non_unique.unique = false;
+    std::stringstream ss;
+    ss << index << "\n" << non_unique << "\n";
+
+    IndexMeta read, read_non_unique;
+    ss >> read >> read_non_unique;
+    EXPECT_EQ(read.tab_name, "t");
+    EXPECT_EQ(read.type, INDEX_HASH);
+    EXPECT_TRUE(read.unique);
+    ASSERT_EQ(read.cols.size(), 1);
+    EXPECT_EQ(read.cols[0].name, "a");
+    EXPECT_EQ(read_non_unique.type, INDEX_BTREE);
+    EXPECT_FALSE(read_non_unique.unique);
+    ASSERT_EQ(read_non_unique.cols.size(), 1);
+}